@@ -0,0 +1,19 @@
+>> x >> y;
+s = x;
+s = s*0.999 + x/(y+1.5) - y*1.25;
+s = s*0.999 + x/(y+2.5) - y*2.25;
+s = s*0.999 + x/(y+3.5) - y*3.25;
+s = s*0.999 + x/(y+4.5) - y*4.25;
+s = s*0.999 + x/(y+5.5) - y*5.25;
+s = s*0.999 + x/(y+6.5) - y*6.25;
+s = s*0.999 + x/(y+7.5) - y*0.25;
+s = s*0.999 + x/(y+8.5) - y*1.25;
+s = s*0.999 + x/(y+9.5) - y*2.25;
+s = s*0.999 + x/(y+10.5) - y*3.25;
+s = s*0.999 + x/(y+11.5) - y*4.25;
+s = s*0.999 + x/(y+12.5) - y*5.25;
+s = s*0.999 + x/(y+13.5) - y*6.25;
+s = s*0.999 + x/(y+14.5) - y*0.25;
+s = s*0.999 + x/(y+15.5) - y*1.25;
+s = s*0.999 + x/(y+16.5) - y*2.25;
+<< s << "\n";
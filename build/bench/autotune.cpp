@@ -0,0 +1,116 @@
+#include "el_input.h"
+#include "el_output.h"
+#define EL_LANES 4
+#include "el_batch.h"
+#include "el_math.h"
+
+int main()
+{
+	for ( long el_record = 0; ; ) {
+		el_lanes el_input0;
+		el_lanes a;
+		el_lanes el_input1;
+		el_lanes b;
+		el_lanes t0;
+		el_lanes t1;
+		el_lanes t2;
+		el_lanes t3;
+		el_lanes t4;
+		el_lanes t5;
+		el_lanes t6;
+		el_lanes t7;
+		el_lanes t8;
+		el_lanes t9;
+		el_lanes t10;
+		el_lanes t11;
+		el_lanes t12;
+		el_lanes t13;
+		el_lanes t14;
+		el_lanes t15;
+		el_lanes t16;
+		el_lanes t17;
+		el_lanes t18;
+		el_lanes t19;
+		el_lanes t20;
+		el_lanes t21;
+		el_lanes t22;
+		el_lanes t23;
+		el_lanes t24;
+		el_lanes t25;
+		el_lanes t26;
+		el_lanes t27;
+		el_lanes t28;
+		el_lanes t29;
+		el_lanes t30;
+		el_lanes t31;
+		el_lanes t32;
+		el_lanes t33;
+		el_lanes t34;
+		el_lanes t35;
+		el_lanes t36;
+		el_lanes t37;
+		el_lanes t38;
+		el_lanes t39;
+		el_lanes t40;
+		double el_value;
+		int el_count = 0;
+		for ( ; el_count < EL_LANES && el_more(); el_count++ ) {
+			el_value = el_input0[el_count];
+			el_read(el_value);
+			el_input0[el_count] = el_value;
+			el_value = el_input1[el_count];
+			el_read(el_value);
+			el_input1[el_count] = el_value;
+		}
+		if ( !el_count ) {
+			break;
+		}
+		a = el_input0;
+		b = el_input1;
+		t0 = a;
+		t1 = ((((t0*b)+1)/((b*b)+1))+el_pow_fast(a,1.5));
+		t2 = ((((t1*b)+2)/((b*b)+1))+el_pow_fast(a,1.5));
+		t3 = ((((t2*b)+3)/((b*b)+1))+el_pow_fast(a,1.5));
+		t4 = ((((t3*b)+4)/((b*b)+1))+el_pow_fast(a,1.5));
+		t5 = ((((t4*b)+5)/((b*b)+1))+el_pow_fast(a,1.5));
+		t6 = ((((t5*b)+6)/((b*b)+1))+el_pow_fast(a,1.5));
+		t7 = ((((t6*b)+7)/((b*b)+1))+el_pow_fast(a,1.5));
+		t8 = ((((t7*b)+8)/((b*b)+1))+el_pow_fast(a,1.5));
+		t9 = ((((t8*b)+9)/((b*b)+1))+el_pow_fast(a,1.5));
+		t10 = (((t9*b)/((b*b)+1))+el_pow_fast(a,1.5));
+		t11 = ((((t10*b)+1)/((b*b)+1))+el_pow_fast(a,1.5));
+		t12 = ((((t11*b)+2)/((b*b)+1))+el_pow_fast(a,1.5));
+		t13 = ((((t12*b)+3)/((b*b)+1))+el_pow_fast(a,1.5));
+		t14 = ((((t13*b)+4)/((b*b)+1))+el_pow_fast(a,1.5));
+		t15 = ((((t14*b)+5)/((b*b)+1))+el_pow_fast(a,1.5));
+		t16 = ((((t15*b)+6)/((b*b)+1))+el_pow_fast(a,1.5));
+		t17 = ((((t16*b)+7)/((b*b)+1))+el_pow_fast(a,1.5));
+		t18 = ((((t17*b)+8)/((b*b)+1))+el_pow_fast(a,1.5));
+		t19 = ((((t18*b)+9)/((b*b)+1))+el_pow_fast(a,1.5));
+		t20 = (((t19*b)/((b*b)+1))+el_pow_fast(a,1.5));
+		t21 = ((((t20*b)+1)/((b*b)+1))+el_pow_fast(a,1.5));
+		t22 = ((((t21*b)+2)/((b*b)+1))+el_pow_fast(a,1.5));
+		t23 = ((((t22*b)+3)/((b*b)+1))+el_pow_fast(a,1.5));
+		t24 = ((((t23*b)+4)/((b*b)+1))+el_pow_fast(a,1.5));
+		t25 = ((((t24*b)+5)/((b*b)+1))+el_pow_fast(a,1.5));
+		t26 = ((((t25*b)+6)/((b*b)+1))+el_pow_fast(a,1.5));
+		t27 = ((((t26*b)+7)/((b*b)+1))+el_pow_fast(a,1.5));
+		t28 = ((((t27*b)+8)/((b*b)+1))+el_pow_fast(a,1.5));
+		t29 = ((((t28*b)+9)/((b*b)+1))+el_pow_fast(a,1.5));
+		t30 = (((t29*b)/((b*b)+1))+el_pow_fast(a,1.5));
+		t31 = ((((t30*b)+1)/((b*b)+1))+el_pow_fast(a,1.5));
+		t32 = ((((t31*b)+2)/((b*b)+1))+el_pow_fast(a,1.5));
+		t33 = ((((t32*b)+3)/((b*b)+1))+el_pow_fast(a,1.5));
+		t34 = ((((t33*b)+4)/((b*b)+1))+el_pow_fast(a,1.5));
+		t35 = ((((t34*b)+5)/((b*b)+1))+el_pow_fast(a,1.5));
+		t36 = ((((t35*b)+6)/((b*b)+1))+el_pow_fast(a,1.5));
+		t37 = ((((t36*b)+7)/((b*b)+1))+el_pow_fast(a,1.5));
+		t38 = ((((t37*b)+8)/((b*b)+1))+el_pow_fast(a,1.5));
+		t39 = ((((t38*b)+9)/((b*b)+1))+el_pow_fast(a,1.5));
+		t40 = (((t39*b)/((b*b)+1))+el_pow_fast(a,1.5));
+		for ( int el_lane = 0; el_lane < el_count; el_lane++, el_record++ ) {
+			el_print(t40[el_lane]);
+			el_write("\n");
+		}
+	}
+}
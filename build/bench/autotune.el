@@ -0,0 +1,43 @@
+>> a >> b;
+t0 = a;
+t1 = (t0 * b + 1) / (b^2 + 1) + a^1.5;
+t2 = (t1 * b + 2) / (b^2 + 1) + a^1.5;
+t3 = (t2 * b + 3) / (b^2 + 1) + a^1.5;
+t4 = (t3 * b + 4) / (b^2 + 1) + a^1.5;
+t5 = (t4 * b + 5) / (b^2 + 1) + a^1.5;
+t6 = (t5 * b + 6) / (b^2 + 1) + a^1.5;
+t7 = (t6 * b + 7) / (b^2 + 1) + a^1.5;
+t8 = (t7 * b + 8) / (b^2 + 1) + a^1.5;
+t9 = (t8 * b + 9) / (b^2 + 1) + a^1.5;
+t10 = (t9 * b + 0) / (b^2 + 1) + a^1.5;
+t11 = (t10 * b + 1) / (b^2 + 1) + a^1.5;
+t12 = (t11 * b + 2) / (b^2 + 1) + a^1.5;
+t13 = (t12 * b + 3) / (b^2 + 1) + a^1.5;
+t14 = (t13 * b + 4) / (b^2 + 1) + a^1.5;
+t15 = (t14 * b + 5) / (b^2 + 1) + a^1.5;
+t16 = (t15 * b + 6) / (b^2 + 1) + a^1.5;
+t17 = (t16 * b + 7) / (b^2 + 1) + a^1.5;
+t18 = (t17 * b + 8) / (b^2 + 1) + a^1.5;
+t19 = (t18 * b + 9) / (b^2 + 1) + a^1.5;
+t20 = (t19 * b + 0) / (b^2 + 1) + a^1.5;
+t21 = (t20 * b + 1) / (b^2 + 1) + a^1.5;
+t22 = (t21 * b + 2) / (b^2 + 1) + a^1.5;
+t23 = (t22 * b + 3) / (b^2 + 1) + a^1.5;
+t24 = (t23 * b + 4) / (b^2 + 1) + a^1.5;
+t25 = (t24 * b + 5) / (b^2 + 1) + a^1.5;
+t26 = (t25 * b + 6) / (b^2 + 1) + a^1.5;
+t27 = (t26 * b + 7) / (b^2 + 1) + a^1.5;
+t28 = (t27 * b + 8) / (b^2 + 1) + a^1.5;
+t29 = (t28 * b + 9) / (b^2 + 1) + a^1.5;
+t30 = (t29 * b + 0) / (b^2 + 1) + a^1.5;
+t31 = (t30 * b + 1) / (b^2 + 1) + a^1.5;
+t32 = (t31 * b + 2) / (b^2 + 1) + a^1.5;
+t33 = (t32 * b + 3) / (b^2 + 1) + a^1.5;
+t34 = (t33 * b + 4) / (b^2 + 1) + a^1.5;
+t35 = (t34 * b + 5) / (b^2 + 1) + a^1.5;
+t36 = (t35 * b + 6) / (b^2 + 1) + a^1.5;
+t37 = (t36 * b + 7) / (b^2 + 1) + a^1.5;
+t38 = (t37 * b + 8) / (b^2 + 1) + a^1.5;
+t39 = (t38 * b + 9) / (b^2 + 1) + a^1.5;
+t40 = (t39 * b + 0) / (b^2 + 1) + a^1.5;
+<< t40 << "\n";
@@ -0,0 +1,1454 @@
+	.file	"b2.cpp"
+	.text
+	.section	.text._ZN9el_outputD2Ev,"axG",@progbits,_ZN9el_outputD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN9el_outputD2Ev
+	.type	_ZN9el_outputD2Ev, @function
+_ZN9el_outputD2Ev:
+.LFB67:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA67
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	movq	65536(%rdi), %rdx
+	movq	stdout(%rip), %rcx
+	movl	$1, %esi
+	call	fwrite@PLT
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE67:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN9el_outputD2Ev,"aG",@progbits,_ZN9el_outputD5Ev,comdat
+.LLSDA67:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE67-.LLSDACSB67
+.LLSDACSB67:
+.LLSDACSE67:
+	.section	.text._ZN9el_outputD2Ev,"axG",@progbits,_ZN9el_outputD5Ev,comdat
+	.size	_ZN9el_outputD2Ev, .-_ZN9el_outputD2Ev
+	.weak	_ZN9el_outputD1Ev
+	.set	_ZN9el_outputD1Ev,_ZN9el_outputD2Ev
+	.text
+	.p2align 4
+	.type	_ZL7el_readRd, @function
+_ZL7el_readRd:
+.LFB45:
+	.cfi_startproc
+	cmpb	$0, 65553+_ZL5el_in(%rip)
+	je	.L97
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	_ZL5el_in(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	65536+_ZL5el_in(%rip), %rax
+	cmpq	65544+_ZL5el_in(%rip), %rax
+	je	.L96
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	movzbl	(%r12,%rax), %ebp
+	leal	-9(%rbp), %edx
+	cmpl	$4, %edx
+	jbe	.L73
+	cmpl	$32, %ebp
+	jne	.L10
+.L73:
+	addq	$1, %rax
+	cmpq	65544+_ZL5el_in(%rip), %rax
+	movq	%rax, 65536+_ZL5el_in(%rip)
+	jne	.L12
+.L96:
+	cmpb	$0, 65552+_ZL5el_in(%rip)
+	jne	.L93
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+	xorl	%edi, %edi
+	movl	$65536, %edx
+	movq	%r12, %rsi
+	call	read@PLT
+	testq	%rax, %rax
+	jle	.L98
+	movq	%rax, 65544+_ZL5el_in(%rip)
+	xorl	%eax, %eax
+	movq	$0, 65536+_ZL5el_in(%rip)
+	jmp	.L12
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	movq	65560+_ZL5el_in(%rip), %rax
+	testq	%rax, %rax
+	je	.L99
+.L16:
+	movq	$0, 65568+_ZL5el_in(%rip)
+	movb	$0, (%rax)
+	leal	-43(%rbp), %eax
+	andl	$-3, %eax
+	je	.L100
+.L17:
+	movq	65560+_ZL5el_in(%rip), %r14
+	xorl	%r13d, %r13d
+	xorl	%r15d, %r15d
+	xorl	%ecx, %ecx
+.L40:
+	leal	-48(%rbp), %edx
+	movq	%r14, %rax
+	cmpl	$9, %edx
+	jbe	.L53
+	cmpl	$46, %ebp
+	movl	%ecx, %esi
+	sete	%dl
+	xorl	$1, %esi
+	andb	%sil, %dl
+	je	.L24
+	testb	%r13b, %r13b
+	jne	.L25
+	movl	%edx, %ecx
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	andl	$-33, %ebp
+	cmpl	$69, %ebp
+	jne	.L22
+	testb	%r13b, %r13b
+	jne	.L25
+	testb	%r15b, %r15b
+	jne	.L101
+.L41:
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	movzbl	(%r14), %edi
+	movq	%r14, %rdx
+	leal	-43(%rdi), %eax
+	andl	$-3, %eax
+	cmpb	$1, %al
+	adcq	$0, %rdx
+	movsbl	(%rdx), %eax
+	testb	%al, %al
+	je	.L42
+	movl	$-1, %ecx
+	xorl	%r8d, %r8d
+	xorl	%esi, %esi
+	jmp	.L44
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	subl	$48, %eax
+	leaq	(%rsi,%rsi,4), %rsi
+	addq	$1, %rdx
+	addl	$1, %r8d
+	cltq
+	leaq	(%rax,%rsi,2), %rsi
+	movl	%ecx, %eax
+	notl	%eax
+	shrl	$31, %eax
+	addl	%eax, %ecx
+	movsbl	(%rdx), %eax
+	testb	%al, %al
+	je	.L102
+.L44:
+	cmpb	$46, %al
+	jne	.L103
+	movsbl	1(%rdx), %eax
+	addq	$1, %rdx
+	xorl	%ecx, %ecx
+	testb	%al, %al
+	jne	.L44
+.L102:
+	testb	%r13b, %r13b
+	jne	.L42
+	subl	$1, %r8d
+	cmpl	$14, %r8d
+	ja	.L42
+	cmpl	$22, %ecx
+	jle	.L104
+.L42:
+	leaq	24(%rsp), %rsi
+	movq	%r14, %rdi
+	call	strtod@PLT
+	movq	24(%rsp), %rax
+	vmovsd	%xmm0, (%rbx)
+	cmpq	%rax, %r14
+	je	.L46
+	cmpb	$0, (%rax)
+	je	.L47
+.L46:
+	movq	$0x000000000, (%rbx)
+	movb	$1, 65553+_ZL5el_in(%rip)
+.L83:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.cfi_restore_state
+	movl	$1, %r15d
+.L23:
+	movq	65568+_ZL5el_in(%rip), %rdx
+	movq	65576+_ZL5el_in(%rip), %rsi
+	leaq	1(%rdx), %rdi
+	cmpq	%rsi, %rdi
+	jnb	.L105
+.L36:
+	movq	65536+_ZL5el_in(%rip), %rsi
+	leaq	1(%rsi), %rdi
+	movzbl	(%r12,%rsi), %esi
+	movq	%rdi, 65536+_ZL5el_in(%rip)
+	leaq	1(%rdx), %rdi
+	movq	%rdi, 65568+_ZL5el_in(%rip)
+	movb	%sil, (%rax,%rdx)
+	movq	65568+_ZL5el_in(%rip), %rax
+	movq	65560+_ZL5el_in(%rip), %rdx
+	movb	$0, (%rdx,%rax)
+	movq	65536+_ZL5el_in(%rip), %rax
+	cmpq	65544+_ZL5el_in(%rip), %rax
+	je	.L106
+.L37:
+	movzbl	(%r12,%rax), %ebp
+	movq	65560+_ZL5el_in(%rip), %r14
+	jmp	.L40
+.L35:
+	movb	$1, 65552+_ZL5el_in(%rip)
+.L91:
+	movq	65560+_ZL5el_in(%rip), %r14
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	movl	$1, %r13d
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	vmovsd	.LC0(%rip), %xmm1
+	vcomisd	%xmm1, %xmm0
+	ja	.L49
+	vmovsd	.LC1(%rip), %xmm2
+	vcomisd	%xmm0, %xmm2
+	jbe	.L83
+.L49:
+	vxorpd	%xmm2, %xmm2, %xmm2
+	vcmpnltsd	%xmm0, %xmm2, %xmm0
+	vmovsd	.LC1(%rip), %xmm2
+	vblendvpd	%xmm0, %xmm2, %xmm1, %xmm1
+	vmovsd	%xmm1, (%rbx)
+.L93:
+	movb	$1, 65553+_ZL5el_in(%rip)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	.cfi_restore_state
+	cmpb	$0, 65552+_ZL5el_in(%rip)
+	jne	.L92
+	movq	stdout(%rip), %rdi
+	movb	%cl, 15(%rsp)
+	call	fflush@PLT
+	xorl	%edi, %edi
+	movl	$65536, %edx
+	movq	%r12, %rsi
+	call	read@PLT
+	movzbl	15(%rsp), %ecx
+	testq	%rax, %rax
+	jle	.L107
+	movq	%rax, 65544+_ZL5el_in(%rip)
+	xorl	%eax, %eax
+	movq	$0, 65536+_ZL5el_in(%rip)
+	jmp	.L37
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	addq	%rsi, %rsi
+	movq	%r14, %rdi
+	movb	%cl, 15(%rsp)
+	movq	%rsi, 65576+_ZL5el_in(%rip)
+	call	realloc@PLT
+	movq	65568+_ZL5el_in(%rip), %rdx
+	movzbl	15(%rsp), %ecx
+	movq	%rax, 65560+_ZL5el_in(%rip)
+	jmp	.L36
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	movq	65568+_ZL5el_in(%rip), %rdx
+	movq	65576+_ZL5el_in(%rip), %rsi
+	movq	65560+_ZL5el_in(%rip), %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%rsi, %rcx
+	jnb	.L108
+.L18:
+	movq	65536+_ZL5el_in(%rip), %rsi
+	movq	%rcx, 65568+_ZL5el_in(%rip)
+	leaq	1(%rsi), %rdi
+	movzbl	(%r12,%rsi), %esi
+	movq	%rdi, 65536+_ZL5el_in(%rip)
+	movb	%sil, (%rax,%rdx)
+	movq	65568+_ZL5el_in(%rip), %rax
+	movq	65560+_ZL5el_in(%rip), %rdx
+	movb	$0, (%rdx,%rax)
+	movq	65536+_ZL5el_in(%rip), %rax
+	cmpq	65544+_ZL5el_in(%rip), %rax
+	je	.L109
+.L19:
+	movzbl	(%r12,%rax), %ebp
+	jmp	.L17
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	movq	65568+_ZL5el_in(%rip), %rdx
+	movq	65576+_ZL5el_in(%rip), %rdi
+	leaq	1(%rdx), %rsi
+	cmpq	%rdi, %rsi
+	jnb	.L110
+.L28:
+	movq	65536+_ZL5el_in(%rip), %rdi
+	movq	%rsi, 65568+_ZL5el_in(%rip)
+	leaq	1(%rdi), %r8
+	movzbl	(%r12,%rdi), %edi
+	movq	%r8, 65536+_ZL5el_in(%rip)
+	movb	%dil, (%rax,%rdx)
+	movq	65560+_ZL5el_in(%rip), %rdx
+	movq	65568+_ZL5el_in(%rip), %rax
+	movb	$0, (%rdx,%rax)
+	movq	65536+_ZL5el_in(%rip), %rdx
+	cmpq	65544+_ZL5el_in(%rip), %rdx
+	je	.L111
+.L29:
+	movzbl	(%r12,%rdx), %ebp
+	movq	65560+_ZL5el_in(%rip), %r14
+	movl	%r15d, %r13d
+	leal	-43(%rbp), %esi
+	movq	%r14, %rax
+	andl	$253, %esi
+	jne	.L40
+	movq	65568+_ZL5el_in(%rip), %rsi
+	movq	65576+_ZL5el_in(%rip), %r8
+	leaq	1(%rsi), %rdi
+	cmpq	%r8, %rdi
+	jnb	.L112
+.L33:
+	addq	$1, %rdx
+	movq	%rdi, 65568+_ZL5el_in(%rip)
+	movq	%rdx, 65536+_ZL5el_in(%rip)
+	movb	%bpl, (%rax,%rsi)
+	movq	65568+_ZL5el_in(%rip), %rax
+	movq	65560+_ZL5el_in(%rip), %rdx
+	movb	$0, (%rdx,%rax)
+	movq	65536+_ZL5el_in(%rip), %rax
+	cmpq	65544+_ZL5el_in(%rip), %rax
+	je	.L113
+.L34:
+	movzbl	(%r12,%rax), %ebp
+	movq	65560+_ZL5el_in(%rip), %r14
+	movl	%r15d, %r13d
+	jmp	.L40
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	movq	$64, 65576+_ZL5el_in(%rip)
+	movl	$64, %edi
+	call	malloc@PLT
+	movq	%rax, 65560+_ZL5el_in(%rip)
+	jmp	.L16
+.L104:
+	xorl	%eax, %eax
+	testl	%ecx, %ecx
+	vxorps	%xmm0, %xmm0, %xmm0
+	cmovs	%eax, %ecx
+	vcvtsi2sdq	%rsi, %xmm0, %xmm0
+	leaq	_ZZL7el_readRdE6POWERS(%rip), %rax
+	movslq	%ecx, %rcx
+	vdivsd	(%rax,%rcx,8), %xmm0, %xmm0
+	cmpb	$45, %dil
+	jne	.L45
+	vxorpd	.LC2(%rip), %xmm0, %xmm0
+.L45:
+	vmovsd	%xmm0, (%rbx)
+	jmp	.L83
+.L109:
+	cmpb	$0, 65552+_ZL5el_in(%rip)
+	jne	.L90
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+	xorl	%edi, %edi
+	movl	$65536, %edx
+	movq	%r12, %rsi
+	call	read@PLT
+	testq	%rax, %rax
+	jle	.L114
+	movq	%rax, 65544+_ZL5el_in(%rip)
+	xorl	%eax, %eax
+	movq	$0, 65536+_ZL5el_in(%rip)
+	jmp	.L19
+.L108:
+	addq	%rsi, %rsi
+	movq	%rax, %rdi
+	movq	%rsi, 65576+_ZL5el_in(%rip)
+	call	realloc@PLT
+	movq	65568+_ZL5el_in(%rip), %rdx
+	movq	%rax, 65560+_ZL5el_in(%rip)
+	leaq	1(%rdx), %rcx
+	jmp	.L18
+.L111:
+	cmpb	$0, 65552+_ZL5el_in(%rip)
+	jne	.L91
+	movq	stdout(%rip), %rdi
+	movb	%cl, 15(%rsp)
+	call	fflush@PLT
+	xorl	%edi, %edi
+	movl	$65536, %edx
+	movq	%r12, %rsi
+	call	read@PLT
+	movzbl	15(%rsp), %ecx
+	testq	%rax, %rax
+	jle	.L35
+	movq	$0, 65536+_ZL5el_in(%rip)
+	xorl	%edx, %edx
+	movq	%rax, 65544+_ZL5el_in(%rip)
+	jmp	.L29
+.L110:
+	leaq	(%rdi,%rdi), %rsi
+	movq	%r14, %rdi
+	movb	%cl, 15(%rsp)
+	movq	%rsi, 65576+_ZL5el_in(%rip)
+	call	realloc@PLT
+	movq	65568+_ZL5el_in(%rip), %rdx
+	movzbl	15(%rsp), %ecx
+	movq	%rax, 65560+_ZL5el_in(%rip)
+	leaq	1(%rdx), %rsi
+	jmp	.L28
+.L98:
+	movb	$1, 65552+_ZL5el_in(%rip)
+	jmp	.L93
+.L113:
+	cmpb	$0, 65552+_ZL5el_in(%rip)
+	jne	.L91
+	movq	stdout(%rip), %rdi
+	movb	%cl, 15(%rsp)
+	call	fflush@PLT
+	xorl	%edi, %edi
+	movl	$65536, %edx
+	movq	%r12, %rsi
+	call	read@PLT
+	testq	%rax, %rax
+	jle	.L35
+	movq	%rax, 65544+_ZL5el_in(%rip)
+	movzbl	15(%rsp), %ecx
+	xorl	%eax, %eax
+	movq	$0, 65536+_ZL5el_in(%rip)
+	jmp	.L34
+.L112:
+	leaq	(%r8,%r8), %rsi
+	movq	%r14, %rdi
+	movb	%cl, 15(%rsp)
+	movq	%rsi, 65576+_ZL5el_in(%rip)
+	call	realloc@PLT
+	movq	65536+_ZL5el_in(%rip), %rdx
+	movzbl	15(%rsp), %ecx
+	movq	65568+_ZL5el_in(%rip), %rsi
+	movq	%rax, 65560+_ZL5el_in(%rip)
+	movzbl	(%r12,%rdx), %ebp
+	leaq	1(%rsi), %rdi
+	jmp	.L33
+.L107:
+	movb	$1, 65552+_ZL5el_in(%rip)
+.L92:
+	movq	65560+_ZL5el_in(%rip), %r14
+	jmp	.L22
+.L114:
+	movb	$1, 65552+_ZL5el_in(%rip)
+.L90:
+	movq	65560+_ZL5el_in(%rip), %r14
+	jmp	.L41
+	.cfi_endproc
+.LFE45:
+	.size	_ZL7el_readRd, .-_ZL7el_readRd
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC150:
+	.string	"%g"
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB84:
+	.cfi_startproc
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-64, %rsp
+	pushq	-8(%r10)
+	pushq	%rbp
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	pushq	%r14
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	leaq	_ZL6el_out(%rip), %r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	pushq	%rbx
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	leaq	_ZL5el_in(%rip), %rbx
+	subq	$256, %rsp
+	.p2align 4,,10
+	.p2align 3
+.L144:
+	xorl	%r12d, %r12d
+	leaq	-256(%rbp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	movq	65536+_ZL5el_in(%rip), %rax
+	cmpq	65544+_ZL5el_in(%rip), %rax
+	je	.L162
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	movzbl	(%rbx,%rax), %edx
+	movl	%edx, %ecx
+	subl	$9, %edx
+	cmpl	$4, %edx
+	jbe	.L155
+	cmpb	$32, %cl
+	jne	.L120
+.L155:
+	addq	$1, %rax
+	cmpq	65544+_ZL5el_in(%rip), %rax
+	movq	%rax, 65536+_ZL5el_in(%rip)
+	jne	.L122
+.L162:
+	cmpb	$0, 65552+_ZL5el_in(%rip)
+	jne	.L125
+	movq	stdout(%rip), %rdi
+	vzeroupper
+	call	fflush@PLT
+	xorl	%edi, %edi
+	movl	$65536, %edx
+	movq	%rbx, %rsi
+	call	read@PLT
+	testq	%rax, %rax
+	jle	.L163
+	movq	%rax, 65544+_ZL5el_in(%rip)
+	xorl	%eax, %eax
+	movq	$0, 65536+_ZL5el_in(%rip)
+	jmp	.L122
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	cmpb	$0, 65553+_ZL5el_in(%rip)
+	je	.L164
+.L125:
+	movslq	%r12d, %rax
+	testl	%r12d, %r12d
+	je	.L128
+.L127:
+	vmovapd	-176(%rbp), %zmm1
+	leaq	-112(%rbp), %r15
+	movq	%r14, %r13
+	vmovapd	-240(%rbp), %zmm2
+	vbroadcastsd	.LC7(%rip), %zmm3
+	leaq	(%r15,%rax,8), %r12
+	vbroadcastsd	.LC9(%rip), %zmm10
+	vaddpd	.LC5(%rip){1to8}, %zmm1, %zmm0
+	vaddpd	.LC11(%rip){1to8}, %zmm1, %zmm4
+	vbroadcastsd	.LC13(%rip), %zmm9
+	vbroadcastsd	.LC17(%rip), %zmm8
+	vbroadcastsd	.LC21(%rip), %zmm7
+	vaddpd	.LC35(%rip){1to8}, %zmm1, %zmm11
+	vbroadcastsd	.LC25(%rip), %zmm6
+	vbroadcastsd	.LC29(%rip), %zmm5
+	vmulpd	%zmm2, %zmm0, %zmm0
+	vmulpd	%zmm2, %zmm4, %zmm4
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm3, %zmm2, %zmm0
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm4, %zmm0
+	vaddpd	.LC15(%rip){1to8}, %zmm1, %zmm4
+	vmulpd	%zmm2, %zmm4, %zmm4
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm4, %zmm0
+	vaddpd	.LC19(%rip){1to8}, %zmm1, %zmm4
+	vmulpd	%zmm2, %zmm4, %zmm4
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm4, %zmm0
+	vaddpd	.LC23(%rip){1to8}, %zmm1, %zmm4
+	vmulpd	%zmm2, %zmm4, %zmm4
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm4, %zmm0
+	vaddpd	.LC27(%rip){1to8}, %zmm1, %zmm4
+	vmulpd	%zmm2, %zmm4, %zmm4
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm4, %zmm0
+	vaddpd	.LC31(%rip){1to8}, %zmm1, %zmm4
+	vmulpd	%zmm2, %zmm4, %zmm4
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm4, %zmm0
+	vbroadcastsd	.LC33(%rip), %zmm4
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC37(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC39(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC41(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC43(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC45(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC47(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC49(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC51(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC53(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC55(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC57(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC59(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC61(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC63(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC65(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC67(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC69(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC71(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC73(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC75(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC77(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC79(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC81(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC83(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC85(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC87(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC89(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC91(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC93(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC95(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC97(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC99(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC101(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC103(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC105(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC107(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC109(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC111(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC113(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC115(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC117(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC119(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC121(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC123(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm9, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC125(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm8, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC127(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm7, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC129(%rip){1to8}, %zmm1, %zmm11
+	movq	65536+_ZL6el_out(%rip), %rdx
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm6, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC131(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm5, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC133(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm4, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vaddpd	.LC135(%rip){1to8}, %zmm1, %zmm11
+	vmulpd	%zmm2, %zmm11, %zmm11
+	vfmadd231pd	%zmm10, %zmm1, %zmm0
+	vfmadd132pd	%zmm3, %zmm11, %zmm0
+	vfmadd132pd	%zmm1, %zmm0, %zmm9
+	vaddpd	.LC137(%rip){1to8}, %zmm1, %zmm0
+	vmulpd	%zmm2, %zmm0, %zmm0
+	vfmadd132pd	%zmm3, %zmm0, %zmm9
+	vaddpd	.LC139(%rip){1to8}, %zmm1, %zmm0
+	vmulpd	%zmm2, %zmm0, %zmm0
+	vfmadd132pd	%zmm1, %zmm9, %zmm8
+	vfmadd132pd	%zmm3, %zmm0, %zmm8
+	vaddpd	.LC141(%rip){1to8}, %zmm1, %zmm0
+	vmulpd	%zmm2, %zmm0, %zmm0
+	vfmadd132pd	%zmm1, %zmm8, %zmm7
+	vfmadd132pd	%zmm3, %zmm0, %zmm7
+	vaddpd	.LC143(%rip){1to8}, %zmm1, %zmm0
+	vmulpd	%zmm2, %zmm0, %zmm0
+	vfmadd132pd	%zmm1, %zmm7, %zmm6
+	vfmadd132pd	%zmm3, %zmm0, %zmm6
+	vaddpd	.LC145(%rip){1to8}, %zmm1, %zmm0
+	vmulpd	%zmm2, %zmm0, %zmm0
+	vfmadd132pd	%zmm1, %zmm6, %zmm5
+	vfmadd132pd	%zmm3, %zmm0, %zmm5
+	vaddpd	.LC147(%rip){1to8}, %zmm1, %zmm0
+	vmulpd	%zmm2, %zmm0, %zmm0
+	vfmadd132pd	%zmm1, %zmm5, %zmm4
+	vfmadd132pd	%zmm3, %zmm0, %zmm4
+	vfmadd132pd	%zmm10, %zmm4, %zmm1
+	vmovapd	%zmm1, -112(%rbp)
+	jmp	.L143
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	vcomisd	.LC148(%rip), %xmm0
+	jbe	.L131
+	vmovsd	.LC149(%rip), %xmm5
+	vcomisd	%xmm0, %xmm5
+	jbe	.L131
+	vcvttsd2sil	%xmm0, %eax
+	vxorpd	%xmm6, %xmm6, %xmm6
+	vcvtsi2sdl	%eax, %xmm6, %xmm1
+	vucomisd	%xmm1, %xmm0
+	jp	.L131
+	jne	.L131
+	vxorpd	%xmm1, %xmm1, %xmm1
+	vucomisd	%xmm1, %xmm0
+	jp	.L135
+	jne	.L135
+	vmovmskpd	%xmm0, %edx
+	andl	$1, %edx
+	je	.L135
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	leaq	.LC150(%rip), %rdx
+	movl	$32, %esi
+	movl	$1, %eax
+	vzeroupper
+	call	snprintf@PLT
+	movslq	%eax, %rdx
+	addq	65536+_ZL6el_out(%rip), %rdx
+	movq	%rdx, 65536+_ZL6el_out(%rip)
+.L140:
+	leaq	1(%rdx), %rax
+	cmpq	$65536, %rax
+	ja	.L141
+	addq	%r13, %rdx
+.L142:
+	movb	$10, (%rdx)
+	movq	65536+_ZL6el_out(%rip), %rax
+	addq	$8, %r15
+	leaq	1(%rax), %rdx
+	movq	%rdx, 65536+_ZL6el_out(%rip)
+	cmpq	%r15, %r12
+	je	.L144
+.L143:
+	leaq	32(%rdx), %rax
+	vmovsd	(%r15), %xmm0
+	leaq	0(%r13,%rdx), %rdi
+	cmpq	$65536, %rax
+	jbe	.L130
+	movq	stdout(%rip), %rcx
+	movq	%r13, %rdi
+	movl	$1, %esi
+	movq	%r14, %r13
+	vmovsd	%xmm0, -264(%rbp)
+	vzeroupper
+	call	fwrite@PLT
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+	leaq	_ZL6el_out(%rip), %rdi
+	movq	$0, 65536+_ZL6el_out(%rip)
+	vmovsd	-264(%rbp), %xmm0
+	jmp	.L130
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	leaq	-240(%rbp), %r15
+	movq	%r13, %rdi
+	vmovsd	(%r15,%r12,8), %xmm0
+	vmovsd	%xmm0, -256(%rbp)
+	vzeroupper
+	call	_ZL7el_readRd
+	movq	%r13, %rdi
+	vmovsd	-256(%rbp), %xmm0
+	vmovsd	%xmm0, (%r15,%r12,8)
+	leaq	-176(%rbp), %r15
+	vmovsd	(%r15,%r12,8), %xmm0
+	vmovsd	%xmm0, -256(%rbp)
+	call	_ZL7el_readRd
+	vmovsd	-256(%rbp), %xmm0
+	vmovsd	%xmm0, (%r15,%r12,8)
+	addq	$1, %r12
+	cmpq	$8, %r12
+	jne	.L126
+	movl	$8, %eax
+	jmp	.L127
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	movq	stdout(%rip), %rcx
+	movq	%r13, %rdi
+	vzeroupper
+	movq	%r14, %r13
+	movl	$1, %esi
+	call	fwrite@PLT
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+	movq	%r14, %rdx
+	movq	$0, 65536+_ZL6el_out(%rip)
+	jmp	.L142
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	movl	%eax, %edx
+	negl	%edx
+	cmovs	%eax, %edx
+	testl	%eax, %eax
+	jns	.L137
+	movb	$45, (%rdi)
+	addq	$1, %rdi
+	addq	$1, 65536+_ZL6el_out(%rip)
+.L137:
+	movl	$1, %ecx
+	leaq	-249(%rbp), %r11
+	movl	$3435973837, %r10d
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	movl	%edx, %eax
+	movl	%edx, %esi
+	imulq	%r10, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %r9d
+	addl	%r9d, %r9d
+	subl	%r9d, %esi
+	movl	%edx, %r9d
+	movl	%eax, %edx
+	addl	$48, %esi
+	movb	%sil, (%r11,%rcx)
+	movq	%rcx, %rsi
+	addq	$1, %rcx
+	cmpl	$9, %r9d
+	ja	.L138
+	movslq	%esi, %rax
+	addq	%rdi, %rsi
+	leaq	-248(%rbp,%rax), %rax
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	movzbl	-1(%rax), %edx
+	addq	$1, %rdi
+	subq	$1, %rax
+	movb	%dl, -1(%rdi)
+	movq	65536+_ZL6el_out(%rip), %rcx
+	leaq	1(%rcx), %rdx
+	movq	%rdx, 65536+_ZL6el_out(%rip)
+	cmpq	%rsi, %rdi
+	jne	.L139
+	jmp	.L140
+.L163:
+	movb	$1, 65552+_ZL5el_in(%rip)
+	movslq	%r12d, %rax
+	testl	%r12d, %r12d
+	jne	.L127
+.L128:
+	xorl	%eax, %eax
+	vzeroupper
+	addq	$256, %rsp
+	popq	%rbx
+	popq	%r10
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE84:
+	.size	main, .-main
+	.p2align 4
+	.type	_GLOBAL__sub_I_main, @function
+_GLOBAL__sub_I_main:
+.LFB90:
+	.cfi_startproc
+	vpxor	%xmm0, %xmm0, %xmm0
+	leaq	__dso_handle(%rip), %rdx
+	leaq	_ZL6el_out(%rip), %rsi
+	movw	$0, 65552+_ZL5el_in(%rip)
+	leaq	_ZN9el_outputD1Ev(%rip), %rdi
+	movq	$0, 65560+_ZL5el_in(%rip)
+	movq	$0, 65536+_ZL6el_out(%rip)
+	vmovdqa	%xmm0, 65536+_ZL5el_in(%rip)
+	vmovdqa	%xmm0, 65568+_ZL5el_in(%rip)
+	jmp	__cxa_atexit@PLT
+	.cfi_endproc
+.LFE90:
+	.size	_GLOBAL__sub_I_main, .-_GLOBAL__sub_I_main
+	.section	.init_array,"aw"
+	.align 8
+	.quad	_GLOBAL__sub_I_main
+	.local	_ZL6el_out
+	.comm	_ZL6el_out,65544,32
+	.section	.rodata
+	.align 32
+	.type	_ZZL7el_readRdE6POWERS, @object
+	.size	_ZZL7el_readRdE6POWERS, 184
+_ZZL7el_readRdE6POWERS:
+	.long	0
+	.long	1072693248
+	.long	0
+	.long	1076101120
+	.long	0
+	.long	1079574528
+	.long	0
+	.long	1083129856
+	.long	0
+	.long	1086556160
+	.long	0
+	.long	1090021888
+	.long	0
+	.long	1093567616
+	.long	0
+	.long	1097011920
+	.long	0
+	.long	1100470148
+	.long	0
+	.long	1104006501
+	.long	536870912
+	.long	1107468383
+	.long	-402653184
+	.long	1110919286
+	.long	-1577058304
+	.long	1114446484
+	.long	-448790528
+	.long	1117925532
+	.long	512753664
+	.long	1121369284
+	.long	640942080
+	.long	1124887541
+	.long	937459712
+	.long	1128383353
+	.long	-2049400832
+	.long	1131820119
+	.long	1733216256
+	.long	1135329645
+	.long	1620131072
+	.long	1138841828
+	.long	2025163840
+	.long	1142271773
+	.long	-689770672
+	.long	1145772772
+	.long	105764242
+	.long	1149300943
+	.local	_ZL5el_in
+	.comm	_ZL5el_in,65584,32
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	-1
+	.long	2146435071
+	.align 8
+.LC1:
+	.long	-1
+	.long	-1048577
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC2:
+	.long	0
+	.long	-2147483648
+	.long	0
+	.long	0
+	.section	.rodata.cst8
+	.align 8
+.LC5:
+	.long	0
+	.long	1073217536
+	.align 8
+.LC7:
+	.long	-652835029
+	.long	1072691150
+	.align 8
+.LC9:
+	.long	0
+	.long	-1074528256
+	.align 8
+.LC11:
+	.long	0
+	.long	1074003968
+	.align 8
+.LC13:
+	.long	0
+	.long	-1073610752
+	.align 8
+.LC15:
+	.long	0
+	.long	1074528256
+	.align 8
+.LC17:
+	.long	0
+	.long	-1073086464
+	.align 8
+.LC19:
+	.long	0
+	.long	1074921472
+	.align 8
+.LC21:
+	.long	0
+	.long	-1072627712
+	.align 8
+.LC23:
+	.long	0
+	.long	1075183616
+	.align 8
+.LC25:
+	.long	0
+	.long	-1072365568
+	.align 8
+.LC27:
+	.long	0
+	.long	1075445760
+	.align 8
+.LC29:
+	.long	0
+	.long	-1072103424
+	.align 8
+.LC31:
+	.long	0
+	.long	1075707904
+	.align 8
+.LC33:
+	.long	0
+	.long	-1076887552
+	.align 8
+.LC35:
+	.long	0
+	.long	1075904512
+	.align 8
+.LC37:
+	.long	0
+	.long	1076035584
+	.align 8
+.LC39:
+	.long	0
+	.long	1076166656
+	.align 8
+.LC41:
+	.long	0
+	.long	1076297728
+	.align 8
+.LC43:
+	.long	0
+	.long	1076428800
+	.align 8
+.LC45:
+	.long	0
+	.long	1076559872
+	.align 8
+.LC47:
+	.long	0
+	.long	1076690944
+	.align 8
+.LC49:
+	.long	0
+	.long	1076822016
+	.align 8
+.LC51:
+	.long	0
+	.long	1076920320
+	.align 8
+.LC53:
+	.long	0
+	.long	1076985856
+	.align 8
+.LC55:
+	.long	0
+	.long	1077051392
+	.align 8
+.LC57:
+	.long	0
+	.long	1077116928
+	.align 8
+.LC59:
+	.long	0
+	.long	1077182464
+	.align 8
+.LC61:
+	.long	0
+	.long	1077248000
+	.align 8
+.LC63:
+	.long	0
+	.long	1077313536
+	.align 8
+.LC65:
+	.long	0
+	.long	1077379072
+	.align 8
+.LC67:
+	.long	0
+	.long	1077444608
+	.align 8
+.LC69:
+	.long	0
+	.long	1077510144
+	.align 8
+.LC71:
+	.long	0
+	.long	1077575680
+	.align 8
+.LC73:
+	.long	0
+	.long	1077641216
+	.align 8
+.LC75:
+	.long	0
+	.long	1077706752
+	.align 8
+.LC77:
+	.long	0
+	.long	1077772288
+	.align 8
+.LC79:
+	.long	0
+	.long	1077837824
+	.align 8
+.LC81:
+	.long	0
+	.long	1077903360
+	.align 8
+.LC83:
+	.long	0
+	.long	1077952512
+	.align 8
+.LC85:
+	.long	0
+	.long	1077985280
+	.align 8
+.LC87:
+	.long	0
+	.long	1078018048
+	.align 8
+.LC89:
+	.long	0
+	.long	1078050816
+	.align 8
+.LC91:
+	.long	0
+	.long	1078083584
+	.align 8
+.LC93:
+	.long	0
+	.long	1078116352
+	.align 8
+.LC95:
+	.long	0
+	.long	1078149120
+	.align 8
+.LC97:
+	.long	0
+	.long	1078181888
+	.align 8
+.LC99:
+	.long	0
+	.long	1078214656
+	.align 8
+.LC101:
+	.long	0
+	.long	1078247424
+	.align 8
+.LC103:
+	.long	0
+	.long	1078280192
+	.align 8
+.LC105:
+	.long	0
+	.long	1078312960
+	.align 8
+.LC107:
+	.long	0
+	.long	1078345728
+	.align 8
+.LC109:
+	.long	0
+	.long	1078378496
+	.align 8
+.LC111:
+	.long	0
+	.long	1078411264
+	.align 8
+.LC113:
+	.long	0
+	.long	1078444032
+	.align 8
+.LC115:
+	.long	0
+	.long	1078476800
+	.align 8
+.LC117:
+	.long	0
+	.long	1078509568
+	.align 8
+.LC119:
+	.long	0
+	.long	1078542336
+	.align 8
+.LC121:
+	.long	0
+	.long	1078575104
+	.align 8
+.LC123:
+	.long	0
+	.long	1078607872
+	.align 8
+.LC125:
+	.long	0
+	.long	1078640640
+	.align 8
+.LC127:
+	.long	0
+	.long	1078673408
+	.align 8
+.LC129:
+	.long	0
+	.long	1078706176
+	.align 8
+.LC131:
+	.long	0
+	.long	1078738944
+	.align 8
+.LC133:
+	.long	0
+	.long	1078771712
+	.align 8
+.LC135:
+	.long	0
+	.long	1078804480
+	.align 8
+.LC137:
+	.long	0
+	.long	1078837248
+	.align 8
+.LC139:
+	.long	0
+	.long	1078870016
+	.align 8
+.LC141:
+	.long	0
+	.long	1078902784
+	.align 8
+.LC143:
+	.long	0
+	.long	1078935552
+	.align 8
+.LC145:
+	.long	0
+	.long	1078968320
+	.align 8
+.LC147:
+	.long	0
+	.long	1078992896
+	.align 8
+.LC148:
+	.long	0
+	.long	-1053916032
+	.align 8
+.LC149:
+	.long	0
+	.long	1093567616
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.hidden	__dso_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,33 @@
+#include "el_input.h"
+#include "el_output.h"
+#define EL_LANES 8
+#include "el_batch.h"
+
+int main()
+{
+	for ( long el_record = 0; ; ) {
+		el_lanes el_input0;
+		el_lanes x;
+		el_lanes el_input1;
+		el_lanes y;
+		double el_value;
+		int el_count = 0;
+		for ( ; el_count < EL_LANES && el_more(); el_count++ ) {
+			el_value = el_input0[el_count];
+			el_read(el_value);
+			el_input0[el_count] = el_value;
+			el_value = el_input1[el_count];
+			el_read(el_value);
+			el_input1[el_count] = el_value;
+		}
+		if ( !el_count ) {
+			break;
+		}
+		x = el_input0;
+		y = el_input1;
+		for ( int el_lane = 0; el_lane < el_count; el_lane++, el_record++ ) {
+			el_print(x[el_lane]);
+			el_write("\n");
+		}
+	}
+}
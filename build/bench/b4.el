@@ -0,0 +1,67 @@
+>> x >> y;
+s = x;
+s = s*0.999 + x*(y+1.5) - y*1.25;
+s = s*0.999 + x*(y+2.5) - y*2.25;
+s = s*0.999 + x*(y+3.5) - y*3.25;
+s = s*0.999 + x*(y+4.5) - y*4.25;
+s = s*0.999 + x*(y+5.5) - y*5.25;
+s = s*0.999 + x*(y+6.5) - y*6.25;
+s = s*0.999 + x*(y+7.5) - y*0.25;
+s = s*0.999 + x*(y+8.5) - y*1.25;
+s = s*0.999 + x*(y+9.5) - y*2.25;
+s = s*0.999 + x*(y+10.5) - y*3.25;
+s = s*0.999 + x*(y+11.5) - y*4.25;
+s = s*0.999 + x*(y+12.5) - y*5.25;
+s = s*0.999 + x*(y+13.5) - y*6.25;
+s = s*0.999 + x*(y+14.5) - y*0.25;
+s = s*0.999 + x*(y+15.5) - y*1.25;
+s = s*0.999 + x*(y+16.5) - y*2.25;
+s = s*0.999 + x*(y+17.5) - y*3.25;
+s = s*0.999 + x*(y+18.5) - y*4.25;
+s = s*0.999 + x*(y+19.5) - y*5.25;
+s = s*0.999 + x*(y+20.5) - y*6.25;
+s = s*0.999 + x*(y+21.5) - y*0.25;
+s = s*0.999 + x*(y+22.5) - y*1.25;
+s = s*0.999 + x*(y+23.5) - y*2.25;
+s = s*0.999 + x*(y+24.5) - y*3.25;
+s = s*0.999 + x*(y+25.5) - y*4.25;
+s = s*0.999 + x*(y+26.5) - y*5.25;
+s = s*0.999 + x*(y+27.5) - y*6.25;
+s = s*0.999 + x*(y+28.5) - y*0.25;
+s = s*0.999 + x*(y+29.5) - y*1.25;
+s = s*0.999 + x*(y+30.5) - y*2.25;
+s = s*0.999 + x*(y+31.5) - y*3.25;
+s = s*0.999 + x*(y+32.5) - y*4.25;
+s = s*0.999 + x*(y+33.5) - y*5.25;
+s = s*0.999 + x*(y+34.5) - y*6.25;
+s = s*0.999 + x*(y+35.5) - y*0.25;
+s = s*0.999 + x*(y+36.5) - y*1.25;
+s = s*0.999 + x*(y+37.5) - y*2.25;
+s = s*0.999 + x*(y+38.5) - y*3.25;
+s = s*0.999 + x*(y+39.5) - y*4.25;
+s = s*0.999 + x*(y+40.5) - y*5.25;
+s = s*0.999 + x*(y+41.5) - y*6.25;
+s = s*0.999 + x*(y+42.5) - y*0.25;
+s = s*0.999 + x*(y+43.5) - y*1.25;
+s = s*0.999 + x*(y+44.5) - y*2.25;
+s = s*0.999 + x*(y+45.5) - y*3.25;
+s = s*0.999 + x*(y+46.5) - y*4.25;
+s = s*0.999 + x*(y+47.5) - y*5.25;
+s = s*0.999 + x*(y+48.5) - y*6.25;
+s = s*0.999 + x*(y+49.5) - y*0.25;
+s = s*0.999 + x*(y+50.5) - y*1.25;
+s = s*0.999 + x*(y+51.5) - y*2.25;
+s = s*0.999 + x*(y+52.5) - y*3.25;
+s = s*0.999 + x*(y+53.5) - y*4.25;
+s = s*0.999 + x*(y+54.5) - y*5.25;
+s = s*0.999 + x*(y+55.5) - y*6.25;
+s = s*0.999 + x*(y+56.5) - y*0.25;
+s = s*0.999 + x*(y+57.5) - y*1.25;
+s = s*0.999 + x*(y+58.5) - y*2.25;
+s = s*0.999 + x*(y+59.5) - y*3.25;
+s = s*0.999 + x*(y+60.5) - y*4.25;
+s = s*0.999 + x*(y+61.5) - y*5.25;
+s = s*0.999 + x*(y+62.5) - y*6.25;
+s = s*0.999 + x*(y+63.5) - y*0.25;
+s = s*0.999 + x*(y+64.5) - y*1.25;
+<< "1\n";
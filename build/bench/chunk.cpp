@@ -0,0 +1,15 @@
+#include <iostream>
+#include <cmath>
+
+using namespace std;
+
+#include "chunk_state.h"
+
+int main()
+{
+	el_state el_values;
+	el_values.el_chunk0 ();
+	el_values.el_chunk1 ();
+	el_values.el_chunk2 ();
+	el_values.el_chunk3 ();
+}
@@ -0,0 +1,3002 @@
+>> a >> b;
+v0 = a;
+v1 = v0*0.999 + b/(v0+1.5);
+v2 = v1*0.999 + b/(v0+2.5);
+v3 = v2*0.999 + b/(v0+3.5);
+v4 = v3*0.999 + b/(v0+4.5);
+v5 = v4*0.999 + b/(v0+5.5);
+v6 = v5*0.999 + b/(v0+6.5);
+v7 = v6*0.999 + b/(v0+7.5);
+v8 = v7*0.999 + b/(v1+8.5);
+v9 = v8*0.999 + b/(v2+9.5);
+v10 = v9*0.999 + b/(v3+10.5);
+v11 = v10*0.999 + b/(v4+11.5);
+v12 = v11*0.999 + b/(v5+12.5);
+v13 = v12*0.999 + b/(v6+0.5);
+v14 = v13*0.999 + b/(v7+1.5);
+v15 = v14*0.999 + b/(v8+2.5);
+v16 = v15*0.999 + b/(v9+3.5);
+v17 = v16*0.999 + b/(v10+4.5);
+v18 = v17*0.999 + b/(v11+5.5);
+v19 = v18*0.999 + b/(v12+6.5);
+v20 = v19*0.999 + b/(v13+7.5);
+v21 = v20*0.999 + b/(v14+8.5);
+v22 = v21*0.999 + b/(v15+9.5);
+v23 = v22*0.999 + b/(v16+10.5);
+v24 = v23*0.999 + b/(v17+11.5);
+v25 = v24*0.999 + b/(v18+12.5);
+v26 = v25*0.999 + b/(v19+0.5);
+v27 = v26*0.999 + b/(v20+1.5);
+v28 = v27*0.999 + b/(v21+2.5);
+v29 = v28*0.999 + b/(v22+3.5);
+v30 = v29*0.999 + b/(v23+4.5);
+v31 = v30*0.999 + b/(v24+5.5);
+v32 = v31*0.999 + b/(v25+6.5);
+v33 = v32*0.999 + b/(v26+7.5);
+v34 = v33*0.999 + b/(v27+8.5);
+v35 = v34*0.999 + b/(v28+9.5);
+v36 = v35*0.999 + b/(v29+10.5);
+v37 = v36*0.999 + b/(v30+11.5);
+v38 = v37*0.999 + b/(v31+12.5);
+v39 = v38*0.999 + b/(v32+0.5);
+v40 = v39*0.999 + b/(v33+1.5);
+v41 = v40*0.999 + b/(v34+2.5);
+v42 = v41*0.999 + b/(v35+3.5);
+v43 = v42*0.999 + b/(v36+4.5);
+v44 = v43*0.999 + b/(v37+5.5);
+v45 = v44*0.999 + b/(v38+6.5);
+v46 = v45*0.999 + b/(v39+7.5);
+v47 = v46*0.999 + b/(v40+8.5);
+v48 = v47*0.999 + b/(v41+9.5);
+v49 = v48*0.999 + b/(v42+10.5);
+v50 = v49*0.999 + b/(v43+11.5);
+v51 = v50*0.999 + b/(v44+12.5);
+v52 = v51*0.999 + b/(v45+0.5);
+v53 = v52*0.999 + b/(v46+1.5);
+v54 = v53*0.999 + b/(v47+2.5);
+v55 = v54*0.999 + b/(v48+3.5);
+v56 = v55*0.999 + b/(v49+4.5);
+v57 = v56*0.999 + b/(v50+5.5);
+v58 = v57*0.999 + b/(v51+6.5);
+v59 = v58*0.999 + b/(v52+7.5);
+v60 = v59*0.999 + b/(v53+8.5);
+v61 = v60*0.999 + b/(v54+9.5);
+v62 = v61*0.999 + b/(v55+10.5);
+v63 = v62*0.999 + b/(v56+11.5);
+v64 = v63*0.999 + b/(v57+12.5);
+v65 = v64*0.999 + b/(v58+0.5);
+v66 = v65*0.999 + b/(v59+1.5);
+v67 = v66*0.999 + b/(v60+2.5);
+v68 = v67*0.999 + b/(v61+3.5);
+v69 = v68*0.999 + b/(v62+4.5);
+v70 = v69*0.999 + b/(v63+5.5);
+v71 = v70*0.999 + b/(v64+6.5);
+v72 = v71*0.999 + b/(v65+7.5);
+v73 = v72*0.999 + b/(v66+8.5);
+v74 = v73*0.999 + b/(v67+9.5);
+v75 = v74*0.999 + b/(v68+10.5);
+v76 = v75*0.999 + b/(v69+11.5);
+v77 = v76*0.999 + b/(v70+12.5);
+v78 = v77*0.999 + b/(v71+0.5);
+v79 = v78*0.999 + b/(v72+1.5);
+v80 = v79*0.999 + b/(v73+2.5);
+v81 = v80*0.999 + b/(v74+3.5);
+v82 = v81*0.999 + b/(v75+4.5);
+v83 = v82*0.999 + b/(v76+5.5);
+v84 = v83*0.999 + b/(v77+6.5);
+v85 = v84*0.999 + b/(v78+7.5);
+v86 = v85*0.999 + b/(v79+8.5);
+v87 = v86*0.999 + b/(v80+9.5);
+v88 = v87*0.999 + b/(v81+10.5);
+v89 = v88*0.999 + b/(v82+11.5);
+v90 = v89*0.999 + b/(v83+12.5);
+v91 = v90*0.999 + b/(v84+0.5);
+v92 = v91*0.999 + b/(v85+1.5);
+v93 = v92*0.999 + b/(v86+2.5);
+v94 = v93*0.999 + b/(v87+3.5);
+v95 = v94*0.999 + b/(v88+4.5);
+v96 = v95*0.999 + b/(v89+5.5);
+v97 = v96*0.999 + b/(v90+6.5);
+v98 = v97*0.999 + b/(v91+7.5);
+v99 = v98*0.999 + b/(v92+8.5);
+v100 = v99*0.999 + b/(v93+9.5);
+v101 = v100*0.999 + b/(v94+10.5);
+v102 = v101*0.999 + b/(v95+11.5);
+v103 = v102*0.999 + b/(v96+12.5);
+v104 = v103*0.999 + b/(v97+0.5);
+v105 = v104*0.999 + b/(v98+1.5);
+v106 = v105*0.999 + b/(v99+2.5);
+v107 = v106*0.999 + b/(v100+3.5);
+v108 = v107*0.999 + b/(v101+4.5);
+v109 = v108*0.999 + b/(v102+5.5);
+v110 = v109*0.999 + b/(v103+6.5);
+v111 = v110*0.999 + b/(v104+7.5);
+v112 = v111*0.999 + b/(v105+8.5);
+v113 = v112*0.999 + b/(v106+9.5);
+v114 = v113*0.999 + b/(v107+10.5);
+v115 = v114*0.999 + b/(v108+11.5);
+v116 = v115*0.999 + b/(v109+12.5);
+v117 = v116*0.999 + b/(v110+0.5);
+v118 = v117*0.999 + b/(v111+1.5);
+v119 = v118*0.999 + b/(v112+2.5);
+v120 = v119*0.999 + b/(v113+3.5);
+v121 = v120*0.999 + b/(v114+4.5);
+v122 = v121*0.999 + b/(v115+5.5);
+v123 = v122*0.999 + b/(v116+6.5);
+v124 = v123*0.999 + b/(v117+7.5);
+v125 = v124*0.999 + b/(v118+8.5);
+v126 = v125*0.999 + b/(v119+9.5);
+v127 = v126*0.999 + b/(v120+10.5);
+v128 = v127*0.999 + b/(v121+11.5);
+v129 = v128*0.999 + b/(v122+12.5);
+v130 = v129*0.999 + b/(v123+0.5);
+v131 = v130*0.999 + b/(v124+1.5);
+v132 = v131*0.999 + b/(v125+2.5);
+v133 = v132*0.999 + b/(v126+3.5);
+v134 = v133*0.999 + b/(v127+4.5);
+v135 = v134*0.999 + b/(v128+5.5);
+v136 = v135*0.999 + b/(v129+6.5);
+v137 = v136*0.999 + b/(v130+7.5);
+v138 = v137*0.999 + b/(v131+8.5);
+v139 = v138*0.999 + b/(v132+9.5);
+v140 = v139*0.999 + b/(v133+10.5);
+v141 = v140*0.999 + b/(v134+11.5);
+v142 = v141*0.999 + b/(v135+12.5);
+v143 = v142*0.999 + b/(v136+0.5);
+v144 = v143*0.999 + b/(v137+1.5);
+v145 = v144*0.999 + b/(v138+2.5);
+v146 = v145*0.999 + b/(v139+3.5);
+v147 = v146*0.999 + b/(v140+4.5);
+v148 = v147*0.999 + b/(v141+5.5);
+v149 = v148*0.999 + b/(v142+6.5);
+v150 = v149*0.999 + b/(v143+7.5);
+v151 = v150*0.999 + b/(v144+8.5);
+v152 = v151*0.999 + b/(v145+9.5);
+v153 = v152*0.999 + b/(v146+10.5);
+v154 = v153*0.999 + b/(v147+11.5);
+v155 = v154*0.999 + b/(v148+12.5);
+v156 = v155*0.999 + b/(v149+0.5);
+v157 = v156*0.999 + b/(v150+1.5);
+v158 = v157*0.999 + b/(v151+2.5);
+v159 = v158*0.999 + b/(v152+3.5);
+v160 = v159*0.999 + b/(v153+4.5);
+v161 = v160*0.999 + b/(v154+5.5);
+v162 = v161*0.999 + b/(v155+6.5);
+v163 = v162*0.999 + b/(v156+7.5);
+v164 = v163*0.999 + b/(v157+8.5);
+v165 = v164*0.999 + b/(v158+9.5);
+v166 = v165*0.999 + b/(v159+10.5);
+v167 = v166*0.999 + b/(v160+11.5);
+v168 = v167*0.999 + b/(v161+12.5);
+v169 = v168*0.999 + b/(v162+0.5);
+v170 = v169*0.999 + b/(v163+1.5);
+v171 = v170*0.999 + b/(v164+2.5);
+v172 = v171*0.999 + b/(v165+3.5);
+v173 = v172*0.999 + b/(v166+4.5);
+v174 = v173*0.999 + b/(v167+5.5);
+v175 = v174*0.999 + b/(v168+6.5);
+v176 = v175*0.999 + b/(v169+7.5);
+v177 = v176*0.999 + b/(v170+8.5);
+v178 = v177*0.999 + b/(v171+9.5);
+v179 = v178*0.999 + b/(v172+10.5);
+v180 = v179*0.999 + b/(v173+11.5);
+v181 = v180*0.999 + b/(v174+12.5);
+v182 = v181*0.999 + b/(v175+0.5);
+v183 = v182*0.999 + b/(v176+1.5);
+v184 = v183*0.999 + b/(v177+2.5);
+v185 = v184*0.999 + b/(v178+3.5);
+v186 = v185*0.999 + b/(v179+4.5);
+v187 = v186*0.999 + b/(v180+5.5);
+v188 = v187*0.999 + b/(v181+6.5);
+v189 = v188*0.999 + b/(v182+7.5);
+v190 = v189*0.999 + b/(v183+8.5);
+v191 = v190*0.999 + b/(v184+9.5);
+v192 = v191*0.999 + b/(v185+10.5);
+v193 = v192*0.999 + b/(v186+11.5);
+v194 = v193*0.999 + b/(v187+12.5);
+v195 = v194*0.999 + b/(v188+0.5);
+v196 = v195*0.999 + b/(v189+1.5);
+v197 = v196*0.999 + b/(v190+2.5);
+v198 = v197*0.999 + b/(v191+3.5);
+v199 = v198*0.999 + b/(v192+4.5);
+v200 = v199*0.999 + b/(v193+5.5);
+v201 = v200*0.999 + b/(v194+6.5);
+v202 = v201*0.999 + b/(v195+7.5);
+v203 = v202*0.999 + b/(v196+8.5);
+v204 = v203*0.999 + b/(v197+9.5);
+v205 = v204*0.999 + b/(v198+10.5);
+v206 = v205*0.999 + b/(v199+11.5);
+v207 = v206*0.999 + b/(v200+12.5);
+v208 = v207*0.999 + b/(v201+0.5);
+v209 = v208*0.999 + b/(v202+1.5);
+v210 = v209*0.999 + b/(v203+2.5);
+v211 = v210*0.999 + b/(v204+3.5);
+v212 = v211*0.999 + b/(v205+4.5);
+v213 = v212*0.999 + b/(v206+5.5);
+v214 = v213*0.999 + b/(v207+6.5);
+v215 = v214*0.999 + b/(v208+7.5);
+v216 = v215*0.999 + b/(v209+8.5);
+v217 = v216*0.999 + b/(v210+9.5);
+v218 = v217*0.999 + b/(v211+10.5);
+v219 = v218*0.999 + b/(v212+11.5);
+v220 = v219*0.999 + b/(v213+12.5);
+v221 = v220*0.999 + b/(v214+0.5);
+v222 = v221*0.999 + b/(v215+1.5);
+v223 = v222*0.999 + b/(v216+2.5);
+v224 = v223*0.999 + b/(v217+3.5);
+v225 = v224*0.999 + b/(v218+4.5);
+v226 = v225*0.999 + b/(v219+5.5);
+v227 = v226*0.999 + b/(v220+6.5);
+v228 = v227*0.999 + b/(v221+7.5);
+v229 = v228*0.999 + b/(v222+8.5);
+v230 = v229*0.999 + b/(v223+9.5);
+v231 = v230*0.999 + b/(v224+10.5);
+v232 = v231*0.999 + b/(v225+11.5);
+v233 = v232*0.999 + b/(v226+12.5);
+v234 = v233*0.999 + b/(v227+0.5);
+v235 = v234*0.999 + b/(v228+1.5);
+v236 = v235*0.999 + b/(v229+2.5);
+v237 = v236*0.999 + b/(v230+3.5);
+v238 = v237*0.999 + b/(v231+4.5);
+v239 = v238*0.999 + b/(v232+5.5);
+v240 = v239*0.999 + b/(v233+6.5);
+v241 = v240*0.999 + b/(v234+7.5);
+v242 = v241*0.999 + b/(v235+8.5);
+v243 = v242*0.999 + b/(v236+9.5);
+v244 = v243*0.999 + b/(v237+10.5);
+v245 = v244*0.999 + b/(v238+11.5);
+v246 = v245*0.999 + b/(v239+12.5);
+v247 = v246*0.999 + b/(v240+0.5);
+v248 = v247*0.999 + b/(v241+1.5);
+v249 = v248*0.999 + b/(v242+2.5);
+v250 = v249*0.999 + b/(v243+3.5);
+v251 = v250*0.999 + b/(v244+4.5);
+v252 = v251*0.999 + b/(v245+5.5);
+v253 = v252*0.999 + b/(v246+6.5);
+v254 = v253*0.999 + b/(v247+7.5);
+v255 = v254*0.999 + b/(v248+8.5);
+v256 = v255*0.999 + b/(v249+9.5);
+v257 = v256*0.999 + b/(v250+10.5);
+v258 = v257*0.999 + b/(v251+11.5);
+v259 = v258*0.999 + b/(v252+12.5);
+v260 = v259*0.999 + b/(v253+0.5);
+v261 = v260*0.999 + b/(v254+1.5);
+v262 = v261*0.999 + b/(v255+2.5);
+v263 = v262*0.999 + b/(v256+3.5);
+v264 = v263*0.999 + b/(v257+4.5);
+v265 = v264*0.999 + b/(v258+5.5);
+v266 = v265*0.999 + b/(v259+6.5);
+v267 = v266*0.999 + b/(v260+7.5);
+v268 = v267*0.999 + b/(v261+8.5);
+v269 = v268*0.999 + b/(v262+9.5);
+v270 = v269*0.999 + b/(v263+10.5);
+v271 = v270*0.999 + b/(v264+11.5);
+v272 = v271*0.999 + b/(v265+12.5);
+v273 = v272*0.999 + b/(v266+0.5);
+v274 = v273*0.999 + b/(v267+1.5);
+v275 = v274*0.999 + b/(v268+2.5);
+v276 = v275*0.999 + b/(v269+3.5);
+v277 = v276*0.999 + b/(v270+4.5);
+v278 = v277*0.999 + b/(v271+5.5);
+v279 = v278*0.999 + b/(v272+6.5);
+v280 = v279*0.999 + b/(v273+7.5);
+v281 = v280*0.999 + b/(v274+8.5);
+v282 = v281*0.999 + b/(v275+9.5);
+v283 = v282*0.999 + b/(v276+10.5);
+v284 = v283*0.999 + b/(v277+11.5);
+v285 = v284*0.999 + b/(v278+12.5);
+v286 = v285*0.999 + b/(v279+0.5);
+v287 = v286*0.999 + b/(v280+1.5);
+v288 = v287*0.999 + b/(v281+2.5);
+v289 = v288*0.999 + b/(v282+3.5);
+v290 = v289*0.999 + b/(v283+4.5);
+v291 = v290*0.999 + b/(v284+5.5);
+v292 = v291*0.999 + b/(v285+6.5);
+v293 = v292*0.999 + b/(v286+7.5);
+v294 = v293*0.999 + b/(v287+8.5);
+v295 = v294*0.999 + b/(v288+9.5);
+v296 = v295*0.999 + b/(v289+10.5);
+v297 = v296*0.999 + b/(v290+11.5);
+v298 = v297*0.999 + b/(v291+12.5);
+v299 = v298*0.999 + b/(v292+0.5);
+v300 = v299*0.999 + b/(v293+1.5);
+v301 = v300*0.999 + b/(v294+2.5);
+v302 = v301*0.999 + b/(v295+3.5);
+v303 = v302*0.999 + b/(v296+4.5);
+v304 = v303*0.999 + b/(v297+5.5);
+v305 = v304*0.999 + b/(v298+6.5);
+v306 = v305*0.999 + b/(v299+7.5);
+v307 = v306*0.999 + b/(v300+8.5);
+v308 = v307*0.999 + b/(v301+9.5);
+v309 = v308*0.999 + b/(v302+10.5);
+v310 = v309*0.999 + b/(v303+11.5);
+v311 = v310*0.999 + b/(v304+12.5);
+v312 = v311*0.999 + b/(v305+0.5);
+v313 = v312*0.999 + b/(v306+1.5);
+v314 = v313*0.999 + b/(v307+2.5);
+v315 = v314*0.999 + b/(v308+3.5);
+v316 = v315*0.999 + b/(v309+4.5);
+v317 = v316*0.999 + b/(v310+5.5);
+v318 = v317*0.999 + b/(v311+6.5);
+v319 = v318*0.999 + b/(v312+7.5);
+v320 = v319*0.999 + b/(v313+8.5);
+v321 = v320*0.999 + b/(v314+9.5);
+v322 = v321*0.999 + b/(v315+10.5);
+v323 = v322*0.999 + b/(v316+11.5);
+v324 = v323*0.999 + b/(v317+12.5);
+v325 = v324*0.999 + b/(v318+0.5);
+v326 = v325*0.999 + b/(v319+1.5);
+v327 = v326*0.999 + b/(v320+2.5);
+v328 = v327*0.999 + b/(v321+3.5);
+v329 = v328*0.999 + b/(v322+4.5);
+v330 = v329*0.999 + b/(v323+5.5);
+v331 = v330*0.999 + b/(v324+6.5);
+v332 = v331*0.999 + b/(v325+7.5);
+v333 = v332*0.999 + b/(v326+8.5);
+v334 = v333*0.999 + b/(v327+9.5);
+v335 = v334*0.999 + b/(v328+10.5);
+v336 = v335*0.999 + b/(v329+11.5);
+v337 = v336*0.999 + b/(v330+12.5);
+v338 = v337*0.999 + b/(v331+0.5);
+v339 = v338*0.999 + b/(v332+1.5);
+v340 = v339*0.999 + b/(v333+2.5);
+v341 = v340*0.999 + b/(v334+3.5);
+v342 = v341*0.999 + b/(v335+4.5);
+v343 = v342*0.999 + b/(v336+5.5);
+v344 = v343*0.999 + b/(v337+6.5);
+v345 = v344*0.999 + b/(v338+7.5);
+v346 = v345*0.999 + b/(v339+8.5);
+v347 = v346*0.999 + b/(v340+9.5);
+v348 = v347*0.999 + b/(v341+10.5);
+v349 = v348*0.999 + b/(v342+11.5);
+v350 = v349*0.999 + b/(v343+12.5);
+v351 = v350*0.999 + b/(v344+0.5);
+v352 = v351*0.999 + b/(v345+1.5);
+v353 = v352*0.999 + b/(v346+2.5);
+v354 = v353*0.999 + b/(v347+3.5);
+v355 = v354*0.999 + b/(v348+4.5);
+v356 = v355*0.999 + b/(v349+5.5);
+v357 = v356*0.999 + b/(v350+6.5);
+v358 = v357*0.999 + b/(v351+7.5);
+v359 = v358*0.999 + b/(v352+8.5);
+v360 = v359*0.999 + b/(v353+9.5);
+v361 = v360*0.999 + b/(v354+10.5);
+v362 = v361*0.999 + b/(v355+11.5);
+v363 = v362*0.999 + b/(v356+12.5);
+v364 = v363*0.999 + b/(v357+0.5);
+v365 = v364*0.999 + b/(v358+1.5);
+v366 = v365*0.999 + b/(v359+2.5);
+v367 = v366*0.999 + b/(v360+3.5);
+v368 = v367*0.999 + b/(v361+4.5);
+v369 = v368*0.999 + b/(v362+5.5);
+v370 = v369*0.999 + b/(v363+6.5);
+v371 = v370*0.999 + b/(v364+7.5);
+v372 = v371*0.999 + b/(v365+8.5);
+v373 = v372*0.999 + b/(v366+9.5);
+v374 = v373*0.999 + b/(v367+10.5);
+v375 = v374*0.999 + b/(v368+11.5);
+v376 = v375*0.999 + b/(v369+12.5);
+v377 = v376*0.999 + b/(v370+0.5);
+v378 = v377*0.999 + b/(v371+1.5);
+v379 = v378*0.999 + b/(v372+2.5);
+v380 = v379*0.999 + b/(v373+3.5);
+v381 = v380*0.999 + b/(v374+4.5);
+v382 = v381*0.999 + b/(v375+5.5);
+v383 = v382*0.999 + b/(v376+6.5);
+v384 = v383*0.999 + b/(v377+7.5);
+v385 = v384*0.999 + b/(v378+8.5);
+v386 = v385*0.999 + b/(v379+9.5);
+v387 = v386*0.999 + b/(v380+10.5);
+v388 = v387*0.999 + b/(v381+11.5);
+v389 = v388*0.999 + b/(v382+12.5);
+v390 = v389*0.999 + b/(v383+0.5);
+v391 = v390*0.999 + b/(v384+1.5);
+v392 = v391*0.999 + b/(v385+2.5);
+v393 = v392*0.999 + b/(v386+3.5);
+v394 = v393*0.999 + b/(v387+4.5);
+v395 = v394*0.999 + b/(v388+5.5);
+v396 = v395*0.999 + b/(v389+6.5);
+v397 = v396*0.999 + b/(v390+7.5);
+v398 = v397*0.999 + b/(v391+8.5);
+v399 = v398*0.999 + b/(v392+9.5);
+v400 = v399*0.999 + b/(v393+10.5);
+v401 = v400*0.999 + b/(v394+11.5);
+v402 = v401*0.999 + b/(v395+12.5);
+v403 = v402*0.999 + b/(v396+0.5);
+v404 = v403*0.999 + b/(v397+1.5);
+v405 = v404*0.999 + b/(v398+2.5);
+v406 = v405*0.999 + b/(v399+3.5);
+v407 = v406*0.999 + b/(v400+4.5);
+v408 = v407*0.999 + b/(v401+5.5);
+v409 = v408*0.999 + b/(v402+6.5);
+v410 = v409*0.999 + b/(v403+7.5);
+v411 = v410*0.999 + b/(v404+8.5);
+v412 = v411*0.999 + b/(v405+9.5);
+v413 = v412*0.999 + b/(v406+10.5);
+v414 = v413*0.999 + b/(v407+11.5);
+v415 = v414*0.999 + b/(v408+12.5);
+v416 = v415*0.999 + b/(v409+0.5);
+v417 = v416*0.999 + b/(v410+1.5);
+v418 = v417*0.999 + b/(v411+2.5);
+v419 = v418*0.999 + b/(v412+3.5);
+v420 = v419*0.999 + b/(v413+4.5);
+v421 = v420*0.999 + b/(v414+5.5);
+v422 = v421*0.999 + b/(v415+6.5);
+v423 = v422*0.999 + b/(v416+7.5);
+v424 = v423*0.999 + b/(v417+8.5);
+v425 = v424*0.999 + b/(v418+9.5);
+v426 = v425*0.999 + b/(v419+10.5);
+v427 = v426*0.999 + b/(v420+11.5);
+v428 = v427*0.999 + b/(v421+12.5);
+v429 = v428*0.999 + b/(v422+0.5);
+v430 = v429*0.999 + b/(v423+1.5);
+v431 = v430*0.999 + b/(v424+2.5);
+v432 = v431*0.999 + b/(v425+3.5);
+v433 = v432*0.999 + b/(v426+4.5);
+v434 = v433*0.999 + b/(v427+5.5);
+v435 = v434*0.999 + b/(v428+6.5);
+v436 = v435*0.999 + b/(v429+7.5);
+v437 = v436*0.999 + b/(v430+8.5);
+v438 = v437*0.999 + b/(v431+9.5);
+v439 = v438*0.999 + b/(v432+10.5);
+v440 = v439*0.999 + b/(v433+11.5);
+v441 = v440*0.999 + b/(v434+12.5);
+v442 = v441*0.999 + b/(v435+0.5);
+v443 = v442*0.999 + b/(v436+1.5);
+v444 = v443*0.999 + b/(v437+2.5);
+v445 = v444*0.999 + b/(v438+3.5);
+v446 = v445*0.999 + b/(v439+4.5);
+v447 = v446*0.999 + b/(v440+5.5);
+v448 = v447*0.999 + b/(v441+6.5);
+v449 = v448*0.999 + b/(v442+7.5);
+v450 = v449*0.999 + b/(v443+8.5);
+v451 = v450*0.999 + b/(v444+9.5);
+v452 = v451*0.999 + b/(v445+10.5);
+v453 = v452*0.999 + b/(v446+11.5);
+v454 = v453*0.999 + b/(v447+12.5);
+v455 = v454*0.999 + b/(v448+0.5);
+v456 = v455*0.999 + b/(v449+1.5);
+v457 = v456*0.999 + b/(v450+2.5);
+v458 = v457*0.999 + b/(v451+3.5);
+v459 = v458*0.999 + b/(v452+4.5);
+v460 = v459*0.999 + b/(v453+5.5);
+v461 = v460*0.999 + b/(v454+6.5);
+v462 = v461*0.999 + b/(v455+7.5);
+v463 = v462*0.999 + b/(v456+8.5);
+v464 = v463*0.999 + b/(v457+9.5);
+v465 = v464*0.999 + b/(v458+10.5);
+v466 = v465*0.999 + b/(v459+11.5);
+v467 = v466*0.999 + b/(v460+12.5);
+v468 = v467*0.999 + b/(v461+0.5);
+v469 = v468*0.999 + b/(v462+1.5);
+v470 = v469*0.999 + b/(v463+2.5);
+v471 = v470*0.999 + b/(v464+3.5);
+v472 = v471*0.999 + b/(v465+4.5);
+v473 = v472*0.999 + b/(v466+5.5);
+v474 = v473*0.999 + b/(v467+6.5);
+v475 = v474*0.999 + b/(v468+7.5);
+v476 = v475*0.999 + b/(v469+8.5);
+v477 = v476*0.999 + b/(v470+9.5);
+v478 = v477*0.999 + b/(v471+10.5);
+v479 = v478*0.999 + b/(v472+11.5);
+v480 = v479*0.999 + b/(v473+12.5);
+v481 = v480*0.999 + b/(v474+0.5);
+v482 = v481*0.999 + b/(v475+1.5);
+v483 = v482*0.999 + b/(v476+2.5);
+v484 = v483*0.999 + b/(v477+3.5);
+v485 = v484*0.999 + b/(v478+4.5);
+v486 = v485*0.999 + b/(v479+5.5);
+v487 = v486*0.999 + b/(v480+6.5);
+v488 = v487*0.999 + b/(v481+7.5);
+v489 = v488*0.999 + b/(v482+8.5);
+v490 = v489*0.999 + b/(v483+9.5);
+v491 = v490*0.999 + b/(v484+10.5);
+v492 = v491*0.999 + b/(v485+11.5);
+v493 = v492*0.999 + b/(v486+12.5);
+v494 = v493*0.999 + b/(v487+0.5);
+v495 = v494*0.999 + b/(v488+1.5);
+v496 = v495*0.999 + b/(v489+2.5);
+v497 = v496*0.999 + b/(v490+3.5);
+v498 = v497*0.999 + b/(v491+4.5);
+v499 = v498*0.999 + b/(v492+5.5);
+v500 = v499*0.999 + b/(v493+6.5);
+v501 = v500*0.999 + b/(v494+7.5);
+v502 = v501*0.999 + b/(v495+8.5);
+v503 = v502*0.999 + b/(v496+9.5);
+v504 = v503*0.999 + b/(v497+10.5);
+v505 = v504*0.999 + b/(v498+11.5);
+v506 = v505*0.999 + b/(v499+12.5);
+v507 = v506*0.999 + b/(v500+0.5);
+v508 = v507*0.999 + b/(v501+1.5);
+v509 = v508*0.999 + b/(v502+2.5);
+v510 = v509*0.999 + b/(v503+3.5);
+v511 = v510*0.999 + b/(v504+4.5);
+v512 = v511*0.999 + b/(v505+5.5);
+v513 = v512*0.999 + b/(v506+6.5);
+v514 = v513*0.999 + b/(v507+7.5);
+v515 = v514*0.999 + b/(v508+8.5);
+v516 = v515*0.999 + b/(v509+9.5);
+v517 = v516*0.999 + b/(v510+10.5);
+v518 = v517*0.999 + b/(v511+11.5);
+v519 = v518*0.999 + b/(v512+12.5);
+v520 = v519*0.999 + b/(v513+0.5);
+v521 = v520*0.999 + b/(v514+1.5);
+v522 = v521*0.999 + b/(v515+2.5);
+v523 = v522*0.999 + b/(v516+3.5);
+v524 = v523*0.999 + b/(v517+4.5);
+v525 = v524*0.999 + b/(v518+5.5);
+v526 = v525*0.999 + b/(v519+6.5);
+v527 = v526*0.999 + b/(v520+7.5);
+v528 = v527*0.999 + b/(v521+8.5);
+v529 = v528*0.999 + b/(v522+9.5);
+v530 = v529*0.999 + b/(v523+10.5);
+v531 = v530*0.999 + b/(v524+11.5);
+v532 = v531*0.999 + b/(v525+12.5);
+v533 = v532*0.999 + b/(v526+0.5);
+v534 = v533*0.999 + b/(v527+1.5);
+v535 = v534*0.999 + b/(v528+2.5);
+v536 = v535*0.999 + b/(v529+3.5);
+v537 = v536*0.999 + b/(v530+4.5);
+v538 = v537*0.999 + b/(v531+5.5);
+v539 = v538*0.999 + b/(v532+6.5);
+v540 = v539*0.999 + b/(v533+7.5);
+v541 = v540*0.999 + b/(v534+8.5);
+v542 = v541*0.999 + b/(v535+9.5);
+v543 = v542*0.999 + b/(v536+10.5);
+v544 = v543*0.999 + b/(v537+11.5);
+v545 = v544*0.999 + b/(v538+12.5);
+v546 = v545*0.999 + b/(v539+0.5);
+v547 = v546*0.999 + b/(v540+1.5);
+v548 = v547*0.999 + b/(v541+2.5);
+v549 = v548*0.999 + b/(v542+3.5);
+v550 = v549*0.999 + b/(v543+4.5);
+v551 = v550*0.999 + b/(v544+5.5);
+v552 = v551*0.999 + b/(v545+6.5);
+v553 = v552*0.999 + b/(v546+7.5);
+v554 = v553*0.999 + b/(v547+8.5);
+v555 = v554*0.999 + b/(v548+9.5);
+v556 = v555*0.999 + b/(v549+10.5);
+v557 = v556*0.999 + b/(v550+11.5);
+v558 = v557*0.999 + b/(v551+12.5);
+v559 = v558*0.999 + b/(v552+0.5);
+v560 = v559*0.999 + b/(v553+1.5);
+v561 = v560*0.999 + b/(v554+2.5);
+v562 = v561*0.999 + b/(v555+3.5);
+v563 = v562*0.999 + b/(v556+4.5);
+v564 = v563*0.999 + b/(v557+5.5);
+v565 = v564*0.999 + b/(v558+6.5);
+v566 = v565*0.999 + b/(v559+7.5);
+v567 = v566*0.999 + b/(v560+8.5);
+v568 = v567*0.999 + b/(v561+9.5);
+v569 = v568*0.999 + b/(v562+10.5);
+v570 = v569*0.999 + b/(v563+11.5);
+v571 = v570*0.999 + b/(v564+12.5);
+v572 = v571*0.999 + b/(v565+0.5);
+v573 = v572*0.999 + b/(v566+1.5);
+v574 = v573*0.999 + b/(v567+2.5);
+v575 = v574*0.999 + b/(v568+3.5);
+v576 = v575*0.999 + b/(v569+4.5);
+v577 = v576*0.999 + b/(v570+5.5);
+v578 = v577*0.999 + b/(v571+6.5);
+v579 = v578*0.999 + b/(v572+7.5);
+v580 = v579*0.999 + b/(v573+8.5);
+v581 = v580*0.999 + b/(v574+9.5);
+v582 = v581*0.999 + b/(v575+10.5);
+v583 = v582*0.999 + b/(v576+11.5);
+v584 = v583*0.999 + b/(v577+12.5);
+v585 = v584*0.999 + b/(v578+0.5);
+v586 = v585*0.999 + b/(v579+1.5);
+v587 = v586*0.999 + b/(v580+2.5);
+v588 = v587*0.999 + b/(v581+3.5);
+v589 = v588*0.999 + b/(v582+4.5);
+v590 = v589*0.999 + b/(v583+5.5);
+v591 = v590*0.999 + b/(v584+6.5);
+v592 = v591*0.999 + b/(v585+7.5);
+v593 = v592*0.999 + b/(v586+8.5);
+v594 = v593*0.999 + b/(v587+9.5);
+v595 = v594*0.999 + b/(v588+10.5);
+v596 = v595*0.999 + b/(v589+11.5);
+v597 = v596*0.999 + b/(v590+12.5);
+v598 = v597*0.999 + b/(v591+0.5);
+v599 = v598*0.999 + b/(v592+1.5);
+v600 = v599*0.999 + b/(v593+2.5);
+v601 = v600*0.999 + b/(v594+3.5);
+v602 = v601*0.999 + b/(v595+4.5);
+v603 = v602*0.999 + b/(v596+5.5);
+v604 = v603*0.999 + b/(v597+6.5);
+v605 = v604*0.999 + b/(v598+7.5);
+v606 = v605*0.999 + b/(v599+8.5);
+v607 = v606*0.999 + b/(v600+9.5);
+v608 = v607*0.999 + b/(v601+10.5);
+v609 = v608*0.999 + b/(v602+11.5);
+v610 = v609*0.999 + b/(v603+12.5);
+v611 = v610*0.999 + b/(v604+0.5);
+v612 = v611*0.999 + b/(v605+1.5);
+v613 = v612*0.999 + b/(v606+2.5);
+v614 = v613*0.999 + b/(v607+3.5);
+v615 = v614*0.999 + b/(v608+4.5);
+v616 = v615*0.999 + b/(v609+5.5);
+v617 = v616*0.999 + b/(v610+6.5);
+v618 = v617*0.999 + b/(v611+7.5);
+v619 = v618*0.999 + b/(v612+8.5);
+v620 = v619*0.999 + b/(v613+9.5);
+v621 = v620*0.999 + b/(v614+10.5);
+v622 = v621*0.999 + b/(v615+11.5);
+v623 = v622*0.999 + b/(v616+12.5);
+v624 = v623*0.999 + b/(v617+0.5);
+v625 = v624*0.999 + b/(v618+1.5);
+v626 = v625*0.999 + b/(v619+2.5);
+v627 = v626*0.999 + b/(v620+3.5);
+v628 = v627*0.999 + b/(v621+4.5);
+v629 = v628*0.999 + b/(v622+5.5);
+v630 = v629*0.999 + b/(v623+6.5);
+v631 = v630*0.999 + b/(v624+7.5);
+v632 = v631*0.999 + b/(v625+8.5);
+v633 = v632*0.999 + b/(v626+9.5);
+v634 = v633*0.999 + b/(v627+10.5);
+v635 = v634*0.999 + b/(v628+11.5);
+v636 = v635*0.999 + b/(v629+12.5);
+v637 = v636*0.999 + b/(v630+0.5);
+v638 = v637*0.999 + b/(v631+1.5);
+v639 = v638*0.999 + b/(v632+2.5);
+v640 = v639*0.999 + b/(v633+3.5);
+v641 = v640*0.999 + b/(v634+4.5);
+v642 = v641*0.999 + b/(v635+5.5);
+v643 = v642*0.999 + b/(v636+6.5);
+v644 = v643*0.999 + b/(v637+7.5);
+v645 = v644*0.999 + b/(v638+8.5);
+v646 = v645*0.999 + b/(v639+9.5);
+v647 = v646*0.999 + b/(v640+10.5);
+v648 = v647*0.999 + b/(v641+11.5);
+v649 = v648*0.999 + b/(v642+12.5);
+v650 = v649*0.999 + b/(v643+0.5);
+v651 = v650*0.999 + b/(v644+1.5);
+v652 = v651*0.999 + b/(v645+2.5);
+v653 = v652*0.999 + b/(v646+3.5);
+v654 = v653*0.999 + b/(v647+4.5);
+v655 = v654*0.999 + b/(v648+5.5);
+v656 = v655*0.999 + b/(v649+6.5);
+v657 = v656*0.999 + b/(v650+7.5);
+v658 = v657*0.999 + b/(v651+8.5);
+v659 = v658*0.999 + b/(v652+9.5);
+v660 = v659*0.999 + b/(v653+10.5);
+v661 = v660*0.999 + b/(v654+11.5);
+v662 = v661*0.999 + b/(v655+12.5);
+v663 = v662*0.999 + b/(v656+0.5);
+v664 = v663*0.999 + b/(v657+1.5);
+v665 = v664*0.999 + b/(v658+2.5);
+v666 = v665*0.999 + b/(v659+3.5);
+v667 = v666*0.999 + b/(v660+4.5);
+v668 = v667*0.999 + b/(v661+5.5);
+v669 = v668*0.999 + b/(v662+6.5);
+v670 = v669*0.999 + b/(v663+7.5);
+v671 = v670*0.999 + b/(v664+8.5);
+v672 = v671*0.999 + b/(v665+9.5);
+v673 = v672*0.999 + b/(v666+10.5);
+v674 = v673*0.999 + b/(v667+11.5);
+v675 = v674*0.999 + b/(v668+12.5);
+v676 = v675*0.999 + b/(v669+0.5);
+v677 = v676*0.999 + b/(v670+1.5);
+v678 = v677*0.999 + b/(v671+2.5);
+v679 = v678*0.999 + b/(v672+3.5);
+v680 = v679*0.999 + b/(v673+4.5);
+v681 = v680*0.999 + b/(v674+5.5);
+v682 = v681*0.999 + b/(v675+6.5);
+v683 = v682*0.999 + b/(v676+7.5);
+v684 = v683*0.999 + b/(v677+8.5);
+v685 = v684*0.999 + b/(v678+9.5);
+v686 = v685*0.999 + b/(v679+10.5);
+v687 = v686*0.999 + b/(v680+11.5);
+v688 = v687*0.999 + b/(v681+12.5);
+v689 = v688*0.999 + b/(v682+0.5);
+v690 = v689*0.999 + b/(v683+1.5);
+v691 = v690*0.999 + b/(v684+2.5);
+v692 = v691*0.999 + b/(v685+3.5);
+v693 = v692*0.999 + b/(v686+4.5);
+v694 = v693*0.999 + b/(v687+5.5);
+v695 = v694*0.999 + b/(v688+6.5);
+v696 = v695*0.999 + b/(v689+7.5);
+v697 = v696*0.999 + b/(v690+8.5);
+v698 = v697*0.999 + b/(v691+9.5);
+v699 = v698*0.999 + b/(v692+10.5);
+v700 = v699*0.999 + b/(v693+11.5);
+v701 = v700*0.999 + b/(v694+12.5);
+v702 = v701*0.999 + b/(v695+0.5);
+v703 = v702*0.999 + b/(v696+1.5);
+v704 = v703*0.999 + b/(v697+2.5);
+v705 = v704*0.999 + b/(v698+3.5);
+v706 = v705*0.999 + b/(v699+4.5);
+v707 = v706*0.999 + b/(v700+5.5);
+v708 = v707*0.999 + b/(v701+6.5);
+v709 = v708*0.999 + b/(v702+7.5);
+v710 = v709*0.999 + b/(v703+8.5);
+v711 = v710*0.999 + b/(v704+9.5);
+v712 = v711*0.999 + b/(v705+10.5);
+v713 = v712*0.999 + b/(v706+11.5);
+v714 = v713*0.999 + b/(v707+12.5);
+v715 = v714*0.999 + b/(v708+0.5);
+v716 = v715*0.999 + b/(v709+1.5);
+v717 = v716*0.999 + b/(v710+2.5);
+v718 = v717*0.999 + b/(v711+3.5);
+v719 = v718*0.999 + b/(v712+4.5);
+v720 = v719*0.999 + b/(v713+5.5);
+v721 = v720*0.999 + b/(v714+6.5);
+v722 = v721*0.999 + b/(v715+7.5);
+v723 = v722*0.999 + b/(v716+8.5);
+v724 = v723*0.999 + b/(v717+9.5);
+v725 = v724*0.999 + b/(v718+10.5);
+v726 = v725*0.999 + b/(v719+11.5);
+v727 = v726*0.999 + b/(v720+12.5);
+v728 = v727*0.999 + b/(v721+0.5);
+v729 = v728*0.999 + b/(v722+1.5);
+v730 = v729*0.999 + b/(v723+2.5);
+v731 = v730*0.999 + b/(v724+3.5);
+v732 = v731*0.999 + b/(v725+4.5);
+v733 = v732*0.999 + b/(v726+5.5);
+v734 = v733*0.999 + b/(v727+6.5);
+v735 = v734*0.999 + b/(v728+7.5);
+v736 = v735*0.999 + b/(v729+8.5);
+v737 = v736*0.999 + b/(v730+9.5);
+v738 = v737*0.999 + b/(v731+10.5);
+v739 = v738*0.999 + b/(v732+11.5);
+v740 = v739*0.999 + b/(v733+12.5);
+v741 = v740*0.999 + b/(v734+0.5);
+v742 = v741*0.999 + b/(v735+1.5);
+v743 = v742*0.999 + b/(v736+2.5);
+v744 = v743*0.999 + b/(v737+3.5);
+v745 = v744*0.999 + b/(v738+4.5);
+v746 = v745*0.999 + b/(v739+5.5);
+v747 = v746*0.999 + b/(v740+6.5);
+v748 = v747*0.999 + b/(v741+7.5);
+v749 = v748*0.999 + b/(v742+8.5);
+v750 = v749*0.999 + b/(v743+9.5);
+v751 = v750*0.999 + b/(v744+10.5);
+v752 = v751*0.999 + b/(v745+11.5);
+v753 = v752*0.999 + b/(v746+12.5);
+v754 = v753*0.999 + b/(v747+0.5);
+v755 = v754*0.999 + b/(v748+1.5);
+v756 = v755*0.999 + b/(v749+2.5);
+v757 = v756*0.999 + b/(v750+3.5);
+v758 = v757*0.999 + b/(v751+4.5);
+v759 = v758*0.999 + b/(v752+5.5);
+v760 = v759*0.999 + b/(v753+6.5);
+v761 = v760*0.999 + b/(v754+7.5);
+v762 = v761*0.999 + b/(v755+8.5);
+v763 = v762*0.999 + b/(v756+9.5);
+v764 = v763*0.999 + b/(v757+10.5);
+v765 = v764*0.999 + b/(v758+11.5);
+v766 = v765*0.999 + b/(v759+12.5);
+v767 = v766*0.999 + b/(v760+0.5);
+v768 = v767*0.999 + b/(v761+1.5);
+v769 = v768*0.999 + b/(v762+2.5);
+v770 = v769*0.999 + b/(v763+3.5);
+v771 = v770*0.999 + b/(v764+4.5);
+v772 = v771*0.999 + b/(v765+5.5);
+v773 = v772*0.999 + b/(v766+6.5);
+v774 = v773*0.999 + b/(v767+7.5);
+v775 = v774*0.999 + b/(v768+8.5);
+v776 = v775*0.999 + b/(v769+9.5);
+v777 = v776*0.999 + b/(v770+10.5);
+v778 = v777*0.999 + b/(v771+11.5);
+v779 = v778*0.999 + b/(v772+12.5);
+v780 = v779*0.999 + b/(v773+0.5);
+v781 = v780*0.999 + b/(v774+1.5);
+v782 = v781*0.999 + b/(v775+2.5);
+v783 = v782*0.999 + b/(v776+3.5);
+v784 = v783*0.999 + b/(v777+4.5);
+v785 = v784*0.999 + b/(v778+5.5);
+v786 = v785*0.999 + b/(v779+6.5);
+v787 = v786*0.999 + b/(v780+7.5);
+v788 = v787*0.999 + b/(v781+8.5);
+v789 = v788*0.999 + b/(v782+9.5);
+v790 = v789*0.999 + b/(v783+10.5);
+v791 = v790*0.999 + b/(v784+11.5);
+v792 = v791*0.999 + b/(v785+12.5);
+v793 = v792*0.999 + b/(v786+0.5);
+v794 = v793*0.999 + b/(v787+1.5);
+v795 = v794*0.999 + b/(v788+2.5);
+v796 = v795*0.999 + b/(v789+3.5);
+v797 = v796*0.999 + b/(v790+4.5);
+v798 = v797*0.999 + b/(v791+5.5);
+v799 = v798*0.999 + b/(v792+6.5);
+v800 = v799*0.999 + b/(v793+7.5);
+v801 = v800*0.999 + b/(v794+8.5);
+v802 = v801*0.999 + b/(v795+9.5);
+v803 = v802*0.999 + b/(v796+10.5);
+v804 = v803*0.999 + b/(v797+11.5);
+v805 = v804*0.999 + b/(v798+12.5);
+v806 = v805*0.999 + b/(v799+0.5);
+v807 = v806*0.999 + b/(v800+1.5);
+v808 = v807*0.999 + b/(v801+2.5);
+v809 = v808*0.999 + b/(v802+3.5);
+v810 = v809*0.999 + b/(v803+4.5);
+v811 = v810*0.999 + b/(v804+5.5);
+v812 = v811*0.999 + b/(v805+6.5);
+v813 = v812*0.999 + b/(v806+7.5);
+v814 = v813*0.999 + b/(v807+8.5);
+v815 = v814*0.999 + b/(v808+9.5);
+v816 = v815*0.999 + b/(v809+10.5);
+v817 = v816*0.999 + b/(v810+11.5);
+v818 = v817*0.999 + b/(v811+12.5);
+v819 = v818*0.999 + b/(v812+0.5);
+v820 = v819*0.999 + b/(v813+1.5);
+v821 = v820*0.999 + b/(v814+2.5);
+v822 = v821*0.999 + b/(v815+3.5);
+v823 = v822*0.999 + b/(v816+4.5);
+v824 = v823*0.999 + b/(v817+5.5);
+v825 = v824*0.999 + b/(v818+6.5);
+v826 = v825*0.999 + b/(v819+7.5);
+v827 = v826*0.999 + b/(v820+8.5);
+v828 = v827*0.999 + b/(v821+9.5);
+v829 = v828*0.999 + b/(v822+10.5);
+v830 = v829*0.999 + b/(v823+11.5);
+v831 = v830*0.999 + b/(v824+12.5);
+v832 = v831*0.999 + b/(v825+0.5);
+v833 = v832*0.999 + b/(v826+1.5);
+v834 = v833*0.999 + b/(v827+2.5);
+v835 = v834*0.999 + b/(v828+3.5);
+v836 = v835*0.999 + b/(v829+4.5);
+v837 = v836*0.999 + b/(v830+5.5);
+v838 = v837*0.999 + b/(v831+6.5);
+v839 = v838*0.999 + b/(v832+7.5);
+v840 = v839*0.999 + b/(v833+8.5);
+v841 = v840*0.999 + b/(v834+9.5);
+v842 = v841*0.999 + b/(v835+10.5);
+v843 = v842*0.999 + b/(v836+11.5);
+v844 = v843*0.999 + b/(v837+12.5);
+v845 = v844*0.999 + b/(v838+0.5);
+v846 = v845*0.999 + b/(v839+1.5);
+v847 = v846*0.999 + b/(v840+2.5);
+v848 = v847*0.999 + b/(v841+3.5);
+v849 = v848*0.999 + b/(v842+4.5);
+v850 = v849*0.999 + b/(v843+5.5);
+v851 = v850*0.999 + b/(v844+6.5);
+v852 = v851*0.999 + b/(v845+7.5);
+v853 = v852*0.999 + b/(v846+8.5);
+v854 = v853*0.999 + b/(v847+9.5);
+v855 = v854*0.999 + b/(v848+10.5);
+v856 = v855*0.999 + b/(v849+11.5);
+v857 = v856*0.999 + b/(v850+12.5);
+v858 = v857*0.999 + b/(v851+0.5);
+v859 = v858*0.999 + b/(v852+1.5);
+v860 = v859*0.999 + b/(v853+2.5);
+v861 = v860*0.999 + b/(v854+3.5);
+v862 = v861*0.999 + b/(v855+4.5);
+v863 = v862*0.999 + b/(v856+5.5);
+v864 = v863*0.999 + b/(v857+6.5);
+v865 = v864*0.999 + b/(v858+7.5);
+v866 = v865*0.999 + b/(v859+8.5);
+v867 = v866*0.999 + b/(v860+9.5);
+v868 = v867*0.999 + b/(v861+10.5);
+v869 = v868*0.999 + b/(v862+11.5);
+v870 = v869*0.999 + b/(v863+12.5);
+v871 = v870*0.999 + b/(v864+0.5);
+v872 = v871*0.999 + b/(v865+1.5);
+v873 = v872*0.999 + b/(v866+2.5);
+v874 = v873*0.999 + b/(v867+3.5);
+v875 = v874*0.999 + b/(v868+4.5);
+v876 = v875*0.999 + b/(v869+5.5);
+v877 = v876*0.999 + b/(v870+6.5);
+v878 = v877*0.999 + b/(v871+7.5);
+v879 = v878*0.999 + b/(v872+8.5);
+v880 = v879*0.999 + b/(v873+9.5);
+v881 = v880*0.999 + b/(v874+10.5);
+v882 = v881*0.999 + b/(v875+11.5);
+v883 = v882*0.999 + b/(v876+12.5);
+v884 = v883*0.999 + b/(v877+0.5);
+v885 = v884*0.999 + b/(v878+1.5);
+v886 = v885*0.999 + b/(v879+2.5);
+v887 = v886*0.999 + b/(v880+3.5);
+v888 = v887*0.999 + b/(v881+4.5);
+v889 = v888*0.999 + b/(v882+5.5);
+v890 = v889*0.999 + b/(v883+6.5);
+v891 = v890*0.999 + b/(v884+7.5);
+v892 = v891*0.999 + b/(v885+8.5);
+v893 = v892*0.999 + b/(v886+9.5);
+v894 = v893*0.999 + b/(v887+10.5);
+v895 = v894*0.999 + b/(v888+11.5);
+v896 = v895*0.999 + b/(v889+12.5);
+v897 = v896*0.999 + b/(v890+0.5);
+v898 = v897*0.999 + b/(v891+1.5);
+v899 = v898*0.999 + b/(v892+2.5);
+v900 = v899*0.999 + b/(v893+3.5);
+v901 = v900*0.999 + b/(v894+4.5);
+v902 = v901*0.999 + b/(v895+5.5);
+v903 = v902*0.999 + b/(v896+6.5);
+v904 = v903*0.999 + b/(v897+7.5);
+v905 = v904*0.999 + b/(v898+8.5);
+v906 = v905*0.999 + b/(v899+9.5);
+v907 = v906*0.999 + b/(v900+10.5);
+v908 = v907*0.999 + b/(v901+11.5);
+v909 = v908*0.999 + b/(v902+12.5);
+v910 = v909*0.999 + b/(v903+0.5);
+v911 = v910*0.999 + b/(v904+1.5);
+v912 = v911*0.999 + b/(v905+2.5);
+v913 = v912*0.999 + b/(v906+3.5);
+v914 = v913*0.999 + b/(v907+4.5);
+v915 = v914*0.999 + b/(v908+5.5);
+v916 = v915*0.999 + b/(v909+6.5);
+v917 = v916*0.999 + b/(v910+7.5);
+v918 = v917*0.999 + b/(v911+8.5);
+v919 = v918*0.999 + b/(v912+9.5);
+v920 = v919*0.999 + b/(v913+10.5);
+v921 = v920*0.999 + b/(v914+11.5);
+v922 = v921*0.999 + b/(v915+12.5);
+v923 = v922*0.999 + b/(v916+0.5);
+v924 = v923*0.999 + b/(v917+1.5);
+v925 = v924*0.999 + b/(v918+2.5);
+v926 = v925*0.999 + b/(v919+3.5);
+v927 = v926*0.999 + b/(v920+4.5);
+v928 = v927*0.999 + b/(v921+5.5);
+v929 = v928*0.999 + b/(v922+6.5);
+v930 = v929*0.999 + b/(v923+7.5);
+v931 = v930*0.999 + b/(v924+8.5);
+v932 = v931*0.999 + b/(v925+9.5);
+v933 = v932*0.999 + b/(v926+10.5);
+v934 = v933*0.999 + b/(v927+11.5);
+v935 = v934*0.999 + b/(v928+12.5);
+v936 = v935*0.999 + b/(v929+0.5);
+v937 = v936*0.999 + b/(v930+1.5);
+v938 = v937*0.999 + b/(v931+2.5);
+v939 = v938*0.999 + b/(v932+3.5);
+v940 = v939*0.999 + b/(v933+4.5);
+v941 = v940*0.999 + b/(v934+5.5);
+v942 = v941*0.999 + b/(v935+6.5);
+v943 = v942*0.999 + b/(v936+7.5);
+v944 = v943*0.999 + b/(v937+8.5);
+v945 = v944*0.999 + b/(v938+9.5);
+v946 = v945*0.999 + b/(v939+10.5);
+v947 = v946*0.999 + b/(v940+11.5);
+v948 = v947*0.999 + b/(v941+12.5);
+v949 = v948*0.999 + b/(v942+0.5);
+v950 = v949*0.999 + b/(v943+1.5);
+v951 = v950*0.999 + b/(v944+2.5);
+v952 = v951*0.999 + b/(v945+3.5);
+v953 = v952*0.999 + b/(v946+4.5);
+v954 = v953*0.999 + b/(v947+5.5);
+v955 = v954*0.999 + b/(v948+6.5);
+v956 = v955*0.999 + b/(v949+7.5);
+v957 = v956*0.999 + b/(v950+8.5);
+v958 = v957*0.999 + b/(v951+9.5);
+v959 = v958*0.999 + b/(v952+10.5);
+v960 = v959*0.999 + b/(v953+11.5);
+v961 = v960*0.999 + b/(v954+12.5);
+v962 = v961*0.999 + b/(v955+0.5);
+v963 = v962*0.999 + b/(v956+1.5);
+v964 = v963*0.999 + b/(v957+2.5);
+v965 = v964*0.999 + b/(v958+3.5);
+v966 = v965*0.999 + b/(v959+4.5);
+v967 = v966*0.999 + b/(v960+5.5);
+v968 = v967*0.999 + b/(v961+6.5);
+v969 = v968*0.999 + b/(v962+7.5);
+v970 = v969*0.999 + b/(v963+8.5);
+v971 = v970*0.999 + b/(v964+9.5);
+v972 = v971*0.999 + b/(v965+10.5);
+v973 = v972*0.999 + b/(v966+11.5);
+v974 = v973*0.999 + b/(v967+12.5);
+v975 = v974*0.999 + b/(v968+0.5);
+v976 = v975*0.999 + b/(v969+1.5);
+v977 = v976*0.999 + b/(v970+2.5);
+v978 = v977*0.999 + b/(v971+3.5);
+v979 = v978*0.999 + b/(v972+4.5);
+v980 = v979*0.999 + b/(v973+5.5);
+v981 = v980*0.999 + b/(v974+6.5);
+v982 = v981*0.999 + b/(v975+7.5);
+v983 = v982*0.999 + b/(v976+8.5);
+v984 = v983*0.999 + b/(v977+9.5);
+v985 = v984*0.999 + b/(v978+10.5);
+v986 = v985*0.999 + b/(v979+11.5);
+v987 = v986*0.999 + b/(v980+12.5);
+v988 = v987*0.999 + b/(v981+0.5);
+v989 = v988*0.999 + b/(v982+1.5);
+v990 = v989*0.999 + b/(v983+2.5);
+v991 = v990*0.999 + b/(v984+3.5);
+v992 = v991*0.999 + b/(v985+4.5);
+v993 = v992*0.999 + b/(v986+5.5);
+v994 = v993*0.999 + b/(v987+6.5);
+v995 = v994*0.999 + b/(v988+7.5);
+v996 = v995*0.999 + b/(v989+8.5);
+v997 = v996*0.999 + b/(v990+9.5);
+v998 = v997*0.999 + b/(v991+10.5);
+v999 = v998*0.999 + b/(v992+11.5);
+v1000 = v999*0.999 + b/(v993+12.5);
+v1001 = v1000*0.999 + b/(v994+0.5);
+v1002 = v1001*0.999 + b/(v995+1.5);
+v1003 = v1002*0.999 + b/(v996+2.5);
+v1004 = v1003*0.999 + b/(v997+3.5);
+v1005 = v1004*0.999 + b/(v998+4.5);
+v1006 = v1005*0.999 + b/(v999+5.5);
+v1007 = v1006*0.999 + b/(v1000+6.5);
+v1008 = v1007*0.999 + b/(v1001+7.5);
+v1009 = v1008*0.999 + b/(v1002+8.5);
+v1010 = v1009*0.999 + b/(v1003+9.5);
+v1011 = v1010*0.999 + b/(v1004+10.5);
+v1012 = v1011*0.999 + b/(v1005+11.5);
+v1013 = v1012*0.999 + b/(v1006+12.5);
+v1014 = v1013*0.999 + b/(v1007+0.5);
+v1015 = v1014*0.999 + b/(v1008+1.5);
+v1016 = v1015*0.999 + b/(v1009+2.5);
+v1017 = v1016*0.999 + b/(v1010+3.5);
+v1018 = v1017*0.999 + b/(v1011+4.5);
+v1019 = v1018*0.999 + b/(v1012+5.5);
+v1020 = v1019*0.999 + b/(v1013+6.5);
+v1021 = v1020*0.999 + b/(v1014+7.5);
+v1022 = v1021*0.999 + b/(v1015+8.5);
+v1023 = v1022*0.999 + b/(v1016+9.5);
+v1024 = v1023*0.999 + b/(v1017+10.5);
+v1025 = v1024*0.999 + b/(v1018+11.5);
+v1026 = v1025*0.999 + b/(v1019+12.5);
+v1027 = v1026*0.999 + b/(v1020+0.5);
+v1028 = v1027*0.999 + b/(v1021+1.5);
+v1029 = v1028*0.999 + b/(v1022+2.5);
+v1030 = v1029*0.999 + b/(v1023+3.5);
+v1031 = v1030*0.999 + b/(v1024+4.5);
+v1032 = v1031*0.999 + b/(v1025+5.5);
+v1033 = v1032*0.999 + b/(v1026+6.5);
+v1034 = v1033*0.999 + b/(v1027+7.5);
+v1035 = v1034*0.999 + b/(v1028+8.5);
+v1036 = v1035*0.999 + b/(v1029+9.5);
+v1037 = v1036*0.999 + b/(v1030+10.5);
+v1038 = v1037*0.999 + b/(v1031+11.5);
+v1039 = v1038*0.999 + b/(v1032+12.5);
+v1040 = v1039*0.999 + b/(v1033+0.5);
+v1041 = v1040*0.999 + b/(v1034+1.5);
+v1042 = v1041*0.999 + b/(v1035+2.5);
+v1043 = v1042*0.999 + b/(v1036+3.5);
+v1044 = v1043*0.999 + b/(v1037+4.5);
+v1045 = v1044*0.999 + b/(v1038+5.5);
+v1046 = v1045*0.999 + b/(v1039+6.5);
+v1047 = v1046*0.999 + b/(v1040+7.5);
+v1048 = v1047*0.999 + b/(v1041+8.5);
+v1049 = v1048*0.999 + b/(v1042+9.5);
+v1050 = v1049*0.999 + b/(v1043+10.5);
+v1051 = v1050*0.999 + b/(v1044+11.5);
+v1052 = v1051*0.999 + b/(v1045+12.5);
+v1053 = v1052*0.999 + b/(v1046+0.5);
+v1054 = v1053*0.999 + b/(v1047+1.5);
+v1055 = v1054*0.999 + b/(v1048+2.5);
+v1056 = v1055*0.999 + b/(v1049+3.5);
+v1057 = v1056*0.999 + b/(v1050+4.5);
+v1058 = v1057*0.999 + b/(v1051+5.5);
+v1059 = v1058*0.999 + b/(v1052+6.5);
+v1060 = v1059*0.999 + b/(v1053+7.5);
+v1061 = v1060*0.999 + b/(v1054+8.5);
+v1062 = v1061*0.999 + b/(v1055+9.5);
+v1063 = v1062*0.999 + b/(v1056+10.5);
+v1064 = v1063*0.999 + b/(v1057+11.5);
+v1065 = v1064*0.999 + b/(v1058+12.5);
+v1066 = v1065*0.999 + b/(v1059+0.5);
+v1067 = v1066*0.999 + b/(v1060+1.5);
+v1068 = v1067*0.999 + b/(v1061+2.5);
+v1069 = v1068*0.999 + b/(v1062+3.5);
+v1070 = v1069*0.999 + b/(v1063+4.5);
+v1071 = v1070*0.999 + b/(v1064+5.5);
+v1072 = v1071*0.999 + b/(v1065+6.5);
+v1073 = v1072*0.999 + b/(v1066+7.5);
+v1074 = v1073*0.999 + b/(v1067+8.5);
+v1075 = v1074*0.999 + b/(v1068+9.5);
+v1076 = v1075*0.999 + b/(v1069+10.5);
+v1077 = v1076*0.999 + b/(v1070+11.5);
+v1078 = v1077*0.999 + b/(v1071+12.5);
+v1079 = v1078*0.999 + b/(v1072+0.5);
+v1080 = v1079*0.999 + b/(v1073+1.5);
+v1081 = v1080*0.999 + b/(v1074+2.5);
+v1082 = v1081*0.999 + b/(v1075+3.5);
+v1083 = v1082*0.999 + b/(v1076+4.5);
+v1084 = v1083*0.999 + b/(v1077+5.5);
+v1085 = v1084*0.999 + b/(v1078+6.5);
+v1086 = v1085*0.999 + b/(v1079+7.5);
+v1087 = v1086*0.999 + b/(v1080+8.5);
+v1088 = v1087*0.999 + b/(v1081+9.5);
+v1089 = v1088*0.999 + b/(v1082+10.5);
+v1090 = v1089*0.999 + b/(v1083+11.5);
+v1091 = v1090*0.999 + b/(v1084+12.5);
+v1092 = v1091*0.999 + b/(v1085+0.5);
+v1093 = v1092*0.999 + b/(v1086+1.5);
+v1094 = v1093*0.999 + b/(v1087+2.5);
+v1095 = v1094*0.999 + b/(v1088+3.5);
+v1096 = v1095*0.999 + b/(v1089+4.5);
+v1097 = v1096*0.999 + b/(v1090+5.5);
+v1098 = v1097*0.999 + b/(v1091+6.5);
+v1099 = v1098*0.999 + b/(v1092+7.5);
+v1100 = v1099*0.999 + b/(v1093+8.5);
+v1101 = v1100*0.999 + b/(v1094+9.5);
+v1102 = v1101*0.999 + b/(v1095+10.5);
+v1103 = v1102*0.999 + b/(v1096+11.5);
+v1104 = v1103*0.999 + b/(v1097+12.5);
+v1105 = v1104*0.999 + b/(v1098+0.5);
+v1106 = v1105*0.999 + b/(v1099+1.5);
+v1107 = v1106*0.999 + b/(v1100+2.5);
+v1108 = v1107*0.999 + b/(v1101+3.5);
+v1109 = v1108*0.999 + b/(v1102+4.5);
+v1110 = v1109*0.999 + b/(v1103+5.5);
+v1111 = v1110*0.999 + b/(v1104+6.5);
+v1112 = v1111*0.999 + b/(v1105+7.5);
+v1113 = v1112*0.999 + b/(v1106+8.5);
+v1114 = v1113*0.999 + b/(v1107+9.5);
+v1115 = v1114*0.999 + b/(v1108+10.5);
+v1116 = v1115*0.999 + b/(v1109+11.5);
+v1117 = v1116*0.999 + b/(v1110+12.5);
+v1118 = v1117*0.999 + b/(v1111+0.5);
+v1119 = v1118*0.999 + b/(v1112+1.5);
+v1120 = v1119*0.999 + b/(v1113+2.5);
+v1121 = v1120*0.999 + b/(v1114+3.5);
+v1122 = v1121*0.999 + b/(v1115+4.5);
+v1123 = v1122*0.999 + b/(v1116+5.5);
+v1124 = v1123*0.999 + b/(v1117+6.5);
+v1125 = v1124*0.999 + b/(v1118+7.5);
+v1126 = v1125*0.999 + b/(v1119+8.5);
+v1127 = v1126*0.999 + b/(v1120+9.5);
+v1128 = v1127*0.999 + b/(v1121+10.5);
+v1129 = v1128*0.999 + b/(v1122+11.5);
+v1130 = v1129*0.999 + b/(v1123+12.5);
+v1131 = v1130*0.999 + b/(v1124+0.5);
+v1132 = v1131*0.999 + b/(v1125+1.5);
+v1133 = v1132*0.999 + b/(v1126+2.5);
+v1134 = v1133*0.999 + b/(v1127+3.5);
+v1135 = v1134*0.999 + b/(v1128+4.5);
+v1136 = v1135*0.999 + b/(v1129+5.5);
+v1137 = v1136*0.999 + b/(v1130+6.5);
+v1138 = v1137*0.999 + b/(v1131+7.5);
+v1139 = v1138*0.999 + b/(v1132+8.5);
+v1140 = v1139*0.999 + b/(v1133+9.5);
+v1141 = v1140*0.999 + b/(v1134+10.5);
+v1142 = v1141*0.999 + b/(v1135+11.5);
+v1143 = v1142*0.999 + b/(v1136+12.5);
+v1144 = v1143*0.999 + b/(v1137+0.5);
+v1145 = v1144*0.999 + b/(v1138+1.5);
+v1146 = v1145*0.999 + b/(v1139+2.5);
+v1147 = v1146*0.999 + b/(v1140+3.5);
+v1148 = v1147*0.999 + b/(v1141+4.5);
+v1149 = v1148*0.999 + b/(v1142+5.5);
+v1150 = v1149*0.999 + b/(v1143+6.5);
+v1151 = v1150*0.999 + b/(v1144+7.5);
+v1152 = v1151*0.999 + b/(v1145+8.5);
+v1153 = v1152*0.999 + b/(v1146+9.5);
+v1154 = v1153*0.999 + b/(v1147+10.5);
+v1155 = v1154*0.999 + b/(v1148+11.5);
+v1156 = v1155*0.999 + b/(v1149+12.5);
+v1157 = v1156*0.999 + b/(v1150+0.5);
+v1158 = v1157*0.999 + b/(v1151+1.5);
+v1159 = v1158*0.999 + b/(v1152+2.5);
+v1160 = v1159*0.999 + b/(v1153+3.5);
+v1161 = v1160*0.999 + b/(v1154+4.5);
+v1162 = v1161*0.999 + b/(v1155+5.5);
+v1163 = v1162*0.999 + b/(v1156+6.5);
+v1164 = v1163*0.999 + b/(v1157+7.5);
+v1165 = v1164*0.999 + b/(v1158+8.5);
+v1166 = v1165*0.999 + b/(v1159+9.5);
+v1167 = v1166*0.999 + b/(v1160+10.5);
+v1168 = v1167*0.999 + b/(v1161+11.5);
+v1169 = v1168*0.999 + b/(v1162+12.5);
+v1170 = v1169*0.999 + b/(v1163+0.5);
+v1171 = v1170*0.999 + b/(v1164+1.5);
+v1172 = v1171*0.999 + b/(v1165+2.5);
+v1173 = v1172*0.999 + b/(v1166+3.5);
+v1174 = v1173*0.999 + b/(v1167+4.5);
+v1175 = v1174*0.999 + b/(v1168+5.5);
+v1176 = v1175*0.999 + b/(v1169+6.5);
+v1177 = v1176*0.999 + b/(v1170+7.5);
+v1178 = v1177*0.999 + b/(v1171+8.5);
+v1179 = v1178*0.999 + b/(v1172+9.5);
+v1180 = v1179*0.999 + b/(v1173+10.5);
+v1181 = v1180*0.999 + b/(v1174+11.5);
+v1182 = v1181*0.999 + b/(v1175+12.5);
+v1183 = v1182*0.999 + b/(v1176+0.5);
+v1184 = v1183*0.999 + b/(v1177+1.5);
+v1185 = v1184*0.999 + b/(v1178+2.5);
+v1186 = v1185*0.999 + b/(v1179+3.5);
+v1187 = v1186*0.999 + b/(v1180+4.5);
+v1188 = v1187*0.999 + b/(v1181+5.5);
+v1189 = v1188*0.999 + b/(v1182+6.5);
+v1190 = v1189*0.999 + b/(v1183+7.5);
+v1191 = v1190*0.999 + b/(v1184+8.5);
+v1192 = v1191*0.999 + b/(v1185+9.5);
+v1193 = v1192*0.999 + b/(v1186+10.5);
+v1194 = v1193*0.999 + b/(v1187+11.5);
+v1195 = v1194*0.999 + b/(v1188+12.5);
+v1196 = v1195*0.999 + b/(v1189+0.5);
+v1197 = v1196*0.999 + b/(v1190+1.5);
+v1198 = v1197*0.999 + b/(v1191+2.5);
+v1199 = v1198*0.999 + b/(v1192+3.5);
+v1200 = v1199*0.999 + b/(v1193+4.5);
+v1201 = v1200*0.999 + b/(v1194+5.5);
+v1202 = v1201*0.999 + b/(v1195+6.5);
+v1203 = v1202*0.999 + b/(v1196+7.5);
+v1204 = v1203*0.999 + b/(v1197+8.5);
+v1205 = v1204*0.999 + b/(v1198+9.5);
+v1206 = v1205*0.999 + b/(v1199+10.5);
+v1207 = v1206*0.999 + b/(v1200+11.5);
+v1208 = v1207*0.999 + b/(v1201+12.5);
+v1209 = v1208*0.999 + b/(v1202+0.5);
+v1210 = v1209*0.999 + b/(v1203+1.5);
+v1211 = v1210*0.999 + b/(v1204+2.5);
+v1212 = v1211*0.999 + b/(v1205+3.5);
+v1213 = v1212*0.999 + b/(v1206+4.5);
+v1214 = v1213*0.999 + b/(v1207+5.5);
+v1215 = v1214*0.999 + b/(v1208+6.5);
+v1216 = v1215*0.999 + b/(v1209+7.5);
+v1217 = v1216*0.999 + b/(v1210+8.5);
+v1218 = v1217*0.999 + b/(v1211+9.5);
+v1219 = v1218*0.999 + b/(v1212+10.5);
+v1220 = v1219*0.999 + b/(v1213+11.5);
+v1221 = v1220*0.999 + b/(v1214+12.5);
+v1222 = v1221*0.999 + b/(v1215+0.5);
+v1223 = v1222*0.999 + b/(v1216+1.5);
+v1224 = v1223*0.999 + b/(v1217+2.5);
+v1225 = v1224*0.999 + b/(v1218+3.5);
+v1226 = v1225*0.999 + b/(v1219+4.5);
+v1227 = v1226*0.999 + b/(v1220+5.5);
+v1228 = v1227*0.999 + b/(v1221+6.5);
+v1229 = v1228*0.999 + b/(v1222+7.5);
+v1230 = v1229*0.999 + b/(v1223+8.5);
+v1231 = v1230*0.999 + b/(v1224+9.5);
+v1232 = v1231*0.999 + b/(v1225+10.5);
+v1233 = v1232*0.999 + b/(v1226+11.5);
+v1234 = v1233*0.999 + b/(v1227+12.5);
+v1235 = v1234*0.999 + b/(v1228+0.5);
+v1236 = v1235*0.999 + b/(v1229+1.5);
+v1237 = v1236*0.999 + b/(v1230+2.5);
+v1238 = v1237*0.999 + b/(v1231+3.5);
+v1239 = v1238*0.999 + b/(v1232+4.5);
+v1240 = v1239*0.999 + b/(v1233+5.5);
+v1241 = v1240*0.999 + b/(v1234+6.5);
+v1242 = v1241*0.999 + b/(v1235+7.5);
+v1243 = v1242*0.999 + b/(v1236+8.5);
+v1244 = v1243*0.999 + b/(v1237+9.5);
+v1245 = v1244*0.999 + b/(v1238+10.5);
+v1246 = v1245*0.999 + b/(v1239+11.5);
+v1247 = v1246*0.999 + b/(v1240+12.5);
+v1248 = v1247*0.999 + b/(v1241+0.5);
+v1249 = v1248*0.999 + b/(v1242+1.5);
+v1250 = v1249*0.999 + b/(v1243+2.5);
+v1251 = v1250*0.999 + b/(v1244+3.5);
+v1252 = v1251*0.999 + b/(v1245+4.5);
+v1253 = v1252*0.999 + b/(v1246+5.5);
+v1254 = v1253*0.999 + b/(v1247+6.5);
+v1255 = v1254*0.999 + b/(v1248+7.5);
+v1256 = v1255*0.999 + b/(v1249+8.5);
+v1257 = v1256*0.999 + b/(v1250+9.5);
+v1258 = v1257*0.999 + b/(v1251+10.5);
+v1259 = v1258*0.999 + b/(v1252+11.5);
+v1260 = v1259*0.999 + b/(v1253+12.5);
+v1261 = v1260*0.999 + b/(v1254+0.5);
+v1262 = v1261*0.999 + b/(v1255+1.5);
+v1263 = v1262*0.999 + b/(v1256+2.5);
+v1264 = v1263*0.999 + b/(v1257+3.5);
+v1265 = v1264*0.999 + b/(v1258+4.5);
+v1266 = v1265*0.999 + b/(v1259+5.5);
+v1267 = v1266*0.999 + b/(v1260+6.5);
+v1268 = v1267*0.999 + b/(v1261+7.5);
+v1269 = v1268*0.999 + b/(v1262+8.5);
+v1270 = v1269*0.999 + b/(v1263+9.5);
+v1271 = v1270*0.999 + b/(v1264+10.5);
+v1272 = v1271*0.999 + b/(v1265+11.5);
+v1273 = v1272*0.999 + b/(v1266+12.5);
+v1274 = v1273*0.999 + b/(v1267+0.5);
+v1275 = v1274*0.999 + b/(v1268+1.5);
+v1276 = v1275*0.999 + b/(v1269+2.5);
+v1277 = v1276*0.999 + b/(v1270+3.5);
+v1278 = v1277*0.999 + b/(v1271+4.5);
+v1279 = v1278*0.999 + b/(v1272+5.5);
+v1280 = v1279*0.999 + b/(v1273+6.5);
+v1281 = v1280*0.999 + b/(v1274+7.5);
+v1282 = v1281*0.999 + b/(v1275+8.5);
+v1283 = v1282*0.999 + b/(v1276+9.5);
+v1284 = v1283*0.999 + b/(v1277+10.5);
+v1285 = v1284*0.999 + b/(v1278+11.5);
+v1286 = v1285*0.999 + b/(v1279+12.5);
+v1287 = v1286*0.999 + b/(v1280+0.5);
+v1288 = v1287*0.999 + b/(v1281+1.5);
+v1289 = v1288*0.999 + b/(v1282+2.5);
+v1290 = v1289*0.999 + b/(v1283+3.5);
+v1291 = v1290*0.999 + b/(v1284+4.5);
+v1292 = v1291*0.999 + b/(v1285+5.5);
+v1293 = v1292*0.999 + b/(v1286+6.5);
+v1294 = v1293*0.999 + b/(v1287+7.5);
+v1295 = v1294*0.999 + b/(v1288+8.5);
+v1296 = v1295*0.999 + b/(v1289+9.5);
+v1297 = v1296*0.999 + b/(v1290+10.5);
+v1298 = v1297*0.999 + b/(v1291+11.5);
+v1299 = v1298*0.999 + b/(v1292+12.5);
+v1300 = v1299*0.999 + b/(v1293+0.5);
+v1301 = v1300*0.999 + b/(v1294+1.5);
+v1302 = v1301*0.999 + b/(v1295+2.5);
+v1303 = v1302*0.999 + b/(v1296+3.5);
+v1304 = v1303*0.999 + b/(v1297+4.5);
+v1305 = v1304*0.999 + b/(v1298+5.5);
+v1306 = v1305*0.999 + b/(v1299+6.5);
+v1307 = v1306*0.999 + b/(v1300+7.5);
+v1308 = v1307*0.999 + b/(v1301+8.5);
+v1309 = v1308*0.999 + b/(v1302+9.5);
+v1310 = v1309*0.999 + b/(v1303+10.5);
+v1311 = v1310*0.999 + b/(v1304+11.5);
+v1312 = v1311*0.999 + b/(v1305+12.5);
+v1313 = v1312*0.999 + b/(v1306+0.5);
+v1314 = v1313*0.999 + b/(v1307+1.5);
+v1315 = v1314*0.999 + b/(v1308+2.5);
+v1316 = v1315*0.999 + b/(v1309+3.5);
+v1317 = v1316*0.999 + b/(v1310+4.5);
+v1318 = v1317*0.999 + b/(v1311+5.5);
+v1319 = v1318*0.999 + b/(v1312+6.5);
+v1320 = v1319*0.999 + b/(v1313+7.5);
+v1321 = v1320*0.999 + b/(v1314+8.5);
+v1322 = v1321*0.999 + b/(v1315+9.5);
+v1323 = v1322*0.999 + b/(v1316+10.5);
+v1324 = v1323*0.999 + b/(v1317+11.5);
+v1325 = v1324*0.999 + b/(v1318+12.5);
+v1326 = v1325*0.999 + b/(v1319+0.5);
+v1327 = v1326*0.999 + b/(v1320+1.5);
+v1328 = v1327*0.999 + b/(v1321+2.5);
+v1329 = v1328*0.999 + b/(v1322+3.5);
+v1330 = v1329*0.999 + b/(v1323+4.5);
+v1331 = v1330*0.999 + b/(v1324+5.5);
+v1332 = v1331*0.999 + b/(v1325+6.5);
+v1333 = v1332*0.999 + b/(v1326+7.5);
+v1334 = v1333*0.999 + b/(v1327+8.5);
+v1335 = v1334*0.999 + b/(v1328+9.5);
+v1336 = v1335*0.999 + b/(v1329+10.5);
+v1337 = v1336*0.999 + b/(v1330+11.5);
+v1338 = v1337*0.999 + b/(v1331+12.5);
+v1339 = v1338*0.999 + b/(v1332+0.5);
+v1340 = v1339*0.999 + b/(v1333+1.5);
+v1341 = v1340*0.999 + b/(v1334+2.5);
+v1342 = v1341*0.999 + b/(v1335+3.5);
+v1343 = v1342*0.999 + b/(v1336+4.5);
+v1344 = v1343*0.999 + b/(v1337+5.5);
+v1345 = v1344*0.999 + b/(v1338+6.5);
+v1346 = v1345*0.999 + b/(v1339+7.5);
+v1347 = v1346*0.999 + b/(v1340+8.5);
+v1348 = v1347*0.999 + b/(v1341+9.5);
+v1349 = v1348*0.999 + b/(v1342+10.5);
+v1350 = v1349*0.999 + b/(v1343+11.5);
+v1351 = v1350*0.999 + b/(v1344+12.5);
+v1352 = v1351*0.999 + b/(v1345+0.5);
+v1353 = v1352*0.999 + b/(v1346+1.5);
+v1354 = v1353*0.999 + b/(v1347+2.5);
+v1355 = v1354*0.999 + b/(v1348+3.5);
+v1356 = v1355*0.999 + b/(v1349+4.5);
+v1357 = v1356*0.999 + b/(v1350+5.5);
+v1358 = v1357*0.999 + b/(v1351+6.5);
+v1359 = v1358*0.999 + b/(v1352+7.5);
+v1360 = v1359*0.999 + b/(v1353+8.5);
+v1361 = v1360*0.999 + b/(v1354+9.5);
+v1362 = v1361*0.999 + b/(v1355+10.5);
+v1363 = v1362*0.999 + b/(v1356+11.5);
+v1364 = v1363*0.999 + b/(v1357+12.5);
+v1365 = v1364*0.999 + b/(v1358+0.5);
+v1366 = v1365*0.999 + b/(v1359+1.5);
+v1367 = v1366*0.999 + b/(v1360+2.5);
+v1368 = v1367*0.999 + b/(v1361+3.5);
+v1369 = v1368*0.999 + b/(v1362+4.5);
+v1370 = v1369*0.999 + b/(v1363+5.5);
+v1371 = v1370*0.999 + b/(v1364+6.5);
+v1372 = v1371*0.999 + b/(v1365+7.5);
+v1373 = v1372*0.999 + b/(v1366+8.5);
+v1374 = v1373*0.999 + b/(v1367+9.5);
+v1375 = v1374*0.999 + b/(v1368+10.5);
+v1376 = v1375*0.999 + b/(v1369+11.5);
+v1377 = v1376*0.999 + b/(v1370+12.5);
+v1378 = v1377*0.999 + b/(v1371+0.5);
+v1379 = v1378*0.999 + b/(v1372+1.5);
+v1380 = v1379*0.999 + b/(v1373+2.5);
+v1381 = v1380*0.999 + b/(v1374+3.5);
+v1382 = v1381*0.999 + b/(v1375+4.5);
+v1383 = v1382*0.999 + b/(v1376+5.5);
+v1384 = v1383*0.999 + b/(v1377+6.5);
+v1385 = v1384*0.999 + b/(v1378+7.5);
+v1386 = v1385*0.999 + b/(v1379+8.5);
+v1387 = v1386*0.999 + b/(v1380+9.5);
+v1388 = v1387*0.999 + b/(v1381+10.5);
+v1389 = v1388*0.999 + b/(v1382+11.5);
+v1390 = v1389*0.999 + b/(v1383+12.5);
+v1391 = v1390*0.999 + b/(v1384+0.5);
+v1392 = v1391*0.999 + b/(v1385+1.5);
+v1393 = v1392*0.999 + b/(v1386+2.5);
+v1394 = v1393*0.999 + b/(v1387+3.5);
+v1395 = v1394*0.999 + b/(v1388+4.5);
+v1396 = v1395*0.999 + b/(v1389+5.5);
+v1397 = v1396*0.999 + b/(v1390+6.5);
+v1398 = v1397*0.999 + b/(v1391+7.5);
+v1399 = v1398*0.999 + b/(v1392+8.5);
+v1400 = v1399*0.999 + b/(v1393+9.5);
+v1401 = v1400*0.999 + b/(v1394+10.5);
+v1402 = v1401*0.999 + b/(v1395+11.5);
+v1403 = v1402*0.999 + b/(v1396+12.5);
+v1404 = v1403*0.999 + b/(v1397+0.5);
+v1405 = v1404*0.999 + b/(v1398+1.5);
+v1406 = v1405*0.999 + b/(v1399+2.5);
+v1407 = v1406*0.999 + b/(v1400+3.5);
+v1408 = v1407*0.999 + b/(v1401+4.5);
+v1409 = v1408*0.999 + b/(v1402+5.5);
+v1410 = v1409*0.999 + b/(v1403+6.5);
+v1411 = v1410*0.999 + b/(v1404+7.5);
+v1412 = v1411*0.999 + b/(v1405+8.5);
+v1413 = v1412*0.999 + b/(v1406+9.5);
+v1414 = v1413*0.999 + b/(v1407+10.5);
+v1415 = v1414*0.999 + b/(v1408+11.5);
+v1416 = v1415*0.999 + b/(v1409+12.5);
+v1417 = v1416*0.999 + b/(v1410+0.5);
+v1418 = v1417*0.999 + b/(v1411+1.5);
+v1419 = v1418*0.999 + b/(v1412+2.5);
+v1420 = v1419*0.999 + b/(v1413+3.5);
+v1421 = v1420*0.999 + b/(v1414+4.5);
+v1422 = v1421*0.999 + b/(v1415+5.5);
+v1423 = v1422*0.999 + b/(v1416+6.5);
+v1424 = v1423*0.999 + b/(v1417+7.5);
+v1425 = v1424*0.999 + b/(v1418+8.5);
+v1426 = v1425*0.999 + b/(v1419+9.5);
+v1427 = v1426*0.999 + b/(v1420+10.5);
+v1428 = v1427*0.999 + b/(v1421+11.5);
+v1429 = v1428*0.999 + b/(v1422+12.5);
+v1430 = v1429*0.999 + b/(v1423+0.5);
+v1431 = v1430*0.999 + b/(v1424+1.5);
+v1432 = v1431*0.999 + b/(v1425+2.5);
+v1433 = v1432*0.999 + b/(v1426+3.5);
+v1434 = v1433*0.999 + b/(v1427+4.5);
+v1435 = v1434*0.999 + b/(v1428+5.5);
+v1436 = v1435*0.999 + b/(v1429+6.5);
+v1437 = v1436*0.999 + b/(v1430+7.5);
+v1438 = v1437*0.999 + b/(v1431+8.5);
+v1439 = v1438*0.999 + b/(v1432+9.5);
+v1440 = v1439*0.999 + b/(v1433+10.5);
+v1441 = v1440*0.999 + b/(v1434+11.5);
+v1442 = v1441*0.999 + b/(v1435+12.5);
+v1443 = v1442*0.999 + b/(v1436+0.5);
+v1444 = v1443*0.999 + b/(v1437+1.5);
+v1445 = v1444*0.999 + b/(v1438+2.5);
+v1446 = v1445*0.999 + b/(v1439+3.5);
+v1447 = v1446*0.999 + b/(v1440+4.5);
+v1448 = v1447*0.999 + b/(v1441+5.5);
+v1449 = v1448*0.999 + b/(v1442+6.5);
+v1450 = v1449*0.999 + b/(v1443+7.5);
+v1451 = v1450*0.999 + b/(v1444+8.5);
+v1452 = v1451*0.999 + b/(v1445+9.5);
+v1453 = v1452*0.999 + b/(v1446+10.5);
+v1454 = v1453*0.999 + b/(v1447+11.5);
+v1455 = v1454*0.999 + b/(v1448+12.5);
+v1456 = v1455*0.999 + b/(v1449+0.5);
+v1457 = v1456*0.999 + b/(v1450+1.5);
+v1458 = v1457*0.999 + b/(v1451+2.5);
+v1459 = v1458*0.999 + b/(v1452+3.5);
+v1460 = v1459*0.999 + b/(v1453+4.5);
+v1461 = v1460*0.999 + b/(v1454+5.5);
+v1462 = v1461*0.999 + b/(v1455+6.5);
+v1463 = v1462*0.999 + b/(v1456+7.5);
+v1464 = v1463*0.999 + b/(v1457+8.5);
+v1465 = v1464*0.999 + b/(v1458+9.5);
+v1466 = v1465*0.999 + b/(v1459+10.5);
+v1467 = v1466*0.999 + b/(v1460+11.5);
+v1468 = v1467*0.999 + b/(v1461+12.5);
+v1469 = v1468*0.999 + b/(v1462+0.5);
+v1470 = v1469*0.999 + b/(v1463+1.5);
+v1471 = v1470*0.999 + b/(v1464+2.5);
+v1472 = v1471*0.999 + b/(v1465+3.5);
+v1473 = v1472*0.999 + b/(v1466+4.5);
+v1474 = v1473*0.999 + b/(v1467+5.5);
+v1475 = v1474*0.999 + b/(v1468+6.5);
+v1476 = v1475*0.999 + b/(v1469+7.5);
+v1477 = v1476*0.999 + b/(v1470+8.5);
+v1478 = v1477*0.999 + b/(v1471+9.5);
+v1479 = v1478*0.999 + b/(v1472+10.5);
+v1480 = v1479*0.999 + b/(v1473+11.5);
+v1481 = v1480*0.999 + b/(v1474+12.5);
+v1482 = v1481*0.999 + b/(v1475+0.5);
+v1483 = v1482*0.999 + b/(v1476+1.5);
+v1484 = v1483*0.999 + b/(v1477+2.5);
+v1485 = v1484*0.999 + b/(v1478+3.5);
+v1486 = v1485*0.999 + b/(v1479+4.5);
+v1487 = v1486*0.999 + b/(v1480+5.5);
+v1488 = v1487*0.999 + b/(v1481+6.5);
+v1489 = v1488*0.999 + b/(v1482+7.5);
+v1490 = v1489*0.999 + b/(v1483+8.5);
+v1491 = v1490*0.999 + b/(v1484+9.5);
+v1492 = v1491*0.999 + b/(v1485+10.5);
+v1493 = v1492*0.999 + b/(v1486+11.5);
+v1494 = v1493*0.999 + b/(v1487+12.5);
+v1495 = v1494*0.999 + b/(v1488+0.5);
+v1496 = v1495*0.999 + b/(v1489+1.5);
+v1497 = v1496*0.999 + b/(v1490+2.5);
+v1498 = v1497*0.999 + b/(v1491+3.5);
+v1499 = v1498*0.999 + b/(v1492+4.5);
+v1500 = v1499*0.999 + b/(v1493+5.5);
+v1501 = v1500*0.999 + b/(v1494+6.5);
+v1502 = v1501*0.999 + b/(v1495+7.5);
+v1503 = v1502*0.999 + b/(v1496+8.5);
+v1504 = v1503*0.999 + b/(v1497+9.5);
+v1505 = v1504*0.999 + b/(v1498+10.5);
+v1506 = v1505*0.999 + b/(v1499+11.5);
+v1507 = v1506*0.999 + b/(v1500+12.5);
+v1508 = v1507*0.999 + b/(v1501+0.5);
+v1509 = v1508*0.999 + b/(v1502+1.5);
+v1510 = v1509*0.999 + b/(v1503+2.5);
+v1511 = v1510*0.999 + b/(v1504+3.5);
+v1512 = v1511*0.999 + b/(v1505+4.5);
+v1513 = v1512*0.999 + b/(v1506+5.5);
+v1514 = v1513*0.999 + b/(v1507+6.5);
+v1515 = v1514*0.999 + b/(v1508+7.5);
+v1516 = v1515*0.999 + b/(v1509+8.5);
+v1517 = v1516*0.999 + b/(v1510+9.5);
+v1518 = v1517*0.999 + b/(v1511+10.5);
+v1519 = v1518*0.999 + b/(v1512+11.5);
+v1520 = v1519*0.999 + b/(v1513+12.5);
+v1521 = v1520*0.999 + b/(v1514+0.5);
+v1522 = v1521*0.999 + b/(v1515+1.5);
+v1523 = v1522*0.999 + b/(v1516+2.5);
+v1524 = v1523*0.999 + b/(v1517+3.5);
+v1525 = v1524*0.999 + b/(v1518+4.5);
+v1526 = v1525*0.999 + b/(v1519+5.5);
+v1527 = v1526*0.999 + b/(v1520+6.5);
+v1528 = v1527*0.999 + b/(v1521+7.5);
+v1529 = v1528*0.999 + b/(v1522+8.5);
+v1530 = v1529*0.999 + b/(v1523+9.5);
+v1531 = v1530*0.999 + b/(v1524+10.5);
+v1532 = v1531*0.999 + b/(v1525+11.5);
+v1533 = v1532*0.999 + b/(v1526+12.5);
+v1534 = v1533*0.999 + b/(v1527+0.5);
+v1535 = v1534*0.999 + b/(v1528+1.5);
+v1536 = v1535*0.999 + b/(v1529+2.5);
+v1537 = v1536*0.999 + b/(v1530+3.5);
+v1538 = v1537*0.999 + b/(v1531+4.5);
+v1539 = v1538*0.999 + b/(v1532+5.5);
+v1540 = v1539*0.999 + b/(v1533+6.5);
+v1541 = v1540*0.999 + b/(v1534+7.5);
+v1542 = v1541*0.999 + b/(v1535+8.5);
+v1543 = v1542*0.999 + b/(v1536+9.5);
+v1544 = v1543*0.999 + b/(v1537+10.5);
+v1545 = v1544*0.999 + b/(v1538+11.5);
+v1546 = v1545*0.999 + b/(v1539+12.5);
+v1547 = v1546*0.999 + b/(v1540+0.5);
+v1548 = v1547*0.999 + b/(v1541+1.5);
+v1549 = v1548*0.999 + b/(v1542+2.5);
+v1550 = v1549*0.999 + b/(v1543+3.5);
+v1551 = v1550*0.999 + b/(v1544+4.5);
+v1552 = v1551*0.999 + b/(v1545+5.5);
+v1553 = v1552*0.999 + b/(v1546+6.5);
+v1554 = v1553*0.999 + b/(v1547+7.5);
+v1555 = v1554*0.999 + b/(v1548+8.5);
+v1556 = v1555*0.999 + b/(v1549+9.5);
+v1557 = v1556*0.999 + b/(v1550+10.5);
+v1558 = v1557*0.999 + b/(v1551+11.5);
+v1559 = v1558*0.999 + b/(v1552+12.5);
+v1560 = v1559*0.999 + b/(v1553+0.5);
+v1561 = v1560*0.999 + b/(v1554+1.5);
+v1562 = v1561*0.999 + b/(v1555+2.5);
+v1563 = v1562*0.999 + b/(v1556+3.5);
+v1564 = v1563*0.999 + b/(v1557+4.5);
+v1565 = v1564*0.999 + b/(v1558+5.5);
+v1566 = v1565*0.999 + b/(v1559+6.5);
+v1567 = v1566*0.999 + b/(v1560+7.5);
+v1568 = v1567*0.999 + b/(v1561+8.5);
+v1569 = v1568*0.999 + b/(v1562+9.5);
+v1570 = v1569*0.999 + b/(v1563+10.5);
+v1571 = v1570*0.999 + b/(v1564+11.5);
+v1572 = v1571*0.999 + b/(v1565+12.5);
+v1573 = v1572*0.999 + b/(v1566+0.5);
+v1574 = v1573*0.999 + b/(v1567+1.5);
+v1575 = v1574*0.999 + b/(v1568+2.5);
+v1576 = v1575*0.999 + b/(v1569+3.5);
+v1577 = v1576*0.999 + b/(v1570+4.5);
+v1578 = v1577*0.999 + b/(v1571+5.5);
+v1579 = v1578*0.999 + b/(v1572+6.5);
+v1580 = v1579*0.999 + b/(v1573+7.5);
+v1581 = v1580*0.999 + b/(v1574+8.5);
+v1582 = v1581*0.999 + b/(v1575+9.5);
+v1583 = v1582*0.999 + b/(v1576+10.5);
+v1584 = v1583*0.999 + b/(v1577+11.5);
+v1585 = v1584*0.999 + b/(v1578+12.5);
+v1586 = v1585*0.999 + b/(v1579+0.5);
+v1587 = v1586*0.999 + b/(v1580+1.5);
+v1588 = v1587*0.999 + b/(v1581+2.5);
+v1589 = v1588*0.999 + b/(v1582+3.5);
+v1590 = v1589*0.999 + b/(v1583+4.5);
+v1591 = v1590*0.999 + b/(v1584+5.5);
+v1592 = v1591*0.999 + b/(v1585+6.5);
+v1593 = v1592*0.999 + b/(v1586+7.5);
+v1594 = v1593*0.999 + b/(v1587+8.5);
+v1595 = v1594*0.999 + b/(v1588+9.5);
+v1596 = v1595*0.999 + b/(v1589+10.5);
+v1597 = v1596*0.999 + b/(v1590+11.5);
+v1598 = v1597*0.999 + b/(v1591+12.5);
+v1599 = v1598*0.999 + b/(v1592+0.5);
+v1600 = v1599*0.999 + b/(v1593+1.5);
+v1601 = v1600*0.999 + b/(v1594+2.5);
+v1602 = v1601*0.999 + b/(v1595+3.5);
+v1603 = v1602*0.999 + b/(v1596+4.5);
+v1604 = v1603*0.999 + b/(v1597+5.5);
+v1605 = v1604*0.999 + b/(v1598+6.5);
+v1606 = v1605*0.999 + b/(v1599+7.5);
+v1607 = v1606*0.999 + b/(v1600+8.5);
+v1608 = v1607*0.999 + b/(v1601+9.5);
+v1609 = v1608*0.999 + b/(v1602+10.5);
+v1610 = v1609*0.999 + b/(v1603+11.5);
+v1611 = v1610*0.999 + b/(v1604+12.5);
+v1612 = v1611*0.999 + b/(v1605+0.5);
+v1613 = v1612*0.999 + b/(v1606+1.5);
+v1614 = v1613*0.999 + b/(v1607+2.5);
+v1615 = v1614*0.999 + b/(v1608+3.5);
+v1616 = v1615*0.999 + b/(v1609+4.5);
+v1617 = v1616*0.999 + b/(v1610+5.5);
+v1618 = v1617*0.999 + b/(v1611+6.5);
+v1619 = v1618*0.999 + b/(v1612+7.5);
+v1620 = v1619*0.999 + b/(v1613+8.5);
+v1621 = v1620*0.999 + b/(v1614+9.5);
+v1622 = v1621*0.999 + b/(v1615+10.5);
+v1623 = v1622*0.999 + b/(v1616+11.5);
+v1624 = v1623*0.999 + b/(v1617+12.5);
+v1625 = v1624*0.999 + b/(v1618+0.5);
+v1626 = v1625*0.999 + b/(v1619+1.5);
+v1627 = v1626*0.999 + b/(v1620+2.5);
+v1628 = v1627*0.999 + b/(v1621+3.5);
+v1629 = v1628*0.999 + b/(v1622+4.5);
+v1630 = v1629*0.999 + b/(v1623+5.5);
+v1631 = v1630*0.999 + b/(v1624+6.5);
+v1632 = v1631*0.999 + b/(v1625+7.5);
+v1633 = v1632*0.999 + b/(v1626+8.5);
+v1634 = v1633*0.999 + b/(v1627+9.5);
+v1635 = v1634*0.999 + b/(v1628+10.5);
+v1636 = v1635*0.999 + b/(v1629+11.5);
+v1637 = v1636*0.999 + b/(v1630+12.5);
+v1638 = v1637*0.999 + b/(v1631+0.5);
+v1639 = v1638*0.999 + b/(v1632+1.5);
+v1640 = v1639*0.999 + b/(v1633+2.5);
+v1641 = v1640*0.999 + b/(v1634+3.5);
+v1642 = v1641*0.999 + b/(v1635+4.5);
+v1643 = v1642*0.999 + b/(v1636+5.5);
+v1644 = v1643*0.999 + b/(v1637+6.5);
+v1645 = v1644*0.999 + b/(v1638+7.5);
+v1646 = v1645*0.999 + b/(v1639+8.5);
+v1647 = v1646*0.999 + b/(v1640+9.5);
+v1648 = v1647*0.999 + b/(v1641+10.5);
+v1649 = v1648*0.999 + b/(v1642+11.5);
+v1650 = v1649*0.999 + b/(v1643+12.5);
+v1651 = v1650*0.999 + b/(v1644+0.5);
+v1652 = v1651*0.999 + b/(v1645+1.5);
+v1653 = v1652*0.999 + b/(v1646+2.5);
+v1654 = v1653*0.999 + b/(v1647+3.5);
+v1655 = v1654*0.999 + b/(v1648+4.5);
+v1656 = v1655*0.999 + b/(v1649+5.5);
+v1657 = v1656*0.999 + b/(v1650+6.5);
+v1658 = v1657*0.999 + b/(v1651+7.5);
+v1659 = v1658*0.999 + b/(v1652+8.5);
+v1660 = v1659*0.999 + b/(v1653+9.5);
+v1661 = v1660*0.999 + b/(v1654+10.5);
+v1662 = v1661*0.999 + b/(v1655+11.5);
+v1663 = v1662*0.999 + b/(v1656+12.5);
+v1664 = v1663*0.999 + b/(v1657+0.5);
+v1665 = v1664*0.999 + b/(v1658+1.5);
+v1666 = v1665*0.999 + b/(v1659+2.5);
+v1667 = v1666*0.999 + b/(v1660+3.5);
+v1668 = v1667*0.999 + b/(v1661+4.5);
+v1669 = v1668*0.999 + b/(v1662+5.5);
+v1670 = v1669*0.999 + b/(v1663+6.5);
+v1671 = v1670*0.999 + b/(v1664+7.5);
+v1672 = v1671*0.999 + b/(v1665+8.5);
+v1673 = v1672*0.999 + b/(v1666+9.5);
+v1674 = v1673*0.999 + b/(v1667+10.5);
+v1675 = v1674*0.999 + b/(v1668+11.5);
+v1676 = v1675*0.999 + b/(v1669+12.5);
+v1677 = v1676*0.999 + b/(v1670+0.5);
+v1678 = v1677*0.999 + b/(v1671+1.5);
+v1679 = v1678*0.999 + b/(v1672+2.5);
+v1680 = v1679*0.999 + b/(v1673+3.5);
+v1681 = v1680*0.999 + b/(v1674+4.5);
+v1682 = v1681*0.999 + b/(v1675+5.5);
+v1683 = v1682*0.999 + b/(v1676+6.5);
+v1684 = v1683*0.999 + b/(v1677+7.5);
+v1685 = v1684*0.999 + b/(v1678+8.5);
+v1686 = v1685*0.999 + b/(v1679+9.5);
+v1687 = v1686*0.999 + b/(v1680+10.5);
+v1688 = v1687*0.999 + b/(v1681+11.5);
+v1689 = v1688*0.999 + b/(v1682+12.5);
+v1690 = v1689*0.999 + b/(v1683+0.5);
+v1691 = v1690*0.999 + b/(v1684+1.5);
+v1692 = v1691*0.999 + b/(v1685+2.5);
+v1693 = v1692*0.999 + b/(v1686+3.5);
+v1694 = v1693*0.999 + b/(v1687+4.5);
+v1695 = v1694*0.999 + b/(v1688+5.5);
+v1696 = v1695*0.999 + b/(v1689+6.5);
+v1697 = v1696*0.999 + b/(v1690+7.5);
+v1698 = v1697*0.999 + b/(v1691+8.5);
+v1699 = v1698*0.999 + b/(v1692+9.5);
+v1700 = v1699*0.999 + b/(v1693+10.5);
+v1701 = v1700*0.999 + b/(v1694+11.5);
+v1702 = v1701*0.999 + b/(v1695+12.5);
+v1703 = v1702*0.999 + b/(v1696+0.5);
+v1704 = v1703*0.999 + b/(v1697+1.5);
+v1705 = v1704*0.999 + b/(v1698+2.5);
+v1706 = v1705*0.999 + b/(v1699+3.5);
+v1707 = v1706*0.999 + b/(v1700+4.5);
+v1708 = v1707*0.999 + b/(v1701+5.5);
+v1709 = v1708*0.999 + b/(v1702+6.5);
+v1710 = v1709*0.999 + b/(v1703+7.5);
+v1711 = v1710*0.999 + b/(v1704+8.5);
+v1712 = v1711*0.999 + b/(v1705+9.5);
+v1713 = v1712*0.999 + b/(v1706+10.5);
+v1714 = v1713*0.999 + b/(v1707+11.5);
+v1715 = v1714*0.999 + b/(v1708+12.5);
+v1716 = v1715*0.999 + b/(v1709+0.5);
+v1717 = v1716*0.999 + b/(v1710+1.5);
+v1718 = v1717*0.999 + b/(v1711+2.5);
+v1719 = v1718*0.999 + b/(v1712+3.5);
+v1720 = v1719*0.999 + b/(v1713+4.5);
+v1721 = v1720*0.999 + b/(v1714+5.5);
+v1722 = v1721*0.999 + b/(v1715+6.5);
+v1723 = v1722*0.999 + b/(v1716+7.5);
+v1724 = v1723*0.999 + b/(v1717+8.5);
+v1725 = v1724*0.999 + b/(v1718+9.5);
+v1726 = v1725*0.999 + b/(v1719+10.5);
+v1727 = v1726*0.999 + b/(v1720+11.5);
+v1728 = v1727*0.999 + b/(v1721+12.5);
+v1729 = v1728*0.999 + b/(v1722+0.5);
+v1730 = v1729*0.999 + b/(v1723+1.5);
+v1731 = v1730*0.999 + b/(v1724+2.5);
+v1732 = v1731*0.999 + b/(v1725+3.5);
+v1733 = v1732*0.999 + b/(v1726+4.5);
+v1734 = v1733*0.999 + b/(v1727+5.5);
+v1735 = v1734*0.999 + b/(v1728+6.5);
+v1736 = v1735*0.999 + b/(v1729+7.5);
+v1737 = v1736*0.999 + b/(v1730+8.5);
+v1738 = v1737*0.999 + b/(v1731+9.5);
+v1739 = v1738*0.999 + b/(v1732+10.5);
+v1740 = v1739*0.999 + b/(v1733+11.5);
+v1741 = v1740*0.999 + b/(v1734+12.5);
+v1742 = v1741*0.999 + b/(v1735+0.5);
+v1743 = v1742*0.999 + b/(v1736+1.5);
+v1744 = v1743*0.999 + b/(v1737+2.5);
+v1745 = v1744*0.999 + b/(v1738+3.5);
+v1746 = v1745*0.999 + b/(v1739+4.5);
+v1747 = v1746*0.999 + b/(v1740+5.5);
+v1748 = v1747*0.999 + b/(v1741+6.5);
+v1749 = v1748*0.999 + b/(v1742+7.5);
+v1750 = v1749*0.999 + b/(v1743+8.5);
+v1751 = v1750*0.999 + b/(v1744+9.5);
+v1752 = v1751*0.999 + b/(v1745+10.5);
+v1753 = v1752*0.999 + b/(v1746+11.5);
+v1754 = v1753*0.999 + b/(v1747+12.5);
+v1755 = v1754*0.999 + b/(v1748+0.5);
+v1756 = v1755*0.999 + b/(v1749+1.5);
+v1757 = v1756*0.999 + b/(v1750+2.5);
+v1758 = v1757*0.999 + b/(v1751+3.5);
+v1759 = v1758*0.999 + b/(v1752+4.5);
+v1760 = v1759*0.999 + b/(v1753+5.5);
+v1761 = v1760*0.999 + b/(v1754+6.5);
+v1762 = v1761*0.999 + b/(v1755+7.5);
+v1763 = v1762*0.999 + b/(v1756+8.5);
+v1764 = v1763*0.999 + b/(v1757+9.5);
+v1765 = v1764*0.999 + b/(v1758+10.5);
+v1766 = v1765*0.999 + b/(v1759+11.5);
+v1767 = v1766*0.999 + b/(v1760+12.5);
+v1768 = v1767*0.999 + b/(v1761+0.5);
+v1769 = v1768*0.999 + b/(v1762+1.5);
+v1770 = v1769*0.999 + b/(v1763+2.5);
+v1771 = v1770*0.999 + b/(v1764+3.5);
+v1772 = v1771*0.999 + b/(v1765+4.5);
+v1773 = v1772*0.999 + b/(v1766+5.5);
+v1774 = v1773*0.999 + b/(v1767+6.5);
+v1775 = v1774*0.999 + b/(v1768+7.5);
+v1776 = v1775*0.999 + b/(v1769+8.5);
+v1777 = v1776*0.999 + b/(v1770+9.5);
+v1778 = v1777*0.999 + b/(v1771+10.5);
+v1779 = v1778*0.999 + b/(v1772+11.5);
+v1780 = v1779*0.999 + b/(v1773+12.5);
+v1781 = v1780*0.999 + b/(v1774+0.5);
+v1782 = v1781*0.999 + b/(v1775+1.5);
+v1783 = v1782*0.999 + b/(v1776+2.5);
+v1784 = v1783*0.999 + b/(v1777+3.5);
+v1785 = v1784*0.999 + b/(v1778+4.5);
+v1786 = v1785*0.999 + b/(v1779+5.5);
+v1787 = v1786*0.999 + b/(v1780+6.5);
+v1788 = v1787*0.999 + b/(v1781+7.5);
+v1789 = v1788*0.999 + b/(v1782+8.5);
+v1790 = v1789*0.999 + b/(v1783+9.5);
+v1791 = v1790*0.999 + b/(v1784+10.5);
+v1792 = v1791*0.999 + b/(v1785+11.5);
+v1793 = v1792*0.999 + b/(v1786+12.5);
+v1794 = v1793*0.999 + b/(v1787+0.5);
+v1795 = v1794*0.999 + b/(v1788+1.5);
+v1796 = v1795*0.999 + b/(v1789+2.5);
+v1797 = v1796*0.999 + b/(v1790+3.5);
+v1798 = v1797*0.999 + b/(v1791+4.5);
+v1799 = v1798*0.999 + b/(v1792+5.5);
+v1800 = v1799*0.999 + b/(v1793+6.5);
+v1801 = v1800*0.999 + b/(v1794+7.5);
+v1802 = v1801*0.999 + b/(v1795+8.5);
+v1803 = v1802*0.999 + b/(v1796+9.5);
+v1804 = v1803*0.999 + b/(v1797+10.5);
+v1805 = v1804*0.999 + b/(v1798+11.5);
+v1806 = v1805*0.999 + b/(v1799+12.5);
+v1807 = v1806*0.999 + b/(v1800+0.5);
+v1808 = v1807*0.999 + b/(v1801+1.5);
+v1809 = v1808*0.999 + b/(v1802+2.5);
+v1810 = v1809*0.999 + b/(v1803+3.5);
+v1811 = v1810*0.999 + b/(v1804+4.5);
+v1812 = v1811*0.999 + b/(v1805+5.5);
+v1813 = v1812*0.999 + b/(v1806+6.5);
+v1814 = v1813*0.999 + b/(v1807+7.5);
+v1815 = v1814*0.999 + b/(v1808+8.5);
+v1816 = v1815*0.999 + b/(v1809+9.5);
+v1817 = v1816*0.999 + b/(v1810+10.5);
+v1818 = v1817*0.999 + b/(v1811+11.5);
+v1819 = v1818*0.999 + b/(v1812+12.5);
+v1820 = v1819*0.999 + b/(v1813+0.5);
+v1821 = v1820*0.999 + b/(v1814+1.5);
+v1822 = v1821*0.999 + b/(v1815+2.5);
+v1823 = v1822*0.999 + b/(v1816+3.5);
+v1824 = v1823*0.999 + b/(v1817+4.5);
+v1825 = v1824*0.999 + b/(v1818+5.5);
+v1826 = v1825*0.999 + b/(v1819+6.5);
+v1827 = v1826*0.999 + b/(v1820+7.5);
+v1828 = v1827*0.999 + b/(v1821+8.5);
+v1829 = v1828*0.999 + b/(v1822+9.5);
+v1830 = v1829*0.999 + b/(v1823+10.5);
+v1831 = v1830*0.999 + b/(v1824+11.5);
+v1832 = v1831*0.999 + b/(v1825+12.5);
+v1833 = v1832*0.999 + b/(v1826+0.5);
+v1834 = v1833*0.999 + b/(v1827+1.5);
+v1835 = v1834*0.999 + b/(v1828+2.5);
+v1836 = v1835*0.999 + b/(v1829+3.5);
+v1837 = v1836*0.999 + b/(v1830+4.5);
+v1838 = v1837*0.999 + b/(v1831+5.5);
+v1839 = v1838*0.999 + b/(v1832+6.5);
+v1840 = v1839*0.999 + b/(v1833+7.5);
+v1841 = v1840*0.999 + b/(v1834+8.5);
+v1842 = v1841*0.999 + b/(v1835+9.5);
+v1843 = v1842*0.999 + b/(v1836+10.5);
+v1844 = v1843*0.999 + b/(v1837+11.5);
+v1845 = v1844*0.999 + b/(v1838+12.5);
+v1846 = v1845*0.999 + b/(v1839+0.5);
+v1847 = v1846*0.999 + b/(v1840+1.5);
+v1848 = v1847*0.999 + b/(v1841+2.5);
+v1849 = v1848*0.999 + b/(v1842+3.5);
+v1850 = v1849*0.999 + b/(v1843+4.5);
+v1851 = v1850*0.999 + b/(v1844+5.5);
+v1852 = v1851*0.999 + b/(v1845+6.5);
+v1853 = v1852*0.999 + b/(v1846+7.5);
+v1854 = v1853*0.999 + b/(v1847+8.5);
+v1855 = v1854*0.999 + b/(v1848+9.5);
+v1856 = v1855*0.999 + b/(v1849+10.5);
+v1857 = v1856*0.999 + b/(v1850+11.5);
+v1858 = v1857*0.999 + b/(v1851+12.5);
+v1859 = v1858*0.999 + b/(v1852+0.5);
+v1860 = v1859*0.999 + b/(v1853+1.5);
+v1861 = v1860*0.999 + b/(v1854+2.5);
+v1862 = v1861*0.999 + b/(v1855+3.5);
+v1863 = v1862*0.999 + b/(v1856+4.5);
+v1864 = v1863*0.999 + b/(v1857+5.5);
+v1865 = v1864*0.999 + b/(v1858+6.5);
+v1866 = v1865*0.999 + b/(v1859+7.5);
+v1867 = v1866*0.999 + b/(v1860+8.5);
+v1868 = v1867*0.999 + b/(v1861+9.5);
+v1869 = v1868*0.999 + b/(v1862+10.5);
+v1870 = v1869*0.999 + b/(v1863+11.5);
+v1871 = v1870*0.999 + b/(v1864+12.5);
+v1872 = v1871*0.999 + b/(v1865+0.5);
+v1873 = v1872*0.999 + b/(v1866+1.5);
+v1874 = v1873*0.999 + b/(v1867+2.5);
+v1875 = v1874*0.999 + b/(v1868+3.5);
+v1876 = v1875*0.999 + b/(v1869+4.5);
+v1877 = v1876*0.999 + b/(v1870+5.5);
+v1878 = v1877*0.999 + b/(v1871+6.5);
+v1879 = v1878*0.999 + b/(v1872+7.5);
+v1880 = v1879*0.999 + b/(v1873+8.5);
+v1881 = v1880*0.999 + b/(v1874+9.5);
+v1882 = v1881*0.999 + b/(v1875+10.5);
+v1883 = v1882*0.999 + b/(v1876+11.5);
+v1884 = v1883*0.999 + b/(v1877+12.5);
+v1885 = v1884*0.999 + b/(v1878+0.5);
+v1886 = v1885*0.999 + b/(v1879+1.5);
+v1887 = v1886*0.999 + b/(v1880+2.5);
+v1888 = v1887*0.999 + b/(v1881+3.5);
+v1889 = v1888*0.999 + b/(v1882+4.5);
+v1890 = v1889*0.999 + b/(v1883+5.5);
+v1891 = v1890*0.999 + b/(v1884+6.5);
+v1892 = v1891*0.999 + b/(v1885+7.5);
+v1893 = v1892*0.999 + b/(v1886+8.5);
+v1894 = v1893*0.999 + b/(v1887+9.5);
+v1895 = v1894*0.999 + b/(v1888+10.5);
+v1896 = v1895*0.999 + b/(v1889+11.5);
+v1897 = v1896*0.999 + b/(v1890+12.5);
+v1898 = v1897*0.999 + b/(v1891+0.5);
+v1899 = v1898*0.999 + b/(v1892+1.5);
+v1900 = v1899*0.999 + b/(v1893+2.5);
+v1901 = v1900*0.999 + b/(v1894+3.5);
+v1902 = v1901*0.999 + b/(v1895+4.5);
+v1903 = v1902*0.999 + b/(v1896+5.5);
+v1904 = v1903*0.999 + b/(v1897+6.5);
+v1905 = v1904*0.999 + b/(v1898+7.5);
+v1906 = v1905*0.999 + b/(v1899+8.5);
+v1907 = v1906*0.999 + b/(v1900+9.5);
+v1908 = v1907*0.999 + b/(v1901+10.5);
+v1909 = v1908*0.999 + b/(v1902+11.5);
+v1910 = v1909*0.999 + b/(v1903+12.5);
+v1911 = v1910*0.999 + b/(v1904+0.5);
+v1912 = v1911*0.999 + b/(v1905+1.5);
+v1913 = v1912*0.999 + b/(v1906+2.5);
+v1914 = v1913*0.999 + b/(v1907+3.5);
+v1915 = v1914*0.999 + b/(v1908+4.5);
+v1916 = v1915*0.999 + b/(v1909+5.5);
+v1917 = v1916*0.999 + b/(v1910+6.5);
+v1918 = v1917*0.999 + b/(v1911+7.5);
+v1919 = v1918*0.999 + b/(v1912+8.5);
+v1920 = v1919*0.999 + b/(v1913+9.5);
+v1921 = v1920*0.999 + b/(v1914+10.5);
+v1922 = v1921*0.999 + b/(v1915+11.5);
+v1923 = v1922*0.999 + b/(v1916+12.5);
+v1924 = v1923*0.999 + b/(v1917+0.5);
+v1925 = v1924*0.999 + b/(v1918+1.5);
+v1926 = v1925*0.999 + b/(v1919+2.5);
+v1927 = v1926*0.999 + b/(v1920+3.5);
+v1928 = v1927*0.999 + b/(v1921+4.5);
+v1929 = v1928*0.999 + b/(v1922+5.5);
+v1930 = v1929*0.999 + b/(v1923+6.5);
+v1931 = v1930*0.999 + b/(v1924+7.5);
+v1932 = v1931*0.999 + b/(v1925+8.5);
+v1933 = v1932*0.999 + b/(v1926+9.5);
+v1934 = v1933*0.999 + b/(v1927+10.5);
+v1935 = v1934*0.999 + b/(v1928+11.5);
+v1936 = v1935*0.999 + b/(v1929+12.5);
+v1937 = v1936*0.999 + b/(v1930+0.5);
+v1938 = v1937*0.999 + b/(v1931+1.5);
+v1939 = v1938*0.999 + b/(v1932+2.5);
+v1940 = v1939*0.999 + b/(v1933+3.5);
+v1941 = v1940*0.999 + b/(v1934+4.5);
+v1942 = v1941*0.999 + b/(v1935+5.5);
+v1943 = v1942*0.999 + b/(v1936+6.5);
+v1944 = v1943*0.999 + b/(v1937+7.5);
+v1945 = v1944*0.999 + b/(v1938+8.5);
+v1946 = v1945*0.999 + b/(v1939+9.5);
+v1947 = v1946*0.999 + b/(v1940+10.5);
+v1948 = v1947*0.999 + b/(v1941+11.5);
+v1949 = v1948*0.999 + b/(v1942+12.5);
+v1950 = v1949*0.999 + b/(v1943+0.5);
+v1951 = v1950*0.999 + b/(v1944+1.5);
+v1952 = v1951*0.999 + b/(v1945+2.5);
+v1953 = v1952*0.999 + b/(v1946+3.5);
+v1954 = v1953*0.999 + b/(v1947+4.5);
+v1955 = v1954*0.999 + b/(v1948+5.5);
+v1956 = v1955*0.999 + b/(v1949+6.5);
+v1957 = v1956*0.999 + b/(v1950+7.5);
+v1958 = v1957*0.999 + b/(v1951+8.5);
+v1959 = v1958*0.999 + b/(v1952+9.5);
+v1960 = v1959*0.999 + b/(v1953+10.5);
+v1961 = v1960*0.999 + b/(v1954+11.5);
+v1962 = v1961*0.999 + b/(v1955+12.5);
+v1963 = v1962*0.999 + b/(v1956+0.5);
+v1964 = v1963*0.999 + b/(v1957+1.5);
+v1965 = v1964*0.999 + b/(v1958+2.5);
+v1966 = v1965*0.999 + b/(v1959+3.5);
+v1967 = v1966*0.999 + b/(v1960+4.5);
+v1968 = v1967*0.999 + b/(v1961+5.5);
+v1969 = v1968*0.999 + b/(v1962+6.5);
+v1970 = v1969*0.999 + b/(v1963+7.5);
+v1971 = v1970*0.999 + b/(v1964+8.5);
+v1972 = v1971*0.999 + b/(v1965+9.5);
+v1973 = v1972*0.999 + b/(v1966+10.5);
+v1974 = v1973*0.999 + b/(v1967+11.5);
+v1975 = v1974*0.999 + b/(v1968+12.5);
+v1976 = v1975*0.999 + b/(v1969+0.5);
+v1977 = v1976*0.999 + b/(v1970+1.5);
+v1978 = v1977*0.999 + b/(v1971+2.5);
+v1979 = v1978*0.999 + b/(v1972+3.5);
+v1980 = v1979*0.999 + b/(v1973+4.5);
+v1981 = v1980*0.999 + b/(v1974+5.5);
+v1982 = v1981*0.999 + b/(v1975+6.5);
+v1983 = v1982*0.999 + b/(v1976+7.5);
+v1984 = v1983*0.999 + b/(v1977+8.5);
+v1985 = v1984*0.999 + b/(v1978+9.5);
+v1986 = v1985*0.999 + b/(v1979+10.5);
+v1987 = v1986*0.999 + b/(v1980+11.5);
+v1988 = v1987*0.999 + b/(v1981+12.5);
+v1989 = v1988*0.999 + b/(v1982+0.5);
+v1990 = v1989*0.999 + b/(v1983+1.5);
+v1991 = v1990*0.999 + b/(v1984+2.5);
+v1992 = v1991*0.999 + b/(v1985+3.5);
+v1993 = v1992*0.999 + b/(v1986+4.5);
+v1994 = v1993*0.999 + b/(v1987+5.5);
+v1995 = v1994*0.999 + b/(v1988+6.5);
+v1996 = v1995*0.999 + b/(v1989+7.5);
+v1997 = v1996*0.999 + b/(v1990+8.5);
+v1998 = v1997*0.999 + b/(v1991+9.5);
+v1999 = v1998*0.999 + b/(v1992+10.5);
+v2000 = v1999*0.999 + b/(v1993+11.5);
+v2001 = v2000*0.999 + b/(v1994+12.5);
+v2002 = v2001*0.999 + b/(v1995+0.5);
+v2003 = v2002*0.999 + b/(v1996+1.5);
+v2004 = v2003*0.999 + b/(v1997+2.5);
+v2005 = v2004*0.999 + b/(v1998+3.5);
+v2006 = v2005*0.999 + b/(v1999+4.5);
+v2007 = v2006*0.999 + b/(v2000+5.5);
+v2008 = v2007*0.999 + b/(v2001+6.5);
+v2009 = v2008*0.999 + b/(v2002+7.5);
+v2010 = v2009*0.999 + b/(v2003+8.5);
+v2011 = v2010*0.999 + b/(v2004+9.5);
+v2012 = v2011*0.999 + b/(v2005+10.5);
+v2013 = v2012*0.999 + b/(v2006+11.5);
+v2014 = v2013*0.999 + b/(v2007+12.5);
+v2015 = v2014*0.999 + b/(v2008+0.5);
+v2016 = v2015*0.999 + b/(v2009+1.5);
+v2017 = v2016*0.999 + b/(v2010+2.5);
+v2018 = v2017*0.999 + b/(v2011+3.5);
+v2019 = v2018*0.999 + b/(v2012+4.5);
+v2020 = v2019*0.999 + b/(v2013+5.5);
+v2021 = v2020*0.999 + b/(v2014+6.5);
+v2022 = v2021*0.999 + b/(v2015+7.5);
+v2023 = v2022*0.999 + b/(v2016+8.5);
+v2024 = v2023*0.999 + b/(v2017+9.5);
+v2025 = v2024*0.999 + b/(v2018+10.5);
+v2026 = v2025*0.999 + b/(v2019+11.5);
+v2027 = v2026*0.999 + b/(v2020+12.5);
+v2028 = v2027*0.999 + b/(v2021+0.5);
+v2029 = v2028*0.999 + b/(v2022+1.5);
+v2030 = v2029*0.999 + b/(v2023+2.5);
+v2031 = v2030*0.999 + b/(v2024+3.5);
+v2032 = v2031*0.999 + b/(v2025+4.5);
+v2033 = v2032*0.999 + b/(v2026+5.5);
+v2034 = v2033*0.999 + b/(v2027+6.5);
+v2035 = v2034*0.999 + b/(v2028+7.5);
+v2036 = v2035*0.999 + b/(v2029+8.5);
+v2037 = v2036*0.999 + b/(v2030+9.5);
+v2038 = v2037*0.999 + b/(v2031+10.5);
+v2039 = v2038*0.999 + b/(v2032+11.5);
+v2040 = v2039*0.999 + b/(v2033+12.5);
+v2041 = v2040*0.999 + b/(v2034+0.5);
+v2042 = v2041*0.999 + b/(v2035+1.5);
+v2043 = v2042*0.999 + b/(v2036+2.5);
+v2044 = v2043*0.999 + b/(v2037+3.5);
+v2045 = v2044*0.999 + b/(v2038+4.5);
+v2046 = v2045*0.999 + b/(v2039+5.5);
+v2047 = v2046*0.999 + b/(v2040+6.5);
+v2048 = v2047*0.999 + b/(v2041+7.5);
+v2049 = v2048*0.999 + b/(v2042+8.5);
+v2050 = v2049*0.999 + b/(v2043+9.5);
+v2051 = v2050*0.999 + b/(v2044+10.5);
+v2052 = v2051*0.999 + b/(v2045+11.5);
+v2053 = v2052*0.999 + b/(v2046+12.5);
+v2054 = v2053*0.999 + b/(v2047+0.5);
+v2055 = v2054*0.999 + b/(v2048+1.5);
+v2056 = v2055*0.999 + b/(v2049+2.5);
+v2057 = v2056*0.999 + b/(v2050+3.5);
+v2058 = v2057*0.999 + b/(v2051+4.5);
+v2059 = v2058*0.999 + b/(v2052+5.5);
+v2060 = v2059*0.999 + b/(v2053+6.5);
+v2061 = v2060*0.999 + b/(v2054+7.5);
+v2062 = v2061*0.999 + b/(v2055+8.5);
+v2063 = v2062*0.999 + b/(v2056+9.5);
+v2064 = v2063*0.999 + b/(v2057+10.5);
+v2065 = v2064*0.999 + b/(v2058+11.5);
+v2066 = v2065*0.999 + b/(v2059+12.5);
+v2067 = v2066*0.999 + b/(v2060+0.5);
+v2068 = v2067*0.999 + b/(v2061+1.5);
+v2069 = v2068*0.999 + b/(v2062+2.5);
+v2070 = v2069*0.999 + b/(v2063+3.5);
+v2071 = v2070*0.999 + b/(v2064+4.5);
+v2072 = v2071*0.999 + b/(v2065+5.5);
+v2073 = v2072*0.999 + b/(v2066+6.5);
+v2074 = v2073*0.999 + b/(v2067+7.5);
+v2075 = v2074*0.999 + b/(v2068+8.5);
+v2076 = v2075*0.999 + b/(v2069+9.5);
+v2077 = v2076*0.999 + b/(v2070+10.5);
+v2078 = v2077*0.999 + b/(v2071+11.5);
+v2079 = v2078*0.999 + b/(v2072+12.5);
+v2080 = v2079*0.999 + b/(v2073+0.5);
+v2081 = v2080*0.999 + b/(v2074+1.5);
+v2082 = v2081*0.999 + b/(v2075+2.5);
+v2083 = v2082*0.999 + b/(v2076+3.5);
+v2084 = v2083*0.999 + b/(v2077+4.5);
+v2085 = v2084*0.999 + b/(v2078+5.5);
+v2086 = v2085*0.999 + b/(v2079+6.5);
+v2087 = v2086*0.999 + b/(v2080+7.5);
+v2088 = v2087*0.999 + b/(v2081+8.5);
+v2089 = v2088*0.999 + b/(v2082+9.5);
+v2090 = v2089*0.999 + b/(v2083+10.5);
+v2091 = v2090*0.999 + b/(v2084+11.5);
+v2092 = v2091*0.999 + b/(v2085+12.5);
+v2093 = v2092*0.999 + b/(v2086+0.5);
+v2094 = v2093*0.999 + b/(v2087+1.5);
+v2095 = v2094*0.999 + b/(v2088+2.5);
+v2096 = v2095*0.999 + b/(v2089+3.5);
+v2097 = v2096*0.999 + b/(v2090+4.5);
+v2098 = v2097*0.999 + b/(v2091+5.5);
+v2099 = v2098*0.999 + b/(v2092+6.5);
+v2100 = v2099*0.999 + b/(v2093+7.5);
+v2101 = v2100*0.999 + b/(v2094+8.5);
+v2102 = v2101*0.999 + b/(v2095+9.5);
+v2103 = v2102*0.999 + b/(v2096+10.5);
+v2104 = v2103*0.999 + b/(v2097+11.5);
+v2105 = v2104*0.999 + b/(v2098+12.5);
+v2106 = v2105*0.999 + b/(v2099+0.5);
+v2107 = v2106*0.999 + b/(v2100+1.5);
+v2108 = v2107*0.999 + b/(v2101+2.5);
+v2109 = v2108*0.999 + b/(v2102+3.5);
+v2110 = v2109*0.999 + b/(v2103+4.5);
+v2111 = v2110*0.999 + b/(v2104+5.5);
+v2112 = v2111*0.999 + b/(v2105+6.5);
+v2113 = v2112*0.999 + b/(v2106+7.5);
+v2114 = v2113*0.999 + b/(v2107+8.5);
+v2115 = v2114*0.999 + b/(v2108+9.5);
+v2116 = v2115*0.999 + b/(v2109+10.5);
+v2117 = v2116*0.999 + b/(v2110+11.5);
+v2118 = v2117*0.999 + b/(v2111+12.5);
+v2119 = v2118*0.999 + b/(v2112+0.5);
+v2120 = v2119*0.999 + b/(v2113+1.5);
+v2121 = v2120*0.999 + b/(v2114+2.5);
+v2122 = v2121*0.999 + b/(v2115+3.5);
+v2123 = v2122*0.999 + b/(v2116+4.5);
+v2124 = v2123*0.999 + b/(v2117+5.5);
+v2125 = v2124*0.999 + b/(v2118+6.5);
+v2126 = v2125*0.999 + b/(v2119+7.5);
+v2127 = v2126*0.999 + b/(v2120+8.5);
+v2128 = v2127*0.999 + b/(v2121+9.5);
+v2129 = v2128*0.999 + b/(v2122+10.5);
+v2130 = v2129*0.999 + b/(v2123+11.5);
+v2131 = v2130*0.999 + b/(v2124+12.5);
+v2132 = v2131*0.999 + b/(v2125+0.5);
+v2133 = v2132*0.999 + b/(v2126+1.5);
+v2134 = v2133*0.999 + b/(v2127+2.5);
+v2135 = v2134*0.999 + b/(v2128+3.5);
+v2136 = v2135*0.999 + b/(v2129+4.5);
+v2137 = v2136*0.999 + b/(v2130+5.5);
+v2138 = v2137*0.999 + b/(v2131+6.5);
+v2139 = v2138*0.999 + b/(v2132+7.5);
+v2140 = v2139*0.999 + b/(v2133+8.5);
+v2141 = v2140*0.999 + b/(v2134+9.5);
+v2142 = v2141*0.999 + b/(v2135+10.5);
+v2143 = v2142*0.999 + b/(v2136+11.5);
+v2144 = v2143*0.999 + b/(v2137+12.5);
+v2145 = v2144*0.999 + b/(v2138+0.5);
+v2146 = v2145*0.999 + b/(v2139+1.5);
+v2147 = v2146*0.999 + b/(v2140+2.5);
+v2148 = v2147*0.999 + b/(v2141+3.5);
+v2149 = v2148*0.999 + b/(v2142+4.5);
+v2150 = v2149*0.999 + b/(v2143+5.5);
+v2151 = v2150*0.999 + b/(v2144+6.5);
+v2152 = v2151*0.999 + b/(v2145+7.5);
+v2153 = v2152*0.999 + b/(v2146+8.5);
+v2154 = v2153*0.999 + b/(v2147+9.5);
+v2155 = v2154*0.999 + b/(v2148+10.5);
+v2156 = v2155*0.999 + b/(v2149+11.5);
+v2157 = v2156*0.999 + b/(v2150+12.5);
+v2158 = v2157*0.999 + b/(v2151+0.5);
+v2159 = v2158*0.999 + b/(v2152+1.5);
+v2160 = v2159*0.999 + b/(v2153+2.5);
+v2161 = v2160*0.999 + b/(v2154+3.5);
+v2162 = v2161*0.999 + b/(v2155+4.5);
+v2163 = v2162*0.999 + b/(v2156+5.5);
+v2164 = v2163*0.999 + b/(v2157+6.5);
+v2165 = v2164*0.999 + b/(v2158+7.5);
+v2166 = v2165*0.999 + b/(v2159+8.5);
+v2167 = v2166*0.999 + b/(v2160+9.5);
+v2168 = v2167*0.999 + b/(v2161+10.5);
+v2169 = v2168*0.999 + b/(v2162+11.5);
+v2170 = v2169*0.999 + b/(v2163+12.5);
+v2171 = v2170*0.999 + b/(v2164+0.5);
+v2172 = v2171*0.999 + b/(v2165+1.5);
+v2173 = v2172*0.999 + b/(v2166+2.5);
+v2174 = v2173*0.999 + b/(v2167+3.5);
+v2175 = v2174*0.999 + b/(v2168+4.5);
+v2176 = v2175*0.999 + b/(v2169+5.5);
+v2177 = v2176*0.999 + b/(v2170+6.5);
+v2178 = v2177*0.999 + b/(v2171+7.5);
+v2179 = v2178*0.999 + b/(v2172+8.5);
+v2180 = v2179*0.999 + b/(v2173+9.5);
+v2181 = v2180*0.999 + b/(v2174+10.5);
+v2182 = v2181*0.999 + b/(v2175+11.5);
+v2183 = v2182*0.999 + b/(v2176+12.5);
+v2184 = v2183*0.999 + b/(v2177+0.5);
+v2185 = v2184*0.999 + b/(v2178+1.5);
+v2186 = v2185*0.999 + b/(v2179+2.5);
+v2187 = v2186*0.999 + b/(v2180+3.5);
+v2188 = v2187*0.999 + b/(v2181+4.5);
+v2189 = v2188*0.999 + b/(v2182+5.5);
+v2190 = v2189*0.999 + b/(v2183+6.5);
+v2191 = v2190*0.999 + b/(v2184+7.5);
+v2192 = v2191*0.999 + b/(v2185+8.5);
+v2193 = v2192*0.999 + b/(v2186+9.5);
+v2194 = v2193*0.999 + b/(v2187+10.5);
+v2195 = v2194*0.999 + b/(v2188+11.5);
+v2196 = v2195*0.999 + b/(v2189+12.5);
+v2197 = v2196*0.999 + b/(v2190+0.5);
+v2198 = v2197*0.999 + b/(v2191+1.5);
+v2199 = v2198*0.999 + b/(v2192+2.5);
+v2200 = v2199*0.999 + b/(v2193+3.5);
+v2201 = v2200*0.999 + b/(v2194+4.5);
+v2202 = v2201*0.999 + b/(v2195+5.5);
+v2203 = v2202*0.999 + b/(v2196+6.5);
+v2204 = v2203*0.999 + b/(v2197+7.5);
+v2205 = v2204*0.999 + b/(v2198+8.5);
+v2206 = v2205*0.999 + b/(v2199+9.5);
+v2207 = v2206*0.999 + b/(v2200+10.5);
+v2208 = v2207*0.999 + b/(v2201+11.5);
+v2209 = v2208*0.999 + b/(v2202+12.5);
+v2210 = v2209*0.999 + b/(v2203+0.5);
+v2211 = v2210*0.999 + b/(v2204+1.5);
+v2212 = v2211*0.999 + b/(v2205+2.5);
+v2213 = v2212*0.999 + b/(v2206+3.5);
+v2214 = v2213*0.999 + b/(v2207+4.5);
+v2215 = v2214*0.999 + b/(v2208+5.5);
+v2216 = v2215*0.999 + b/(v2209+6.5);
+v2217 = v2216*0.999 + b/(v2210+7.5);
+v2218 = v2217*0.999 + b/(v2211+8.5);
+v2219 = v2218*0.999 + b/(v2212+9.5);
+v2220 = v2219*0.999 + b/(v2213+10.5);
+v2221 = v2220*0.999 + b/(v2214+11.5);
+v2222 = v2221*0.999 + b/(v2215+12.5);
+v2223 = v2222*0.999 + b/(v2216+0.5);
+v2224 = v2223*0.999 + b/(v2217+1.5);
+v2225 = v2224*0.999 + b/(v2218+2.5);
+v2226 = v2225*0.999 + b/(v2219+3.5);
+v2227 = v2226*0.999 + b/(v2220+4.5);
+v2228 = v2227*0.999 + b/(v2221+5.5);
+v2229 = v2228*0.999 + b/(v2222+6.5);
+v2230 = v2229*0.999 + b/(v2223+7.5);
+v2231 = v2230*0.999 + b/(v2224+8.5);
+v2232 = v2231*0.999 + b/(v2225+9.5);
+v2233 = v2232*0.999 + b/(v2226+10.5);
+v2234 = v2233*0.999 + b/(v2227+11.5);
+v2235 = v2234*0.999 + b/(v2228+12.5);
+v2236 = v2235*0.999 + b/(v2229+0.5);
+v2237 = v2236*0.999 + b/(v2230+1.5);
+v2238 = v2237*0.999 + b/(v2231+2.5);
+v2239 = v2238*0.999 + b/(v2232+3.5);
+v2240 = v2239*0.999 + b/(v2233+4.5);
+v2241 = v2240*0.999 + b/(v2234+5.5);
+v2242 = v2241*0.999 + b/(v2235+6.5);
+v2243 = v2242*0.999 + b/(v2236+7.5);
+v2244 = v2243*0.999 + b/(v2237+8.5);
+v2245 = v2244*0.999 + b/(v2238+9.5);
+v2246 = v2245*0.999 + b/(v2239+10.5);
+v2247 = v2246*0.999 + b/(v2240+11.5);
+v2248 = v2247*0.999 + b/(v2241+12.5);
+v2249 = v2248*0.999 + b/(v2242+0.5);
+v2250 = v2249*0.999 + b/(v2243+1.5);
+v2251 = v2250*0.999 + b/(v2244+2.5);
+v2252 = v2251*0.999 + b/(v2245+3.5);
+v2253 = v2252*0.999 + b/(v2246+4.5);
+v2254 = v2253*0.999 + b/(v2247+5.5);
+v2255 = v2254*0.999 + b/(v2248+6.5);
+v2256 = v2255*0.999 + b/(v2249+7.5);
+v2257 = v2256*0.999 + b/(v2250+8.5);
+v2258 = v2257*0.999 + b/(v2251+9.5);
+v2259 = v2258*0.999 + b/(v2252+10.5);
+v2260 = v2259*0.999 + b/(v2253+11.5);
+v2261 = v2260*0.999 + b/(v2254+12.5);
+v2262 = v2261*0.999 + b/(v2255+0.5);
+v2263 = v2262*0.999 + b/(v2256+1.5);
+v2264 = v2263*0.999 + b/(v2257+2.5);
+v2265 = v2264*0.999 + b/(v2258+3.5);
+v2266 = v2265*0.999 + b/(v2259+4.5);
+v2267 = v2266*0.999 + b/(v2260+5.5);
+v2268 = v2267*0.999 + b/(v2261+6.5);
+v2269 = v2268*0.999 + b/(v2262+7.5);
+v2270 = v2269*0.999 + b/(v2263+8.5);
+v2271 = v2270*0.999 + b/(v2264+9.5);
+v2272 = v2271*0.999 + b/(v2265+10.5);
+v2273 = v2272*0.999 + b/(v2266+11.5);
+v2274 = v2273*0.999 + b/(v2267+12.5);
+v2275 = v2274*0.999 + b/(v2268+0.5);
+v2276 = v2275*0.999 + b/(v2269+1.5);
+v2277 = v2276*0.999 + b/(v2270+2.5);
+v2278 = v2277*0.999 + b/(v2271+3.5);
+v2279 = v2278*0.999 + b/(v2272+4.5);
+v2280 = v2279*0.999 + b/(v2273+5.5);
+v2281 = v2280*0.999 + b/(v2274+6.5);
+v2282 = v2281*0.999 + b/(v2275+7.5);
+v2283 = v2282*0.999 + b/(v2276+8.5);
+v2284 = v2283*0.999 + b/(v2277+9.5);
+v2285 = v2284*0.999 + b/(v2278+10.5);
+v2286 = v2285*0.999 + b/(v2279+11.5);
+v2287 = v2286*0.999 + b/(v2280+12.5);
+v2288 = v2287*0.999 + b/(v2281+0.5);
+v2289 = v2288*0.999 + b/(v2282+1.5);
+v2290 = v2289*0.999 + b/(v2283+2.5);
+v2291 = v2290*0.999 + b/(v2284+3.5);
+v2292 = v2291*0.999 + b/(v2285+4.5);
+v2293 = v2292*0.999 + b/(v2286+5.5);
+v2294 = v2293*0.999 + b/(v2287+6.5);
+v2295 = v2294*0.999 + b/(v2288+7.5);
+v2296 = v2295*0.999 + b/(v2289+8.5);
+v2297 = v2296*0.999 + b/(v2290+9.5);
+v2298 = v2297*0.999 + b/(v2291+10.5);
+v2299 = v2298*0.999 + b/(v2292+11.5);
+v2300 = v2299*0.999 + b/(v2293+12.5);
+v2301 = v2300*0.999 + b/(v2294+0.5);
+v2302 = v2301*0.999 + b/(v2295+1.5);
+v2303 = v2302*0.999 + b/(v2296+2.5);
+v2304 = v2303*0.999 + b/(v2297+3.5);
+v2305 = v2304*0.999 + b/(v2298+4.5);
+v2306 = v2305*0.999 + b/(v2299+5.5);
+v2307 = v2306*0.999 + b/(v2300+6.5);
+v2308 = v2307*0.999 + b/(v2301+7.5);
+v2309 = v2308*0.999 + b/(v2302+8.5);
+v2310 = v2309*0.999 + b/(v2303+9.5);
+v2311 = v2310*0.999 + b/(v2304+10.5);
+v2312 = v2311*0.999 + b/(v2305+11.5);
+v2313 = v2312*0.999 + b/(v2306+12.5);
+v2314 = v2313*0.999 + b/(v2307+0.5);
+v2315 = v2314*0.999 + b/(v2308+1.5);
+v2316 = v2315*0.999 + b/(v2309+2.5);
+v2317 = v2316*0.999 + b/(v2310+3.5);
+v2318 = v2317*0.999 + b/(v2311+4.5);
+v2319 = v2318*0.999 + b/(v2312+5.5);
+v2320 = v2319*0.999 + b/(v2313+6.5);
+v2321 = v2320*0.999 + b/(v2314+7.5);
+v2322 = v2321*0.999 + b/(v2315+8.5);
+v2323 = v2322*0.999 + b/(v2316+9.5);
+v2324 = v2323*0.999 + b/(v2317+10.5);
+v2325 = v2324*0.999 + b/(v2318+11.5);
+v2326 = v2325*0.999 + b/(v2319+12.5);
+v2327 = v2326*0.999 + b/(v2320+0.5);
+v2328 = v2327*0.999 + b/(v2321+1.5);
+v2329 = v2328*0.999 + b/(v2322+2.5);
+v2330 = v2329*0.999 + b/(v2323+3.5);
+v2331 = v2330*0.999 + b/(v2324+4.5);
+v2332 = v2331*0.999 + b/(v2325+5.5);
+v2333 = v2332*0.999 + b/(v2326+6.5);
+v2334 = v2333*0.999 + b/(v2327+7.5);
+v2335 = v2334*0.999 + b/(v2328+8.5);
+v2336 = v2335*0.999 + b/(v2329+9.5);
+v2337 = v2336*0.999 + b/(v2330+10.5);
+v2338 = v2337*0.999 + b/(v2331+11.5);
+v2339 = v2338*0.999 + b/(v2332+12.5);
+v2340 = v2339*0.999 + b/(v2333+0.5);
+v2341 = v2340*0.999 + b/(v2334+1.5);
+v2342 = v2341*0.999 + b/(v2335+2.5);
+v2343 = v2342*0.999 + b/(v2336+3.5);
+v2344 = v2343*0.999 + b/(v2337+4.5);
+v2345 = v2344*0.999 + b/(v2338+5.5);
+v2346 = v2345*0.999 + b/(v2339+6.5);
+v2347 = v2346*0.999 + b/(v2340+7.5);
+v2348 = v2347*0.999 + b/(v2341+8.5);
+v2349 = v2348*0.999 + b/(v2342+9.5);
+v2350 = v2349*0.999 + b/(v2343+10.5);
+v2351 = v2350*0.999 + b/(v2344+11.5);
+v2352 = v2351*0.999 + b/(v2345+12.5);
+v2353 = v2352*0.999 + b/(v2346+0.5);
+v2354 = v2353*0.999 + b/(v2347+1.5);
+v2355 = v2354*0.999 + b/(v2348+2.5);
+v2356 = v2355*0.999 + b/(v2349+3.5);
+v2357 = v2356*0.999 + b/(v2350+4.5);
+v2358 = v2357*0.999 + b/(v2351+5.5);
+v2359 = v2358*0.999 + b/(v2352+6.5);
+v2360 = v2359*0.999 + b/(v2353+7.5);
+v2361 = v2360*0.999 + b/(v2354+8.5);
+v2362 = v2361*0.999 + b/(v2355+9.5);
+v2363 = v2362*0.999 + b/(v2356+10.5);
+v2364 = v2363*0.999 + b/(v2357+11.5);
+v2365 = v2364*0.999 + b/(v2358+12.5);
+v2366 = v2365*0.999 + b/(v2359+0.5);
+v2367 = v2366*0.999 + b/(v2360+1.5);
+v2368 = v2367*0.999 + b/(v2361+2.5);
+v2369 = v2368*0.999 + b/(v2362+3.5);
+v2370 = v2369*0.999 + b/(v2363+4.5);
+v2371 = v2370*0.999 + b/(v2364+5.5);
+v2372 = v2371*0.999 + b/(v2365+6.5);
+v2373 = v2372*0.999 + b/(v2366+7.5);
+v2374 = v2373*0.999 + b/(v2367+8.5);
+v2375 = v2374*0.999 + b/(v2368+9.5);
+v2376 = v2375*0.999 + b/(v2369+10.5);
+v2377 = v2376*0.999 + b/(v2370+11.5);
+v2378 = v2377*0.999 + b/(v2371+12.5);
+v2379 = v2378*0.999 + b/(v2372+0.5);
+v2380 = v2379*0.999 + b/(v2373+1.5);
+v2381 = v2380*0.999 + b/(v2374+2.5);
+v2382 = v2381*0.999 + b/(v2375+3.5);
+v2383 = v2382*0.999 + b/(v2376+4.5);
+v2384 = v2383*0.999 + b/(v2377+5.5);
+v2385 = v2384*0.999 + b/(v2378+6.5);
+v2386 = v2385*0.999 + b/(v2379+7.5);
+v2387 = v2386*0.999 + b/(v2380+8.5);
+v2388 = v2387*0.999 + b/(v2381+9.5);
+v2389 = v2388*0.999 + b/(v2382+10.5);
+v2390 = v2389*0.999 + b/(v2383+11.5);
+v2391 = v2390*0.999 + b/(v2384+12.5);
+v2392 = v2391*0.999 + b/(v2385+0.5);
+v2393 = v2392*0.999 + b/(v2386+1.5);
+v2394 = v2393*0.999 + b/(v2387+2.5);
+v2395 = v2394*0.999 + b/(v2388+3.5);
+v2396 = v2395*0.999 + b/(v2389+4.5);
+v2397 = v2396*0.999 + b/(v2390+5.5);
+v2398 = v2397*0.999 + b/(v2391+6.5);
+v2399 = v2398*0.999 + b/(v2392+7.5);
+v2400 = v2399*0.999 + b/(v2393+8.5);
+v2401 = v2400*0.999 + b/(v2394+9.5);
+v2402 = v2401*0.999 + b/(v2395+10.5);
+v2403 = v2402*0.999 + b/(v2396+11.5);
+v2404 = v2403*0.999 + b/(v2397+12.5);
+v2405 = v2404*0.999 + b/(v2398+0.5);
+v2406 = v2405*0.999 + b/(v2399+1.5);
+v2407 = v2406*0.999 + b/(v2400+2.5);
+v2408 = v2407*0.999 + b/(v2401+3.5);
+v2409 = v2408*0.999 + b/(v2402+4.5);
+v2410 = v2409*0.999 + b/(v2403+5.5);
+v2411 = v2410*0.999 + b/(v2404+6.5);
+v2412 = v2411*0.999 + b/(v2405+7.5);
+v2413 = v2412*0.999 + b/(v2406+8.5);
+v2414 = v2413*0.999 + b/(v2407+9.5);
+v2415 = v2414*0.999 + b/(v2408+10.5);
+v2416 = v2415*0.999 + b/(v2409+11.5);
+v2417 = v2416*0.999 + b/(v2410+12.5);
+v2418 = v2417*0.999 + b/(v2411+0.5);
+v2419 = v2418*0.999 + b/(v2412+1.5);
+v2420 = v2419*0.999 + b/(v2413+2.5);
+v2421 = v2420*0.999 + b/(v2414+3.5);
+v2422 = v2421*0.999 + b/(v2415+4.5);
+v2423 = v2422*0.999 + b/(v2416+5.5);
+v2424 = v2423*0.999 + b/(v2417+6.5);
+v2425 = v2424*0.999 + b/(v2418+7.5);
+v2426 = v2425*0.999 + b/(v2419+8.5);
+v2427 = v2426*0.999 + b/(v2420+9.5);
+v2428 = v2427*0.999 + b/(v2421+10.5);
+v2429 = v2428*0.999 + b/(v2422+11.5);
+v2430 = v2429*0.999 + b/(v2423+12.5);
+v2431 = v2430*0.999 + b/(v2424+0.5);
+v2432 = v2431*0.999 + b/(v2425+1.5);
+v2433 = v2432*0.999 + b/(v2426+2.5);
+v2434 = v2433*0.999 + b/(v2427+3.5);
+v2435 = v2434*0.999 + b/(v2428+4.5);
+v2436 = v2435*0.999 + b/(v2429+5.5);
+v2437 = v2436*0.999 + b/(v2430+6.5);
+v2438 = v2437*0.999 + b/(v2431+7.5);
+v2439 = v2438*0.999 + b/(v2432+8.5);
+v2440 = v2439*0.999 + b/(v2433+9.5);
+v2441 = v2440*0.999 + b/(v2434+10.5);
+v2442 = v2441*0.999 + b/(v2435+11.5);
+v2443 = v2442*0.999 + b/(v2436+12.5);
+v2444 = v2443*0.999 + b/(v2437+0.5);
+v2445 = v2444*0.999 + b/(v2438+1.5);
+v2446 = v2445*0.999 + b/(v2439+2.5);
+v2447 = v2446*0.999 + b/(v2440+3.5);
+v2448 = v2447*0.999 + b/(v2441+4.5);
+v2449 = v2448*0.999 + b/(v2442+5.5);
+v2450 = v2449*0.999 + b/(v2443+6.5);
+v2451 = v2450*0.999 + b/(v2444+7.5);
+v2452 = v2451*0.999 + b/(v2445+8.5);
+v2453 = v2452*0.999 + b/(v2446+9.5);
+v2454 = v2453*0.999 + b/(v2447+10.5);
+v2455 = v2454*0.999 + b/(v2448+11.5);
+v2456 = v2455*0.999 + b/(v2449+12.5);
+v2457 = v2456*0.999 + b/(v2450+0.5);
+v2458 = v2457*0.999 + b/(v2451+1.5);
+v2459 = v2458*0.999 + b/(v2452+2.5);
+v2460 = v2459*0.999 + b/(v2453+3.5);
+v2461 = v2460*0.999 + b/(v2454+4.5);
+v2462 = v2461*0.999 + b/(v2455+5.5);
+v2463 = v2462*0.999 + b/(v2456+6.5);
+v2464 = v2463*0.999 + b/(v2457+7.5);
+v2465 = v2464*0.999 + b/(v2458+8.5);
+v2466 = v2465*0.999 + b/(v2459+9.5);
+v2467 = v2466*0.999 + b/(v2460+10.5);
+v2468 = v2467*0.999 + b/(v2461+11.5);
+v2469 = v2468*0.999 + b/(v2462+12.5);
+v2470 = v2469*0.999 + b/(v2463+0.5);
+v2471 = v2470*0.999 + b/(v2464+1.5);
+v2472 = v2471*0.999 + b/(v2465+2.5);
+v2473 = v2472*0.999 + b/(v2466+3.5);
+v2474 = v2473*0.999 + b/(v2467+4.5);
+v2475 = v2474*0.999 + b/(v2468+5.5);
+v2476 = v2475*0.999 + b/(v2469+6.5);
+v2477 = v2476*0.999 + b/(v2470+7.5);
+v2478 = v2477*0.999 + b/(v2471+8.5);
+v2479 = v2478*0.999 + b/(v2472+9.5);
+v2480 = v2479*0.999 + b/(v2473+10.5);
+v2481 = v2480*0.999 + b/(v2474+11.5);
+v2482 = v2481*0.999 + b/(v2475+12.5);
+v2483 = v2482*0.999 + b/(v2476+0.5);
+v2484 = v2483*0.999 + b/(v2477+1.5);
+v2485 = v2484*0.999 + b/(v2478+2.5);
+v2486 = v2485*0.999 + b/(v2479+3.5);
+v2487 = v2486*0.999 + b/(v2480+4.5);
+v2488 = v2487*0.999 + b/(v2481+5.5);
+v2489 = v2488*0.999 + b/(v2482+6.5);
+v2490 = v2489*0.999 + b/(v2483+7.5);
+v2491 = v2490*0.999 + b/(v2484+8.5);
+v2492 = v2491*0.999 + b/(v2485+9.5);
+v2493 = v2492*0.999 + b/(v2486+10.5);
+v2494 = v2493*0.999 + b/(v2487+11.5);
+v2495 = v2494*0.999 + b/(v2488+12.5);
+v2496 = v2495*0.999 + b/(v2489+0.5);
+v2497 = v2496*0.999 + b/(v2490+1.5);
+v2498 = v2497*0.999 + b/(v2491+2.5);
+v2499 = v2498*0.999 + b/(v2492+3.5);
+v2500 = v2499*0.999 + b/(v2493+4.5);
+v2501 = v2500*0.999 + b/(v2494+5.5);
+v2502 = v2501*0.999 + b/(v2495+6.5);
+v2503 = v2502*0.999 + b/(v2496+7.5);
+v2504 = v2503*0.999 + b/(v2497+8.5);
+v2505 = v2504*0.999 + b/(v2498+9.5);
+v2506 = v2505*0.999 + b/(v2499+10.5);
+v2507 = v2506*0.999 + b/(v2500+11.5);
+v2508 = v2507*0.999 + b/(v2501+12.5);
+v2509 = v2508*0.999 + b/(v2502+0.5);
+v2510 = v2509*0.999 + b/(v2503+1.5);
+v2511 = v2510*0.999 + b/(v2504+2.5);
+v2512 = v2511*0.999 + b/(v2505+3.5);
+v2513 = v2512*0.999 + b/(v2506+4.5);
+v2514 = v2513*0.999 + b/(v2507+5.5);
+v2515 = v2514*0.999 + b/(v2508+6.5);
+v2516 = v2515*0.999 + b/(v2509+7.5);
+v2517 = v2516*0.999 + b/(v2510+8.5);
+v2518 = v2517*0.999 + b/(v2511+9.5);
+v2519 = v2518*0.999 + b/(v2512+10.5);
+v2520 = v2519*0.999 + b/(v2513+11.5);
+v2521 = v2520*0.999 + b/(v2514+12.5);
+v2522 = v2521*0.999 + b/(v2515+0.5);
+v2523 = v2522*0.999 + b/(v2516+1.5);
+v2524 = v2523*0.999 + b/(v2517+2.5);
+v2525 = v2524*0.999 + b/(v2518+3.5);
+v2526 = v2525*0.999 + b/(v2519+4.5);
+v2527 = v2526*0.999 + b/(v2520+5.5);
+v2528 = v2527*0.999 + b/(v2521+6.5);
+v2529 = v2528*0.999 + b/(v2522+7.5);
+v2530 = v2529*0.999 + b/(v2523+8.5);
+v2531 = v2530*0.999 + b/(v2524+9.5);
+v2532 = v2531*0.999 + b/(v2525+10.5);
+v2533 = v2532*0.999 + b/(v2526+11.5);
+v2534 = v2533*0.999 + b/(v2527+12.5);
+v2535 = v2534*0.999 + b/(v2528+0.5);
+v2536 = v2535*0.999 + b/(v2529+1.5);
+v2537 = v2536*0.999 + b/(v2530+2.5);
+v2538 = v2537*0.999 + b/(v2531+3.5);
+v2539 = v2538*0.999 + b/(v2532+4.5);
+v2540 = v2539*0.999 + b/(v2533+5.5);
+v2541 = v2540*0.999 + b/(v2534+6.5);
+v2542 = v2541*0.999 + b/(v2535+7.5);
+v2543 = v2542*0.999 + b/(v2536+8.5);
+v2544 = v2543*0.999 + b/(v2537+9.5);
+v2545 = v2544*0.999 + b/(v2538+10.5);
+v2546 = v2545*0.999 + b/(v2539+11.5);
+v2547 = v2546*0.999 + b/(v2540+12.5);
+v2548 = v2547*0.999 + b/(v2541+0.5);
+v2549 = v2548*0.999 + b/(v2542+1.5);
+v2550 = v2549*0.999 + b/(v2543+2.5);
+v2551 = v2550*0.999 + b/(v2544+3.5);
+v2552 = v2551*0.999 + b/(v2545+4.5);
+v2553 = v2552*0.999 + b/(v2546+5.5);
+v2554 = v2553*0.999 + b/(v2547+6.5);
+v2555 = v2554*0.999 + b/(v2548+7.5);
+v2556 = v2555*0.999 + b/(v2549+8.5);
+v2557 = v2556*0.999 + b/(v2550+9.5);
+v2558 = v2557*0.999 + b/(v2551+10.5);
+v2559 = v2558*0.999 + b/(v2552+11.5);
+v2560 = v2559*0.999 + b/(v2553+12.5);
+v2561 = v2560*0.999 + b/(v2554+0.5);
+v2562 = v2561*0.999 + b/(v2555+1.5);
+v2563 = v2562*0.999 + b/(v2556+2.5);
+v2564 = v2563*0.999 + b/(v2557+3.5);
+v2565 = v2564*0.999 + b/(v2558+4.5);
+v2566 = v2565*0.999 + b/(v2559+5.5);
+v2567 = v2566*0.999 + b/(v2560+6.5);
+v2568 = v2567*0.999 + b/(v2561+7.5);
+v2569 = v2568*0.999 + b/(v2562+8.5);
+v2570 = v2569*0.999 + b/(v2563+9.5);
+v2571 = v2570*0.999 + b/(v2564+10.5);
+v2572 = v2571*0.999 + b/(v2565+11.5);
+v2573 = v2572*0.999 + b/(v2566+12.5);
+v2574 = v2573*0.999 + b/(v2567+0.5);
+v2575 = v2574*0.999 + b/(v2568+1.5);
+v2576 = v2575*0.999 + b/(v2569+2.5);
+v2577 = v2576*0.999 + b/(v2570+3.5);
+v2578 = v2577*0.999 + b/(v2571+4.5);
+v2579 = v2578*0.999 + b/(v2572+5.5);
+v2580 = v2579*0.999 + b/(v2573+6.5);
+v2581 = v2580*0.999 + b/(v2574+7.5);
+v2582 = v2581*0.999 + b/(v2575+8.5);
+v2583 = v2582*0.999 + b/(v2576+9.5);
+v2584 = v2583*0.999 + b/(v2577+10.5);
+v2585 = v2584*0.999 + b/(v2578+11.5);
+v2586 = v2585*0.999 + b/(v2579+12.5);
+v2587 = v2586*0.999 + b/(v2580+0.5);
+v2588 = v2587*0.999 + b/(v2581+1.5);
+v2589 = v2588*0.999 + b/(v2582+2.5);
+v2590 = v2589*0.999 + b/(v2583+3.5);
+v2591 = v2590*0.999 + b/(v2584+4.5);
+v2592 = v2591*0.999 + b/(v2585+5.5);
+v2593 = v2592*0.999 + b/(v2586+6.5);
+v2594 = v2593*0.999 + b/(v2587+7.5);
+v2595 = v2594*0.999 + b/(v2588+8.5);
+v2596 = v2595*0.999 + b/(v2589+9.5);
+v2597 = v2596*0.999 + b/(v2590+10.5);
+v2598 = v2597*0.999 + b/(v2591+11.5);
+v2599 = v2598*0.999 + b/(v2592+12.5);
+v2600 = v2599*0.999 + b/(v2593+0.5);
+v2601 = v2600*0.999 + b/(v2594+1.5);
+v2602 = v2601*0.999 + b/(v2595+2.5);
+v2603 = v2602*0.999 + b/(v2596+3.5);
+v2604 = v2603*0.999 + b/(v2597+4.5);
+v2605 = v2604*0.999 + b/(v2598+5.5);
+v2606 = v2605*0.999 + b/(v2599+6.5);
+v2607 = v2606*0.999 + b/(v2600+7.5);
+v2608 = v2607*0.999 + b/(v2601+8.5);
+v2609 = v2608*0.999 + b/(v2602+9.5);
+v2610 = v2609*0.999 + b/(v2603+10.5);
+v2611 = v2610*0.999 + b/(v2604+11.5);
+v2612 = v2611*0.999 + b/(v2605+12.5);
+v2613 = v2612*0.999 + b/(v2606+0.5);
+v2614 = v2613*0.999 + b/(v2607+1.5);
+v2615 = v2614*0.999 + b/(v2608+2.5);
+v2616 = v2615*0.999 + b/(v2609+3.5);
+v2617 = v2616*0.999 + b/(v2610+4.5);
+v2618 = v2617*0.999 + b/(v2611+5.5);
+v2619 = v2618*0.999 + b/(v2612+6.5);
+v2620 = v2619*0.999 + b/(v2613+7.5);
+v2621 = v2620*0.999 + b/(v2614+8.5);
+v2622 = v2621*0.999 + b/(v2615+9.5);
+v2623 = v2622*0.999 + b/(v2616+10.5);
+v2624 = v2623*0.999 + b/(v2617+11.5);
+v2625 = v2624*0.999 + b/(v2618+12.5);
+v2626 = v2625*0.999 + b/(v2619+0.5);
+v2627 = v2626*0.999 + b/(v2620+1.5);
+v2628 = v2627*0.999 + b/(v2621+2.5);
+v2629 = v2628*0.999 + b/(v2622+3.5);
+v2630 = v2629*0.999 + b/(v2623+4.5);
+v2631 = v2630*0.999 + b/(v2624+5.5);
+v2632 = v2631*0.999 + b/(v2625+6.5);
+v2633 = v2632*0.999 + b/(v2626+7.5);
+v2634 = v2633*0.999 + b/(v2627+8.5);
+v2635 = v2634*0.999 + b/(v2628+9.5);
+v2636 = v2635*0.999 + b/(v2629+10.5);
+v2637 = v2636*0.999 + b/(v2630+11.5);
+v2638 = v2637*0.999 + b/(v2631+12.5);
+v2639 = v2638*0.999 + b/(v2632+0.5);
+v2640 = v2639*0.999 + b/(v2633+1.5);
+v2641 = v2640*0.999 + b/(v2634+2.5);
+v2642 = v2641*0.999 + b/(v2635+3.5);
+v2643 = v2642*0.999 + b/(v2636+4.5);
+v2644 = v2643*0.999 + b/(v2637+5.5);
+v2645 = v2644*0.999 + b/(v2638+6.5);
+v2646 = v2645*0.999 + b/(v2639+7.5);
+v2647 = v2646*0.999 + b/(v2640+8.5);
+v2648 = v2647*0.999 + b/(v2641+9.5);
+v2649 = v2648*0.999 + b/(v2642+10.5);
+v2650 = v2649*0.999 + b/(v2643+11.5);
+v2651 = v2650*0.999 + b/(v2644+12.5);
+v2652 = v2651*0.999 + b/(v2645+0.5);
+v2653 = v2652*0.999 + b/(v2646+1.5);
+v2654 = v2653*0.999 + b/(v2647+2.5);
+v2655 = v2654*0.999 + b/(v2648+3.5);
+v2656 = v2655*0.999 + b/(v2649+4.5);
+v2657 = v2656*0.999 + b/(v2650+5.5);
+v2658 = v2657*0.999 + b/(v2651+6.5);
+v2659 = v2658*0.999 + b/(v2652+7.5);
+v2660 = v2659*0.999 + b/(v2653+8.5);
+v2661 = v2660*0.999 + b/(v2654+9.5);
+v2662 = v2661*0.999 + b/(v2655+10.5);
+v2663 = v2662*0.999 + b/(v2656+11.5);
+v2664 = v2663*0.999 + b/(v2657+12.5);
+v2665 = v2664*0.999 + b/(v2658+0.5);
+v2666 = v2665*0.999 + b/(v2659+1.5);
+v2667 = v2666*0.999 + b/(v2660+2.5);
+v2668 = v2667*0.999 + b/(v2661+3.5);
+v2669 = v2668*0.999 + b/(v2662+4.5);
+v2670 = v2669*0.999 + b/(v2663+5.5);
+v2671 = v2670*0.999 + b/(v2664+6.5);
+v2672 = v2671*0.999 + b/(v2665+7.5);
+v2673 = v2672*0.999 + b/(v2666+8.5);
+v2674 = v2673*0.999 + b/(v2667+9.5);
+v2675 = v2674*0.999 + b/(v2668+10.5);
+v2676 = v2675*0.999 + b/(v2669+11.5);
+v2677 = v2676*0.999 + b/(v2670+12.5);
+v2678 = v2677*0.999 + b/(v2671+0.5);
+v2679 = v2678*0.999 + b/(v2672+1.5);
+v2680 = v2679*0.999 + b/(v2673+2.5);
+v2681 = v2680*0.999 + b/(v2674+3.5);
+v2682 = v2681*0.999 + b/(v2675+4.5);
+v2683 = v2682*0.999 + b/(v2676+5.5);
+v2684 = v2683*0.999 + b/(v2677+6.5);
+v2685 = v2684*0.999 + b/(v2678+7.5);
+v2686 = v2685*0.999 + b/(v2679+8.5);
+v2687 = v2686*0.999 + b/(v2680+9.5);
+v2688 = v2687*0.999 + b/(v2681+10.5);
+v2689 = v2688*0.999 + b/(v2682+11.5);
+v2690 = v2689*0.999 + b/(v2683+12.5);
+v2691 = v2690*0.999 + b/(v2684+0.5);
+v2692 = v2691*0.999 + b/(v2685+1.5);
+v2693 = v2692*0.999 + b/(v2686+2.5);
+v2694 = v2693*0.999 + b/(v2687+3.5);
+v2695 = v2694*0.999 + b/(v2688+4.5);
+v2696 = v2695*0.999 + b/(v2689+5.5);
+v2697 = v2696*0.999 + b/(v2690+6.5);
+v2698 = v2697*0.999 + b/(v2691+7.5);
+v2699 = v2698*0.999 + b/(v2692+8.5);
+v2700 = v2699*0.999 + b/(v2693+9.5);
+v2701 = v2700*0.999 + b/(v2694+10.5);
+v2702 = v2701*0.999 + b/(v2695+11.5);
+v2703 = v2702*0.999 + b/(v2696+12.5);
+v2704 = v2703*0.999 + b/(v2697+0.5);
+v2705 = v2704*0.999 + b/(v2698+1.5);
+v2706 = v2705*0.999 + b/(v2699+2.5);
+v2707 = v2706*0.999 + b/(v2700+3.5);
+v2708 = v2707*0.999 + b/(v2701+4.5);
+v2709 = v2708*0.999 + b/(v2702+5.5);
+v2710 = v2709*0.999 + b/(v2703+6.5);
+v2711 = v2710*0.999 + b/(v2704+7.5);
+v2712 = v2711*0.999 + b/(v2705+8.5);
+v2713 = v2712*0.999 + b/(v2706+9.5);
+v2714 = v2713*0.999 + b/(v2707+10.5);
+v2715 = v2714*0.999 + b/(v2708+11.5);
+v2716 = v2715*0.999 + b/(v2709+12.5);
+v2717 = v2716*0.999 + b/(v2710+0.5);
+v2718 = v2717*0.999 + b/(v2711+1.5);
+v2719 = v2718*0.999 + b/(v2712+2.5);
+v2720 = v2719*0.999 + b/(v2713+3.5);
+v2721 = v2720*0.999 + b/(v2714+4.5);
+v2722 = v2721*0.999 + b/(v2715+5.5);
+v2723 = v2722*0.999 + b/(v2716+6.5);
+v2724 = v2723*0.999 + b/(v2717+7.5);
+v2725 = v2724*0.999 + b/(v2718+8.5);
+v2726 = v2725*0.999 + b/(v2719+9.5);
+v2727 = v2726*0.999 + b/(v2720+10.5);
+v2728 = v2727*0.999 + b/(v2721+11.5);
+v2729 = v2728*0.999 + b/(v2722+12.5);
+v2730 = v2729*0.999 + b/(v2723+0.5);
+v2731 = v2730*0.999 + b/(v2724+1.5);
+v2732 = v2731*0.999 + b/(v2725+2.5);
+v2733 = v2732*0.999 + b/(v2726+3.5);
+v2734 = v2733*0.999 + b/(v2727+4.5);
+v2735 = v2734*0.999 + b/(v2728+5.5);
+v2736 = v2735*0.999 + b/(v2729+6.5);
+v2737 = v2736*0.999 + b/(v2730+7.5);
+v2738 = v2737*0.999 + b/(v2731+8.5);
+v2739 = v2738*0.999 + b/(v2732+9.5);
+v2740 = v2739*0.999 + b/(v2733+10.5);
+v2741 = v2740*0.999 + b/(v2734+11.5);
+v2742 = v2741*0.999 + b/(v2735+12.5);
+v2743 = v2742*0.999 + b/(v2736+0.5);
+v2744 = v2743*0.999 + b/(v2737+1.5);
+v2745 = v2744*0.999 + b/(v2738+2.5);
+v2746 = v2745*0.999 + b/(v2739+3.5);
+v2747 = v2746*0.999 + b/(v2740+4.5);
+v2748 = v2747*0.999 + b/(v2741+5.5);
+v2749 = v2748*0.999 + b/(v2742+6.5);
+v2750 = v2749*0.999 + b/(v2743+7.5);
+v2751 = v2750*0.999 + b/(v2744+8.5);
+v2752 = v2751*0.999 + b/(v2745+9.5);
+v2753 = v2752*0.999 + b/(v2746+10.5);
+v2754 = v2753*0.999 + b/(v2747+11.5);
+v2755 = v2754*0.999 + b/(v2748+12.5);
+v2756 = v2755*0.999 + b/(v2749+0.5);
+v2757 = v2756*0.999 + b/(v2750+1.5);
+v2758 = v2757*0.999 + b/(v2751+2.5);
+v2759 = v2758*0.999 + b/(v2752+3.5);
+v2760 = v2759*0.999 + b/(v2753+4.5);
+v2761 = v2760*0.999 + b/(v2754+5.5);
+v2762 = v2761*0.999 + b/(v2755+6.5);
+v2763 = v2762*0.999 + b/(v2756+7.5);
+v2764 = v2763*0.999 + b/(v2757+8.5);
+v2765 = v2764*0.999 + b/(v2758+9.5);
+v2766 = v2765*0.999 + b/(v2759+10.5);
+v2767 = v2766*0.999 + b/(v2760+11.5);
+v2768 = v2767*0.999 + b/(v2761+12.5);
+v2769 = v2768*0.999 + b/(v2762+0.5);
+v2770 = v2769*0.999 + b/(v2763+1.5);
+v2771 = v2770*0.999 + b/(v2764+2.5);
+v2772 = v2771*0.999 + b/(v2765+3.5);
+v2773 = v2772*0.999 + b/(v2766+4.5);
+v2774 = v2773*0.999 + b/(v2767+5.5);
+v2775 = v2774*0.999 + b/(v2768+6.5);
+v2776 = v2775*0.999 + b/(v2769+7.5);
+v2777 = v2776*0.999 + b/(v2770+8.5);
+v2778 = v2777*0.999 + b/(v2771+9.5);
+v2779 = v2778*0.999 + b/(v2772+10.5);
+v2780 = v2779*0.999 + b/(v2773+11.5);
+v2781 = v2780*0.999 + b/(v2774+12.5);
+v2782 = v2781*0.999 + b/(v2775+0.5);
+v2783 = v2782*0.999 + b/(v2776+1.5);
+v2784 = v2783*0.999 + b/(v2777+2.5);
+v2785 = v2784*0.999 + b/(v2778+3.5);
+v2786 = v2785*0.999 + b/(v2779+4.5);
+v2787 = v2786*0.999 + b/(v2780+5.5);
+v2788 = v2787*0.999 + b/(v2781+6.5);
+v2789 = v2788*0.999 + b/(v2782+7.5);
+v2790 = v2789*0.999 + b/(v2783+8.5);
+v2791 = v2790*0.999 + b/(v2784+9.5);
+v2792 = v2791*0.999 + b/(v2785+10.5);
+v2793 = v2792*0.999 + b/(v2786+11.5);
+v2794 = v2793*0.999 + b/(v2787+12.5);
+v2795 = v2794*0.999 + b/(v2788+0.5);
+v2796 = v2795*0.999 + b/(v2789+1.5);
+v2797 = v2796*0.999 + b/(v2790+2.5);
+v2798 = v2797*0.999 + b/(v2791+3.5);
+v2799 = v2798*0.999 + b/(v2792+4.5);
+v2800 = v2799*0.999 + b/(v2793+5.5);
+v2801 = v2800*0.999 + b/(v2794+6.5);
+v2802 = v2801*0.999 + b/(v2795+7.5);
+v2803 = v2802*0.999 + b/(v2796+8.5);
+v2804 = v2803*0.999 + b/(v2797+9.5);
+v2805 = v2804*0.999 + b/(v2798+10.5);
+v2806 = v2805*0.999 + b/(v2799+11.5);
+v2807 = v2806*0.999 + b/(v2800+12.5);
+v2808 = v2807*0.999 + b/(v2801+0.5);
+v2809 = v2808*0.999 + b/(v2802+1.5);
+v2810 = v2809*0.999 + b/(v2803+2.5);
+v2811 = v2810*0.999 + b/(v2804+3.5);
+v2812 = v2811*0.999 + b/(v2805+4.5);
+v2813 = v2812*0.999 + b/(v2806+5.5);
+v2814 = v2813*0.999 + b/(v2807+6.5);
+v2815 = v2814*0.999 + b/(v2808+7.5);
+v2816 = v2815*0.999 + b/(v2809+8.5);
+v2817 = v2816*0.999 + b/(v2810+9.5);
+v2818 = v2817*0.999 + b/(v2811+10.5);
+v2819 = v2818*0.999 + b/(v2812+11.5);
+v2820 = v2819*0.999 + b/(v2813+12.5);
+v2821 = v2820*0.999 + b/(v2814+0.5);
+v2822 = v2821*0.999 + b/(v2815+1.5);
+v2823 = v2822*0.999 + b/(v2816+2.5);
+v2824 = v2823*0.999 + b/(v2817+3.5);
+v2825 = v2824*0.999 + b/(v2818+4.5);
+v2826 = v2825*0.999 + b/(v2819+5.5);
+v2827 = v2826*0.999 + b/(v2820+6.5);
+v2828 = v2827*0.999 + b/(v2821+7.5);
+v2829 = v2828*0.999 + b/(v2822+8.5);
+v2830 = v2829*0.999 + b/(v2823+9.5);
+v2831 = v2830*0.999 + b/(v2824+10.5);
+v2832 = v2831*0.999 + b/(v2825+11.5);
+v2833 = v2832*0.999 + b/(v2826+12.5);
+v2834 = v2833*0.999 + b/(v2827+0.5);
+v2835 = v2834*0.999 + b/(v2828+1.5);
+v2836 = v2835*0.999 + b/(v2829+2.5);
+v2837 = v2836*0.999 + b/(v2830+3.5);
+v2838 = v2837*0.999 + b/(v2831+4.5);
+v2839 = v2838*0.999 + b/(v2832+5.5);
+v2840 = v2839*0.999 + b/(v2833+6.5);
+v2841 = v2840*0.999 + b/(v2834+7.5);
+v2842 = v2841*0.999 + b/(v2835+8.5);
+v2843 = v2842*0.999 + b/(v2836+9.5);
+v2844 = v2843*0.999 + b/(v2837+10.5);
+v2845 = v2844*0.999 + b/(v2838+11.5);
+v2846 = v2845*0.999 + b/(v2839+12.5);
+v2847 = v2846*0.999 + b/(v2840+0.5);
+v2848 = v2847*0.999 + b/(v2841+1.5);
+v2849 = v2848*0.999 + b/(v2842+2.5);
+v2850 = v2849*0.999 + b/(v2843+3.5);
+v2851 = v2850*0.999 + b/(v2844+4.5);
+v2852 = v2851*0.999 + b/(v2845+5.5);
+v2853 = v2852*0.999 + b/(v2846+6.5);
+v2854 = v2853*0.999 + b/(v2847+7.5);
+v2855 = v2854*0.999 + b/(v2848+8.5);
+v2856 = v2855*0.999 + b/(v2849+9.5);
+v2857 = v2856*0.999 + b/(v2850+10.5);
+v2858 = v2857*0.999 + b/(v2851+11.5);
+v2859 = v2858*0.999 + b/(v2852+12.5);
+v2860 = v2859*0.999 + b/(v2853+0.5);
+v2861 = v2860*0.999 + b/(v2854+1.5);
+v2862 = v2861*0.999 + b/(v2855+2.5);
+v2863 = v2862*0.999 + b/(v2856+3.5);
+v2864 = v2863*0.999 + b/(v2857+4.5);
+v2865 = v2864*0.999 + b/(v2858+5.5);
+v2866 = v2865*0.999 + b/(v2859+6.5);
+v2867 = v2866*0.999 + b/(v2860+7.5);
+v2868 = v2867*0.999 + b/(v2861+8.5);
+v2869 = v2868*0.999 + b/(v2862+9.5);
+v2870 = v2869*0.999 + b/(v2863+10.5);
+v2871 = v2870*0.999 + b/(v2864+11.5);
+v2872 = v2871*0.999 + b/(v2865+12.5);
+v2873 = v2872*0.999 + b/(v2866+0.5);
+v2874 = v2873*0.999 + b/(v2867+1.5);
+v2875 = v2874*0.999 + b/(v2868+2.5);
+v2876 = v2875*0.999 + b/(v2869+3.5);
+v2877 = v2876*0.999 + b/(v2870+4.5);
+v2878 = v2877*0.999 + b/(v2871+5.5);
+v2879 = v2878*0.999 + b/(v2872+6.5);
+v2880 = v2879*0.999 + b/(v2873+7.5);
+v2881 = v2880*0.999 + b/(v2874+8.5);
+v2882 = v2881*0.999 + b/(v2875+9.5);
+v2883 = v2882*0.999 + b/(v2876+10.5);
+v2884 = v2883*0.999 + b/(v2877+11.5);
+v2885 = v2884*0.999 + b/(v2878+12.5);
+v2886 = v2885*0.999 + b/(v2879+0.5);
+v2887 = v2886*0.999 + b/(v2880+1.5);
+v2888 = v2887*0.999 + b/(v2881+2.5);
+v2889 = v2888*0.999 + b/(v2882+3.5);
+v2890 = v2889*0.999 + b/(v2883+4.5);
+v2891 = v2890*0.999 + b/(v2884+5.5);
+v2892 = v2891*0.999 + b/(v2885+6.5);
+v2893 = v2892*0.999 + b/(v2886+7.5);
+v2894 = v2893*0.999 + b/(v2887+8.5);
+v2895 = v2894*0.999 + b/(v2888+9.5);
+v2896 = v2895*0.999 + b/(v2889+10.5);
+v2897 = v2896*0.999 + b/(v2890+11.5);
+v2898 = v2897*0.999 + b/(v2891+12.5);
+v2899 = v2898*0.999 + b/(v2892+0.5);
+v2900 = v2899*0.999 + b/(v2893+1.5);
+v2901 = v2900*0.999 + b/(v2894+2.5);
+v2902 = v2901*0.999 + b/(v2895+3.5);
+v2903 = v2902*0.999 + b/(v2896+4.5);
+v2904 = v2903*0.999 + b/(v2897+5.5);
+v2905 = v2904*0.999 + b/(v2898+6.5);
+v2906 = v2905*0.999 + b/(v2899+7.5);
+v2907 = v2906*0.999 + b/(v2900+8.5);
+v2908 = v2907*0.999 + b/(v2901+9.5);
+v2909 = v2908*0.999 + b/(v2902+10.5);
+v2910 = v2909*0.999 + b/(v2903+11.5);
+v2911 = v2910*0.999 + b/(v2904+12.5);
+v2912 = v2911*0.999 + b/(v2905+0.5);
+v2913 = v2912*0.999 + b/(v2906+1.5);
+v2914 = v2913*0.999 + b/(v2907+2.5);
+v2915 = v2914*0.999 + b/(v2908+3.5);
+v2916 = v2915*0.999 + b/(v2909+4.5);
+v2917 = v2916*0.999 + b/(v2910+5.5);
+v2918 = v2917*0.999 + b/(v2911+6.5);
+v2919 = v2918*0.999 + b/(v2912+7.5);
+v2920 = v2919*0.999 + b/(v2913+8.5);
+v2921 = v2920*0.999 + b/(v2914+9.5);
+v2922 = v2921*0.999 + b/(v2915+10.5);
+v2923 = v2922*0.999 + b/(v2916+11.5);
+v2924 = v2923*0.999 + b/(v2917+12.5);
+v2925 = v2924*0.999 + b/(v2918+0.5);
+v2926 = v2925*0.999 + b/(v2919+1.5);
+v2927 = v2926*0.999 + b/(v2920+2.5);
+v2928 = v2927*0.999 + b/(v2921+3.5);
+v2929 = v2928*0.999 + b/(v2922+4.5);
+v2930 = v2929*0.999 + b/(v2923+5.5);
+v2931 = v2930*0.999 + b/(v2924+6.5);
+v2932 = v2931*0.999 + b/(v2925+7.5);
+v2933 = v2932*0.999 + b/(v2926+8.5);
+v2934 = v2933*0.999 + b/(v2927+9.5);
+v2935 = v2934*0.999 + b/(v2928+10.5);
+v2936 = v2935*0.999 + b/(v2929+11.5);
+v2937 = v2936*0.999 + b/(v2930+12.5);
+v2938 = v2937*0.999 + b/(v2931+0.5);
+v2939 = v2938*0.999 + b/(v2932+1.5);
+v2940 = v2939*0.999 + b/(v2933+2.5);
+v2941 = v2940*0.999 + b/(v2934+3.5);
+v2942 = v2941*0.999 + b/(v2935+4.5);
+v2943 = v2942*0.999 + b/(v2936+5.5);
+v2944 = v2943*0.999 + b/(v2937+6.5);
+v2945 = v2944*0.999 + b/(v2938+7.5);
+v2946 = v2945*0.999 + b/(v2939+8.5);
+v2947 = v2946*0.999 + b/(v2940+9.5);
+v2948 = v2947*0.999 + b/(v2941+10.5);
+v2949 = v2948*0.999 + b/(v2942+11.5);
+v2950 = v2949*0.999 + b/(v2943+12.5);
+v2951 = v2950*0.999 + b/(v2944+0.5);
+v2952 = v2951*0.999 + b/(v2945+1.5);
+v2953 = v2952*0.999 + b/(v2946+2.5);
+v2954 = v2953*0.999 + b/(v2947+3.5);
+v2955 = v2954*0.999 + b/(v2948+4.5);
+v2956 = v2955*0.999 + b/(v2949+5.5);
+v2957 = v2956*0.999 + b/(v2950+6.5);
+v2958 = v2957*0.999 + b/(v2951+7.5);
+v2959 = v2958*0.999 + b/(v2952+8.5);
+v2960 = v2959*0.999 + b/(v2953+9.5);
+v2961 = v2960*0.999 + b/(v2954+10.5);
+v2962 = v2961*0.999 + b/(v2955+11.5);
+v2963 = v2962*0.999 + b/(v2956+12.5);
+v2964 = v2963*0.999 + b/(v2957+0.5);
+v2965 = v2964*0.999 + b/(v2958+1.5);
+v2966 = v2965*0.999 + b/(v2959+2.5);
+v2967 = v2966*0.999 + b/(v2960+3.5);
+v2968 = v2967*0.999 + b/(v2961+4.5);
+v2969 = v2968*0.999 + b/(v2962+5.5);
+v2970 = v2969*0.999 + b/(v2963+6.5);
+v2971 = v2970*0.999 + b/(v2964+7.5);
+v2972 = v2971*0.999 + b/(v2965+8.5);
+v2973 = v2972*0.999 + b/(v2966+9.5);
+v2974 = v2973*0.999 + b/(v2967+10.5);
+v2975 = v2974*0.999 + b/(v2968+11.5);
+v2976 = v2975*0.999 + b/(v2969+12.5);
+v2977 = v2976*0.999 + b/(v2970+0.5);
+v2978 = v2977*0.999 + b/(v2971+1.5);
+v2979 = v2978*0.999 + b/(v2972+2.5);
+v2980 = v2979*0.999 + b/(v2973+3.5);
+v2981 = v2980*0.999 + b/(v2974+4.5);
+v2982 = v2981*0.999 + b/(v2975+5.5);
+v2983 = v2982*0.999 + b/(v2976+6.5);
+v2984 = v2983*0.999 + b/(v2977+7.5);
+v2985 = v2984*0.999 + b/(v2978+8.5);
+v2986 = v2985*0.999 + b/(v2979+9.5);
+v2987 = v2986*0.999 + b/(v2980+10.5);
+v2988 = v2987*0.999 + b/(v2981+11.5);
+v2989 = v2988*0.999 + b/(v2982+12.5);
+v2990 = v2989*0.999 + b/(v2983+0.5);
+v2991 = v2990*0.999 + b/(v2984+1.5);
+v2992 = v2991*0.999 + b/(v2985+2.5);
+v2993 = v2992*0.999 + b/(v2986+3.5);
+v2994 = v2993*0.999 + b/(v2987+4.5);
+v2995 = v2994*0.999 + b/(v2988+5.5);
+v2996 = v2995*0.999 + b/(v2989+6.5);
+v2997 = v2996*0.999 + b/(v2990+7.5);
+v2998 = v2997*0.999 + b/(v2991+8.5);
+v2999 = v2998*0.999 + b/(v2992+9.5);
+<< v2999 << "\n";
@@ -0,0 +1,2016 @@
+#include "chunk_state.h"
+
+void el_state::el_chunk0 ()
+{
+	double a;
+	double b;
+	double v0;
+	double v1;
+	double v2;
+	double v3;
+	double v4;
+	double v5;
+	double v6;
+	double v7;
+	double v8;
+	double v9;
+	double v10;
+	double v11;
+	double v12;
+	double v13;
+	double v14;
+	double v15;
+	double v16;
+	double v17;
+	double v18;
+	double v19;
+	double v20;
+	double v21;
+	double v22;
+	double v23;
+	double v24;
+	double v25;
+	double v26;
+	double v27;
+	double v28;
+	double v29;
+	double v30;
+	double v31;
+	double v32;
+	double v33;
+	double v34;
+	double v35;
+	double v36;
+	double v37;
+	double v38;
+	double v39;
+	double v40;
+	double v41;
+	double v42;
+	double v43;
+	double v44;
+	double v45;
+	double v46;
+	double v47;
+	double v48;
+	double v49;
+	double v50;
+	double v51;
+	double v52;
+	double v53;
+	double v54;
+	double v55;
+	double v56;
+	double v57;
+	double v58;
+	double v59;
+	double v60;
+	double v61;
+	double v62;
+	double v63;
+	double v64;
+	double v65;
+	double v66;
+	double v67;
+	double v68;
+	double v69;
+	double v70;
+	double v71;
+	double v72;
+	double v73;
+	double v74;
+	double v75;
+	double v76;
+	double v77;
+	double v78;
+	double v79;
+	double v80;
+	double v81;
+	double v82;
+	double v83;
+	double v84;
+	double v85;
+	double v86;
+	double v87;
+	double v88;
+	double v89;
+	double v90;
+	double v91;
+	double v92;
+	double v93;
+	double v94;
+	double v95;
+	double v96;
+	double v97;
+	double v98;
+	double v99;
+	double v100;
+	double v101;
+	double v102;
+	double v103;
+	double v104;
+	double v105;
+	double v106;
+	double v107;
+	double v108;
+	double v109;
+	double v110;
+	double v111;
+	double v112;
+	double v113;
+	double v114;
+	double v115;
+	double v116;
+	double v117;
+	double v118;
+	double v119;
+	double v120;
+	double v121;
+	double v122;
+	double v123;
+	double v124;
+	double v125;
+	double v126;
+	double v127;
+	double v128;
+	double v129;
+	double v130;
+	double v131;
+	double v132;
+	double v133;
+	double v134;
+	double v135;
+	double v136;
+	double v137;
+	double v138;
+	double v139;
+	double v140;
+	double v141;
+	double v142;
+	double v143;
+	double v144;
+	double v145;
+	double v146;
+	double v147;
+	double v148;
+	double v149;
+	double v150;
+	double v151;
+	double v152;
+	double v153;
+	double v154;
+	double v155;
+	double v156;
+	double v157;
+	double v158;
+	double v159;
+	double v160;
+	double v161;
+	double v162;
+	double v163;
+	double v164;
+	double v165;
+	double v166;
+	double v167;
+	double v168;
+	double v169;
+	double v170;
+	double v171;
+	double v172;
+	double v173;
+	double v174;
+	double v175;
+	double v176;
+	double v177;
+	double v178;
+	double v179;
+	double v180;
+	double v181;
+	double v182;
+	double v183;
+	double v184;
+	double v185;
+	double v186;
+	double v187;
+	double v188;
+	double v189;
+	double v190;
+	double v191;
+	double v192;
+	double v193;
+	double v194;
+	double v195;
+	double v196;
+	double v197;
+	double v198;
+	double v199;
+	double v200;
+	double v201;
+	double v202;
+	double v203;
+	double v204;
+	double v205;
+	double v206;
+	double v207;
+	double v208;
+	double v209;
+	double v210;
+	double v211;
+	double v212;
+	double v213;
+	double v214;
+	double v215;
+	double v216;
+	double v217;
+	double v218;
+	double v219;
+	double v220;
+	double v221;
+	double v222;
+	double v223;
+	double v224;
+	double v225;
+	double v226;
+	double v227;
+	double v228;
+	double v229;
+	double v230;
+	double v231;
+	double v232;
+	double v233;
+	double v234;
+	double v235;
+	double v236;
+	double v237;
+	double v238;
+	double v239;
+	double v240;
+	double v241;
+	double v242;
+	double v243;
+	double v244;
+	double v245;
+	double v246;
+	double v247;
+	double v248;
+	double v249;
+	double v250;
+	double v251;
+	double v252;
+	double v253;
+	double v254;
+	double v255;
+	double v256;
+	double v257;
+	double v258;
+	double v259;
+	double v260;
+	double v261;
+	double v262;
+	double v263;
+	double v264;
+	double v265;
+	double v266;
+	double v267;
+	double v268;
+	double v269;
+	double v270;
+	double v271;
+	double v272;
+	double v273;
+	double v274;
+	double v275;
+	double v276;
+	double v277;
+	double v278;
+	double v279;
+	double v280;
+	double v281;
+	double v282;
+	double v283;
+	double v284;
+	double v285;
+	double v286;
+	double v287;
+	double v288;
+	double v289;
+	double v290;
+	double v291;
+	double v292;
+	double v293;
+	double v294;
+	double v295;
+	double v296;
+	double v297;
+	double v298;
+	double v299;
+	double v300;
+	double v301;
+	double v302;
+	double v303;
+	double v304;
+	double v305;
+	double v306;
+	double v307;
+	double v308;
+	double v309;
+	double v310;
+	double v311;
+	double v312;
+	double v313;
+	double v314;
+	double v315;
+	double v316;
+	double v317;
+	double v318;
+	double v319;
+	double v320;
+	double v321;
+	double v322;
+	double v323;
+	double v324;
+	double v325;
+	double v326;
+	double v327;
+	double v328;
+	double v329;
+	double v330;
+	double v331;
+	double v332;
+	double v333;
+	double v334;
+	double v335;
+	double v336;
+	double v337;
+	double v338;
+	double v339;
+	double v340;
+	double v341;
+	double v342;
+	double v343;
+	double v344;
+	double v345;
+	double v346;
+	double v347;
+	double v348;
+	double v349;
+	double v350;
+	double v351;
+	double v352;
+	double v353;
+	double v354;
+	double v355;
+	double v356;
+	double v357;
+	double v358;
+	double v359;
+	double v360;
+	double v361;
+	double v362;
+	double v363;
+	double v364;
+	double v365;
+	double v366;
+	double v367;
+	double v368;
+	double v369;
+	double v370;
+	double v371;
+	double v372;
+	double v373;
+	double v374;
+	double v375;
+	double v376;
+	double v377;
+	double v378;
+	double v379;
+	double v380;
+	double v381;
+	double v382;
+	double v383;
+	double v384;
+	double v385;
+	double v386;
+	double v387;
+	double v388;
+	double v389;
+	double v390;
+	double v391;
+	double v392;
+	double v393;
+	double v394;
+	double v395;
+	double v396;
+	double v397;
+	double v398;
+	double v399;
+	double v400;
+	double v401;
+	double v402;
+	double v403;
+	double v404;
+	double v405;
+	double v406;
+	double v407;
+	double v408;
+	double v409;
+	double v410;
+	double v411;
+	double v412;
+	double v413;
+	double v414;
+	double v415;
+	double v416;
+	double v417;
+	double v418;
+	double v419;
+	double v420;
+	double v421;
+	double v422;
+	double v423;
+	double v424;
+	double v425;
+	double v426;
+	double v427;
+	double v428;
+	double v429;
+	double v430;
+	double v431;
+	double v432;
+	double v433;
+	double v434;
+	double v435;
+	double v436;
+	double v437;
+	double v438;
+	double v439;
+	double v440;
+	double v441;
+	double v442;
+	double v443;
+	double v444;
+	double v445;
+	double v446;
+	double v447;
+	double v448;
+	double v449;
+	double v450;
+	double v451;
+	double v452;
+	double v453;
+	double v454;
+	double v455;
+	double v456;
+	double v457;
+	double v458;
+	double v459;
+	double v460;
+	double v461;
+	double v462;
+	double v463;
+	double v464;
+	double v465;
+	double v466;
+	double v467;
+	double v468;
+	double v469;
+	double v470;
+	double v471;
+	double v472;
+	double v473;
+	double v474;
+	double v475;
+	double v476;
+	double v477;
+	double v478;
+	double v479;
+	double v480;
+	double v481;
+	double v482;
+	double v483;
+	double v484;
+	double v485;
+	double v486;
+	double v487;
+	double v488;
+	double v489;
+	double v490;
+	double v491;
+	double v492;
+	double v493;
+	double v494;
+	double v495;
+	double v496;
+	double v497;
+	double v498;
+	double v499;
+	double v500;
+	double v501;
+	double v502;
+	double v503;
+	double v504;
+	double v505;
+	double v506;
+	double v507;
+	double v508;
+	double v509;
+	double v510;
+	double v511;
+	double v512;
+	double v513;
+	double v514;
+	double v515;
+	double v516;
+	double v517;
+	double v518;
+	double v519;
+	double v520;
+	double v521;
+	double v522;
+	double v523;
+	double v524;
+	double v525;
+	double v526;
+	double v527;
+	double v528;
+	double v529;
+	double v530;
+	double v531;
+	double v532;
+	double v533;
+	double v534;
+	double v535;
+	double v536;
+	double v537;
+	double v538;
+	double v539;
+	double v540;
+	double v541;
+	double v542;
+	double v543;
+	double v544;
+	double v545;
+	double v546;
+	double v547;
+	double v548;
+	double v549;
+	double v550;
+	double v551;
+	double v552;
+	double v553;
+	double v554;
+	double v555;
+	double v556;
+	double v557;
+	double v558;
+	double v559;
+	double v560;
+	double v561;
+	double v562;
+	double v563;
+	double v564;
+	double v565;
+	double v566;
+	double v567;
+	double v568;
+	double v569;
+	double v570;
+	double v571;
+	double v572;
+	double v573;
+	double v574;
+	double v575;
+	double v576;
+	double v577;
+	double v578;
+	double v579;
+	double v580;
+	double v581;
+	double v582;
+	double v583;
+	double v584;
+	double v585;
+	double v586;
+	double v587;
+	double v588;
+	double v589;
+	double v590;
+	double v591;
+	double v592;
+	double v593;
+	double v594;
+	double v595;
+	double v596;
+	double v597;
+	double v598;
+	double v599;
+	double v600;
+	double v601;
+	double v602;
+	double v603;
+	double v604;
+	double v605;
+	double v606;
+	double v607;
+	double v608;
+	double v609;
+	double v610;
+	double v611;
+	double v612;
+	double v613;
+	double v614;
+	double v615;
+	double v616;
+	double v617;
+	double v618;
+	double v619;
+	double v620;
+	double v621;
+	double v622;
+	double v623;
+	double v624;
+	double v625;
+	double v626;
+	double v627;
+	double v628;
+	double v629;
+	double v630;
+	double v631;
+	double v632;
+	double v633;
+	double v634;
+	double v635;
+	double v636;
+	double v637;
+	double v638;
+	double v639;
+	double v640;
+	double v641;
+	double v642;
+	double v643;
+	double v644;
+	double v645;
+	double v646;
+	double v647;
+	double v648;
+	double v649;
+	double v650;
+	double v651;
+	double v652;
+	double v653;
+	double v654;
+	double v655;
+	double v656;
+	double v657;
+	double v658;
+	double v659;
+	double v660;
+	double v661;
+	double v662;
+	double v663;
+	double v664;
+	double v665;
+	double v666;
+	double v667;
+	double v668;
+	double v669;
+	double v670;
+	double v671;
+	double v672;
+	double v673;
+	double v674;
+	double v675;
+	double v676;
+	double v677;
+	double v678;
+	double v679;
+	double v680;
+	double v681;
+	double v682;
+	double v683;
+	double v684;
+	double v685;
+	double v686;
+	double v687;
+	double v688;
+	double v689;
+	double v690;
+	double v691;
+	double v692;
+	double v693;
+	double v694;
+	double v695;
+	double v696;
+	double v697;
+	double v698;
+	double v699;
+	double v700;
+	double v701;
+	double v702;
+	double v703;
+	double v704;
+	double v705;
+	double v706;
+	double v707;
+	double v708;
+	double v709;
+	double v710;
+	double v711;
+	double v712;
+	double v713;
+	double v714;
+	double v715;
+	double v716;
+	double v717;
+	double v718;
+	double v719;
+	double v720;
+	double v721;
+	double v722;
+	double v723;
+	double v724;
+	double v725;
+	double v726;
+	double v727;
+	double v728;
+	double v729;
+	double v730;
+	double v731;
+	double v732;
+	double v733;
+	double v734;
+	double v735;
+	double v736;
+	double v737;
+	double v738;
+	double v739;
+	double v740;
+	double v741;
+	double v742;
+	double v743;
+	double v744;
+	double v745;
+	double v746;
+	double v747;
+	double v748;
+	double v749;
+	double v750;
+	double v751;
+	double v752;
+	double v753;
+	double v754;
+	double v755;
+	double v756;
+	double v757;
+	double v758;
+	double v759;
+	double v760;
+	double v761;
+	double v762;
+	double v763;
+	double v764;
+	double v765;
+	double v766;
+	double v767;
+	double v768;
+	double v769;
+	double v770;
+	double v771;
+	double v772;
+	double v773;
+	double v774;
+	double v775;
+	double v776;
+	double v777;
+	double v778;
+	double v779;
+	double v780;
+	double v781;
+	double v782;
+	double v783;
+	double v784;
+	double v785;
+	double v786;
+	double v787;
+	double v788;
+	double v789;
+	double v790;
+	double v791;
+	double v792;
+	double v793;
+	double v794;
+	double v795;
+	double v796;
+	double v797;
+	double v798;
+	double v799;
+	double v800;
+	double v801;
+	double v802;
+	double v803;
+	double v804;
+	double v805;
+	double v806;
+	double v807;
+	double v808;
+	double v809;
+	double v810;
+	double v811;
+	double v812;
+	double v813;
+	double v814;
+	double v815;
+	double v816;
+	double v817;
+	double v818;
+	double v819;
+	double v820;
+	double v821;
+	double v822;
+	double v823;
+	double v824;
+	double v825;
+	double v826;
+	double v827;
+	double v828;
+	double v829;
+	double v830;
+	double v831;
+	double v832;
+	double v833;
+	double v834;
+	double v835;
+	double v836;
+	double v837;
+	double v838;
+	double v839;
+	double v840;
+	double v841;
+	double v842;
+	double v843;
+	double v844;
+	double v845;
+	double v846;
+	double v847;
+	double v848;
+	double v849;
+	double v850;
+	double v851;
+	double v852;
+	double v853;
+	double v854;
+	double v855;
+	double v856;
+	double v857;
+	double v858;
+	double v859;
+	double v860;
+	double v861;
+	double v862;
+	double v863;
+	double v864;
+	double v865;
+	double v866;
+	double v867;
+	double v868;
+	double v869;
+	double v870;
+	double v871;
+	double v872;
+	double v873;
+	double v874;
+	double v875;
+	double v876;
+	double v877;
+	double v878;
+	double v879;
+	double v880;
+	double v881;
+	double v882;
+	double v883;
+	double v884;
+	double v885;
+	double v886;
+	double v887;
+	double v888;
+	double v889;
+	double v890;
+	double v891;
+	double v892;
+	double v893;
+	double v894;
+	double v895;
+	double v896;
+	double v897;
+	double v898;
+	double v899;
+	double v900;
+	double v901;
+	double v902;
+	double v903;
+	double v904;
+	double v905;
+	double v906;
+	double v907;
+	double v908;
+	double v909;
+	double v910;
+	double v911;
+	double v912;
+	double v913;
+	double v914;
+	double v915;
+	double v916;
+	double v917;
+	double v918;
+	double v919;
+	double v920;
+	double v921;
+	double v922;
+	double v923;
+	double v924;
+	double v925;
+	double v926;
+	double v927;
+	double v928;
+	double v929;
+	double v930;
+	double v931;
+	double v932;
+	double v933;
+	double v934;
+	double v935;
+	double v936;
+	double v937;
+	double v938;
+	double v939;
+	double v940;
+	double v941;
+	double v942;
+	double v943;
+	double v944;
+	double v945;
+	double v946;
+	double v947;
+	double v948;
+	double v949;
+	double v950;
+	double v951;
+	double v952;
+	double v953;
+	double v954;
+	double v955;
+	double v956;
+	double v957;
+	double v958;
+	double v959;
+	double v960;
+	double v961;
+	double v962;
+	double v963;
+	double v964;
+	double v965;
+	double v966;
+	double v967;
+	double v968;
+	double v969;
+	double v970;
+	double v971;
+	double v972;
+	double v973;
+	double v974;
+	double v975;
+	double v976;
+	double v977;
+	double v978;
+	double v979;
+	double v980;
+	double v981;
+	double v982;
+	double v983;
+	double v984;
+	double v985;
+	double v986;
+	double v987;
+	double v988;
+	double v989;
+	double v990;
+	double v991;
+	double v992;
+	double v993;
+	double v994;
+	double v995;
+	double v996;
+	double v997;
+	double v998;
+	cin >> a;
+	cin >> b;
+	v0 = a;
+	v1 = ((v0*0.999)+(b/((v0+1.5))));
+	v2 = ((v1*0.999)+(b/((v0+2.5))));
+	v3 = ((v2*0.999)+(b/((v0+3.5))));
+	v4 = ((v3*0.999)+(b/((v0+4.5))));
+	v5 = ((v4*0.999)+(b/((v0+5.5))));
+	v6 = ((v5*0.999)+(b/((v0+6.5))));
+	v7 = ((v6*0.999)+(b/((v0+7.5))));
+	v8 = ((v7*0.999)+(b/((v1+8.5))));
+	v9 = ((v8*0.999)+(b/((v2+9.5))));
+	v10 = ((v9*0.999)+(b/((v3+10.5))));
+	v11 = ((v10*0.999)+(b/((v4+11.5))));
+	v12 = ((v11*0.999)+(b/((v5+12.5))));
+	v13 = ((v12*0.999)+(b/((v6+0.5))));
+	v14 = ((v13*0.999)+(b/((v7+1.5))));
+	v15 = ((v14*0.999)+(b/((v8+2.5))));
+	v16 = ((v15*0.999)+(b/((v9+3.5))));
+	v17 = ((v16*0.999)+(b/((v10+4.5))));
+	v18 = ((v17*0.999)+(b/((v11+5.5))));
+	v19 = ((v18*0.999)+(b/((v12+6.5))));
+	v20 = ((v19*0.999)+(b/((v13+7.5))));
+	v21 = ((v20*0.999)+(b/((v14+8.5))));
+	v22 = ((v21*0.999)+(b/((v15+9.5))));
+	v23 = ((v22*0.999)+(b/((v16+10.5))));
+	v24 = ((v23*0.999)+(b/((v17+11.5))));
+	v25 = ((v24*0.999)+(b/((v18+12.5))));
+	v26 = ((v25*0.999)+(b/((v19+0.5))));
+	v27 = ((v26*0.999)+(b/((v20+1.5))));
+	v28 = ((v27*0.999)+(b/((v21+2.5))));
+	v29 = ((v28*0.999)+(b/((v22+3.5))));
+	v30 = ((v29*0.999)+(b/((v23+4.5))));
+	v31 = ((v30*0.999)+(b/((v24+5.5))));
+	v32 = ((v31*0.999)+(b/((v25+6.5))));
+	v33 = ((v32*0.999)+(b/((v26+7.5))));
+	v34 = ((v33*0.999)+(b/((v27+8.5))));
+	v35 = ((v34*0.999)+(b/((v28+9.5))));
+	v36 = ((v35*0.999)+(b/((v29+10.5))));
+	v37 = ((v36*0.999)+(b/((v30+11.5))));
+	v38 = ((v37*0.999)+(b/((v31+12.5))));
+	v39 = ((v38*0.999)+(b/((v32+0.5))));
+	v40 = ((v39*0.999)+(b/((v33+1.5))));
+	v41 = ((v40*0.999)+(b/((v34+2.5))));
+	v42 = ((v41*0.999)+(b/((v35+3.5))));
+	v43 = ((v42*0.999)+(b/((v36+4.5))));
+	v44 = ((v43*0.999)+(b/((v37+5.5))));
+	v45 = ((v44*0.999)+(b/((v38+6.5))));
+	v46 = ((v45*0.999)+(b/((v39+7.5))));
+	v47 = ((v46*0.999)+(b/((v40+8.5))));
+	v48 = ((v47*0.999)+(b/((v41+9.5))));
+	v49 = ((v48*0.999)+(b/((v42+10.5))));
+	v50 = ((v49*0.999)+(b/((v43+11.5))));
+	v51 = ((v50*0.999)+(b/((v44+12.5))));
+	v52 = ((v51*0.999)+(b/((v45+0.5))));
+	v53 = ((v52*0.999)+(b/((v46+1.5))));
+	v54 = ((v53*0.999)+(b/((v47+2.5))));
+	v55 = ((v54*0.999)+(b/((v48+3.5))));
+	v56 = ((v55*0.999)+(b/((v49+4.5))));
+	v57 = ((v56*0.999)+(b/((v50+5.5))));
+	v58 = ((v57*0.999)+(b/((v51+6.5))));
+	v59 = ((v58*0.999)+(b/((v52+7.5))));
+	v60 = ((v59*0.999)+(b/((v53+8.5))));
+	v61 = ((v60*0.999)+(b/((v54+9.5))));
+	v62 = ((v61*0.999)+(b/((v55+10.5))));
+	v63 = ((v62*0.999)+(b/((v56+11.5))));
+	v64 = ((v63*0.999)+(b/((v57+12.5))));
+	v65 = ((v64*0.999)+(b/((v58+0.5))));
+	v66 = ((v65*0.999)+(b/((v59+1.5))));
+	v67 = ((v66*0.999)+(b/((v60+2.5))));
+	v68 = ((v67*0.999)+(b/((v61+3.5))));
+	v69 = ((v68*0.999)+(b/((v62+4.5))));
+	v70 = ((v69*0.999)+(b/((v63+5.5))));
+	v71 = ((v70*0.999)+(b/((v64+6.5))));
+	v72 = ((v71*0.999)+(b/((v65+7.5))));
+	v73 = ((v72*0.999)+(b/((v66+8.5))));
+	v74 = ((v73*0.999)+(b/((v67+9.5))));
+	v75 = ((v74*0.999)+(b/((v68+10.5))));
+	v76 = ((v75*0.999)+(b/((v69+11.5))));
+	v77 = ((v76*0.999)+(b/((v70+12.5))));
+	v78 = ((v77*0.999)+(b/((v71+0.5))));
+	v79 = ((v78*0.999)+(b/((v72+1.5))));
+	v80 = ((v79*0.999)+(b/((v73+2.5))));
+	v81 = ((v80*0.999)+(b/((v74+3.5))));
+	v82 = ((v81*0.999)+(b/((v75+4.5))));
+	v83 = ((v82*0.999)+(b/((v76+5.5))));
+	v84 = ((v83*0.999)+(b/((v77+6.5))));
+	v85 = ((v84*0.999)+(b/((v78+7.5))));
+	v86 = ((v85*0.999)+(b/((v79+8.5))));
+	v87 = ((v86*0.999)+(b/((v80+9.5))));
+	v88 = ((v87*0.999)+(b/((v81+10.5))));
+	v89 = ((v88*0.999)+(b/((v82+11.5))));
+	v90 = ((v89*0.999)+(b/((v83+12.5))));
+	v91 = ((v90*0.999)+(b/((v84+0.5))));
+	v92 = ((v91*0.999)+(b/((v85+1.5))));
+	v93 = ((v92*0.999)+(b/((v86+2.5))));
+	v94 = ((v93*0.999)+(b/((v87+3.5))));
+	v95 = ((v94*0.999)+(b/((v88+4.5))));
+	v96 = ((v95*0.999)+(b/((v89+5.5))));
+	v97 = ((v96*0.999)+(b/((v90+6.5))));
+	v98 = ((v97*0.999)+(b/((v91+7.5))));
+	v99 = ((v98*0.999)+(b/((v92+8.5))));
+	v100 = ((v99*0.999)+(b/((v93+9.5))));
+	v101 = ((v100*0.999)+(b/((v94+10.5))));
+	v102 = ((v101*0.999)+(b/((v95+11.5))));
+	v103 = ((v102*0.999)+(b/((v96+12.5))));
+	v104 = ((v103*0.999)+(b/((v97+0.5))));
+	v105 = ((v104*0.999)+(b/((v98+1.5))));
+	v106 = ((v105*0.999)+(b/((v99+2.5))));
+	v107 = ((v106*0.999)+(b/((v100+3.5))));
+	v108 = ((v107*0.999)+(b/((v101+4.5))));
+	v109 = ((v108*0.999)+(b/((v102+5.5))));
+	v110 = ((v109*0.999)+(b/((v103+6.5))));
+	v111 = ((v110*0.999)+(b/((v104+7.5))));
+	v112 = ((v111*0.999)+(b/((v105+8.5))));
+	v113 = ((v112*0.999)+(b/((v106+9.5))));
+	v114 = ((v113*0.999)+(b/((v107+10.5))));
+	v115 = ((v114*0.999)+(b/((v108+11.5))));
+	v116 = ((v115*0.999)+(b/((v109+12.5))));
+	v117 = ((v116*0.999)+(b/((v110+0.5))));
+	v118 = ((v117*0.999)+(b/((v111+1.5))));
+	v119 = ((v118*0.999)+(b/((v112+2.5))));
+	v120 = ((v119*0.999)+(b/((v113+3.5))));
+	v121 = ((v120*0.999)+(b/((v114+4.5))));
+	v122 = ((v121*0.999)+(b/((v115+5.5))));
+	v123 = ((v122*0.999)+(b/((v116+6.5))));
+	v124 = ((v123*0.999)+(b/((v117+7.5))));
+	v125 = ((v124*0.999)+(b/((v118+8.5))));
+	v126 = ((v125*0.999)+(b/((v119+9.5))));
+	v127 = ((v126*0.999)+(b/((v120+10.5))));
+	v128 = ((v127*0.999)+(b/((v121+11.5))));
+	v129 = ((v128*0.999)+(b/((v122+12.5))));
+	v130 = ((v129*0.999)+(b/((v123+0.5))));
+	v131 = ((v130*0.999)+(b/((v124+1.5))));
+	v132 = ((v131*0.999)+(b/((v125+2.5))));
+	v133 = ((v132*0.999)+(b/((v126+3.5))));
+	v134 = ((v133*0.999)+(b/((v127+4.5))));
+	v135 = ((v134*0.999)+(b/((v128+5.5))));
+	v136 = ((v135*0.999)+(b/((v129+6.5))));
+	v137 = ((v136*0.999)+(b/((v130+7.5))));
+	v138 = ((v137*0.999)+(b/((v131+8.5))));
+	v139 = ((v138*0.999)+(b/((v132+9.5))));
+	v140 = ((v139*0.999)+(b/((v133+10.5))));
+	v141 = ((v140*0.999)+(b/((v134+11.5))));
+	v142 = ((v141*0.999)+(b/((v135+12.5))));
+	v143 = ((v142*0.999)+(b/((v136+0.5))));
+	v144 = ((v143*0.999)+(b/((v137+1.5))));
+	v145 = ((v144*0.999)+(b/((v138+2.5))));
+	v146 = ((v145*0.999)+(b/((v139+3.5))));
+	v147 = ((v146*0.999)+(b/((v140+4.5))));
+	v148 = ((v147*0.999)+(b/((v141+5.5))));
+	v149 = ((v148*0.999)+(b/((v142+6.5))));
+	v150 = ((v149*0.999)+(b/((v143+7.5))));
+	v151 = ((v150*0.999)+(b/((v144+8.5))));
+	v152 = ((v151*0.999)+(b/((v145+9.5))));
+	v153 = ((v152*0.999)+(b/((v146+10.5))));
+	v154 = ((v153*0.999)+(b/((v147+11.5))));
+	v155 = ((v154*0.999)+(b/((v148+12.5))));
+	v156 = ((v155*0.999)+(b/((v149+0.5))));
+	v157 = ((v156*0.999)+(b/((v150+1.5))));
+	v158 = ((v157*0.999)+(b/((v151+2.5))));
+	v159 = ((v158*0.999)+(b/((v152+3.5))));
+	v160 = ((v159*0.999)+(b/((v153+4.5))));
+	v161 = ((v160*0.999)+(b/((v154+5.5))));
+	v162 = ((v161*0.999)+(b/((v155+6.5))));
+	v163 = ((v162*0.999)+(b/((v156+7.5))));
+	v164 = ((v163*0.999)+(b/((v157+8.5))));
+	v165 = ((v164*0.999)+(b/((v158+9.5))));
+	v166 = ((v165*0.999)+(b/((v159+10.5))));
+	v167 = ((v166*0.999)+(b/((v160+11.5))));
+	v168 = ((v167*0.999)+(b/((v161+12.5))));
+	v169 = ((v168*0.999)+(b/((v162+0.5))));
+	v170 = ((v169*0.999)+(b/((v163+1.5))));
+	v171 = ((v170*0.999)+(b/((v164+2.5))));
+	v172 = ((v171*0.999)+(b/((v165+3.5))));
+	v173 = ((v172*0.999)+(b/((v166+4.5))));
+	v174 = ((v173*0.999)+(b/((v167+5.5))));
+	v175 = ((v174*0.999)+(b/((v168+6.5))));
+	v176 = ((v175*0.999)+(b/((v169+7.5))));
+	v177 = ((v176*0.999)+(b/((v170+8.5))));
+	v178 = ((v177*0.999)+(b/((v171+9.5))));
+	v179 = ((v178*0.999)+(b/((v172+10.5))));
+	v180 = ((v179*0.999)+(b/((v173+11.5))));
+	v181 = ((v180*0.999)+(b/((v174+12.5))));
+	v182 = ((v181*0.999)+(b/((v175+0.5))));
+	v183 = ((v182*0.999)+(b/((v176+1.5))));
+	v184 = ((v183*0.999)+(b/((v177+2.5))));
+	v185 = ((v184*0.999)+(b/((v178+3.5))));
+	v186 = ((v185*0.999)+(b/((v179+4.5))));
+	v187 = ((v186*0.999)+(b/((v180+5.5))));
+	v188 = ((v187*0.999)+(b/((v181+6.5))));
+	v189 = ((v188*0.999)+(b/((v182+7.5))));
+	v190 = ((v189*0.999)+(b/((v183+8.5))));
+	v191 = ((v190*0.999)+(b/((v184+9.5))));
+	v192 = ((v191*0.999)+(b/((v185+10.5))));
+	v193 = ((v192*0.999)+(b/((v186+11.5))));
+	v194 = ((v193*0.999)+(b/((v187+12.5))));
+	v195 = ((v194*0.999)+(b/((v188+0.5))));
+	v196 = ((v195*0.999)+(b/((v189+1.5))));
+	v197 = ((v196*0.999)+(b/((v190+2.5))));
+	v198 = ((v197*0.999)+(b/((v191+3.5))));
+	v199 = ((v198*0.999)+(b/((v192+4.5))));
+	v200 = ((v199*0.999)+(b/((v193+5.5))));
+	v201 = ((v200*0.999)+(b/((v194+6.5))));
+	v202 = ((v201*0.999)+(b/((v195+7.5))));
+	v203 = ((v202*0.999)+(b/((v196+8.5))));
+	v204 = ((v203*0.999)+(b/((v197+9.5))));
+	v205 = ((v204*0.999)+(b/((v198+10.5))));
+	v206 = ((v205*0.999)+(b/((v199+11.5))));
+	v207 = ((v206*0.999)+(b/((v200+12.5))));
+	v208 = ((v207*0.999)+(b/((v201+0.5))));
+	v209 = ((v208*0.999)+(b/((v202+1.5))));
+	v210 = ((v209*0.999)+(b/((v203+2.5))));
+	v211 = ((v210*0.999)+(b/((v204+3.5))));
+	v212 = ((v211*0.999)+(b/((v205+4.5))));
+	v213 = ((v212*0.999)+(b/((v206+5.5))));
+	v214 = ((v213*0.999)+(b/((v207+6.5))));
+	v215 = ((v214*0.999)+(b/((v208+7.5))));
+	v216 = ((v215*0.999)+(b/((v209+8.5))));
+	v217 = ((v216*0.999)+(b/((v210+9.5))));
+	v218 = ((v217*0.999)+(b/((v211+10.5))));
+	v219 = ((v218*0.999)+(b/((v212+11.5))));
+	v220 = ((v219*0.999)+(b/((v213+12.5))));
+	v221 = ((v220*0.999)+(b/((v214+0.5))));
+	v222 = ((v221*0.999)+(b/((v215+1.5))));
+	v223 = ((v222*0.999)+(b/((v216+2.5))));
+	v224 = ((v223*0.999)+(b/((v217+3.5))));
+	v225 = ((v224*0.999)+(b/((v218+4.5))));
+	v226 = ((v225*0.999)+(b/((v219+5.5))));
+	v227 = ((v226*0.999)+(b/((v220+6.5))));
+	v228 = ((v227*0.999)+(b/((v221+7.5))));
+	v229 = ((v228*0.999)+(b/((v222+8.5))));
+	v230 = ((v229*0.999)+(b/((v223+9.5))));
+	v231 = ((v230*0.999)+(b/((v224+10.5))));
+	v232 = ((v231*0.999)+(b/((v225+11.5))));
+	v233 = ((v232*0.999)+(b/((v226+12.5))));
+	v234 = ((v233*0.999)+(b/((v227+0.5))));
+	v235 = ((v234*0.999)+(b/((v228+1.5))));
+	v236 = ((v235*0.999)+(b/((v229+2.5))));
+	v237 = ((v236*0.999)+(b/((v230+3.5))));
+	v238 = ((v237*0.999)+(b/((v231+4.5))));
+	v239 = ((v238*0.999)+(b/((v232+5.5))));
+	v240 = ((v239*0.999)+(b/((v233+6.5))));
+	v241 = ((v240*0.999)+(b/((v234+7.5))));
+	v242 = ((v241*0.999)+(b/((v235+8.5))));
+	v243 = ((v242*0.999)+(b/((v236+9.5))));
+	v244 = ((v243*0.999)+(b/((v237+10.5))));
+	v245 = ((v244*0.999)+(b/((v238+11.5))));
+	v246 = ((v245*0.999)+(b/((v239+12.5))));
+	v247 = ((v246*0.999)+(b/((v240+0.5))));
+	v248 = ((v247*0.999)+(b/((v241+1.5))));
+	v249 = ((v248*0.999)+(b/((v242+2.5))));
+	v250 = ((v249*0.999)+(b/((v243+3.5))));
+	v251 = ((v250*0.999)+(b/((v244+4.5))));
+	v252 = ((v251*0.999)+(b/((v245+5.5))));
+	v253 = ((v252*0.999)+(b/((v246+6.5))));
+	v254 = ((v253*0.999)+(b/((v247+7.5))));
+	v255 = ((v254*0.999)+(b/((v248+8.5))));
+	v256 = ((v255*0.999)+(b/((v249+9.5))));
+	v257 = ((v256*0.999)+(b/((v250+10.5))));
+	v258 = ((v257*0.999)+(b/((v251+11.5))));
+	v259 = ((v258*0.999)+(b/((v252+12.5))));
+	v260 = ((v259*0.999)+(b/((v253+0.5))));
+	v261 = ((v260*0.999)+(b/((v254+1.5))));
+	v262 = ((v261*0.999)+(b/((v255+2.5))));
+	v263 = ((v262*0.999)+(b/((v256+3.5))));
+	v264 = ((v263*0.999)+(b/((v257+4.5))));
+	v265 = ((v264*0.999)+(b/((v258+5.5))));
+	v266 = ((v265*0.999)+(b/((v259+6.5))));
+	v267 = ((v266*0.999)+(b/((v260+7.5))));
+	v268 = ((v267*0.999)+(b/((v261+8.5))));
+	v269 = ((v268*0.999)+(b/((v262+9.5))));
+	v270 = ((v269*0.999)+(b/((v263+10.5))));
+	v271 = ((v270*0.999)+(b/((v264+11.5))));
+	v272 = ((v271*0.999)+(b/((v265+12.5))));
+	v273 = ((v272*0.999)+(b/((v266+0.5))));
+	v274 = ((v273*0.999)+(b/((v267+1.5))));
+	v275 = ((v274*0.999)+(b/((v268+2.5))));
+	v276 = ((v275*0.999)+(b/((v269+3.5))));
+	v277 = ((v276*0.999)+(b/((v270+4.5))));
+	v278 = ((v277*0.999)+(b/((v271+5.5))));
+	v279 = ((v278*0.999)+(b/((v272+6.5))));
+	v280 = ((v279*0.999)+(b/((v273+7.5))));
+	v281 = ((v280*0.999)+(b/((v274+8.5))));
+	v282 = ((v281*0.999)+(b/((v275+9.5))));
+	v283 = ((v282*0.999)+(b/((v276+10.5))));
+	v284 = ((v283*0.999)+(b/((v277+11.5))));
+	v285 = ((v284*0.999)+(b/((v278+12.5))));
+	v286 = ((v285*0.999)+(b/((v279+0.5))));
+	v287 = ((v286*0.999)+(b/((v280+1.5))));
+	v288 = ((v287*0.999)+(b/((v281+2.5))));
+	v289 = ((v288*0.999)+(b/((v282+3.5))));
+	v290 = ((v289*0.999)+(b/((v283+4.5))));
+	v291 = ((v290*0.999)+(b/((v284+5.5))));
+	v292 = ((v291*0.999)+(b/((v285+6.5))));
+	v293 = ((v292*0.999)+(b/((v286+7.5))));
+	v294 = ((v293*0.999)+(b/((v287+8.5))));
+	v295 = ((v294*0.999)+(b/((v288+9.5))));
+	v296 = ((v295*0.999)+(b/((v289+10.5))));
+	v297 = ((v296*0.999)+(b/((v290+11.5))));
+	v298 = ((v297*0.999)+(b/((v291+12.5))));
+	v299 = ((v298*0.999)+(b/((v292+0.5))));
+	v300 = ((v299*0.999)+(b/((v293+1.5))));
+	v301 = ((v300*0.999)+(b/((v294+2.5))));
+	v302 = ((v301*0.999)+(b/((v295+3.5))));
+	v303 = ((v302*0.999)+(b/((v296+4.5))));
+	v304 = ((v303*0.999)+(b/((v297+5.5))));
+	v305 = ((v304*0.999)+(b/((v298+6.5))));
+	v306 = ((v305*0.999)+(b/((v299+7.5))));
+	v307 = ((v306*0.999)+(b/((v300+8.5))));
+	v308 = ((v307*0.999)+(b/((v301+9.5))));
+	v309 = ((v308*0.999)+(b/((v302+10.5))));
+	v310 = ((v309*0.999)+(b/((v303+11.5))));
+	v311 = ((v310*0.999)+(b/((v304+12.5))));
+	v312 = ((v311*0.999)+(b/((v305+0.5))));
+	v313 = ((v312*0.999)+(b/((v306+1.5))));
+	v314 = ((v313*0.999)+(b/((v307+2.5))));
+	v315 = ((v314*0.999)+(b/((v308+3.5))));
+	v316 = ((v315*0.999)+(b/((v309+4.5))));
+	v317 = ((v316*0.999)+(b/((v310+5.5))));
+	v318 = ((v317*0.999)+(b/((v311+6.5))));
+	v319 = ((v318*0.999)+(b/((v312+7.5))));
+	v320 = ((v319*0.999)+(b/((v313+8.5))));
+	v321 = ((v320*0.999)+(b/((v314+9.5))));
+	v322 = ((v321*0.999)+(b/((v315+10.5))));
+	v323 = ((v322*0.999)+(b/((v316+11.5))));
+	v324 = ((v323*0.999)+(b/((v317+12.5))));
+	v325 = ((v324*0.999)+(b/((v318+0.5))));
+	v326 = ((v325*0.999)+(b/((v319+1.5))));
+	v327 = ((v326*0.999)+(b/((v320+2.5))));
+	v328 = ((v327*0.999)+(b/((v321+3.5))));
+	v329 = ((v328*0.999)+(b/((v322+4.5))));
+	v330 = ((v329*0.999)+(b/((v323+5.5))));
+	v331 = ((v330*0.999)+(b/((v324+6.5))));
+	v332 = ((v331*0.999)+(b/((v325+7.5))));
+	v333 = ((v332*0.999)+(b/((v326+8.5))));
+	v334 = ((v333*0.999)+(b/((v327+9.5))));
+	v335 = ((v334*0.999)+(b/((v328+10.5))));
+	v336 = ((v335*0.999)+(b/((v329+11.5))));
+	v337 = ((v336*0.999)+(b/((v330+12.5))));
+	v338 = ((v337*0.999)+(b/((v331+0.5))));
+	v339 = ((v338*0.999)+(b/((v332+1.5))));
+	v340 = ((v339*0.999)+(b/((v333+2.5))));
+	v341 = ((v340*0.999)+(b/((v334+3.5))));
+	v342 = ((v341*0.999)+(b/((v335+4.5))));
+	v343 = ((v342*0.999)+(b/((v336+5.5))));
+	v344 = ((v343*0.999)+(b/((v337+6.5))));
+	v345 = ((v344*0.999)+(b/((v338+7.5))));
+	v346 = ((v345*0.999)+(b/((v339+8.5))));
+	v347 = ((v346*0.999)+(b/((v340+9.5))));
+	v348 = ((v347*0.999)+(b/((v341+10.5))));
+	v349 = ((v348*0.999)+(b/((v342+11.5))));
+	v350 = ((v349*0.999)+(b/((v343+12.5))));
+	v351 = ((v350*0.999)+(b/((v344+0.5))));
+	v352 = ((v351*0.999)+(b/((v345+1.5))));
+	v353 = ((v352*0.999)+(b/((v346+2.5))));
+	v354 = ((v353*0.999)+(b/((v347+3.5))));
+	v355 = ((v354*0.999)+(b/((v348+4.5))));
+	v356 = ((v355*0.999)+(b/((v349+5.5))));
+	v357 = ((v356*0.999)+(b/((v350+6.5))));
+	v358 = ((v357*0.999)+(b/((v351+7.5))));
+	v359 = ((v358*0.999)+(b/((v352+8.5))));
+	v360 = ((v359*0.999)+(b/((v353+9.5))));
+	v361 = ((v360*0.999)+(b/((v354+10.5))));
+	v362 = ((v361*0.999)+(b/((v355+11.5))));
+	v363 = ((v362*0.999)+(b/((v356+12.5))));
+	v364 = ((v363*0.999)+(b/((v357+0.5))));
+	v365 = ((v364*0.999)+(b/((v358+1.5))));
+	v366 = ((v365*0.999)+(b/((v359+2.5))));
+	v367 = ((v366*0.999)+(b/((v360+3.5))));
+	v368 = ((v367*0.999)+(b/((v361+4.5))));
+	v369 = ((v368*0.999)+(b/((v362+5.5))));
+	v370 = ((v369*0.999)+(b/((v363+6.5))));
+	v371 = ((v370*0.999)+(b/((v364+7.5))));
+	v372 = ((v371*0.999)+(b/((v365+8.5))));
+	v373 = ((v372*0.999)+(b/((v366+9.5))));
+	v374 = ((v373*0.999)+(b/((v367+10.5))));
+	v375 = ((v374*0.999)+(b/((v368+11.5))));
+	v376 = ((v375*0.999)+(b/((v369+12.5))));
+	v377 = ((v376*0.999)+(b/((v370+0.5))));
+	v378 = ((v377*0.999)+(b/((v371+1.5))));
+	v379 = ((v378*0.999)+(b/((v372+2.5))));
+	v380 = ((v379*0.999)+(b/((v373+3.5))));
+	v381 = ((v380*0.999)+(b/((v374+4.5))));
+	v382 = ((v381*0.999)+(b/((v375+5.5))));
+	v383 = ((v382*0.999)+(b/((v376+6.5))));
+	v384 = ((v383*0.999)+(b/((v377+7.5))));
+	v385 = ((v384*0.999)+(b/((v378+8.5))));
+	v386 = ((v385*0.999)+(b/((v379+9.5))));
+	v387 = ((v386*0.999)+(b/((v380+10.5))));
+	v388 = ((v387*0.999)+(b/((v381+11.5))));
+	v389 = ((v388*0.999)+(b/((v382+12.5))));
+	v390 = ((v389*0.999)+(b/((v383+0.5))));
+	v391 = ((v390*0.999)+(b/((v384+1.5))));
+	v392 = ((v391*0.999)+(b/((v385+2.5))));
+	v393 = ((v392*0.999)+(b/((v386+3.5))));
+	v394 = ((v393*0.999)+(b/((v387+4.5))));
+	v395 = ((v394*0.999)+(b/((v388+5.5))));
+	v396 = ((v395*0.999)+(b/((v389+6.5))));
+	v397 = ((v396*0.999)+(b/((v390+7.5))));
+	v398 = ((v397*0.999)+(b/((v391+8.5))));
+	v399 = ((v398*0.999)+(b/((v392+9.5))));
+	v400 = ((v399*0.999)+(b/((v393+10.5))));
+	v401 = ((v400*0.999)+(b/((v394+11.5))));
+	v402 = ((v401*0.999)+(b/((v395+12.5))));
+	v403 = ((v402*0.999)+(b/((v396+0.5))));
+	v404 = ((v403*0.999)+(b/((v397+1.5))));
+	v405 = ((v404*0.999)+(b/((v398+2.5))));
+	v406 = ((v405*0.999)+(b/((v399+3.5))));
+	v407 = ((v406*0.999)+(b/((v400+4.5))));
+	v408 = ((v407*0.999)+(b/((v401+5.5))));
+	v409 = ((v408*0.999)+(b/((v402+6.5))));
+	v410 = ((v409*0.999)+(b/((v403+7.5))));
+	v411 = ((v410*0.999)+(b/((v404+8.5))));
+	v412 = ((v411*0.999)+(b/((v405+9.5))));
+	v413 = ((v412*0.999)+(b/((v406+10.5))));
+	v414 = ((v413*0.999)+(b/((v407+11.5))));
+	v415 = ((v414*0.999)+(b/((v408+12.5))));
+	v416 = ((v415*0.999)+(b/((v409+0.5))));
+	v417 = ((v416*0.999)+(b/((v410+1.5))));
+	v418 = ((v417*0.999)+(b/((v411+2.5))));
+	v419 = ((v418*0.999)+(b/((v412+3.5))));
+	v420 = ((v419*0.999)+(b/((v413+4.5))));
+	v421 = ((v420*0.999)+(b/((v414+5.5))));
+	v422 = ((v421*0.999)+(b/((v415+6.5))));
+	v423 = ((v422*0.999)+(b/((v416+7.5))));
+	v424 = ((v423*0.999)+(b/((v417+8.5))));
+	v425 = ((v424*0.999)+(b/((v418+9.5))));
+	v426 = ((v425*0.999)+(b/((v419+10.5))));
+	v427 = ((v426*0.999)+(b/((v420+11.5))));
+	v428 = ((v427*0.999)+(b/((v421+12.5))));
+	v429 = ((v428*0.999)+(b/((v422+0.5))));
+	v430 = ((v429*0.999)+(b/((v423+1.5))));
+	v431 = ((v430*0.999)+(b/((v424+2.5))));
+	v432 = ((v431*0.999)+(b/((v425+3.5))));
+	v433 = ((v432*0.999)+(b/((v426+4.5))));
+	v434 = ((v433*0.999)+(b/((v427+5.5))));
+	v435 = ((v434*0.999)+(b/((v428+6.5))));
+	v436 = ((v435*0.999)+(b/((v429+7.5))));
+	v437 = ((v436*0.999)+(b/((v430+8.5))));
+	v438 = ((v437*0.999)+(b/((v431+9.5))));
+	v439 = ((v438*0.999)+(b/((v432+10.5))));
+	v440 = ((v439*0.999)+(b/((v433+11.5))));
+	v441 = ((v440*0.999)+(b/((v434+12.5))));
+	v442 = ((v441*0.999)+(b/((v435+0.5))));
+	v443 = ((v442*0.999)+(b/((v436+1.5))));
+	v444 = ((v443*0.999)+(b/((v437+2.5))));
+	v445 = ((v444*0.999)+(b/((v438+3.5))));
+	v446 = ((v445*0.999)+(b/((v439+4.5))));
+	v447 = ((v446*0.999)+(b/((v440+5.5))));
+	v448 = ((v447*0.999)+(b/((v441+6.5))));
+	v449 = ((v448*0.999)+(b/((v442+7.5))));
+	v450 = ((v449*0.999)+(b/((v443+8.5))));
+	v451 = ((v450*0.999)+(b/((v444+9.5))));
+	v452 = ((v451*0.999)+(b/((v445+10.5))));
+	v453 = ((v452*0.999)+(b/((v446+11.5))));
+	v454 = ((v453*0.999)+(b/((v447+12.5))));
+	v455 = ((v454*0.999)+(b/((v448+0.5))));
+	v456 = ((v455*0.999)+(b/((v449+1.5))));
+	v457 = ((v456*0.999)+(b/((v450+2.5))));
+	v458 = ((v457*0.999)+(b/((v451+3.5))));
+	v459 = ((v458*0.999)+(b/((v452+4.5))));
+	v460 = ((v459*0.999)+(b/((v453+5.5))));
+	v461 = ((v460*0.999)+(b/((v454+6.5))));
+	v462 = ((v461*0.999)+(b/((v455+7.5))));
+	v463 = ((v462*0.999)+(b/((v456+8.5))));
+	v464 = ((v463*0.999)+(b/((v457+9.5))));
+	v465 = ((v464*0.999)+(b/((v458+10.5))));
+	v466 = ((v465*0.999)+(b/((v459+11.5))));
+	v467 = ((v466*0.999)+(b/((v460+12.5))));
+	v468 = ((v467*0.999)+(b/((v461+0.5))));
+	v469 = ((v468*0.999)+(b/((v462+1.5))));
+	v470 = ((v469*0.999)+(b/((v463+2.5))));
+	v471 = ((v470*0.999)+(b/((v464+3.5))));
+	v472 = ((v471*0.999)+(b/((v465+4.5))));
+	v473 = ((v472*0.999)+(b/((v466+5.5))));
+	v474 = ((v473*0.999)+(b/((v467+6.5))));
+	v475 = ((v474*0.999)+(b/((v468+7.5))));
+	v476 = ((v475*0.999)+(b/((v469+8.5))));
+	v477 = ((v476*0.999)+(b/((v470+9.5))));
+	v478 = ((v477*0.999)+(b/((v471+10.5))));
+	v479 = ((v478*0.999)+(b/((v472+11.5))));
+	v480 = ((v479*0.999)+(b/((v473+12.5))));
+	v481 = ((v480*0.999)+(b/((v474+0.5))));
+	v482 = ((v481*0.999)+(b/((v475+1.5))));
+	v483 = ((v482*0.999)+(b/((v476+2.5))));
+	v484 = ((v483*0.999)+(b/((v477+3.5))));
+	v485 = ((v484*0.999)+(b/((v478+4.5))));
+	v486 = ((v485*0.999)+(b/((v479+5.5))));
+	v487 = ((v486*0.999)+(b/((v480+6.5))));
+	v488 = ((v487*0.999)+(b/((v481+7.5))));
+	v489 = ((v488*0.999)+(b/((v482+8.5))));
+	v490 = ((v489*0.999)+(b/((v483+9.5))));
+	v491 = ((v490*0.999)+(b/((v484+10.5))));
+	v492 = ((v491*0.999)+(b/((v485+11.5))));
+	v493 = ((v492*0.999)+(b/((v486+12.5))));
+	v494 = ((v493*0.999)+(b/((v487+0.5))));
+	v495 = ((v494*0.999)+(b/((v488+1.5))));
+	v496 = ((v495*0.999)+(b/((v489+2.5))));
+	v497 = ((v496*0.999)+(b/((v490+3.5))));
+	v498 = ((v497*0.999)+(b/((v491+4.5))));
+	v499 = ((v498*0.999)+(b/((v492+5.5))));
+	v500 = ((v499*0.999)+(b/((v493+6.5))));
+	v501 = ((v500*0.999)+(b/((v494+7.5))));
+	v502 = ((v501*0.999)+(b/((v495+8.5))));
+	v503 = ((v502*0.999)+(b/((v496+9.5))));
+	v504 = ((v503*0.999)+(b/((v497+10.5))));
+	v505 = ((v504*0.999)+(b/((v498+11.5))));
+	v506 = ((v505*0.999)+(b/((v499+12.5))));
+	v507 = ((v506*0.999)+(b/((v500+0.5))));
+	v508 = ((v507*0.999)+(b/((v501+1.5))));
+	v509 = ((v508*0.999)+(b/((v502+2.5))));
+	v510 = ((v509*0.999)+(b/((v503+3.5))));
+	v511 = ((v510*0.999)+(b/((v504+4.5))));
+	v512 = ((v511*0.999)+(b/((v505+5.5))));
+	v513 = ((v512*0.999)+(b/((v506+6.5))));
+	v514 = ((v513*0.999)+(b/((v507+7.5))));
+	v515 = ((v514*0.999)+(b/((v508+8.5))));
+	v516 = ((v515*0.999)+(b/((v509+9.5))));
+	v517 = ((v516*0.999)+(b/((v510+10.5))));
+	v518 = ((v517*0.999)+(b/((v511+11.5))));
+	v519 = ((v518*0.999)+(b/((v512+12.5))));
+	v520 = ((v519*0.999)+(b/((v513+0.5))));
+	v521 = ((v520*0.999)+(b/((v514+1.5))));
+	v522 = ((v521*0.999)+(b/((v515+2.5))));
+	v523 = ((v522*0.999)+(b/((v516+3.5))));
+	v524 = ((v523*0.999)+(b/((v517+4.5))));
+	v525 = ((v524*0.999)+(b/((v518+5.5))));
+	v526 = ((v525*0.999)+(b/((v519+6.5))));
+	v527 = ((v526*0.999)+(b/((v520+7.5))));
+	v528 = ((v527*0.999)+(b/((v521+8.5))));
+	v529 = ((v528*0.999)+(b/((v522+9.5))));
+	v530 = ((v529*0.999)+(b/((v523+10.5))));
+	v531 = ((v530*0.999)+(b/((v524+11.5))));
+	v532 = ((v531*0.999)+(b/((v525+12.5))));
+	v533 = ((v532*0.999)+(b/((v526+0.5))));
+	v534 = ((v533*0.999)+(b/((v527+1.5))));
+	v535 = ((v534*0.999)+(b/((v528+2.5))));
+	v536 = ((v535*0.999)+(b/((v529+3.5))));
+	v537 = ((v536*0.999)+(b/((v530+4.5))));
+	v538 = ((v537*0.999)+(b/((v531+5.5))));
+	v539 = ((v538*0.999)+(b/((v532+6.5))));
+	v540 = ((v539*0.999)+(b/((v533+7.5))));
+	v541 = ((v540*0.999)+(b/((v534+8.5))));
+	v542 = ((v541*0.999)+(b/((v535+9.5))));
+	v543 = ((v542*0.999)+(b/((v536+10.5))));
+	v544 = ((v543*0.999)+(b/((v537+11.5))));
+	v545 = ((v544*0.999)+(b/((v538+12.5))));
+	v546 = ((v545*0.999)+(b/((v539+0.5))));
+	v547 = ((v546*0.999)+(b/((v540+1.5))));
+	v548 = ((v547*0.999)+(b/((v541+2.5))));
+	v549 = ((v548*0.999)+(b/((v542+3.5))));
+	v550 = ((v549*0.999)+(b/((v543+4.5))));
+	v551 = ((v550*0.999)+(b/((v544+5.5))));
+	v552 = ((v551*0.999)+(b/((v545+6.5))));
+	v553 = ((v552*0.999)+(b/((v546+7.5))));
+	v554 = ((v553*0.999)+(b/((v547+8.5))));
+	v555 = ((v554*0.999)+(b/((v548+9.5))));
+	v556 = ((v555*0.999)+(b/((v549+10.5))));
+	v557 = ((v556*0.999)+(b/((v550+11.5))));
+	v558 = ((v557*0.999)+(b/((v551+12.5))));
+	v559 = ((v558*0.999)+(b/((v552+0.5))));
+	v560 = ((v559*0.999)+(b/((v553+1.5))));
+	v561 = ((v560*0.999)+(b/((v554+2.5))));
+	v562 = ((v561*0.999)+(b/((v555+3.5))));
+	v563 = ((v562*0.999)+(b/((v556+4.5))));
+	v564 = ((v563*0.999)+(b/((v557+5.5))));
+	v565 = ((v564*0.999)+(b/((v558+6.5))));
+	v566 = ((v565*0.999)+(b/((v559+7.5))));
+	v567 = ((v566*0.999)+(b/((v560+8.5))));
+	v568 = ((v567*0.999)+(b/((v561+9.5))));
+	v569 = ((v568*0.999)+(b/((v562+10.5))));
+	v570 = ((v569*0.999)+(b/((v563+11.5))));
+	v571 = ((v570*0.999)+(b/((v564+12.5))));
+	v572 = ((v571*0.999)+(b/((v565+0.5))));
+	v573 = ((v572*0.999)+(b/((v566+1.5))));
+	v574 = ((v573*0.999)+(b/((v567+2.5))));
+	v575 = ((v574*0.999)+(b/((v568+3.5))));
+	v576 = ((v575*0.999)+(b/((v569+4.5))));
+	v577 = ((v576*0.999)+(b/((v570+5.5))));
+	v578 = ((v577*0.999)+(b/((v571+6.5))));
+	v579 = ((v578*0.999)+(b/((v572+7.5))));
+	v580 = ((v579*0.999)+(b/((v573+8.5))));
+	v581 = ((v580*0.999)+(b/((v574+9.5))));
+	v582 = ((v581*0.999)+(b/((v575+10.5))));
+	v583 = ((v582*0.999)+(b/((v576+11.5))));
+	v584 = ((v583*0.999)+(b/((v577+12.5))));
+	v585 = ((v584*0.999)+(b/((v578+0.5))));
+	v586 = ((v585*0.999)+(b/((v579+1.5))));
+	v587 = ((v586*0.999)+(b/((v580+2.5))));
+	v588 = ((v587*0.999)+(b/((v581+3.5))));
+	v589 = ((v588*0.999)+(b/((v582+4.5))));
+	v590 = ((v589*0.999)+(b/((v583+5.5))));
+	v591 = ((v590*0.999)+(b/((v584+6.5))));
+	v592 = ((v591*0.999)+(b/((v585+7.5))));
+	v593 = ((v592*0.999)+(b/((v586+8.5))));
+	v594 = ((v593*0.999)+(b/((v587+9.5))));
+	v595 = ((v594*0.999)+(b/((v588+10.5))));
+	v596 = ((v595*0.999)+(b/((v589+11.5))));
+	v597 = ((v596*0.999)+(b/((v590+12.5))));
+	v598 = ((v597*0.999)+(b/((v591+0.5))));
+	v599 = ((v598*0.999)+(b/((v592+1.5))));
+	v600 = ((v599*0.999)+(b/((v593+2.5))));
+	v601 = ((v600*0.999)+(b/((v594+3.5))));
+	v602 = ((v601*0.999)+(b/((v595+4.5))));
+	v603 = ((v602*0.999)+(b/((v596+5.5))));
+	v604 = ((v603*0.999)+(b/((v597+6.5))));
+	v605 = ((v604*0.999)+(b/((v598+7.5))));
+	v606 = ((v605*0.999)+(b/((v599+8.5))));
+	v607 = ((v606*0.999)+(b/((v600+9.5))));
+	v608 = ((v607*0.999)+(b/((v601+10.5))));
+	v609 = ((v608*0.999)+(b/((v602+11.5))));
+	v610 = ((v609*0.999)+(b/((v603+12.5))));
+	v611 = ((v610*0.999)+(b/((v604+0.5))));
+	v612 = ((v611*0.999)+(b/((v605+1.5))));
+	v613 = ((v612*0.999)+(b/((v606+2.5))));
+	v614 = ((v613*0.999)+(b/((v607+3.5))));
+	v615 = ((v614*0.999)+(b/((v608+4.5))));
+	v616 = ((v615*0.999)+(b/((v609+5.5))));
+	v617 = ((v616*0.999)+(b/((v610+6.5))));
+	v618 = ((v617*0.999)+(b/((v611+7.5))));
+	v619 = ((v618*0.999)+(b/((v612+8.5))));
+	v620 = ((v619*0.999)+(b/((v613+9.5))));
+	v621 = ((v620*0.999)+(b/((v614+10.5))));
+	v622 = ((v621*0.999)+(b/((v615+11.5))));
+	v623 = ((v622*0.999)+(b/((v616+12.5))));
+	v624 = ((v623*0.999)+(b/((v617+0.5))));
+	v625 = ((v624*0.999)+(b/((v618+1.5))));
+	v626 = ((v625*0.999)+(b/((v619+2.5))));
+	v627 = ((v626*0.999)+(b/((v620+3.5))));
+	v628 = ((v627*0.999)+(b/((v621+4.5))));
+	v629 = ((v628*0.999)+(b/((v622+5.5))));
+	v630 = ((v629*0.999)+(b/((v623+6.5))));
+	v631 = ((v630*0.999)+(b/((v624+7.5))));
+	v632 = ((v631*0.999)+(b/((v625+8.5))));
+	v633 = ((v632*0.999)+(b/((v626+9.5))));
+	v634 = ((v633*0.999)+(b/((v627+10.5))));
+	v635 = ((v634*0.999)+(b/((v628+11.5))));
+	v636 = ((v635*0.999)+(b/((v629+12.5))));
+	v637 = ((v636*0.999)+(b/((v630+0.5))));
+	v638 = ((v637*0.999)+(b/((v631+1.5))));
+	v639 = ((v638*0.999)+(b/((v632+2.5))));
+	v640 = ((v639*0.999)+(b/((v633+3.5))));
+	v641 = ((v640*0.999)+(b/((v634+4.5))));
+	v642 = ((v641*0.999)+(b/((v635+5.5))));
+	v643 = ((v642*0.999)+(b/((v636+6.5))));
+	v644 = ((v643*0.999)+(b/((v637+7.5))));
+	v645 = ((v644*0.999)+(b/((v638+8.5))));
+	v646 = ((v645*0.999)+(b/((v639+9.5))));
+	v647 = ((v646*0.999)+(b/((v640+10.5))));
+	v648 = ((v647*0.999)+(b/((v641+11.5))));
+	v649 = ((v648*0.999)+(b/((v642+12.5))));
+	v650 = ((v649*0.999)+(b/((v643+0.5))));
+	v651 = ((v650*0.999)+(b/((v644+1.5))));
+	v652 = ((v651*0.999)+(b/((v645+2.5))));
+	v653 = ((v652*0.999)+(b/((v646+3.5))));
+	v654 = ((v653*0.999)+(b/((v647+4.5))));
+	v655 = ((v654*0.999)+(b/((v648+5.5))));
+	v656 = ((v655*0.999)+(b/((v649+6.5))));
+	v657 = ((v656*0.999)+(b/((v650+7.5))));
+	v658 = ((v657*0.999)+(b/((v651+8.5))));
+	v659 = ((v658*0.999)+(b/((v652+9.5))));
+	v660 = ((v659*0.999)+(b/((v653+10.5))));
+	v661 = ((v660*0.999)+(b/((v654+11.5))));
+	v662 = ((v661*0.999)+(b/((v655+12.5))));
+	v663 = ((v662*0.999)+(b/((v656+0.5))));
+	v664 = ((v663*0.999)+(b/((v657+1.5))));
+	v665 = ((v664*0.999)+(b/((v658+2.5))));
+	v666 = ((v665*0.999)+(b/((v659+3.5))));
+	v667 = ((v666*0.999)+(b/((v660+4.5))));
+	v668 = ((v667*0.999)+(b/((v661+5.5))));
+	v669 = ((v668*0.999)+(b/((v662+6.5))));
+	v670 = ((v669*0.999)+(b/((v663+7.5))));
+	v671 = ((v670*0.999)+(b/((v664+8.5))));
+	v672 = ((v671*0.999)+(b/((v665+9.5))));
+	v673 = ((v672*0.999)+(b/((v666+10.5))));
+	v674 = ((v673*0.999)+(b/((v667+11.5))));
+	v675 = ((v674*0.999)+(b/((v668+12.5))));
+	v676 = ((v675*0.999)+(b/((v669+0.5))));
+	v677 = ((v676*0.999)+(b/((v670+1.5))));
+	v678 = ((v677*0.999)+(b/((v671+2.5))));
+	v679 = ((v678*0.999)+(b/((v672+3.5))));
+	v680 = ((v679*0.999)+(b/((v673+4.5))));
+	v681 = ((v680*0.999)+(b/((v674+5.5))));
+	v682 = ((v681*0.999)+(b/((v675+6.5))));
+	v683 = ((v682*0.999)+(b/((v676+7.5))));
+	v684 = ((v683*0.999)+(b/((v677+8.5))));
+	v685 = ((v684*0.999)+(b/((v678+9.5))));
+	v686 = ((v685*0.999)+(b/((v679+10.5))));
+	v687 = ((v686*0.999)+(b/((v680+11.5))));
+	v688 = ((v687*0.999)+(b/((v681+12.5))));
+	v689 = ((v688*0.999)+(b/((v682+0.5))));
+	v690 = ((v689*0.999)+(b/((v683+1.5))));
+	v691 = ((v690*0.999)+(b/((v684+2.5))));
+	v692 = ((v691*0.999)+(b/((v685+3.5))));
+	v693 = ((v692*0.999)+(b/((v686+4.5))));
+	v694 = ((v693*0.999)+(b/((v687+5.5))));
+	v695 = ((v694*0.999)+(b/((v688+6.5))));
+	v696 = ((v695*0.999)+(b/((v689+7.5))));
+	v697 = ((v696*0.999)+(b/((v690+8.5))));
+	v698 = ((v697*0.999)+(b/((v691+9.5))));
+	v699 = ((v698*0.999)+(b/((v692+10.5))));
+	v700 = ((v699*0.999)+(b/((v693+11.5))));
+	v701 = ((v700*0.999)+(b/((v694+12.5))));
+	v702 = ((v701*0.999)+(b/((v695+0.5))));
+	v703 = ((v702*0.999)+(b/((v696+1.5))));
+	v704 = ((v703*0.999)+(b/((v697+2.5))));
+	v705 = ((v704*0.999)+(b/((v698+3.5))));
+	v706 = ((v705*0.999)+(b/((v699+4.5))));
+	v707 = ((v706*0.999)+(b/((v700+5.5))));
+	v708 = ((v707*0.999)+(b/((v701+6.5))));
+	v709 = ((v708*0.999)+(b/((v702+7.5))));
+	v710 = ((v709*0.999)+(b/((v703+8.5))));
+	v711 = ((v710*0.999)+(b/((v704+9.5))));
+	v712 = ((v711*0.999)+(b/((v705+10.5))));
+	v713 = ((v712*0.999)+(b/((v706+11.5))));
+	v714 = ((v713*0.999)+(b/((v707+12.5))));
+	v715 = ((v714*0.999)+(b/((v708+0.5))));
+	v716 = ((v715*0.999)+(b/((v709+1.5))));
+	v717 = ((v716*0.999)+(b/((v710+2.5))));
+	v718 = ((v717*0.999)+(b/((v711+3.5))));
+	v719 = ((v718*0.999)+(b/((v712+4.5))));
+	v720 = ((v719*0.999)+(b/((v713+5.5))));
+	v721 = ((v720*0.999)+(b/((v714+6.5))));
+	v722 = ((v721*0.999)+(b/((v715+7.5))));
+	v723 = ((v722*0.999)+(b/((v716+8.5))));
+	v724 = ((v723*0.999)+(b/((v717+9.5))));
+	v725 = ((v724*0.999)+(b/((v718+10.5))));
+	v726 = ((v725*0.999)+(b/((v719+11.5))));
+	v727 = ((v726*0.999)+(b/((v720+12.5))));
+	v728 = ((v727*0.999)+(b/((v721+0.5))));
+	v729 = ((v728*0.999)+(b/((v722+1.5))));
+	v730 = ((v729*0.999)+(b/((v723+2.5))));
+	v731 = ((v730*0.999)+(b/((v724+3.5))));
+	v732 = ((v731*0.999)+(b/((v725+4.5))));
+	v733 = ((v732*0.999)+(b/((v726+5.5))));
+	v734 = ((v733*0.999)+(b/((v727+6.5))));
+	v735 = ((v734*0.999)+(b/((v728+7.5))));
+	v736 = ((v735*0.999)+(b/((v729+8.5))));
+	v737 = ((v736*0.999)+(b/((v730+9.5))));
+	v738 = ((v737*0.999)+(b/((v731+10.5))));
+	v739 = ((v738*0.999)+(b/((v732+11.5))));
+	v740 = ((v739*0.999)+(b/((v733+12.5))));
+	v741 = ((v740*0.999)+(b/((v734+0.5))));
+	v742 = ((v741*0.999)+(b/((v735+1.5))));
+	v743 = ((v742*0.999)+(b/((v736+2.5))));
+	v744 = ((v743*0.999)+(b/((v737+3.5))));
+	v745 = ((v744*0.999)+(b/((v738+4.5))));
+	v746 = ((v745*0.999)+(b/((v739+5.5))));
+	v747 = ((v746*0.999)+(b/((v740+6.5))));
+	v748 = ((v747*0.999)+(b/((v741+7.5))));
+	v749 = ((v748*0.999)+(b/((v742+8.5))));
+	v750 = ((v749*0.999)+(b/((v743+9.5))));
+	v751 = ((v750*0.999)+(b/((v744+10.5))));
+	v752 = ((v751*0.999)+(b/((v745+11.5))));
+	v753 = ((v752*0.999)+(b/((v746+12.5))));
+	v754 = ((v753*0.999)+(b/((v747+0.5))));
+	v755 = ((v754*0.999)+(b/((v748+1.5))));
+	v756 = ((v755*0.999)+(b/((v749+2.5))));
+	v757 = ((v756*0.999)+(b/((v750+3.5))));
+	v758 = ((v757*0.999)+(b/((v751+4.5))));
+	v759 = ((v758*0.999)+(b/((v752+5.5))));
+	v760 = ((v759*0.999)+(b/((v753+6.5))));
+	v761 = ((v760*0.999)+(b/((v754+7.5))));
+	v762 = ((v761*0.999)+(b/((v755+8.5))));
+	v763 = ((v762*0.999)+(b/((v756+9.5))));
+	v764 = ((v763*0.999)+(b/((v757+10.5))));
+	v765 = ((v764*0.999)+(b/((v758+11.5))));
+	v766 = ((v765*0.999)+(b/((v759+12.5))));
+	v767 = ((v766*0.999)+(b/((v760+0.5))));
+	v768 = ((v767*0.999)+(b/((v761+1.5))));
+	v769 = ((v768*0.999)+(b/((v762+2.5))));
+	v770 = ((v769*0.999)+(b/((v763+3.5))));
+	v771 = ((v770*0.999)+(b/((v764+4.5))));
+	v772 = ((v771*0.999)+(b/((v765+5.5))));
+	v773 = ((v772*0.999)+(b/((v766+6.5))));
+	v774 = ((v773*0.999)+(b/((v767+7.5))));
+	v775 = ((v774*0.999)+(b/((v768+8.5))));
+	v776 = ((v775*0.999)+(b/((v769+9.5))));
+	v777 = ((v776*0.999)+(b/((v770+10.5))));
+	v778 = ((v777*0.999)+(b/((v771+11.5))));
+	v779 = ((v778*0.999)+(b/((v772+12.5))));
+	v780 = ((v779*0.999)+(b/((v773+0.5))));
+	v781 = ((v780*0.999)+(b/((v774+1.5))));
+	v782 = ((v781*0.999)+(b/((v775+2.5))));
+	v783 = ((v782*0.999)+(b/((v776+3.5))));
+	v784 = ((v783*0.999)+(b/((v777+4.5))));
+	v785 = ((v784*0.999)+(b/((v778+5.5))));
+	v786 = ((v785*0.999)+(b/((v779+6.5))));
+	v787 = ((v786*0.999)+(b/((v780+7.5))));
+	v788 = ((v787*0.999)+(b/((v781+8.5))));
+	v789 = ((v788*0.999)+(b/((v782+9.5))));
+	v790 = ((v789*0.999)+(b/((v783+10.5))));
+	v791 = ((v790*0.999)+(b/((v784+11.5))));
+	v792 = ((v791*0.999)+(b/((v785+12.5))));
+	v793 = ((v792*0.999)+(b/((v786+0.5))));
+	v794 = ((v793*0.999)+(b/((v787+1.5))));
+	v795 = ((v794*0.999)+(b/((v788+2.5))));
+	v796 = ((v795*0.999)+(b/((v789+3.5))));
+	v797 = ((v796*0.999)+(b/((v790+4.5))));
+	v798 = ((v797*0.999)+(b/((v791+5.5))));
+	v799 = ((v798*0.999)+(b/((v792+6.5))));
+	v800 = ((v799*0.999)+(b/((v793+7.5))));
+	v801 = ((v800*0.999)+(b/((v794+8.5))));
+	v802 = ((v801*0.999)+(b/((v795+9.5))));
+	v803 = ((v802*0.999)+(b/((v796+10.5))));
+	v804 = ((v803*0.999)+(b/((v797+11.5))));
+	v805 = ((v804*0.999)+(b/((v798+12.5))));
+	v806 = ((v805*0.999)+(b/((v799+0.5))));
+	v807 = ((v806*0.999)+(b/((v800+1.5))));
+	v808 = ((v807*0.999)+(b/((v801+2.5))));
+	v809 = ((v808*0.999)+(b/((v802+3.5))));
+	v810 = ((v809*0.999)+(b/((v803+4.5))));
+	v811 = ((v810*0.999)+(b/((v804+5.5))));
+	v812 = ((v811*0.999)+(b/((v805+6.5))));
+	v813 = ((v812*0.999)+(b/((v806+7.5))));
+	v814 = ((v813*0.999)+(b/((v807+8.5))));
+	v815 = ((v814*0.999)+(b/((v808+9.5))));
+	v816 = ((v815*0.999)+(b/((v809+10.5))));
+	v817 = ((v816*0.999)+(b/((v810+11.5))));
+	v818 = ((v817*0.999)+(b/((v811+12.5))));
+	v819 = ((v818*0.999)+(b/((v812+0.5))));
+	v820 = ((v819*0.999)+(b/((v813+1.5))));
+	v821 = ((v820*0.999)+(b/((v814+2.5))));
+	v822 = ((v821*0.999)+(b/((v815+3.5))));
+	v823 = ((v822*0.999)+(b/((v816+4.5))));
+	v824 = ((v823*0.999)+(b/((v817+5.5))));
+	v825 = ((v824*0.999)+(b/((v818+6.5))));
+	v826 = ((v825*0.999)+(b/((v819+7.5))));
+	v827 = ((v826*0.999)+(b/((v820+8.5))));
+	v828 = ((v827*0.999)+(b/((v821+9.5))));
+	v829 = ((v828*0.999)+(b/((v822+10.5))));
+	v830 = ((v829*0.999)+(b/((v823+11.5))));
+	v831 = ((v830*0.999)+(b/((v824+12.5))));
+	v832 = ((v831*0.999)+(b/((v825+0.5))));
+	v833 = ((v832*0.999)+(b/((v826+1.5))));
+	v834 = ((v833*0.999)+(b/((v827+2.5))));
+	v835 = ((v834*0.999)+(b/((v828+3.5))));
+	v836 = ((v835*0.999)+(b/((v829+4.5))));
+	v837 = ((v836*0.999)+(b/((v830+5.5))));
+	v838 = ((v837*0.999)+(b/((v831+6.5))));
+	v839 = ((v838*0.999)+(b/((v832+7.5))));
+	v840 = ((v839*0.999)+(b/((v833+8.5))));
+	v841 = ((v840*0.999)+(b/((v834+9.5))));
+	v842 = ((v841*0.999)+(b/((v835+10.5))));
+	v843 = ((v842*0.999)+(b/((v836+11.5))));
+	v844 = ((v843*0.999)+(b/((v837+12.5))));
+	v845 = ((v844*0.999)+(b/((v838+0.5))));
+	v846 = ((v845*0.999)+(b/((v839+1.5))));
+	v847 = ((v846*0.999)+(b/((v840+2.5))));
+	v848 = ((v847*0.999)+(b/((v841+3.5))));
+	v849 = ((v848*0.999)+(b/((v842+4.5))));
+	v850 = ((v849*0.999)+(b/((v843+5.5))));
+	v851 = ((v850*0.999)+(b/((v844+6.5))));
+	v852 = ((v851*0.999)+(b/((v845+7.5))));
+	v853 = ((v852*0.999)+(b/((v846+8.5))));
+	v854 = ((v853*0.999)+(b/((v847+9.5))));
+	v855 = ((v854*0.999)+(b/((v848+10.5))));
+	v856 = ((v855*0.999)+(b/((v849+11.5))));
+	v857 = ((v856*0.999)+(b/((v850+12.5))));
+	v858 = ((v857*0.999)+(b/((v851+0.5))));
+	v859 = ((v858*0.999)+(b/((v852+1.5))));
+	v860 = ((v859*0.999)+(b/((v853+2.5))));
+	v861 = ((v860*0.999)+(b/((v854+3.5))));
+	v862 = ((v861*0.999)+(b/((v855+4.5))));
+	v863 = ((v862*0.999)+(b/((v856+5.5))));
+	v864 = ((v863*0.999)+(b/((v857+6.5))));
+	v865 = ((v864*0.999)+(b/((v858+7.5))));
+	v866 = ((v865*0.999)+(b/((v859+8.5))));
+	v867 = ((v866*0.999)+(b/((v860+9.5))));
+	v868 = ((v867*0.999)+(b/((v861+10.5))));
+	v869 = ((v868*0.999)+(b/((v862+11.5))));
+	v870 = ((v869*0.999)+(b/((v863+12.5))));
+	v871 = ((v870*0.999)+(b/((v864+0.5))));
+	v872 = ((v871*0.999)+(b/((v865+1.5))));
+	v873 = ((v872*0.999)+(b/((v866+2.5))));
+	v874 = ((v873*0.999)+(b/((v867+3.5))));
+	v875 = ((v874*0.999)+(b/((v868+4.5))));
+	v876 = ((v875*0.999)+(b/((v869+5.5))));
+	v877 = ((v876*0.999)+(b/((v870+6.5))));
+	v878 = ((v877*0.999)+(b/((v871+7.5))));
+	v879 = ((v878*0.999)+(b/((v872+8.5))));
+	v880 = ((v879*0.999)+(b/((v873+9.5))));
+	v881 = ((v880*0.999)+(b/((v874+10.5))));
+	v882 = ((v881*0.999)+(b/((v875+11.5))));
+	v883 = ((v882*0.999)+(b/((v876+12.5))));
+	v884 = ((v883*0.999)+(b/((v877+0.5))));
+	v885 = ((v884*0.999)+(b/((v878+1.5))));
+	v886 = ((v885*0.999)+(b/((v879+2.5))));
+	v887 = ((v886*0.999)+(b/((v880+3.5))));
+	v888 = ((v887*0.999)+(b/((v881+4.5))));
+	v889 = ((v888*0.999)+(b/((v882+5.5))));
+	v890 = ((v889*0.999)+(b/((v883+6.5))));
+	v891 = ((v890*0.999)+(b/((v884+7.5))));
+	v892 = ((v891*0.999)+(b/((v885+8.5))));
+	v893 = ((v892*0.999)+(b/((v886+9.5))));
+	v894 = ((v893*0.999)+(b/((v887+10.5))));
+	v895 = ((v894*0.999)+(b/((v888+11.5))));
+	v896 = ((v895*0.999)+(b/((v889+12.5))));
+	v897 = ((v896*0.999)+(b/((v890+0.5))));
+	v898 = ((v897*0.999)+(b/((v891+1.5))));
+	v899 = ((v898*0.999)+(b/((v892+2.5))));
+	v900 = ((v899*0.999)+(b/((v893+3.5))));
+	v901 = ((v900*0.999)+(b/((v894+4.5))));
+	v902 = ((v901*0.999)+(b/((v895+5.5))));
+	v903 = ((v902*0.999)+(b/((v896+6.5))));
+	v904 = ((v903*0.999)+(b/((v897+7.5))));
+	v905 = ((v904*0.999)+(b/((v898+8.5))));
+	v906 = ((v905*0.999)+(b/((v899+9.5))));
+	v907 = ((v906*0.999)+(b/((v900+10.5))));
+	v908 = ((v907*0.999)+(b/((v901+11.5))));
+	v909 = ((v908*0.999)+(b/((v902+12.5))));
+	v910 = ((v909*0.999)+(b/((v903+0.5))));
+	v911 = ((v910*0.999)+(b/((v904+1.5))));
+	v912 = ((v911*0.999)+(b/((v905+2.5))));
+	v913 = ((v912*0.999)+(b/((v906+3.5))));
+	v914 = ((v913*0.999)+(b/((v907+4.5))));
+	v915 = ((v914*0.999)+(b/((v908+5.5))));
+	v916 = ((v915*0.999)+(b/((v909+6.5))));
+	v917 = ((v916*0.999)+(b/((v910+7.5))));
+	v918 = ((v917*0.999)+(b/((v911+8.5))));
+	v919 = ((v918*0.999)+(b/((v912+9.5))));
+	v920 = ((v919*0.999)+(b/((v913+10.5))));
+	v921 = ((v920*0.999)+(b/((v914+11.5))));
+	v922 = ((v921*0.999)+(b/((v915+12.5))));
+	v923 = ((v922*0.999)+(b/((v916+0.5))));
+	v924 = ((v923*0.999)+(b/((v917+1.5))));
+	v925 = ((v924*0.999)+(b/((v918+2.5))));
+	v926 = ((v925*0.999)+(b/((v919+3.5))));
+	v927 = ((v926*0.999)+(b/((v920+4.5))));
+	v928 = ((v927*0.999)+(b/((v921+5.5))));
+	v929 = ((v928*0.999)+(b/((v922+6.5))));
+	v930 = ((v929*0.999)+(b/((v923+7.5))));
+	v931 = ((v930*0.999)+(b/((v924+8.5))));
+	v932 = ((v931*0.999)+(b/((v925+9.5))));
+	v933 = ((v932*0.999)+(b/((v926+10.5))));
+	v934 = ((v933*0.999)+(b/((v927+11.5))));
+	v935 = ((v934*0.999)+(b/((v928+12.5))));
+	v936 = ((v935*0.999)+(b/((v929+0.5))));
+	v937 = ((v936*0.999)+(b/((v930+1.5))));
+	v938 = ((v937*0.999)+(b/((v931+2.5))));
+	v939 = ((v938*0.999)+(b/((v932+3.5))));
+	v940 = ((v939*0.999)+(b/((v933+4.5))));
+	v941 = ((v940*0.999)+(b/((v934+5.5))));
+	v942 = ((v941*0.999)+(b/((v935+6.5))));
+	v943 = ((v942*0.999)+(b/((v936+7.5))));
+	v944 = ((v943*0.999)+(b/((v937+8.5))));
+	v945 = ((v944*0.999)+(b/((v938+9.5))));
+	v946 = ((v945*0.999)+(b/((v939+10.5))));
+	v947 = ((v946*0.999)+(b/((v940+11.5))));
+	v948 = ((v947*0.999)+(b/((v941+12.5))));
+	v949 = ((v948*0.999)+(b/((v942+0.5))));
+	v950 = ((v949*0.999)+(b/((v943+1.5))));
+	v951 = ((v950*0.999)+(b/((v944+2.5))));
+	v952 = ((v951*0.999)+(b/((v945+3.5))));
+	v953 = ((v952*0.999)+(b/((v946+4.5))));
+	v954 = ((v953*0.999)+(b/((v947+5.5))));
+	v955 = ((v954*0.999)+(b/((v948+6.5))));
+	v956 = ((v955*0.999)+(b/((v949+7.5))));
+	v957 = ((v956*0.999)+(b/((v950+8.5))));
+	v958 = ((v957*0.999)+(b/((v951+9.5))));
+	v959 = ((v958*0.999)+(b/((v952+10.5))));
+	v960 = ((v959*0.999)+(b/((v953+11.5))));
+	v961 = ((v960*0.999)+(b/((v954+12.5))));
+	v962 = ((v961*0.999)+(b/((v955+0.5))));
+	v963 = ((v962*0.999)+(b/((v956+1.5))));
+	v964 = ((v963*0.999)+(b/((v957+2.5))));
+	v965 = ((v964*0.999)+(b/((v958+3.5))));
+	v966 = ((v965*0.999)+(b/((v959+4.5))));
+	v967 = ((v966*0.999)+(b/((v960+5.5))));
+	v968 = ((v967*0.999)+(b/((v961+6.5))));
+	v969 = ((v968*0.999)+(b/((v962+7.5))));
+	v970 = ((v969*0.999)+(b/((v963+8.5))));
+	v971 = ((v970*0.999)+(b/((v964+9.5))));
+	v972 = ((v971*0.999)+(b/((v965+10.5))));
+	v973 = ((v972*0.999)+(b/((v966+11.5))));
+	v974 = ((v973*0.999)+(b/((v967+12.5))));
+	v975 = ((v974*0.999)+(b/((v968+0.5))));
+	v976 = ((v975*0.999)+(b/((v969+1.5))));
+	v977 = ((v976*0.999)+(b/((v970+2.5))));
+	v978 = ((v977*0.999)+(b/((v971+3.5))));
+	v979 = ((v978*0.999)+(b/((v972+4.5))));
+	v980 = ((v979*0.999)+(b/((v973+5.5))));
+	v981 = ((v980*0.999)+(b/((v974+6.5))));
+	v982 = ((v981*0.999)+(b/((v975+7.5))));
+	v983 = ((v982*0.999)+(b/((v976+8.5))));
+	v984 = ((v983*0.999)+(b/((v977+9.5))));
+	v985 = ((v984*0.999)+(b/((v978+10.5))));
+	v986 = ((v985*0.999)+(b/((v979+11.5))));
+	v987 = ((v986*0.999)+(b/((v980+12.5))));
+	v988 = ((v987*0.999)+(b/((v981+0.5))));
+	v989 = ((v988*0.999)+(b/((v982+1.5))));
+	v990 = ((v989*0.999)+(b/((v983+2.5))));
+	v991 = ((v990*0.999)+(b/((v984+3.5))));
+	v992 = ((v991*0.999)+(b/((v985+4.5))));
+	v993 = ((v992*0.999)+(b/((v986+5.5))));
+	v994 = ((v993*0.999)+(b/((v987+6.5))));
+	v995 = ((v994*0.999)+(b/((v988+7.5))));
+	v996 = ((v995*0.999)+(b/((v989+8.5))));
+	v997 = ((v996*0.999)+(b/((v990+9.5))));
+	v998 = ((v997*0.999)+(b/((v991+10.5))));
+	this->b = b;
+	this->v992 = v992;
+	this->v993 = v993;
+	this->v994 = v994;
+	this->v995 = v995;
+	this->v996 = v996;
+	this->v997 = v997;
+	this->v998 = v998;
+}
+
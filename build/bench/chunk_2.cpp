@@ -0,0 +1,2021 @@
+#include "chunk_state.h"
+
+void el_state::el_chunk1 ()
+{
+	double b = this->b;
+	double v992 = this->v992;
+	double v998 = this->v998;
+	double v999;
+	double v1000;
+	double v993 = this->v993;
+	double v1001;
+	double v994 = this->v994;
+	double v1002;
+	double v995 = this->v995;
+	double v1003;
+	double v996 = this->v996;
+	double v1004;
+	double v997 = this->v997;
+	double v1005;
+	double v1006;
+	double v1007;
+	double v1008;
+	double v1009;
+	double v1010;
+	double v1011;
+	double v1012;
+	double v1013;
+	double v1014;
+	double v1015;
+	double v1016;
+	double v1017;
+	double v1018;
+	double v1019;
+	double v1020;
+	double v1021;
+	double v1022;
+	double v1023;
+	double v1024;
+	double v1025;
+	double v1026;
+	double v1027;
+	double v1028;
+	double v1029;
+	double v1030;
+	double v1031;
+	double v1032;
+	double v1033;
+	double v1034;
+	double v1035;
+	double v1036;
+	double v1037;
+	double v1038;
+	double v1039;
+	double v1040;
+	double v1041;
+	double v1042;
+	double v1043;
+	double v1044;
+	double v1045;
+	double v1046;
+	double v1047;
+	double v1048;
+	double v1049;
+	double v1050;
+	double v1051;
+	double v1052;
+	double v1053;
+	double v1054;
+	double v1055;
+	double v1056;
+	double v1057;
+	double v1058;
+	double v1059;
+	double v1060;
+	double v1061;
+	double v1062;
+	double v1063;
+	double v1064;
+	double v1065;
+	double v1066;
+	double v1067;
+	double v1068;
+	double v1069;
+	double v1070;
+	double v1071;
+	double v1072;
+	double v1073;
+	double v1074;
+	double v1075;
+	double v1076;
+	double v1077;
+	double v1078;
+	double v1079;
+	double v1080;
+	double v1081;
+	double v1082;
+	double v1083;
+	double v1084;
+	double v1085;
+	double v1086;
+	double v1087;
+	double v1088;
+	double v1089;
+	double v1090;
+	double v1091;
+	double v1092;
+	double v1093;
+	double v1094;
+	double v1095;
+	double v1096;
+	double v1097;
+	double v1098;
+	double v1099;
+	double v1100;
+	double v1101;
+	double v1102;
+	double v1103;
+	double v1104;
+	double v1105;
+	double v1106;
+	double v1107;
+	double v1108;
+	double v1109;
+	double v1110;
+	double v1111;
+	double v1112;
+	double v1113;
+	double v1114;
+	double v1115;
+	double v1116;
+	double v1117;
+	double v1118;
+	double v1119;
+	double v1120;
+	double v1121;
+	double v1122;
+	double v1123;
+	double v1124;
+	double v1125;
+	double v1126;
+	double v1127;
+	double v1128;
+	double v1129;
+	double v1130;
+	double v1131;
+	double v1132;
+	double v1133;
+	double v1134;
+	double v1135;
+	double v1136;
+	double v1137;
+	double v1138;
+	double v1139;
+	double v1140;
+	double v1141;
+	double v1142;
+	double v1143;
+	double v1144;
+	double v1145;
+	double v1146;
+	double v1147;
+	double v1148;
+	double v1149;
+	double v1150;
+	double v1151;
+	double v1152;
+	double v1153;
+	double v1154;
+	double v1155;
+	double v1156;
+	double v1157;
+	double v1158;
+	double v1159;
+	double v1160;
+	double v1161;
+	double v1162;
+	double v1163;
+	double v1164;
+	double v1165;
+	double v1166;
+	double v1167;
+	double v1168;
+	double v1169;
+	double v1170;
+	double v1171;
+	double v1172;
+	double v1173;
+	double v1174;
+	double v1175;
+	double v1176;
+	double v1177;
+	double v1178;
+	double v1179;
+	double v1180;
+	double v1181;
+	double v1182;
+	double v1183;
+	double v1184;
+	double v1185;
+	double v1186;
+	double v1187;
+	double v1188;
+	double v1189;
+	double v1190;
+	double v1191;
+	double v1192;
+	double v1193;
+	double v1194;
+	double v1195;
+	double v1196;
+	double v1197;
+	double v1198;
+	double v1199;
+	double v1200;
+	double v1201;
+	double v1202;
+	double v1203;
+	double v1204;
+	double v1205;
+	double v1206;
+	double v1207;
+	double v1208;
+	double v1209;
+	double v1210;
+	double v1211;
+	double v1212;
+	double v1213;
+	double v1214;
+	double v1215;
+	double v1216;
+	double v1217;
+	double v1218;
+	double v1219;
+	double v1220;
+	double v1221;
+	double v1222;
+	double v1223;
+	double v1224;
+	double v1225;
+	double v1226;
+	double v1227;
+	double v1228;
+	double v1229;
+	double v1230;
+	double v1231;
+	double v1232;
+	double v1233;
+	double v1234;
+	double v1235;
+	double v1236;
+	double v1237;
+	double v1238;
+	double v1239;
+	double v1240;
+	double v1241;
+	double v1242;
+	double v1243;
+	double v1244;
+	double v1245;
+	double v1246;
+	double v1247;
+	double v1248;
+	double v1249;
+	double v1250;
+	double v1251;
+	double v1252;
+	double v1253;
+	double v1254;
+	double v1255;
+	double v1256;
+	double v1257;
+	double v1258;
+	double v1259;
+	double v1260;
+	double v1261;
+	double v1262;
+	double v1263;
+	double v1264;
+	double v1265;
+	double v1266;
+	double v1267;
+	double v1268;
+	double v1269;
+	double v1270;
+	double v1271;
+	double v1272;
+	double v1273;
+	double v1274;
+	double v1275;
+	double v1276;
+	double v1277;
+	double v1278;
+	double v1279;
+	double v1280;
+	double v1281;
+	double v1282;
+	double v1283;
+	double v1284;
+	double v1285;
+	double v1286;
+	double v1287;
+	double v1288;
+	double v1289;
+	double v1290;
+	double v1291;
+	double v1292;
+	double v1293;
+	double v1294;
+	double v1295;
+	double v1296;
+	double v1297;
+	double v1298;
+	double v1299;
+	double v1300;
+	double v1301;
+	double v1302;
+	double v1303;
+	double v1304;
+	double v1305;
+	double v1306;
+	double v1307;
+	double v1308;
+	double v1309;
+	double v1310;
+	double v1311;
+	double v1312;
+	double v1313;
+	double v1314;
+	double v1315;
+	double v1316;
+	double v1317;
+	double v1318;
+	double v1319;
+	double v1320;
+	double v1321;
+	double v1322;
+	double v1323;
+	double v1324;
+	double v1325;
+	double v1326;
+	double v1327;
+	double v1328;
+	double v1329;
+	double v1330;
+	double v1331;
+	double v1332;
+	double v1333;
+	double v1334;
+	double v1335;
+	double v1336;
+	double v1337;
+	double v1338;
+	double v1339;
+	double v1340;
+	double v1341;
+	double v1342;
+	double v1343;
+	double v1344;
+	double v1345;
+	double v1346;
+	double v1347;
+	double v1348;
+	double v1349;
+	double v1350;
+	double v1351;
+	double v1352;
+	double v1353;
+	double v1354;
+	double v1355;
+	double v1356;
+	double v1357;
+	double v1358;
+	double v1359;
+	double v1360;
+	double v1361;
+	double v1362;
+	double v1363;
+	double v1364;
+	double v1365;
+	double v1366;
+	double v1367;
+	double v1368;
+	double v1369;
+	double v1370;
+	double v1371;
+	double v1372;
+	double v1373;
+	double v1374;
+	double v1375;
+	double v1376;
+	double v1377;
+	double v1378;
+	double v1379;
+	double v1380;
+	double v1381;
+	double v1382;
+	double v1383;
+	double v1384;
+	double v1385;
+	double v1386;
+	double v1387;
+	double v1388;
+	double v1389;
+	double v1390;
+	double v1391;
+	double v1392;
+	double v1393;
+	double v1394;
+	double v1395;
+	double v1396;
+	double v1397;
+	double v1398;
+	double v1399;
+	double v1400;
+	double v1401;
+	double v1402;
+	double v1403;
+	double v1404;
+	double v1405;
+	double v1406;
+	double v1407;
+	double v1408;
+	double v1409;
+	double v1410;
+	double v1411;
+	double v1412;
+	double v1413;
+	double v1414;
+	double v1415;
+	double v1416;
+	double v1417;
+	double v1418;
+	double v1419;
+	double v1420;
+	double v1421;
+	double v1422;
+	double v1423;
+	double v1424;
+	double v1425;
+	double v1426;
+	double v1427;
+	double v1428;
+	double v1429;
+	double v1430;
+	double v1431;
+	double v1432;
+	double v1433;
+	double v1434;
+	double v1435;
+	double v1436;
+	double v1437;
+	double v1438;
+	double v1439;
+	double v1440;
+	double v1441;
+	double v1442;
+	double v1443;
+	double v1444;
+	double v1445;
+	double v1446;
+	double v1447;
+	double v1448;
+	double v1449;
+	double v1450;
+	double v1451;
+	double v1452;
+	double v1453;
+	double v1454;
+	double v1455;
+	double v1456;
+	double v1457;
+	double v1458;
+	double v1459;
+	double v1460;
+	double v1461;
+	double v1462;
+	double v1463;
+	double v1464;
+	double v1465;
+	double v1466;
+	double v1467;
+	double v1468;
+	double v1469;
+	double v1470;
+	double v1471;
+	double v1472;
+	double v1473;
+	double v1474;
+	double v1475;
+	double v1476;
+	double v1477;
+	double v1478;
+	double v1479;
+	double v1480;
+	double v1481;
+	double v1482;
+	double v1483;
+	double v1484;
+	double v1485;
+	double v1486;
+	double v1487;
+	double v1488;
+	double v1489;
+	double v1490;
+	double v1491;
+	double v1492;
+	double v1493;
+	double v1494;
+	double v1495;
+	double v1496;
+	double v1497;
+	double v1498;
+	double v1499;
+	double v1500;
+	double v1501;
+	double v1502;
+	double v1503;
+	double v1504;
+	double v1505;
+	double v1506;
+	double v1507;
+	double v1508;
+	double v1509;
+	double v1510;
+	double v1511;
+	double v1512;
+	double v1513;
+	double v1514;
+	double v1515;
+	double v1516;
+	double v1517;
+	double v1518;
+	double v1519;
+	double v1520;
+	double v1521;
+	double v1522;
+	double v1523;
+	double v1524;
+	double v1525;
+	double v1526;
+	double v1527;
+	double v1528;
+	double v1529;
+	double v1530;
+	double v1531;
+	double v1532;
+	double v1533;
+	double v1534;
+	double v1535;
+	double v1536;
+	double v1537;
+	double v1538;
+	double v1539;
+	double v1540;
+	double v1541;
+	double v1542;
+	double v1543;
+	double v1544;
+	double v1545;
+	double v1546;
+	double v1547;
+	double v1548;
+	double v1549;
+	double v1550;
+	double v1551;
+	double v1552;
+	double v1553;
+	double v1554;
+	double v1555;
+	double v1556;
+	double v1557;
+	double v1558;
+	double v1559;
+	double v1560;
+	double v1561;
+	double v1562;
+	double v1563;
+	double v1564;
+	double v1565;
+	double v1566;
+	double v1567;
+	double v1568;
+	double v1569;
+	double v1570;
+	double v1571;
+	double v1572;
+	double v1573;
+	double v1574;
+	double v1575;
+	double v1576;
+	double v1577;
+	double v1578;
+	double v1579;
+	double v1580;
+	double v1581;
+	double v1582;
+	double v1583;
+	double v1584;
+	double v1585;
+	double v1586;
+	double v1587;
+	double v1588;
+	double v1589;
+	double v1590;
+	double v1591;
+	double v1592;
+	double v1593;
+	double v1594;
+	double v1595;
+	double v1596;
+	double v1597;
+	double v1598;
+	double v1599;
+	double v1600;
+	double v1601;
+	double v1602;
+	double v1603;
+	double v1604;
+	double v1605;
+	double v1606;
+	double v1607;
+	double v1608;
+	double v1609;
+	double v1610;
+	double v1611;
+	double v1612;
+	double v1613;
+	double v1614;
+	double v1615;
+	double v1616;
+	double v1617;
+	double v1618;
+	double v1619;
+	double v1620;
+	double v1621;
+	double v1622;
+	double v1623;
+	double v1624;
+	double v1625;
+	double v1626;
+	double v1627;
+	double v1628;
+	double v1629;
+	double v1630;
+	double v1631;
+	double v1632;
+	double v1633;
+	double v1634;
+	double v1635;
+	double v1636;
+	double v1637;
+	double v1638;
+	double v1639;
+	double v1640;
+	double v1641;
+	double v1642;
+	double v1643;
+	double v1644;
+	double v1645;
+	double v1646;
+	double v1647;
+	double v1648;
+	double v1649;
+	double v1650;
+	double v1651;
+	double v1652;
+	double v1653;
+	double v1654;
+	double v1655;
+	double v1656;
+	double v1657;
+	double v1658;
+	double v1659;
+	double v1660;
+	double v1661;
+	double v1662;
+	double v1663;
+	double v1664;
+	double v1665;
+	double v1666;
+	double v1667;
+	double v1668;
+	double v1669;
+	double v1670;
+	double v1671;
+	double v1672;
+	double v1673;
+	double v1674;
+	double v1675;
+	double v1676;
+	double v1677;
+	double v1678;
+	double v1679;
+	double v1680;
+	double v1681;
+	double v1682;
+	double v1683;
+	double v1684;
+	double v1685;
+	double v1686;
+	double v1687;
+	double v1688;
+	double v1689;
+	double v1690;
+	double v1691;
+	double v1692;
+	double v1693;
+	double v1694;
+	double v1695;
+	double v1696;
+	double v1697;
+	double v1698;
+	double v1699;
+	double v1700;
+	double v1701;
+	double v1702;
+	double v1703;
+	double v1704;
+	double v1705;
+	double v1706;
+	double v1707;
+	double v1708;
+	double v1709;
+	double v1710;
+	double v1711;
+	double v1712;
+	double v1713;
+	double v1714;
+	double v1715;
+	double v1716;
+	double v1717;
+	double v1718;
+	double v1719;
+	double v1720;
+	double v1721;
+	double v1722;
+	double v1723;
+	double v1724;
+	double v1725;
+	double v1726;
+	double v1727;
+	double v1728;
+	double v1729;
+	double v1730;
+	double v1731;
+	double v1732;
+	double v1733;
+	double v1734;
+	double v1735;
+	double v1736;
+	double v1737;
+	double v1738;
+	double v1739;
+	double v1740;
+	double v1741;
+	double v1742;
+	double v1743;
+	double v1744;
+	double v1745;
+	double v1746;
+	double v1747;
+	double v1748;
+	double v1749;
+	double v1750;
+	double v1751;
+	double v1752;
+	double v1753;
+	double v1754;
+	double v1755;
+	double v1756;
+	double v1757;
+	double v1758;
+	double v1759;
+	double v1760;
+	double v1761;
+	double v1762;
+	double v1763;
+	double v1764;
+	double v1765;
+	double v1766;
+	double v1767;
+	double v1768;
+	double v1769;
+	double v1770;
+	double v1771;
+	double v1772;
+	double v1773;
+	double v1774;
+	double v1775;
+	double v1776;
+	double v1777;
+	double v1778;
+	double v1779;
+	double v1780;
+	double v1781;
+	double v1782;
+	double v1783;
+	double v1784;
+	double v1785;
+	double v1786;
+	double v1787;
+	double v1788;
+	double v1789;
+	double v1790;
+	double v1791;
+	double v1792;
+	double v1793;
+	double v1794;
+	double v1795;
+	double v1796;
+	double v1797;
+	double v1798;
+	double v1799;
+	double v1800;
+	double v1801;
+	double v1802;
+	double v1803;
+	double v1804;
+	double v1805;
+	double v1806;
+	double v1807;
+	double v1808;
+	double v1809;
+	double v1810;
+	double v1811;
+	double v1812;
+	double v1813;
+	double v1814;
+	double v1815;
+	double v1816;
+	double v1817;
+	double v1818;
+	double v1819;
+	double v1820;
+	double v1821;
+	double v1822;
+	double v1823;
+	double v1824;
+	double v1825;
+	double v1826;
+	double v1827;
+	double v1828;
+	double v1829;
+	double v1830;
+	double v1831;
+	double v1832;
+	double v1833;
+	double v1834;
+	double v1835;
+	double v1836;
+	double v1837;
+	double v1838;
+	double v1839;
+	double v1840;
+	double v1841;
+	double v1842;
+	double v1843;
+	double v1844;
+	double v1845;
+	double v1846;
+	double v1847;
+	double v1848;
+	double v1849;
+	double v1850;
+	double v1851;
+	double v1852;
+	double v1853;
+	double v1854;
+	double v1855;
+	double v1856;
+	double v1857;
+	double v1858;
+	double v1859;
+	double v1860;
+	double v1861;
+	double v1862;
+	double v1863;
+	double v1864;
+	double v1865;
+	double v1866;
+	double v1867;
+	double v1868;
+	double v1869;
+	double v1870;
+	double v1871;
+	double v1872;
+	double v1873;
+	double v1874;
+	double v1875;
+	double v1876;
+	double v1877;
+	double v1878;
+	double v1879;
+	double v1880;
+	double v1881;
+	double v1882;
+	double v1883;
+	double v1884;
+	double v1885;
+	double v1886;
+	double v1887;
+	double v1888;
+	double v1889;
+	double v1890;
+	double v1891;
+	double v1892;
+	double v1893;
+	double v1894;
+	double v1895;
+	double v1896;
+	double v1897;
+	double v1898;
+	double v1899;
+	double v1900;
+	double v1901;
+	double v1902;
+	double v1903;
+	double v1904;
+	double v1905;
+	double v1906;
+	double v1907;
+	double v1908;
+	double v1909;
+	double v1910;
+	double v1911;
+	double v1912;
+	double v1913;
+	double v1914;
+	double v1915;
+	double v1916;
+	double v1917;
+	double v1918;
+	double v1919;
+	double v1920;
+	double v1921;
+	double v1922;
+	double v1923;
+	double v1924;
+	double v1925;
+	double v1926;
+	double v1927;
+	double v1928;
+	double v1929;
+	double v1930;
+	double v1931;
+	double v1932;
+	double v1933;
+	double v1934;
+	double v1935;
+	double v1936;
+	double v1937;
+	double v1938;
+	double v1939;
+	double v1940;
+	double v1941;
+	double v1942;
+	double v1943;
+	double v1944;
+	double v1945;
+	double v1946;
+	double v1947;
+	double v1948;
+	double v1949;
+	double v1950;
+	double v1951;
+	double v1952;
+	double v1953;
+	double v1954;
+	double v1955;
+	double v1956;
+	double v1957;
+	double v1958;
+	double v1959;
+	double v1960;
+	double v1961;
+	double v1962;
+	double v1963;
+	double v1964;
+	double v1965;
+	double v1966;
+	double v1967;
+	double v1968;
+	double v1969;
+	double v1970;
+	double v1971;
+	double v1972;
+	double v1973;
+	double v1974;
+	double v1975;
+	double v1976;
+	double v1977;
+	double v1978;
+	double v1979;
+	double v1980;
+	double v1981;
+	double v1982;
+	double v1983;
+	double v1984;
+	double v1985;
+	double v1986;
+	double v1987;
+	double v1988;
+	double v1989;
+	double v1990;
+	double v1991;
+	double v1992;
+	double v1993;
+	double v1994;
+	double v1995;
+	double v1996;
+	double v1997;
+	double v1998;
+	v999 = ((v998*0.999)+(b/((v992+11.5))));
+	v1000 = ((v999*0.999)+(b/((v993+12.5))));
+	v1001 = ((v1000*0.999)+(b/((v994+0.5))));
+	v1002 = ((v1001*0.999)+(b/((v995+1.5))));
+	v1003 = ((v1002*0.999)+(b/((v996+2.5))));
+	v1004 = ((v1003*0.999)+(b/((v997+3.5))));
+	v1005 = ((v1004*0.999)+(b/((v998+4.5))));
+	v1006 = ((v1005*0.999)+(b/((v999+5.5))));
+	v1007 = ((v1006*0.999)+(b/((v1000+6.5))));
+	v1008 = ((v1007*0.999)+(b/((v1001+7.5))));
+	v1009 = ((v1008*0.999)+(b/((v1002+8.5))));
+	v1010 = ((v1009*0.999)+(b/((v1003+9.5))));
+	v1011 = ((v1010*0.999)+(b/((v1004+10.5))));
+	v1012 = ((v1011*0.999)+(b/((v1005+11.5))));
+	v1013 = ((v1012*0.999)+(b/((v1006+12.5))));
+	v1014 = ((v1013*0.999)+(b/((v1007+0.5))));
+	v1015 = ((v1014*0.999)+(b/((v1008+1.5))));
+	v1016 = ((v1015*0.999)+(b/((v1009+2.5))));
+	v1017 = ((v1016*0.999)+(b/((v1010+3.5))));
+	v1018 = ((v1017*0.999)+(b/((v1011+4.5))));
+	v1019 = ((v1018*0.999)+(b/((v1012+5.5))));
+	v1020 = ((v1019*0.999)+(b/((v1013+6.5))));
+	v1021 = ((v1020*0.999)+(b/((v1014+7.5))));
+	v1022 = ((v1021*0.999)+(b/((v1015+8.5))));
+	v1023 = ((v1022*0.999)+(b/((v1016+9.5))));
+	v1024 = ((v1023*0.999)+(b/((v1017+10.5))));
+	v1025 = ((v1024*0.999)+(b/((v1018+11.5))));
+	v1026 = ((v1025*0.999)+(b/((v1019+12.5))));
+	v1027 = ((v1026*0.999)+(b/((v1020+0.5))));
+	v1028 = ((v1027*0.999)+(b/((v1021+1.5))));
+	v1029 = ((v1028*0.999)+(b/((v1022+2.5))));
+	v1030 = ((v1029*0.999)+(b/((v1023+3.5))));
+	v1031 = ((v1030*0.999)+(b/((v1024+4.5))));
+	v1032 = ((v1031*0.999)+(b/((v1025+5.5))));
+	v1033 = ((v1032*0.999)+(b/((v1026+6.5))));
+	v1034 = ((v1033*0.999)+(b/((v1027+7.5))));
+	v1035 = ((v1034*0.999)+(b/((v1028+8.5))));
+	v1036 = ((v1035*0.999)+(b/((v1029+9.5))));
+	v1037 = ((v1036*0.999)+(b/((v1030+10.5))));
+	v1038 = ((v1037*0.999)+(b/((v1031+11.5))));
+	v1039 = ((v1038*0.999)+(b/((v1032+12.5))));
+	v1040 = ((v1039*0.999)+(b/((v1033+0.5))));
+	v1041 = ((v1040*0.999)+(b/((v1034+1.5))));
+	v1042 = ((v1041*0.999)+(b/((v1035+2.5))));
+	v1043 = ((v1042*0.999)+(b/((v1036+3.5))));
+	v1044 = ((v1043*0.999)+(b/((v1037+4.5))));
+	v1045 = ((v1044*0.999)+(b/((v1038+5.5))));
+	v1046 = ((v1045*0.999)+(b/((v1039+6.5))));
+	v1047 = ((v1046*0.999)+(b/((v1040+7.5))));
+	v1048 = ((v1047*0.999)+(b/((v1041+8.5))));
+	v1049 = ((v1048*0.999)+(b/((v1042+9.5))));
+	v1050 = ((v1049*0.999)+(b/((v1043+10.5))));
+	v1051 = ((v1050*0.999)+(b/((v1044+11.5))));
+	v1052 = ((v1051*0.999)+(b/((v1045+12.5))));
+	v1053 = ((v1052*0.999)+(b/((v1046+0.5))));
+	v1054 = ((v1053*0.999)+(b/((v1047+1.5))));
+	v1055 = ((v1054*0.999)+(b/((v1048+2.5))));
+	v1056 = ((v1055*0.999)+(b/((v1049+3.5))));
+	v1057 = ((v1056*0.999)+(b/((v1050+4.5))));
+	v1058 = ((v1057*0.999)+(b/((v1051+5.5))));
+	v1059 = ((v1058*0.999)+(b/((v1052+6.5))));
+	v1060 = ((v1059*0.999)+(b/((v1053+7.5))));
+	v1061 = ((v1060*0.999)+(b/((v1054+8.5))));
+	v1062 = ((v1061*0.999)+(b/((v1055+9.5))));
+	v1063 = ((v1062*0.999)+(b/((v1056+10.5))));
+	v1064 = ((v1063*0.999)+(b/((v1057+11.5))));
+	v1065 = ((v1064*0.999)+(b/((v1058+12.5))));
+	v1066 = ((v1065*0.999)+(b/((v1059+0.5))));
+	v1067 = ((v1066*0.999)+(b/((v1060+1.5))));
+	v1068 = ((v1067*0.999)+(b/((v1061+2.5))));
+	v1069 = ((v1068*0.999)+(b/((v1062+3.5))));
+	v1070 = ((v1069*0.999)+(b/((v1063+4.5))));
+	v1071 = ((v1070*0.999)+(b/((v1064+5.5))));
+	v1072 = ((v1071*0.999)+(b/((v1065+6.5))));
+	v1073 = ((v1072*0.999)+(b/((v1066+7.5))));
+	v1074 = ((v1073*0.999)+(b/((v1067+8.5))));
+	v1075 = ((v1074*0.999)+(b/((v1068+9.5))));
+	v1076 = ((v1075*0.999)+(b/((v1069+10.5))));
+	v1077 = ((v1076*0.999)+(b/((v1070+11.5))));
+	v1078 = ((v1077*0.999)+(b/((v1071+12.5))));
+	v1079 = ((v1078*0.999)+(b/((v1072+0.5))));
+	v1080 = ((v1079*0.999)+(b/((v1073+1.5))));
+	v1081 = ((v1080*0.999)+(b/((v1074+2.5))));
+	v1082 = ((v1081*0.999)+(b/((v1075+3.5))));
+	v1083 = ((v1082*0.999)+(b/((v1076+4.5))));
+	v1084 = ((v1083*0.999)+(b/((v1077+5.5))));
+	v1085 = ((v1084*0.999)+(b/((v1078+6.5))));
+	v1086 = ((v1085*0.999)+(b/((v1079+7.5))));
+	v1087 = ((v1086*0.999)+(b/((v1080+8.5))));
+	v1088 = ((v1087*0.999)+(b/((v1081+9.5))));
+	v1089 = ((v1088*0.999)+(b/((v1082+10.5))));
+	v1090 = ((v1089*0.999)+(b/((v1083+11.5))));
+	v1091 = ((v1090*0.999)+(b/((v1084+12.5))));
+	v1092 = ((v1091*0.999)+(b/((v1085+0.5))));
+	v1093 = ((v1092*0.999)+(b/((v1086+1.5))));
+	v1094 = ((v1093*0.999)+(b/((v1087+2.5))));
+	v1095 = ((v1094*0.999)+(b/((v1088+3.5))));
+	v1096 = ((v1095*0.999)+(b/((v1089+4.5))));
+	v1097 = ((v1096*0.999)+(b/((v1090+5.5))));
+	v1098 = ((v1097*0.999)+(b/((v1091+6.5))));
+	v1099 = ((v1098*0.999)+(b/((v1092+7.5))));
+	v1100 = ((v1099*0.999)+(b/((v1093+8.5))));
+	v1101 = ((v1100*0.999)+(b/((v1094+9.5))));
+	v1102 = ((v1101*0.999)+(b/((v1095+10.5))));
+	v1103 = ((v1102*0.999)+(b/((v1096+11.5))));
+	v1104 = ((v1103*0.999)+(b/((v1097+12.5))));
+	v1105 = ((v1104*0.999)+(b/((v1098+0.5))));
+	v1106 = ((v1105*0.999)+(b/((v1099+1.5))));
+	v1107 = ((v1106*0.999)+(b/((v1100+2.5))));
+	v1108 = ((v1107*0.999)+(b/((v1101+3.5))));
+	v1109 = ((v1108*0.999)+(b/((v1102+4.5))));
+	v1110 = ((v1109*0.999)+(b/((v1103+5.5))));
+	v1111 = ((v1110*0.999)+(b/((v1104+6.5))));
+	v1112 = ((v1111*0.999)+(b/((v1105+7.5))));
+	v1113 = ((v1112*0.999)+(b/((v1106+8.5))));
+	v1114 = ((v1113*0.999)+(b/((v1107+9.5))));
+	v1115 = ((v1114*0.999)+(b/((v1108+10.5))));
+	v1116 = ((v1115*0.999)+(b/((v1109+11.5))));
+	v1117 = ((v1116*0.999)+(b/((v1110+12.5))));
+	v1118 = ((v1117*0.999)+(b/((v1111+0.5))));
+	v1119 = ((v1118*0.999)+(b/((v1112+1.5))));
+	v1120 = ((v1119*0.999)+(b/((v1113+2.5))));
+	v1121 = ((v1120*0.999)+(b/((v1114+3.5))));
+	v1122 = ((v1121*0.999)+(b/((v1115+4.5))));
+	v1123 = ((v1122*0.999)+(b/((v1116+5.5))));
+	v1124 = ((v1123*0.999)+(b/((v1117+6.5))));
+	v1125 = ((v1124*0.999)+(b/((v1118+7.5))));
+	v1126 = ((v1125*0.999)+(b/((v1119+8.5))));
+	v1127 = ((v1126*0.999)+(b/((v1120+9.5))));
+	v1128 = ((v1127*0.999)+(b/((v1121+10.5))));
+	v1129 = ((v1128*0.999)+(b/((v1122+11.5))));
+	v1130 = ((v1129*0.999)+(b/((v1123+12.5))));
+	v1131 = ((v1130*0.999)+(b/((v1124+0.5))));
+	v1132 = ((v1131*0.999)+(b/((v1125+1.5))));
+	v1133 = ((v1132*0.999)+(b/((v1126+2.5))));
+	v1134 = ((v1133*0.999)+(b/((v1127+3.5))));
+	v1135 = ((v1134*0.999)+(b/((v1128+4.5))));
+	v1136 = ((v1135*0.999)+(b/((v1129+5.5))));
+	v1137 = ((v1136*0.999)+(b/((v1130+6.5))));
+	v1138 = ((v1137*0.999)+(b/((v1131+7.5))));
+	v1139 = ((v1138*0.999)+(b/((v1132+8.5))));
+	v1140 = ((v1139*0.999)+(b/((v1133+9.5))));
+	v1141 = ((v1140*0.999)+(b/((v1134+10.5))));
+	v1142 = ((v1141*0.999)+(b/((v1135+11.5))));
+	v1143 = ((v1142*0.999)+(b/((v1136+12.5))));
+	v1144 = ((v1143*0.999)+(b/((v1137+0.5))));
+	v1145 = ((v1144*0.999)+(b/((v1138+1.5))));
+	v1146 = ((v1145*0.999)+(b/((v1139+2.5))));
+	v1147 = ((v1146*0.999)+(b/((v1140+3.5))));
+	v1148 = ((v1147*0.999)+(b/((v1141+4.5))));
+	v1149 = ((v1148*0.999)+(b/((v1142+5.5))));
+	v1150 = ((v1149*0.999)+(b/((v1143+6.5))));
+	v1151 = ((v1150*0.999)+(b/((v1144+7.5))));
+	v1152 = ((v1151*0.999)+(b/((v1145+8.5))));
+	v1153 = ((v1152*0.999)+(b/((v1146+9.5))));
+	v1154 = ((v1153*0.999)+(b/((v1147+10.5))));
+	v1155 = ((v1154*0.999)+(b/((v1148+11.5))));
+	v1156 = ((v1155*0.999)+(b/((v1149+12.5))));
+	v1157 = ((v1156*0.999)+(b/((v1150+0.5))));
+	v1158 = ((v1157*0.999)+(b/((v1151+1.5))));
+	v1159 = ((v1158*0.999)+(b/((v1152+2.5))));
+	v1160 = ((v1159*0.999)+(b/((v1153+3.5))));
+	v1161 = ((v1160*0.999)+(b/((v1154+4.5))));
+	v1162 = ((v1161*0.999)+(b/((v1155+5.5))));
+	v1163 = ((v1162*0.999)+(b/((v1156+6.5))));
+	v1164 = ((v1163*0.999)+(b/((v1157+7.5))));
+	v1165 = ((v1164*0.999)+(b/((v1158+8.5))));
+	v1166 = ((v1165*0.999)+(b/((v1159+9.5))));
+	v1167 = ((v1166*0.999)+(b/((v1160+10.5))));
+	v1168 = ((v1167*0.999)+(b/((v1161+11.5))));
+	v1169 = ((v1168*0.999)+(b/((v1162+12.5))));
+	v1170 = ((v1169*0.999)+(b/((v1163+0.5))));
+	v1171 = ((v1170*0.999)+(b/((v1164+1.5))));
+	v1172 = ((v1171*0.999)+(b/((v1165+2.5))));
+	v1173 = ((v1172*0.999)+(b/((v1166+3.5))));
+	v1174 = ((v1173*0.999)+(b/((v1167+4.5))));
+	v1175 = ((v1174*0.999)+(b/((v1168+5.5))));
+	v1176 = ((v1175*0.999)+(b/((v1169+6.5))));
+	v1177 = ((v1176*0.999)+(b/((v1170+7.5))));
+	v1178 = ((v1177*0.999)+(b/((v1171+8.5))));
+	v1179 = ((v1178*0.999)+(b/((v1172+9.5))));
+	v1180 = ((v1179*0.999)+(b/((v1173+10.5))));
+	v1181 = ((v1180*0.999)+(b/((v1174+11.5))));
+	v1182 = ((v1181*0.999)+(b/((v1175+12.5))));
+	v1183 = ((v1182*0.999)+(b/((v1176+0.5))));
+	v1184 = ((v1183*0.999)+(b/((v1177+1.5))));
+	v1185 = ((v1184*0.999)+(b/((v1178+2.5))));
+	v1186 = ((v1185*0.999)+(b/((v1179+3.5))));
+	v1187 = ((v1186*0.999)+(b/((v1180+4.5))));
+	v1188 = ((v1187*0.999)+(b/((v1181+5.5))));
+	v1189 = ((v1188*0.999)+(b/((v1182+6.5))));
+	v1190 = ((v1189*0.999)+(b/((v1183+7.5))));
+	v1191 = ((v1190*0.999)+(b/((v1184+8.5))));
+	v1192 = ((v1191*0.999)+(b/((v1185+9.5))));
+	v1193 = ((v1192*0.999)+(b/((v1186+10.5))));
+	v1194 = ((v1193*0.999)+(b/((v1187+11.5))));
+	v1195 = ((v1194*0.999)+(b/((v1188+12.5))));
+	v1196 = ((v1195*0.999)+(b/((v1189+0.5))));
+	v1197 = ((v1196*0.999)+(b/((v1190+1.5))));
+	v1198 = ((v1197*0.999)+(b/((v1191+2.5))));
+	v1199 = ((v1198*0.999)+(b/((v1192+3.5))));
+	v1200 = ((v1199*0.999)+(b/((v1193+4.5))));
+	v1201 = ((v1200*0.999)+(b/((v1194+5.5))));
+	v1202 = ((v1201*0.999)+(b/((v1195+6.5))));
+	v1203 = ((v1202*0.999)+(b/((v1196+7.5))));
+	v1204 = ((v1203*0.999)+(b/((v1197+8.5))));
+	v1205 = ((v1204*0.999)+(b/((v1198+9.5))));
+	v1206 = ((v1205*0.999)+(b/((v1199+10.5))));
+	v1207 = ((v1206*0.999)+(b/((v1200+11.5))));
+	v1208 = ((v1207*0.999)+(b/((v1201+12.5))));
+	v1209 = ((v1208*0.999)+(b/((v1202+0.5))));
+	v1210 = ((v1209*0.999)+(b/((v1203+1.5))));
+	v1211 = ((v1210*0.999)+(b/((v1204+2.5))));
+	v1212 = ((v1211*0.999)+(b/((v1205+3.5))));
+	v1213 = ((v1212*0.999)+(b/((v1206+4.5))));
+	v1214 = ((v1213*0.999)+(b/((v1207+5.5))));
+	v1215 = ((v1214*0.999)+(b/((v1208+6.5))));
+	v1216 = ((v1215*0.999)+(b/((v1209+7.5))));
+	v1217 = ((v1216*0.999)+(b/((v1210+8.5))));
+	v1218 = ((v1217*0.999)+(b/((v1211+9.5))));
+	v1219 = ((v1218*0.999)+(b/((v1212+10.5))));
+	v1220 = ((v1219*0.999)+(b/((v1213+11.5))));
+	v1221 = ((v1220*0.999)+(b/((v1214+12.5))));
+	v1222 = ((v1221*0.999)+(b/((v1215+0.5))));
+	v1223 = ((v1222*0.999)+(b/((v1216+1.5))));
+	v1224 = ((v1223*0.999)+(b/((v1217+2.5))));
+	v1225 = ((v1224*0.999)+(b/((v1218+3.5))));
+	v1226 = ((v1225*0.999)+(b/((v1219+4.5))));
+	v1227 = ((v1226*0.999)+(b/((v1220+5.5))));
+	v1228 = ((v1227*0.999)+(b/((v1221+6.5))));
+	v1229 = ((v1228*0.999)+(b/((v1222+7.5))));
+	v1230 = ((v1229*0.999)+(b/((v1223+8.5))));
+	v1231 = ((v1230*0.999)+(b/((v1224+9.5))));
+	v1232 = ((v1231*0.999)+(b/((v1225+10.5))));
+	v1233 = ((v1232*0.999)+(b/((v1226+11.5))));
+	v1234 = ((v1233*0.999)+(b/((v1227+12.5))));
+	v1235 = ((v1234*0.999)+(b/((v1228+0.5))));
+	v1236 = ((v1235*0.999)+(b/((v1229+1.5))));
+	v1237 = ((v1236*0.999)+(b/((v1230+2.5))));
+	v1238 = ((v1237*0.999)+(b/((v1231+3.5))));
+	v1239 = ((v1238*0.999)+(b/((v1232+4.5))));
+	v1240 = ((v1239*0.999)+(b/((v1233+5.5))));
+	v1241 = ((v1240*0.999)+(b/((v1234+6.5))));
+	v1242 = ((v1241*0.999)+(b/((v1235+7.5))));
+	v1243 = ((v1242*0.999)+(b/((v1236+8.5))));
+	v1244 = ((v1243*0.999)+(b/((v1237+9.5))));
+	v1245 = ((v1244*0.999)+(b/((v1238+10.5))));
+	v1246 = ((v1245*0.999)+(b/((v1239+11.5))));
+	v1247 = ((v1246*0.999)+(b/((v1240+12.5))));
+	v1248 = ((v1247*0.999)+(b/((v1241+0.5))));
+	v1249 = ((v1248*0.999)+(b/((v1242+1.5))));
+	v1250 = ((v1249*0.999)+(b/((v1243+2.5))));
+	v1251 = ((v1250*0.999)+(b/((v1244+3.5))));
+	v1252 = ((v1251*0.999)+(b/((v1245+4.5))));
+	v1253 = ((v1252*0.999)+(b/((v1246+5.5))));
+	v1254 = ((v1253*0.999)+(b/((v1247+6.5))));
+	v1255 = ((v1254*0.999)+(b/((v1248+7.5))));
+	v1256 = ((v1255*0.999)+(b/((v1249+8.5))));
+	v1257 = ((v1256*0.999)+(b/((v1250+9.5))));
+	v1258 = ((v1257*0.999)+(b/((v1251+10.5))));
+	v1259 = ((v1258*0.999)+(b/((v1252+11.5))));
+	v1260 = ((v1259*0.999)+(b/((v1253+12.5))));
+	v1261 = ((v1260*0.999)+(b/((v1254+0.5))));
+	v1262 = ((v1261*0.999)+(b/((v1255+1.5))));
+	v1263 = ((v1262*0.999)+(b/((v1256+2.5))));
+	v1264 = ((v1263*0.999)+(b/((v1257+3.5))));
+	v1265 = ((v1264*0.999)+(b/((v1258+4.5))));
+	v1266 = ((v1265*0.999)+(b/((v1259+5.5))));
+	v1267 = ((v1266*0.999)+(b/((v1260+6.5))));
+	v1268 = ((v1267*0.999)+(b/((v1261+7.5))));
+	v1269 = ((v1268*0.999)+(b/((v1262+8.5))));
+	v1270 = ((v1269*0.999)+(b/((v1263+9.5))));
+	v1271 = ((v1270*0.999)+(b/((v1264+10.5))));
+	v1272 = ((v1271*0.999)+(b/((v1265+11.5))));
+	v1273 = ((v1272*0.999)+(b/((v1266+12.5))));
+	v1274 = ((v1273*0.999)+(b/((v1267+0.5))));
+	v1275 = ((v1274*0.999)+(b/((v1268+1.5))));
+	v1276 = ((v1275*0.999)+(b/((v1269+2.5))));
+	v1277 = ((v1276*0.999)+(b/((v1270+3.5))));
+	v1278 = ((v1277*0.999)+(b/((v1271+4.5))));
+	v1279 = ((v1278*0.999)+(b/((v1272+5.5))));
+	v1280 = ((v1279*0.999)+(b/((v1273+6.5))));
+	v1281 = ((v1280*0.999)+(b/((v1274+7.5))));
+	v1282 = ((v1281*0.999)+(b/((v1275+8.5))));
+	v1283 = ((v1282*0.999)+(b/((v1276+9.5))));
+	v1284 = ((v1283*0.999)+(b/((v1277+10.5))));
+	v1285 = ((v1284*0.999)+(b/((v1278+11.5))));
+	v1286 = ((v1285*0.999)+(b/((v1279+12.5))));
+	v1287 = ((v1286*0.999)+(b/((v1280+0.5))));
+	v1288 = ((v1287*0.999)+(b/((v1281+1.5))));
+	v1289 = ((v1288*0.999)+(b/((v1282+2.5))));
+	v1290 = ((v1289*0.999)+(b/((v1283+3.5))));
+	v1291 = ((v1290*0.999)+(b/((v1284+4.5))));
+	v1292 = ((v1291*0.999)+(b/((v1285+5.5))));
+	v1293 = ((v1292*0.999)+(b/((v1286+6.5))));
+	v1294 = ((v1293*0.999)+(b/((v1287+7.5))));
+	v1295 = ((v1294*0.999)+(b/((v1288+8.5))));
+	v1296 = ((v1295*0.999)+(b/((v1289+9.5))));
+	v1297 = ((v1296*0.999)+(b/((v1290+10.5))));
+	v1298 = ((v1297*0.999)+(b/((v1291+11.5))));
+	v1299 = ((v1298*0.999)+(b/((v1292+12.5))));
+	v1300 = ((v1299*0.999)+(b/((v1293+0.5))));
+	v1301 = ((v1300*0.999)+(b/((v1294+1.5))));
+	v1302 = ((v1301*0.999)+(b/((v1295+2.5))));
+	v1303 = ((v1302*0.999)+(b/((v1296+3.5))));
+	v1304 = ((v1303*0.999)+(b/((v1297+4.5))));
+	v1305 = ((v1304*0.999)+(b/((v1298+5.5))));
+	v1306 = ((v1305*0.999)+(b/((v1299+6.5))));
+	v1307 = ((v1306*0.999)+(b/((v1300+7.5))));
+	v1308 = ((v1307*0.999)+(b/((v1301+8.5))));
+	v1309 = ((v1308*0.999)+(b/((v1302+9.5))));
+	v1310 = ((v1309*0.999)+(b/((v1303+10.5))));
+	v1311 = ((v1310*0.999)+(b/((v1304+11.5))));
+	v1312 = ((v1311*0.999)+(b/((v1305+12.5))));
+	v1313 = ((v1312*0.999)+(b/((v1306+0.5))));
+	v1314 = ((v1313*0.999)+(b/((v1307+1.5))));
+	v1315 = ((v1314*0.999)+(b/((v1308+2.5))));
+	v1316 = ((v1315*0.999)+(b/((v1309+3.5))));
+	v1317 = ((v1316*0.999)+(b/((v1310+4.5))));
+	v1318 = ((v1317*0.999)+(b/((v1311+5.5))));
+	v1319 = ((v1318*0.999)+(b/((v1312+6.5))));
+	v1320 = ((v1319*0.999)+(b/((v1313+7.5))));
+	v1321 = ((v1320*0.999)+(b/((v1314+8.5))));
+	v1322 = ((v1321*0.999)+(b/((v1315+9.5))));
+	v1323 = ((v1322*0.999)+(b/((v1316+10.5))));
+	v1324 = ((v1323*0.999)+(b/((v1317+11.5))));
+	v1325 = ((v1324*0.999)+(b/((v1318+12.5))));
+	v1326 = ((v1325*0.999)+(b/((v1319+0.5))));
+	v1327 = ((v1326*0.999)+(b/((v1320+1.5))));
+	v1328 = ((v1327*0.999)+(b/((v1321+2.5))));
+	v1329 = ((v1328*0.999)+(b/((v1322+3.5))));
+	v1330 = ((v1329*0.999)+(b/((v1323+4.5))));
+	v1331 = ((v1330*0.999)+(b/((v1324+5.5))));
+	v1332 = ((v1331*0.999)+(b/((v1325+6.5))));
+	v1333 = ((v1332*0.999)+(b/((v1326+7.5))));
+	v1334 = ((v1333*0.999)+(b/((v1327+8.5))));
+	v1335 = ((v1334*0.999)+(b/((v1328+9.5))));
+	v1336 = ((v1335*0.999)+(b/((v1329+10.5))));
+	v1337 = ((v1336*0.999)+(b/((v1330+11.5))));
+	v1338 = ((v1337*0.999)+(b/((v1331+12.5))));
+	v1339 = ((v1338*0.999)+(b/((v1332+0.5))));
+	v1340 = ((v1339*0.999)+(b/((v1333+1.5))));
+	v1341 = ((v1340*0.999)+(b/((v1334+2.5))));
+	v1342 = ((v1341*0.999)+(b/((v1335+3.5))));
+	v1343 = ((v1342*0.999)+(b/((v1336+4.5))));
+	v1344 = ((v1343*0.999)+(b/((v1337+5.5))));
+	v1345 = ((v1344*0.999)+(b/((v1338+6.5))));
+	v1346 = ((v1345*0.999)+(b/((v1339+7.5))));
+	v1347 = ((v1346*0.999)+(b/((v1340+8.5))));
+	v1348 = ((v1347*0.999)+(b/((v1341+9.5))));
+	v1349 = ((v1348*0.999)+(b/((v1342+10.5))));
+	v1350 = ((v1349*0.999)+(b/((v1343+11.5))));
+	v1351 = ((v1350*0.999)+(b/((v1344+12.5))));
+	v1352 = ((v1351*0.999)+(b/((v1345+0.5))));
+	v1353 = ((v1352*0.999)+(b/((v1346+1.5))));
+	v1354 = ((v1353*0.999)+(b/((v1347+2.5))));
+	v1355 = ((v1354*0.999)+(b/((v1348+3.5))));
+	v1356 = ((v1355*0.999)+(b/((v1349+4.5))));
+	v1357 = ((v1356*0.999)+(b/((v1350+5.5))));
+	v1358 = ((v1357*0.999)+(b/((v1351+6.5))));
+	v1359 = ((v1358*0.999)+(b/((v1352+7.5))));
+	v1360 = ((v1359*0.999)+(b/((v1353+8.5))));
+	v1361 = ((v1360*0.999)+(b/((v1354+9.5))));
+	v1362 = ((v1361*0.999)+(b/((v1355+10.5))));
+	v1363 = ((v1362*0.999)+(b/((v1356+11.5))));
+	v1364 = ((v1363*0.999)+(b/((v1357+12.5))));
+	v1365 = ((v1364*0.999)+(b/((v1358+0.5))));
+	v1366 = ((v1365*0.999)+(b/((v1359+1.5))));
+	v1367 = ((v1366*0.999)+(b/((v1360+2.5))));
+	v1368 = ((v1367*0.999)+(b/((v1361+3.5))));
+	v1369 = ((v1368*0.999)+(b/((v1362+4.5))));
+	v1370 = ((v1369*0.999)+(b/((v1363+5.5))));
+	v1371 = ((v1370*0.999)+(b/((v1364+6.5))));
+	v1372 = ((v1371*0.999)+(b/((v1365+7.5))));
+	v1373 = ((v1372*0.999)+(b/((v1366+8.5))));
+	v1374 = ((v1373*0.999)+(b/((v1367+9.5))));
+	v1375 = ((v1374*0.999)+(b/((v1368+10.5))));
+	v1376 = ((v1375*0.999)+(b/((v1369+11.5))));
+	v1377 = ((v1376*0.999)+(b/((v1370+12.5))));
+	v1378 = ((v1377*0.999)+(b/((v1371+0.5))));
+	v1379 = ((v1378*0.999)+(b/((v1372+1.5))));
+	v1380 = ((v1379*0.999)+(b/((v1373+2.5))));
+	v1381 = ((v1380*0.999)+(b/((v1374+3.5))));
+	v1382 = ((v1381*0.999)+(b/((v1375+4.5))));
+	v1383 = ((v1382*0.999)+(b/((v1376+5.5))));
+	v1384 = ((v1383*0.999)+(b/((v1377+6.5))));
+	v1385 = ((v1384*0.999)+(b/((v1378+7.5))));
+	v1386 = ((v1385*0.999)+(b/((v1379+8.5))));
+	v1387 = ((v1386*0.999)+(b/((v1380+9.5))));
+	v1388 = ((v1387*0.999)+(b/((v1381+10.5))));
+	v1389 = ((v1388*0.999)+(b/((v1382+11.5))));
+	v1390 = ((v1389*0.999)+(b/((v1383+12.5))));
+	v1391 = ((v1390*0.999)+(b/((v1384+0.5))));
+	v1392 = ((v1391*0.999)+(b/((v1385+1.5))));
+	v1393 = ((v1392*0.999)+(b/((v1386+2.5))));
+	v1394 = ((v1393*0.999)+(b/((v1387+3.5))));
+	v1395 = ((v1394*0.999)+(b/((v1388+4.5))));
+	v1396 = ((v1395*0.999)+(b/((v1389+5.5))));
+	v1397 = ((v1396*0.999)+(b/((v1390+6.5))));
+	v1398 = ((v1397*0.999)+(b/((v1391+7.5))));
+	v1399 = ((v1398*0.999)+(b/((v1392+8.5))));
+	v1400 = ((v1399*0.999)+(b/((v1393+9.5))));
+	v1401 = ((v1400*0.999)+(b/((v1394+10.5))));
+	v1402 = ((v1401*0.999)+(b/((v1395+11.5))));
+	v1403 = ((v1402*0.999)+(b/((v1396+12.5))));
+	v1404 = ((v1403*0.999)+(b/((v1397+0.5))));
+	v1405 = ((v1404*0.999)+(b/((v1398+1.5))));
+	v1406 = ((v1405*0.999)+(b/((v1399+2.5))));
+	v1407 = ((v1406*0.999)+(b/((v1400+3.5))));
+	v1408 = ((v1407*0.999)+(b/((v1401+4.5))));
+	v1409 = ((v1408*0.999)+(b/((v1402+5.5))));
+	v1410 = ((v1409*0.999)+(b/((v1403+6.5))));
+	v1411 = ((v1410*0.999)+(b/((v1404+7.5))));
+	v1412 = ((v1411*0.999)+(b/((v1405+8.5))));
+	v1413 = ((v1412*0.999)+(b/((v1406+9.5))));
+	v1414 = ((v1413*0.999)+(b/((v1407+10.5))));
+	v1415 = ((v1414*0.999)+(b/((v1408+11.5))));
+	v1416 = ((v1415*0.999)+(b/((v1409+12.5))));
+	v1417 = ((v1416*0.999)+(b/((v1410+0.5))));
+	v1418 = ((v1417*0.999)+(b/((v1411+1.5))));
+	v1419 = ((v1418*0.999)+(b/((v1412+2.5))));
+	v1420 = ((v1419*0.999)+(b/((v1413+3.5))));
+	v1421 = ((v1420*0.999)+(b/((v1414+4.5))));
+	v1422 = ((v1421*0.999)+(b/((v1415+5.5))));
+	v1423 = ((v1422*0.999)+(b/((v1416+6.5))));
+	v1424 = ((v1423*0.999)+(b/((v1417+7.5))));
+	v1425 = ((v1424*0.999)+(b/((v1418+8.5))));
+	v1426 = ((v1425*0.999)+(b/((v1419+9.5))));
+	v1427 = ((v1426*0.999)+(b/((v1420+10.5))));
+	v1428 = ((v1427*0.999)+(b/((v1421+11.5))));
+	v1429 = ((v1428*0.999)+(b/((v1422+12.5))));
+	v1430 = ((v1429*0.999)+(b/((v1423+0.5))));
+	v1431 = ((v1430*0.999)+(b/((v1424+1.5))));
+	v1432 = ((v1431*0.999)+(b/((v1425+2.5))));
+	v1433 = ((v1432*0.999)+(b/((v1426+3.5))));
+	v1434 = ((v1433*0.999)+(b/((v1427+4.5))));
+	v1435 = ((v1434*0.999)+(b/((v1428+5.5))));
+	v1436 = ((v1435*0.999)+(b/((v1429+6.5))));
+	v1437 = ((v1436*0.999)+(b/((v1430+7.5))));
+	v1438 = ((v1437*0.999)+(b/((v1431+8.5))));
+	v1439 = ((v1438*0.999)+(b/((v1432+9.5))));
+	v1440 = ((v1439*0.999)+(b/((v1433+10.5))));
+	v1441 = ((v1440*0.999)+(b/((v1434+11.5))));
+	v1442 = ((v1441*0.999)+(b/((v1435+12.5))));
+	v1443 = ((v1442*0.999)+(b/((v1436+0.5))));
+	v1444 = ((v1443*0.999)+(b/((v1437+1.5))));
+	v1445 = ((v1444*0.999)+(b/((v1438+2.5))));
+	v1446 = ((v1445*0.999)+(b/((v1439+3.5))));
+	v1447 = ((v1446*0.999)+(b/((v1440+4.5))));
+	v1448 = ((v1447*0.999)+(b/((v1441+5.5))));
+	v1449 = ((v1448*0.999)+(b/((v1442+6.5))));
+	v1450 = ((v1449*0.999)+(b/((v1443+7.5))));
+	v1451 = ((v1450*0.999)+(b/((v1444+8.5))));
+	v1452 = ((v1451*0.999)+(b/((v1445+9.5))));
+	v1453 = ((v1452*0.999)+(b/((v1446+10.5))));
+	v1454 = ((v1453*0.999)+(b/((v1447+11.5))));
+	v1455 = ((v1454*0.999)+(b/((v1448+12.5))));
+	v1456 = ((v1455*0.999)+(b/((v1449+0.5))));
+	v1457 = ((v1456*0.999)+(b/((v1450+1.5))));
+	v1458 = ((v1457*0.999)+(b/((v1451+2.5))));
+	v1459 = ((v1458*0.999)+(b/((v1452+3.5))));
+	v1460 = ((v1459*0.999)+(b/((v1453+4.5))));
+	v1461 = ((v1460*0.999)+(b/((v1454+5.5))));
+	v1462 = ((v1461*0.999)+(b/((v1455+6.5))));
+	v1463 = ((v1462*0.999)+(b/((v1456+7.5))));
+	v1464 = ((v1463*0.999)+(b/((v1457+8.5))));
+	v1465 = ((v1464*0.999)+(b/((v1458+9.5))));
+	v1466 = ((v1465*0.999)+(b/((v1459+10.5))));
+	v1467 = ((v1466*0.999)+(b/((v1460+11.5))));
+	v1468 = ((v1467*0.999)+(b/((v1461+12.5))));
+	v1469 = ((v1468*0.999)+(b/((v1462+0.5))));
+	v1470 = ((v1469*0.999)+(b/((v1463+1.5))));
+	v1471 = ((v1470*0.999)+(b/((v1464+2.5))));
+	v1472 = ((v1471*0.999)+(b/((v1465+3.5))));
+	v1473 = ((v1472*0.999)+(b/((v1466+4.5))));
+	v1474 = ((v1473*0.999)+(b/((v1467+5.5))));
+	v1475 = ((v1474*0.999)+(b/((v1468+6.5))));
+	v1476 = ((v1475*0.999)+(b/((v1469+7.5))));
+	v1477 = ((v1476*0.999)+(b/((v1470+8.5))));
+	v1478 = ((v1477*0.999)+(b/((v1471+9.5))));
+	v1479 = ((v1478*0.999)+(b/((v1472+10.5))));
+	v1480 = ((v1479*0.999)+(b/((v1473+11.5))));
+	v1481 = ((v1480*0.999)+(b/((v1474+12.5))));
+	v1482 = ((v1481*0.999)+(b/((v1475+0.5))));
+	v1483 = ((v1482*0.999)+(b/((v1476+1.5))));
+	v1484 = ((v1483*0.999)+(b/((v1477+2.5))));
+	v1485 = ((v1484*0.999)+(b/((v1478+3.5))));
+	v1486 = ((v1485*0.999)+(b/((v1479+4.5))));
+	v1487 = ((v1486*0.999)+(b/((v1480+5.5))));
+	v1488 = ((v1487*0.999)+(b/((v1481+6.5))));
+	v1489 = ((v1488*0.999)+(b/((v1482+7.5))));
+	v1490 = ((v1489*0.999)+(b/((v1483+8.5))));
+	v1491 = ((v1490*0.999)+(b/((v1484+9.5))));
+	v1492 = ((v1491*0.999)+(b/((v1485+10.5))));
+	v1493 = ((v1492*0.999)+(b/((v1486+11.5))));
+	v1494 = ((v1493*0.999)+(b/((v1487+12.5))));
+	v1495 = ((v1494*0.999)+(b/((v1488+0.5))));
+	v1496 = ((v1495*0.999)+(b/((v1489+1.5))));
+	v1497 = ((v1496*0.999)+(b/((v1490+2.5))));
+	v1498 = ((v1497*0.999)+(b/((v1491+3.5))));
+	v1499 = ((v1498*0.999)+(b/((v1492+4.5))));
+	v1500 = ((v1499*0.999)+(b/((v1493+5.5))));
+	v1501 = ((v1500*0.999)+(b/((v1494+6.5))));
+	v1502 = ((v1501*0.999)+(b/((v1495+7.5))));
+	v1503 = ((v1502*0.999)+(b/((v1496+8.5))));
+	v1504 = ((v1503*0.999)+(b/((v1497+9.5))));
+	v1505 = ((v1504*0.999)+(b/((v1498+10.5))));
+	v1506 = ((v1505*0.999)+(b/((v1499+11.5))));
+	v1507 = ((v1506*0.999)+(b/((v1500+12.5))));
+	v1508 = ((v1507*0.999)+(b/((v1501+0.5))));
+	v1509 = ((v1508*0.999)+(b/((v1502+1.5))));
+	v1510 = ((v1509*0.999)+(b/((v1503+2.5))));
+	v1511 = ((v1510*0.999)+(b/((v1504+3.5))));
+	v1512 = ((v1511*0.999)+(b/((v1505+4.5))));
+	v1513 = ((v1512*0.999)+(b/((v1506+5.5))));
+	v1514 = ((v1513*0.999)+(b/((v1507+6.5))));
+	v1515 = ((v1514*0.999)+(b/((v1508+7.5))));
+	v1516 = ((v1515*0.999)+(b/((v1509+8.5))));
+	v1517 = ((v1516*0.999)+(b/((v1510+9.5))));
+	v1518 = ((v1517*0.999)+(b/((v1511+10.5))));
+	v1519 = ((v1518*0.999)+(b/((v1512+11.5))));
+	v1520 = ((v1519*0.999)+(b/((v1513+12.5))));
+	v1521 = ((v1520*0.999)+(b/((v1514+0.5))));
+	v1522 = ((v1521*0.999)+(b/((v1515+1.5))));
+	v1523 = ((v1522*0.999)+(b/((v1516+2.5))));
+	v1524 = ((v1523*0.999)+(b/((v1517+3.5))));
+	v1525 = ((v1524*0.999)+(b/((v1518+4.5))));
+	v1526 = ((v1525*0.999)+(b/((v1519+5.5))));
+	v1527 = ((v1526*0.999)+(b/((v1520+6.5))));
+	v1528 = ((v1527*0.999)+(b/((v1521+7.5))));
+	v1529 = ((v1528*0.999)+(b/((v1522+8.5))));
+	v1530 = ((v1529*0.999)+(b/((v1523+9.5))));
+	v1531 = ((v1530*0.999)+(b/((v1524+10.5))));
+	v1532 = ((v1531*0.999)+(b/((v1525+11.5))));
+	v1533 = ((v1532*0.999)+(b/((v1526+12.5))));
+	v1534 = ((v1533*0.999)+(b/((v1527+0.5))));
+	v1535 = ((v1534*0.999)+(b/((v1528+1.5))));
+	v1536 = ((v1535*0.999)+(b/((v1529+2.5))));
+	v1537 = ((v1536*0.999)+(b/((v1530+3.5))));
+	v1538 = ((v1537*0.999)+(b/((v1531+4.5))));
+	v1539 = ((v1538*0.999)+(b/((v1532+5.5))));
+	v1540 = ((v1539*0.999)+(b/((v1533+6.5))));
+	v1541 = ((v1540*0.999)+(b/((v1534+7.5))));
+	v1542 = ((v1541*0.999)+(b/((v1535+8.5))));
+	v1543 = ((v1542*0.999)+(b/((v1536+9.5))));
+	v1544 = ((v1543*0.999)+(b/((v1537+10.5))));
+	v1545 = ((v1544*0.999)+(b/((v1538+11.5))));
+	v1546 = ((v1545*0.999)+(b/((v1539+12.5))));
+	v1547 = ((v1546*0.999)+(b/((v1540+0.5))));
+	v1548 = ((v1547*0.999)+(b/((v1541+1.5))));
+	v1549 = ((v1548*0.999)+(b/((v1542+2.5))));
+	v1550 = ((v1549*0.999)+(b/((v1543+3.5))));
+	v1551 = ((v1550*0.999)+(b/((v1544+4.5))));
+	v1552 = ((v1551*0.999)+(b/((v1545+5.5))));
+	v1553 = ((v1552*0.999)+(b/((v1546+6.5))));
+	v1554 = ((v1553*0.999)+(b/((v1547+7.5))));
+	v1555 = ((v1554*0.999)+(b/((v1548+8.5))));
+	v1556 = ((v1555*0.999)+(b/((v1549+9.5))));
+	v1557 = ((v1556*0.999)+(b/((v1550+10.5))));
+	v1558 = ((v1557*0.999)+(b/((v1551+11.5))));
+	v1559 = ((v1558*0.999)+(b/((v1552+12.5))));
+	v1560 = ((v1559*0.999)+(b/((v1553+0.5))));
+	v1561 = ((v1560*0.999)+(b/((v1554+1.5))));
+	v1562 = ((v1561*0.999)+(b/((v1555+2.5))));
+	v1563 = ((v1562*0.999)+(b/((v1556+3.5))));
+	v1564 = ((v1563*0.999)+(b/((v1557+4.5))));
+	v1565 = ((v1564*0.999)+(b/((v1558+5.5))));
+	v1566 = ((v1565*0.999)+(b/((v1559+6.5))));
+	v1567 = ((v1566*0.999)+(b/((v1560+7.5))));
+	v1568 = ((v1567*0.999)+(b/((v1561+8.5))));
+	v1569 = ((v1568*0.999)+(b/((v1562+9.5))));
+	v1570 = ((v1569*0.999)+(b/((v1563+10.5))));
+	v1571 = ((v1570*0.999)+(b/((v1564+11.5))));
+	v1572 = ((v1571*0.999)+(b/((v1565+12.5))));
+	v1573 = ((v1572*0.999)+(b/((v1566+0.5))));
+	v1574 = ((v1573*0.999)+(b/((v1567+1.5))));
+	v1575 = ((v1574*0.999)+(b/((v1568+2.5))));
+	v1576 = ((v1575*0.999)+(b/((v1569+3.5))));
+	v1577 = ((v1576*0.999)+(b/((v1570+4.5))));
+	v1578 = ((v1577*0.999)+(b/((v1571+5.5))));
+	v1579 = ((v1578*0.999)+(b/((v1572+6.5))));
+	v1580 = ((v1579*0.999)+(b/((v1573+7.5))));
+	v1581 = ((v1580*0.999)+(b/((v1574+8.5))));
+	v1582 = ((v1581*0.999)+(b/((v1575+9.5))));
+	v1583 = ((v1582*0.999)+(b/((v1576+10.5))));
+	v1584 = ((v1583*0.999)+(b/((v1577+11.5))));
+	v1585 = ((v1584*0.999)+(b/((v1578+12.5))));
+	v1586 = ((v1585*0.999)+(b/((v1579+0.5))));
+	v1587 = ((v1586*0.999)+(b/((v1580+1.5))));
+	v1588 = ((v1587*0.999)+(b/((v1581+2.5))));
+	v1589 = ((v1588*0.999)+(b/((v1582+3.5))));
+	v1590 = ((v1589*0.999)+(b/((v1583+4.5))));
+	v1591 = ((v1590*0.999)+(b/((v1584+5.5))));
+	v1592 = ((v1591*0.999)+(b/((v1585+6.5))));
+	v1593 = ((v1592*0.999)+(b/((v1586+7.5))));
+	v1594 = ((v1593*0.999)+(b/((v1587+8.5))));
+	v1595 = ((v1594*0.999)+(b/((v1588+9.5))));
+	v1596 = ((v1595*0.999)+(b/((v1589+10.5))));
+	v1597 = ((v1596*0.999)+(b/((v1590+11.5))));
+	v1598 = ((v1597*0.999)+(b/((v1591+12.5))));
+	v1599 = ((v1598*0.999)+(b/((v1592+0.5))));
+	v1600 = ((v1599*0.999)+(b/((v1593+1.5))));
+	v1601 = ((v1600*0.999)+(b/((v1594+2.5))));
+	v1602 = ((v1601*0.999)+(b/((v1595+3.5))));
+	v1603 = ((v1602*0.999)+(b/((v1596+4.5))));
+	v1604 = ((v1603*0.999)+(b/((v1597+5.5))));
+	v1605 = ((v1604*0.999)+(b/((v1598+6.5))));
+	v1606 = ((v1605*0.999)+(b/((v1599+7.5))));
+	v1607 = ((v1606*0.999)+(b/((v1600+8.5))));
+	v1608 = ((v1607*0.999)+(b/((v1601+9.5))));
+	v1609 = ((v1608*0.999)+(b/((v1602+10.5))));
+	v1610 = ((v1609*0.999)+(b/((v1603+11.5))));
+	v1611 = ((v1610*0.999)+(b/((v1604+12.5))));
+	v1612 = ((v1611*0.999)+(b/((v1605+0.5))));
+	v1613 = ((v1612*0.999)+(b/((v1606+1.5))));
+	v1614 = ((v1613*0.999)+(b/((v1607+2.5))));
+	v1615 = ((v1614*0.999)+(b/((v1608+3.5))));
+	v1616 = ((v1615*0.999)+(b/((v1609+4.5))));
+	v1617 = ((v1616*0.999)+(b/((v1610+5.5))));
+	v1618 = ((v1617*0.999)+(b/((v1611+6.5))));
+	v1619 = ((v1618*0.999)+(b/((v1612+7.5))));
+	v1620 = ((v1619*0.999)+(b/((v1613+8.5))));
+	v1621 = ((v1620*0.999)+(b/((v1614+9.5))));
+	v1622 = ((v1621*0.999)+(b/((v1615+10.5))));
+	v1623 = ((v1622*0.999)+(b/((v1616+11.5))));
+	v1624 = ((v1623*0.999)+(b/((v1617+12.5))));
+	v1625 = ((v1624*0.999)+(b/((v1618+0.5))));
+	v1626 = ((v1625*0.999)+(b/((v1619+1.5))));
+	v1627 = ((v1626*0.999)+(b/((v1620+2.5))));
+	v1628 = ((v1627*0.999)+(b/((v1621+3.5))));
+	v1629 = ((v1628*0.999)+(b/((v1622+4.5))));
+	v1630 = ((v1629*0.999)+(b/((v1623+5.5))));
+	v1631 = ((v1630*0.999)+(b/((v1624+6.5))));
+	v1632 = ((v1631*0.999)+(b/((v1625+7.5))));
+	v1633 = ((v1632*0.999)+(b/((v1626+8.5))));
+	v1634 = ((v1633*0.999)+(b/((v1627+9.5))));
+	v1635 = ((v1634*0.999)+(b/((v1628+10.5))));
+	v1636 = ((v1635*0.999)+(b/((v1629+11.5))));
+	v1637 = ((v1636*0.999)+(b/((v1630+12.5))));
+	v1638 = ((v1637*0.999)+(b/((v1631+0.5))));
+	v1639 = ((v1638*0.999)+(b/((v1632+1.5))));
+	v1640 = ((v1639*0.999)+(b/((v1633+2.5))));
+	v1641 = ((v1640*0.999)+(b/((v1634+3.5))));
+	v1642 = ((v1641*0.999)+(b/((v1635+4.5))));
+	v1643 = ((v1642*0.999)+(b/((v1636+5.5))));
+	v1644 = ((v1643*0.999)+(b/((v1637+6.5))));
+	v1645 = ((v1644*0.999)+(b/((v1638+7.5))));
+	v1646 = ((v1645*0.999)+(b/((v1639+8.5))));
+	v1647 = ((v1646*0.999)+(b/((v1640+9.5))));
+	v1648 = ((v1647*0.999)+(b/((v1641+10.5))));
+	v1649 = ((v1648*0.999)+(b/((v1642+11.5))));
+	v1650 = ((v1649*0.999)+(b/((v1643+12.5))));
+	v1651 = ((v1650*0.999)+(b/((v1644+0.5))));
+	v1652 = ((v1651*0.999)+(b/((v1645+1.5))));
+	v1653 = ((v1652*0.999)+(b/((v1646+2.5))));
+	v1654 = ((v1653*0.999)+(b/((v1647+3.5))));
+	v1655 = ((v1654*0.999)+(b/((v1648+4.5))));
+	v1656 = ((v1655*0.999)+(b/((v1649+5.5))));
+	v1657 = ((v1656*0.999)+(b/((v1650+6.5))));
+	v1658 = ((v1657*0.999)+(b/((v1651+7.5))));
+	v1659 = ((v1658*0.999)+(b/((v1652+8.5))));
+	v1660 = ((v1659*0.999)+(b/((v1653+9.5))));
+	v1661 = ((v1660*0.999)+(b/((v1654+10.5))));
+	v1662 = ((v1661*0.999)+(b/((v1655+11.5))));
+	v1663 = ((v1662*0.999)+(b/((v1656+12.5))));
+	v1664 = ((v1663*0.999)+(b/((v1657+0.5))));
+	v1665 = ((v1664*0.999)+(b/((v1658+1.5))));
+	v1666 = ((v1665*0.999)+(b/((v1659+2.5))));
+	v1667 = ((v1666*0.999)+(b/((v1660+3.5))));
+	v1668 = ((v1667*0.999)+(b/((v1661+4.5))));
+	v1669 = ((v1668*0.999)+(b/((v1662+5.5))));
+	v1670 = ((v1669*0.999)+(b/((v1663+6.5))));
+	v1671 = ((v1670*0.999)+(b/((v1664+7.5))));
+	v1672 = ((v1671*0.999)+(b/((v1665+8.5))));
+	v1673 = ((v1672*0.999)+(b/((v1666+9.5))));
+	v1674 = ((v1673*0.999)+(b/((v1667+10.5))));
+	v1675 = ((v1674*0.999)+(b/((v1668+11.5))));
+	v1676 = ((v1675*0.999)+(b/((v1669+12.5))));
+	v1677 = ((v1676*0.999)+(b/((v1670+0.5))));
+	v1678 = ((v1677*0.999)+(b/((v1671+1.5))));
+	v1679 = ((v1678*0.999)+(b/((v1672+2.5))));
+	v1680 = ((v1679*0.999)+(b/((v1673+3.5))));
+	v1681 = ((v1680*0.999)+(b/((v1674+4.5))));
+	v1682 = ((v1681*0.999)+(b/((v1675+5.5))));
+	v1683 = ((v1682*0.999)+(b/((v1676+6.5))));
+	v1684 = ((v1683*0.999)+(b/((v1677+7.5))));
+	v1685 = ((v1684*0.999)+(b/((v1678+8.5))));
+	v1686 = ((v1685*0.999)+(b/((v1679+9.5))));
+	v1687 = ((v1686*0.999)+(b/((v1680+10.5))));
+	v1688 = ((v1687*0.999)+(b/((v1681+11.5))));
+	v1689 = ((v1688*0.999)+(b/((v1682+12.5))));
+	v1690 = ((v1689*0.999)+(b/((v1683+0.5))));
+	v1691 = ((v1690*0.999)+(b/((v1684+1.5))));
+	v1692 = ((v1691*0.999)+(b/((v1685+2.5))));
+	v1693 = ((v1692*0.999)+(b/((v1686+3.5))));
+	v1694 = ((v1693*0.999)+(b/((v1687+4.5))));
+	v1695 = ((v1694*0.999)+(b/((v1688+5.5))));
+	v1696 = ((v1695*0.999)+(b/((v1689+6.5))));
+	v1697 = ((v1696*0.999)+(b/((v1690+7.5))));
+	v1698 = ((v1697*0.999)+(b/((v1691+8.5))));
+	v1699 = ((v1698*0.999)+(b/((v1692+9.5))));
+	v1700 = ((v1699*0.999)+(b/((v1693+10.5))));
+	v1701 = ((v1700*0.999)+(b/((v1694+11.5))));
+	v1702 = ((v1701*0.999)+(b/((v1695+12.5))));
+	v1703 = ((v1702*0.999)+(b/((v1696+0.5))));
+	v1704 = ((v1703*0.999)+(b/((v1697+1.5))));
+	v1705 = ((v1704*0.999)+(b/((v1698+2.5))));
+	v1706 = ((v1705*0.999)+(b/((v1699+3.5))));
+	v1707 = ((v1706*0.999)+(b/((v1700+4.5))));
+	v1708 = ((v1707*0.999)+(b/((v1701+5.5))));
+	v1709 = ((v1708*0.999)+(b/((v1702+6.5))));
+	v1710 = ((v1709*0.999)+(b/((v1703+7.5))));
+	v1711 = ((v1710*0.999)+(b/((v1704+8.5))));
+	v1712 = ((v1711*0.999)+(b/((v1705+9.5))));
+	v1713 = ((v1712*0.999)+(b/((v1706+10.5))));
+	v1714 = ((v1713*0.999)+(b/((v1707+11.5))));
+	v1715 = ((v1714*0.999)+(b/((v1708+12.5))));
+	v1716 = ((v1715*0.999)+(b/((v1709+0.5))));
+	v1717 = ((v1716*0.999)+(b/((v1710+1.5))));
+	v1718 = ((v1717*0.999)+(b/((v1711+2.5))));
+	v1719 = ((v1718*0.999)+(b/((v1712+3.5))));
+	v1720 = ((v1719*0.999)+(b/((v1713+4.5))));
+	v1721 = ((v1720*0.999)+(b/((v1714+5.5))));
+	v1722 = ((v1721*0.999)+(b/((v1715+6.5))));
+	v1723 = ((v1722*0.999)+(b/((v1716+7.5))));
+	v1724 = ((v1723*0.999)+(b/((v1717+8.5))));
+	v1725 = ((v1724*0.999)+(b/((v1718+9.5))));
+	v1726 = ((v1725*0.999)+(b/((v1719+10.5))));
+	v1727 = ((v1726*0.999)+(b/((v1720+11.5))));
+	v1728 = ((v1727*0.999)+(b/((v1721+12.5))));
+	v1729 = ((v1728*0.999)+(b/((v1722+0.5))));
+	v1730 = ((v1729*0.999)+(b/((v1723+1.5))));
+	v1731 = ((v1730*0.999)+(b/((v1724+2.5))));
+	v1732 = ((v1731*0.999)+(b/((v1725+3.5))));
+	v1733 = ((v1732*0.999)+(b/((v1726+4.5))));
+	v1734 = ((v1733*0.999)+(b/((v1727+5.5))));
+	v1735 = ((v1734*0.999)+(b/((v1728+6.5))));
+	v1736 = ((v1735*0.999)+(b/((v1729+7.5))));
+	v1737 = ((v1736*0.999)+(b/((v1730+8.5))));
+	v1738 = ((v1737*0.999)+(b/((v1731+9.5))));
+	v1739 = ((v1738*0.999)+(b/((v1732+10.5))));
+	v1740 = ((v1739*0.999)+(b/((v1733+11.5))));
+	v1741 = ((v1740*0.999)+(b/((v1734+12.5))));
+	v1742 = ((v1741*0.999)+(b/((v1735+0.5))));
+	v1743 = ((v1742*0.999)+(b/((v1736+1.5))));
+	v1744 = ((v1743*0.999)+(b/((v1737+2.5))));
+	v1745 = ((v1744*0.999)+(b/((v1738+3.5))));
+	v1746 = ((v1745*0.999)+(b/((v1739+4.5))));
+	v1747 = ((v1746*0.999)+(b/((v1740+5.5))));
+	v1748 = ((v1747*0.999)+(b/((v1741+6.5))));
+	v1749 = ((v1748*0.999)+(b/((v1742+7.5))));
+	v1750 = ((v1749*0.999)+(b/((v1743+8.5))));
+	v1751 = ((v1750*0.999)+(b/((v1744+9.5))));
+	v1752 = ((v1751*0.999)+(b/((v1745+10.5))));
+	v1753 = ((v1752*0.999)+(b/((v1746+11.5))));
+	v1754 = ((v1753*0.999)+(b/((v1747+12.5))));
+	v1755 = ((v1754*0.999)+(b/((v1748+0.5))));
+	v1756 = ((v1755*0.999)+(b/((v1749+1.5))));
+	v1757 = ((v1756*0.999)+(b/((v1750+2.5))));
+	v1758 = ((v1757*0.999)+(b/((v1751+3.5))));
+	v1759 = ((v1758*0.999)+(b/((v1752+4.5))));
+	v1760 = ((v1759*0.999)+(b/((v1753+5.5))));
+	v1761 = ((v1760*0.999)+(b/((v1754+6.5))));
+	v1762 = ((v1761*0.999)+(b/((v1755+7.5))));
+	v1763 = ((v1762*0.999)+(b/((v1756+8.5))));
+	v1764 = ((v1763*0.999)+(b/((v1757+9.5))));
+	v1765 = ((v1764*0.999)+(b/((v1758+10.5))));
+	v1766 = ((v1765*0.999)+(b/((v1759+11.5))));
+	v1767 = ((v1766*0.999)+(b/((v1760+12.5))));
+	v1768 = ((v1767*0.999)+(b/((v1761+0.5))));
+	v1769 = ((v1768*0.999)+(b/((v1762+1.5))));
+	v1770 = ((v1769*0.999)+(b/((v1763+2.5))));
+	v1771 = ((v1770*0.999)+(b/((v1764+3.5))));
+	v1772 = ((v1771*0.999)+(b/((v1765+4.5))));
+	v1773 = ((v1772*0.999)+(b/((v1766+5.5))));
+	v1774 = ((v1773*0.999)+(b/((v1767+6.5))));
+	v1775 = ((v1774*0.999)+(b/((v1768+7.5))));
+	v1776 = ((v1775*0.999)+(b/((v1769+8.5))));
+	v1777 = ((v1776*0.999)+(b/((v1770+9.5))));
+	v1778 = ((v1777*0.999)+(b/((v1771+10.5))));
+	v1779 = ((v1778*0.999)+(b/((v1772+11.5))));
+	v1780 = ((v1779*0.999)+(b/((v1773+12.5))));
+	v1781 = ((v1780*0.999)+(b/((v1774+0.5))));
+	v1782 = ((v1781*0.999)+(b/((v1775+1.5))));
+	v1783 = ((v1782*0.999)+(b/((v1776+2.5))));
+	v1784 = ((v1783*0.999)+(b/((v1777+3.5))));
+	v1785 = ((v1784*0.999)+(b/((v1778+4.5))));
+	v1786 = ((v1785*0.999)+(b/((v1779+5.5))));
+	v1787 = ((v1786*0.999)+(b/((v1780+6.5))));
+	v1788 = ((v1787*0.999)+(b/((v1781+7.5))));
+	v1789 = ((v1788*0.999)+(b/((v1782+8.5))));
+	v1790 = ((v1789*0.999)+(b/((v1783+9.5))));
+	v1791 = ((v1790*0.999)+(b/((v1784+10.5))));
+	v1792 = ((v1791*0.999)+(b/((v1785+11.5))));
+	v1793 = ((v1792*0.999)+(b/((v1786+12.5))));
+	v1794 = ((v1793*0.999)+(b/((v1787+0.5))));
+	v1795 = ((v1794*0.999)+(b/((v1788+1.5))));
+	v1796 = ((v1795*0.999)+(b/((v1789+2.5))));
+	v1797 = ((v1796*0.999)+(b/((v1790+3.5))));
+	v1798 = ((v1797*0.999)+(b/((v1791+4.5))));
+	v1799 = ((v1798*0.999)+(b/((v1792+5.5))));
+	v1800 = ((v1799*0.999)+(b/((v1793+6.5))));
+	v1801 = ((v1800*0.999)+(b/((v1794+7.5))));
+	v1802 = ((v1801*0.999)+(b/((v1795+8.5))));
+	v1803 = ((v1802*0.999)+(b/((v1796+9.5))));
+	v1804 = ((v1803*0.999)+(b/((v1797+10.5))));
+	v1805 = ((v1804*0.999)+(b/((v1798+11.5))));
+	v1806 = ((v1805*0.999)+(b/((v1799+12.5))));
+	v1807 = ((v1806*0.999)+(b/((v1800+0.5))));
+	v1808 = ((v1807*0.999)+(b/((v1801+1.5))));
+	v1809 = ((v1808*0.999)+(b/((v1802+2.5))));
+	v1810 = ((v1809*0.999)+(b/((v1803+3.5))));
+	v1811 = ((v1810*0.999)+(b/((v1804+4.5))));
+	v1812 = ((v1811*0.999)+(b/((v1805+5.5))));
+	v1813 = ((v1812*0.999)+(b/((v1806+6.5))));
+	v1814 = ((v1813*0.999)+(b/((v1807+7.5))));
+	v1815 = ((v1814*0.999)+(b/((v1808+8.5))));
+	v1816 = ((v1815*0.999)+(b/((v1809+9.5))));
+	v1817 = ((v1816*0.999)+(b/((v1810+10.5))));
+	v1818 = ((v1817*0.999)+(b/((v1811+11.5))));
+	v1819 = ((v1818*0.999)+(b/((v1812+12.5))));
+	v1820 = ((v1819*0.999)+(b/((v1813+0.5))));
+	v1821 = ((v1820*0.999)+(b/((v1814+1.5))));
+	v1822 = ((v1821*0.999)+(b/((v1815+2.5))));
+	v1823 = ((v1822*0.999)+(b/((v1816+3.5))));
+	v1824 = ((v1823*0.999)+(b/((v1817+4.5))));
+	v1825 = ((v1824*0.999)+(b/((v1818+5.5))));
+	v1826 = ((v1825*0.999)+(b/((v1819+6.5))));
+	v1827 = ((v1826*0.999)+(b/((v1820+7.5))));
+	v1828 = ((v1827*0.999)+(b/((v1821+8.5))));
+	v1829 = ((v1828*0.999)+(b/((v1822+9.5))));
+	v1830 = ((v1829*0.999)+(b/((v1823+10.5))));
+	v1831 = ((v1830*0.999)+(b/((v1824+11.5))));
+	v1832 = ((v1831*0.999)+(b/((v1825+12.5))));
+	v1833 = ((v1832*0.999)+(b/((v1826+0.5))));
+	v1834 = ((v1833*0.999)+(b/((v1827+1.5))));
+	v1835 = ((v1834*0.999)+(b/((v1828+2.5))));
+	v1836 = ((v1835*0.999)+(b/((v1829+3.5))));
+	v1837 = ((v1836*0.999)+(b/((v1830+4.5))));
+	v1838 = ((v1837*0.999)+(b/((v1831+5.5))));
+	v1839 = ((v1838*0.999)+(b/((v1832+6.5))));
+	v1840 = ((v1839*0.999)+(b/((v1833+7.5))));
+	v1841 = ((v1840*0.999)+(b/((v1834+8.5))));
+	v1842 = ((v1841*0.999)+(b/((v1835+9.5))));
+	v1843 = ((v1842*0.999)+(b/((v1836+10.5))));
+	v1844 = ((v1843*0.999)+(b/((v1837+11.5))));
+	v1845 = ((v1844*0.999)+(b/((v1838+12.5))));
+	v1846 = ((v1845*0.999)+(b/((v1839+0.5))));
+	v1847 = ((v1846*0.999)+(b/((v1840+1.5))));
+	v1848 = ((v1847*0.999)+(b/((v1841+2.5))));
+	v1849 = ((v1848*0.999)+(b/((v1842+3.5))));
+	v1850 = ((v1849*0.999)+(b/((v1843+4.5))));
+	v1851 = ((v1850*0.999)+(b/((v1844+5.5))));
+	v1852 = ((v1851*0.999)+(b/((v1845+6.5))));
+	v1853 = ((v1852*0.999)+(b/((v1846+7.5))));
+	v1854 = ((v1853*0.999)+(b/((v1847+8.5))));
+	v1855 = ((v1854*0.999)+(b/((v1848+9.5))));
+	v1856 = ((v1855*0.999)+(b/((v1849+10.5))));
+	v1857 = ((v1856*0.999)+(b/((v1850+11.5))));
+	v1858 = ((v1857*0.999)+(b/((v1851+12.5))));
+	v1859 = ((v1858*0.999)+(b/((v1852+0.5))));
+	v1860 = ((v1859*0.999)+(b/((v1853+1.5))));
+	v1861 = ((v1860*0.999)+(b/((v1854+2.5))));
+	v1862 = ((v1861*0.999)+(b/((v1855+3.5))));
+	v1863 = ((v1862*0.999)+(b/((v1856+4.5))));
+	v1864 = ((v1863*0.999)+(b/((v1857+5.5))));
+	v1865 = ((v1864*0.999)+(b/((v1858+6.5))));
+	v1866 = ((v1865*0.999)+(b/((v1859+7.5))));
+	v1867 = ((v1866*0.999)+(b/((v1860+8.5))));
+	v1868 = ((v1867*0.999)+(b/((v1861+9.5))));
+	v1869 = ((v1868*0.999)+(b/((v1862+10.5))));
+	v1870 = ((v1869*0.999)+(b/((v1863+11.5))));
+	v1871 = ((v1870*0.999)+(b/((v1864+12.5))));
+	v1872 = ((v1871*0.999)+(b/((v1865+0.5))));
+	v1873 = ((v1872*0.999)+(b/((v1866+1.5))));
+	v1874 = ((v1873*0.999)+(b/((v1867+2.5))));
+	v1875 = ((v1874*0.999)+(b/((v1868+3.5))));
+	v1876 = ((v1875*0.999)+(b/((v1869+4.5))));
+	v1877 = ((v1876*0.999)+(b/((v1870+5.5))));
+	v1878 = ((v1877*0.999)+(b/((v1871+6.5))));
+	v1879 = ((v1878*0.999)+(b/((v1872+7.5))));
+	v1880 = ((v1879*0.999)+(b/((v1873+8.5))));
+	v1881 = ((v1880*0.999)+(b/((v1874+9.5))));
+	v1882 = ((v1881*0.999)+(b/((v1875+10.5))));
+	v1883 = ((v1882*0.999)+(b/((v1876+11.5))));
+	v1884 = ((v1883*0.999)+(b/((v1877+12.5))));
+	v1885 = ((v1884*0.999)+(b/((v1878+0.5))));
+	v1886 = ((v1885*0.999)+(b/((v1879+1.5))));
+	v1887 = ((v1886*0.999)+(b/((v1880+2.5))));
+	v1888 = ((v1887*0.999)+(b/((v1881+3.5))));
+	v1889 = ((v1888*0.999)+(b/((v1882+4.5))));
+	v1890 = ((v1889*0.999)+(b/((v1883+5.5))));
+	v1891 = ((v1890*0.999)+(b/((v1884+6.5))));
+	v1892 = ((v1891*0.999)+(b/((v1885+7.5))));
+	v1893 = ((v1892*0.999)+(b/((v1886+8.5))));
+	v1894 = ((v1893*0.999)+(b/((v1887+9.5))));
+	v1895 = ((v1894*0.999)+(b/((v1888+10.5))));
+	v1896 = ((v1895*0.999)+(b/((v1889+11.5))));
+	v1897 = ((v1896*0.999)+(b/((v1890+12.5))));
+	v1898 = ((v1897*0.999)+(b/((v1891+0.5))));
+	v1899 = ((v1898*0.999)+(b/((v1892+1.5))));
+	v1900 = ((v1899*0.999)+(b/((v1893+2.5))));
+	v1901 = ((v1900*0.999)+(b/((v1894+3.5))));
+	v1902 = ((v1901*0.999)+(b/((v1895+4.5))));
+	v1903 = ((v1902*0.999)+(b/((v1896+5.5))));
+	v1904 = ((v1903*0.999)+(b/((v1897+6.5))));
+	v1905 = ((v1904*0.999)+(b/((v1898+7.5))));
+	v1906 = ((v1905*0.999)+(b/((v1899+8.5))));
+	v1907 = ((v1906*0.999)+(b/((v1900+9.5))));
+	v1908 = ((v1907*0.999)+(b/((v1901+10.5))));
+	v1909 = ((v1908*0.999)+(b/((v1902+11.5))));
+	v1910 = ((v1909*0.999)+(b/((v1903+12.5))));
+	v1911 = ((v1910*0.999)+(b/((v1904+0.5))));
+	v1912 = ((v1911*0.999)+(b/((v1905+1.5))));
+	v1913 = ((v1912*0.999)+(b/((v1906+2.5))));
+	v1914 = ((v1913*0.999)+(b/((v1907+3.5))));
+	v1915 = ((v1914*0.999)+(b/((v1908+4.5))));
+	v1916 = ((v1915*0.999)+(b/((v1909+5.5))));
+	v1917 = ((v1916*0.999)+(b/((v1910+6.5))));
+	v1918 = ((v1917*0.999)+(b/((v1911+7.5))));
+	v1919 = ((v1918*0.999)+(b/((v1912+8.5))));
+	v1920 = ((v1919*0.999)+(b/((v1913+9.5))));
+	v1921 = ((v1920*0.999)+(b/((v1914+10.5))));
+	v1922 = ((v1921*0.999)+(b/((v1915+11.5))));
+	v1923 = ((v1922*0.999)+(b/((v1916+12.5))));
+	v1924 = ((v1923*0.999)+(b/((v1917+0.5))));
+	v1925 = ((v1924*0.999)+(b/((v1918+1.5))));
+	v1926 = ((v1925*0.999)+(b/((v1919+2.5))));
+	v1927 = ((v1926*0.999)+(b/((v1920+3.5))));
+	v1928 = ((v1927*0.999)+(b/((v1921+4.5))));
+	v1929 = ((v1928*0.999)+(b/((v1922+5.5))));
+	v1930 = ((v1929*0.999)+(b/((v1923+6.5))));
+	v1931 = ((v1930*0.999)+(b/((v1924+7.5))));
+	v1932 = ((v1931*0.999)+(b/((v1925+8.5))));
+	v1933 = ((v1932*0.999)+(b/((v1926+9.5))));
+	v1934 = ((v1933*0.999)+(b/((v1927+10.5))));
+	v1935 = ((v1934*0.999)+(b/((v1928+11.5))));
+	v1936 = ((v1935*0.999)+(b/((v1929+12.5))));
+	v1937 = ((v1936*0.999)+(b/((v1930+0.5))));
+	v1938 = ((v1937*0.999)+(b/((v1931+1.5))));
+	v1939 = ((v1938*0.999)+(b/((v1932+2.5))));
+	v1940 = ((v1939*0.999)+(b/((v1933+3.5))));
+	v1941 = ((v1940*0.999)+(b/((v1934+4.5))));
+	v1942 = ((v1941*0.999)+(b/((v1935+5.5))));
+	v1943 = ((v1942*0.999)+(b/((v1936+6.5))));
+	v1944 = ((v1943*0.999)+(b/((v1937+7.5))));
+	v1945 = ((v1944*0.999)+(b/((v1938+8.5))));
+	v1946 = ((v1945*0.999)+(b/((v1939+9.5))));
+	v1947 = ((v1946*0.999)+(b/((v1940+10.5))));
+	v1948 = ((v1947*0.999)+(b/((v1941+11.5))));
+	v1949 = ((v1948*0.999)+(b/((v1942+12.5))));
+	v1950 = ((v1949*0.999)+(b/((v1943+0.5))));
+	v1951 = ((v1950*0.999)+(b/((v1944+1.5))));
+	v1952 = ((v1951*0.999)+(b/((v1945+2.5))));
+	v1953 = ((v1952*0.999)+(b/((v1946+3.5))));
+	v1954 = ((v1953*0.999)+(b/((v1947+4.5))));
+	v1955 = ((v1954*0.999)+(b/((v1948+5.5))));
+	v1956 = ((v1955*0.999)+(b/((v1949+6.5))));
+	v1957 = ((v1956*0.999)+(b/((v1950+7.5))));
+	v1958 = ((v1957*0.999)+(b/((v1951+8.5))));
+	v1959 = ((v1958*0.999)+(b/((v1952+9.5))));
+	v1960 = ((v1959*0.999)+(b/((v1953+10.5))));
+	v1961 = ((v1960*0.999)+(b/((v1954+11.5))));
+	v1962 = ((v1961*0.999)+(b/((v1955+12.5))));
+	v1963 = ((v1962*0.999)+(b/((v1956+0.5))));
+	v1964 = ((v1963*0.999)+(b/((v1957+1.5))));
+	v1965 = ((v1964*0.999)+(b/((v1958+2.5))));
+	v1966 = ((v1965*0.999)+(b/((v1959+3.5))));
+	v1967 = ((v1966*0.999)+(b/((v1960+4.5))));
+	v1968 = ((v1967*0.999)+(b/((v1961+5.5))));
+	v1969 = ((v1968*0.999)+(b/((v1962+6.5))));
+	v1970 = ((v1969*0.999)+(b/((v1963+7.5))));
+	v1971 = ((v1970*0.999)+(b/((v1964+8.5))));
+	v1972 = ((v1971*0.999)+(b/((v1965+9.5))));
+	v1973 = ((v1972*0.999)+(b/((v1966+10.5))));
+	v1974 = ((v1973*0.999)+(b/((v1967+11.5))));
+	v1975 = ((v1974*0.999)+(b/((v1968+12.5))));
+	v1976 = ((v1975*0.999)+(b/((v1969+0.5))));
+	v1977 = ((v1976*0.999)+(b/((v1970+1.5))));
+	v1978 = ((v1977*0.999)+(b/((v1971+2.5))));
+	v1979 = ((v1978*0.999)+(b/((v1972+3.5))));
+	v1980 = ((v1979*0.999)+(b/((v1973+4.5))));
+	v1981 = ((v1980*0.999)+(b/((v1974+5.5))));
+	v1982 = ((v1981*0.999)+(b/((v1975+6.5))));
+	v1983 = ((v1982*0.999)+(b/((v1976+7.5))));
+	v1984 = ((v1983*0.999)+(b/((v1977+8.5))));
+	v1985 = ((v1984*0.999)+(b/((v1978+9.5))));
+	v1986 = ((v1985*0.999)+(b/((v1979+10.5))));
+	v1987 = ((v1986*0.999)+(b/((v1980+11.5))));
+	v1988 = ((v1987*0.999)+(b/((v1981+12.5))));
+	v1989 = ((v1988*0.999)+(b/((v1982+0.5))));
+	v1990 = ((v1989*0.999)+(b/((v1983+1.5))));
+	v1991 = ((v1990*0.999)+(b/((v1984+2.5))));
+	v1992 = ((v1991*0.999)+(b/((v1985+3.5))));
+	v1993 = ((v1992*0.999)+(b/((v1986+4.5))));
+	v1994 = ((v1993*0.999)+(b/((v1987+5.5))));
+	v1995 = ((v1994*0.999)+(b/((v1988+6.5))));
+	v1996 = ((v1995*0.999)+(b/((v1989+7.5))));
+	v1997 = ((v1996*0.999)+(b/((v1990+8.5))));
+	v1998 = ((v1997*0.999)+(b/((v1991+9.5))));
+	this->v1992 = v1992;
+	this->v1993 = v1993;
+	this->v1994 = v1994;
+	this->v1995 = v1995;
+	this->v1996 = v1996;
+	this->v1997 = v1997;
+	this->v1998 = v1998;
+}
+
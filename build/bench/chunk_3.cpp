@@ -0,0 +1,2016 @@
+#include "chunk_state.h"
+
+void el_state::el_chunk2 ()
+{
+	double b = this->b;
+	double v1992 = this->v1992;
+	double v1998 = this->v1998;
+	double v1999;
+	double v1993 = this->v1993;
+	double v2000;
+	double v1994 = this->v1994;
+	double v2001;
+	double v1995 = this->v1995;
+	double v2002;
+	double v1996 = this->v1996;
+	double v2003;
+	double v1997 = this->v1997;
+	double v2004;
+	double v2005;
+	double v2006;
+	double v2007;
+	double v2008;
+	double v2009;
+	double v2010;
+	double v2011;
+	double v2012;
+	double v2013;
+	double v2014;
+	double v2015;
+	double v2016;
+	double v2017;
+	double v2018;
+	double v2019;
+	double v2020;
+	double v2021;
+	double v2022;
+	double v2023;
+	double v2024;
+	double v2025;
+	double v2026;
+	double v2027;
+	double v2028;
+	double v2029;
+	double v2030;
+	double v2031;
+	double v2032;
+	double v2033;
+	double v2034;
+	double v2035;
+	double v2036;
+	double v2037;
+	double v2038;
+	double v2039;
+	double v2040;
+	double v2041;
+	double v2042;
+	double v2043;
+	double v2044;
+	double v2045;
+	double v2046;
+	double v2047;
+	double v2048;
+	double v2049;
+	double v2050;
+	double v2051;
+	double v2052;
+	double v2053;
+	double v2054;
+	double v2055;
+	double v2056;
+	double v2057;
+	double v2058;
+	double v2059;
+	double v2060;
+	double v2061;
+	double v2062;
+	double v2063;
+	double v2064;
+	double v2065;
+	double v2066;
+	double v2067;
+	double v2068;
+	double v2069;
+	double v2070;
+	double v2071;
+	double v2072;
+	double v2073;
+	double v2074;
+	double v2075;
+	double v2076;
+	double v2077;
+	double v2078;
+	double v2079;
+	double v2080;
+	double v2081;
+	double v2082;
+	double v2083;
+	double v2084;
+	double v2085;
+	double v2086;
+	double v2087;
+	double v2088;
+	double v2089;
+	double v2090;
+	double v2091;
+	double v2092;
+	double v2093;
+	double v2094;
+	double v2095;
+	double v2096;
+	double v2097;
+	double v2098;
+	double v2099;
+	double v2100;
+	double v2101;
+	double v2102;
+	double v2103;
+	double v2104;
+	double v2105;
+	double v2106;
+	double v2107;
+	double v2108;
+	double v2109;
+	double v2110;
+	double v2111;
+	double v2112;
+	double v2113;
+	double v2114;
+	double v2115;
+	double v2116;
+	double v2117;
+	double v2118;
+	double v2119;
+	double v2120;
+	double v2121;
+	double v2122;
+	double v2123;
+	double v2124;
+	double v2125;
+	double v2126;
+	double v2127;
+	double v2128;
+	double v2129;
+	double v2130;
+	double v2131;
+	double v2132;
+	double v2133;
+	double v2134;
+	double v2135;
+	double v2136;
+	double v2137;
+	double v2138;
+	double v2139;
+	double v2140;
+	double v2141;
+	double v2142;
+	double v2143;
+	double v2144;
+	double v2145;
+	double v2146;
+	double v2147;
+	double v2148;
+	double v2149;
+	double v2150;
+	double v2151;
+	double v2152;
+	double v2153;
+	double v2154;
+	double v2155;
+	double v2156;
+	double v2157;
+	double v2158;
+	double v2159;
+	double v2160;
+	double v2161;
+	double v2162;
+	double v2163;
+	double v2164;
+	double v2165;
+	double v2166;
+	double v2167;
+	double v2168;
+	double v2169;
+	double v2170;
+	double v2171;
+	double v2172;
+	double v2173;
+	double v2174;
+	double v2175;
+	double v2176;
+	double v2177;
+	double v2178;
+	double v2179;
+	double v2180;
+	double v2181;
+	double v2182;
+	double v2183;
+	double v2184;
+	double v2185;
+	double v2186;
+	double v2187;
+	double v2188;
+	double v2189;
+	double v2190;
+	double v2191;
+	double v2192;
+	double v2193;
+	double v2194;
+	double v2195;
+	double v2196;
+	double v2197;
+	double v2198;
+	double v2199;
+	double v2200;
+	double v2201;
+	double v2202;
+	double v2203;
+	double v2204;
+	double v2205;
+	double v2206;
+	double v2207;
+	double v2208;
+	double v2209;
+	double v2210;
+	double v2211;
+	double v2212;
+	double v2213;
+	double v2214;
+	double v2215;
+	double v2216;
+	double v2217;
+	double v2218;
+	double v2219;
+	double v2220;
+	double v2221;
+	double v2222;
+	double v2223;
+	double v2224;
+	double v2225;
+	double v2226;
+	double v2227;
+	double v2228;
+	double v2229;
+	double v2230;
+	double v2231;
+	double v2232;
+	double v2233;
+	double v2234;
+	double v2235;
+	double v2236;
+	double v2237;
+	double v2238;
+	double v2239;
+	double v2240;
+	double v2241;
+	double v2242;
+	double v2243;
+	double v2244;
+	double v2245;
+	double v2246;
+	double v2247;
+	double v2248;
+	double v2249;
+	double v2250;
+	double v2251;
+	double v2252;
+	double v2253;
+	double v2254;
+	double v2255;
+	double v2256;
+	double v2257;
+	double v2258;
+	double v2259;
+	double v2260;
+	double v2261;
+	double v2262;
+	double v2263;
+	double v2264;
+	double v2265;
+	double v2266;
+	double v2267;
+	double v2268;
+	double v2269;
+	double v2270;
+	double v2271;
+	double v2272;
+	double v2273;
+	double v2274;
+	double v2275;
+	double v2276;
+	double v2277;
+	double v2278;
+	double v2279;
+	double v2280;
+	double v2281;
+	double v2282;
+	double v2283;
+	double v2284;
+	double v2285;
+	double v2286;
+	double v2287;
+	double v2288;
+	double v2289;
+	double v2290;
+	double v2291;
+	double v2292;
+	double v2293;
+	double v2294;
+	double v2295;
+	double v2296;
+	double v2297;
+	double v2298;
+	double v2299;
+	double v2300;
+	double v2301;
+	double v2302;
+	double v2303;
+	double v2304;
+	double v2305;
+	double v2306;
+	double v2307;
+	double v2308;
+	double v2309;
+	double v2310;
+	double v2311;
+	double v2312;
+	double v2313;
+	double v2314;
+	double v2315;
+	double v2316;
+	double v2317;
+	double v2318;
+	double v2319;
+	double v2320;
+	double v2321;
+	double v2322;
+	double v2323;
+	double v2324;
+	double v2325;
+	double v2326;
+	double v2327;
+	double v2328;
+	double v2329;
+	double v2330;
+	double v2331;
+	double v2332;
+	double v2333;
+	double v2334;
+	double v2335;
+	double v2336;
+	double v2337;
+	double v2338;
+	double v2339;
+	double v2340;
+	double v2341;
+	double v2342;
+	double v2343;
+	double v2344;
+	double v2345;
+	double v2346;
+	double v2347;
+	double v2348;
+	double v2349;
+	double v2350;
+	double v2351;
+	double v2352;
+	double v2353;
+	double v2354;
+	double v2355;
+	double v2356;
+	double v2357;
+	double v2358;
+	double v2359;
+	double v2360;
+	double v2361;
+	double v2362;
+	double v2363;
+	double v2364;
+	double v2365;
+	double v2366;
+	double v2367;
+	double v2368;
+	double v2369;
+	double v2370;
+	double v2371;
+	double v2372;
+	double v2373;
+	double v2374;
+	double v2375;
+	double v2376;
+	double v2377;
+	double v2378;
+	double v2379;
+	double v2380;
+	double v2381;
+	double v2382;
+	double v2383;
+	double v2384;
+	double v2385;
+	double v2386;
+	double v2387;
+	double v2388;
+	double v2389;
+	double v2390;
+	double v2391;
+	double v2392;
+	double v2393;
+	double v2394;
+	double v2395;
+	double v2396;
+	double v2397;
+	double v2398;
+	double v2399;
+	double v2400;
+	double v2401;
+	double v2402;
+	double v2403;
+	double v2404;
+	double v2405;
+	double v2406;
+	double v2407;
+	double v2408;
+	double v2409;
+	double v2410;
+	double v2411;
+	double v2412;
+	double v2413;
+	double v2414;
+	double v2415;
+	double v2416;
+	double v2417;
+	double v2418;
+	double v2419;
+	double v2420;
+	double v2421;
+	double v2422;
+	double v2423;
+	double v2424;
+	double v2425;
+	double v2426;
+	double v2427;
+	double v2428;
+	double v2429;
+	double v2430;
+	double v2431;
+	double v2432;
+	double v2433;
+	double v2434;
+	double v2435;
+	double v2436;
+	double v2437;
+	double v2438;
+	double v2439;
+	double v2440;
+	double v2441;
+	double v2442;
+	double v2443;
+	double v2444;
+	double v2445;
+	double v2446;
+	double v2447;
+	double v2448;
+	double v2449;
+	double v2450;
+	double v2451;
+	double v2452;
+	double v2453;
+	double v2454;
+	double v2455;
+	double v2456;
+	double v2457;
+	double v2458;
+	double v2459;
+	double v2460;
+	double v2461;
+	double v2462;
+	double v2463;
+	double v2464;
+	double v2465;
+	double v2466;
+	double v2467;
+	double v2468;
+	double v2469;
+	double v2470;
+	double v2471;
+	double v2472;
+	double v2473;
+	double v2474;
+	double v2475;
+	double v2476;
+	double v2477;
+	double v2478;
+	double v2479;
+	double v2480;
+	double v2481;
+	double v2482;
+	double v2483;
+	double v2484;
+	double v2485;
+	double v2486;
+	double v2487;
+	double v2488;
+	double v2489;
+	double v2490;
+	double v2491;
+	double v2492;
+	double v2493;
+	double v2494;
+	double v2495;
+	double v2496;
+	double v2497;
+	double v2498;
+	double v2499;
+	double v2500;
+	double v2501;
+	double v2502;
+	double v2503;
+	double v2504;
+	double v2505;
+	double v2506;
+	double v2507;
+	double v2508;
+	double v2509;
+	double v2510;
+	double v2511;
+	double v2512;
+	double v2513;
+	double v2514;
+	double v2515;
+	double v2516;
+	double v2517;
+	double v2518;
+	double v2519;
+	double v2520;
+	double v2521;
+	double v2522;
+	double v2523;
+	double v2524;
+	double v2525;
+	double v2526;
+	double v2527;
+	double v2528;
+	double v2529;
+	double v2530;
+	double v2531;
+	double v2532;
+	double v2533;
+	double v2534;
+	double v2535;
+	double v2536;
+	double v2537;
+	double v2538;
+	double v2539;
+	double v2540;
+	double v2541;
+	double v2542;
+	double v2543;
+	double v2544;
+	double v2545;
+	double v2546;
+	double v2547;
+	double v2548;
+	double v2549;
+	double v2550;
+	double v2551;
+	double v2552;
+	double v2553;
+	double v2554;
+	double v2555;
+	double v2556;
+	double v2557;
+	double v2558;
+	double v2559;
+	double v2560;
+	double v2561;
+	double v2562;
+	double v2563;
+	double v2564;
+	double v2565;
+	double v2566;
+	double v2567;
+	double v2568;
+	double v2569;
+	double v2570;
+	double v2571;
+	double v2572;
+	double v2573;
+	double v2574;
+	double v2575;
+	double v2576;
+	double v2577;
+	double v2578;
+	double v2579;
+	double v2580;
+	double v2581;
+	double v2582;
+	double v2583;
+	double v2584;
+	double v2585;
+	double v2586;
+	double v2587;
+	double v2588;
+	double v2589;
+	double v2590;
+	double v2591;
+	double v2592;
+	double v2593;
+	double v2594;
+	double v2595;
+	double v2596;
+	double v2597;
+	double v2598;
+	double v2599;
+	double v2600;
+	double v2601;
+	double v2602;
+	double v2603;
+	double v2604;
+	double v2605;
+	double v2606;
+	double v2607;
+	double v2608;
+	double v2609;
+	double v2610;
+	double v2611;
+	double v2612;
+	double v2613;
+	double v2614;
+	double v2615;
+	double v2616;
+	double v2617;
+	double v2618;
+	double v2619;
+	double v2620;
+	double v2621;
+	double v2622;
+	double v2623;
+	double v2624;
+	double v2625;
+	double v2626;
+	double v2627;
+	double v2628;
+	double v2629;
+	double v2630;
+	double v2631;
+	double v2632;
+	double v2633;
+	double v2634;
+	double v2635;
+	double v2636;
+	double v2637;
+	double v2638;
+	double v2639;
+	double v2640;
+	double v2641;
+	double v2642;
+	double v2643;
+	double v2644;
+	double v2645;
+	double v2646;
+	double v2647;
+	double v2648;
+	double v2649;
+	double v2650;
+	double v2651;
+	double v2652;
+	double v2653;
+	double v2654;
+	double v2655;
+	double v2656;
+	double v2657;
+	double v2658;
+	double v2659;
+	double v2660;
+	double v2661;
+	double v2662;
+	double v2663;
+	double v2664;
+	double v2665;
+	double v2666;
+	double v2667;
+	double v2668;
+	double v2669;
+	double v2670;
+	double v2671;
+	double v2672;
+	double v2673;
+	double v2674;
+	double v2675;
+	double v2676;
+	double v2677;
+	double v2678;
+	double v2679;
+	double v2680;
+	double v2681;
+	double v2682;
+	double v2683;
+	double v2684;
+	double v2685;
+	double v2686;
+	double v2687;
+	double v2688;
+	double v2689;
+	double v2690;
+	double v2691;
+	double v2692;
+	double v2693;
+	double v2694;
+	double v2695;
+	double v2696;
+	double v2697;
+	double v2698;
+	double v2699;
+	double v2700;
+	double v2701;
+	double v2702;
+	double v2703;
+	double v2704;
+	double v2705;
+	double v2706;
+	double v2707;
+	double v2708;
+	double v2709;
+	double v2710;
+	double v2711;
+	double v2712;
+	double v2713;
+	double v2714;
+	double v2715;
+	double v2716;
+	double v2717;
+	double v2718;
+	double v2719;
+	double v2720;
+	double v2721;
+	double v2722;
+	double v2723;
+	double v2724;
+	double v2725;
+	double v2726;
+	double v2727;
+	double v2728;
+	double v2729;
+	double v2730;
+	double v2731;
+	double v2732;
+	double v2733;
+	double v2734;
+	double v2735;
+	double v2736;
+	double v2737;
+	double v2738;
+	double v2739;
+	double v2740;
+	double v2741;
+	double v2742;
+	double v2743;
+	double v2744;
+	double v2745;
+	double v2746;
+	double v2747;
+	double v2748;
+	double v2749;
+	double v2750;
+	double v2751;
+	double v2752;
+	double v2753;
+	double v2754;
+	double v2755;
+	double v2756;
+	double v2757;
+	double v2758;
+	double v2759;
+	double v2760;
+	double v2761;
+	double v2762;
+	double v2763;
+	double v2764;
+	double v2765;
+	double v2766;
+	double v2767;
+	double v2768;
+	double v2769;
+	double v2770;
+	double v2771;
+	double v2772;
+	double v2773;
+	double v2774;
+	double v2775;
+	double v2776;
+	double v2777;
+	double v2778;
+	double v2779;
+	double v2780;
+	double v2781;
+	double v2782;
+	double v2783;
+	double v2784;
+	double v2785;
+	double v2786;
+	double v2787;
+	double v2788;
+	double v2789;
+	double v2790;
+	double v2791;
+	double v2792;
+	double v2793;
+	double v2794;
+	double v2795;
+	double v2796;
+	double v2797;
+	double v2798;
+	double v2799;
+	double v2800;
+	double v2801;
+	double v2802;
+	double v2803;
+	double v2804;
+	double v2805;
+	double v2806;
+	double v2807;
+	double v2808;
+	double v2809;
+	double v2810;
+	double v2811;
+	double v2812;
+	double v2813;
+	double v2814;
+	double v2815;
+	double v2816;
+	double v2817;
+	double v2818;
+	double v2819;
+	double v2820;
+	double v2821;
+	double v2822;
+	double v2823;
+	double v2824;
+	double v2825;
+	double v2826;
+	double v2827;
+	double v2828;
+	double v2829;
+	double v2830;
+	double v2831;
+	double v2832;
+	double v2833;
+	double v2834;
+	double v2835;
+	double v2836;
+	double v2837;
+	double v2838;
+	double v2839;
+	double v2840;
+	double v2841;
+	double v2842;
+	double v2843;
+	double v2844;
+	double v2845;
+	double v2846;
+	double v2847;
+	double v2848;
+	double v2849;
+	double v2850;
+	double v2851;
+	double v2852;
+	double v2853;
+	double v2854;
+	double v2855;
+	double v2856;
+	double v2857;
+	double v2858;
+	double v2859;
+	double v2860;
+	double v2861;
+	double v2862;
+	double v2863;
+	double v2864;
+	double v2865;
+	double v2866;
+	double v2867;
+	double v2868;
+	double v2869;
+	double v2870;
+	double v2871;
+	double v2872;
+	double v2873;
+	double v2874;
+	double v2875;
+	double v2876;
+	double v2877;
+	double v2878;
+	double v2879;
+	double v2880;
+	double v2881;
+	double v2882;
+	double v2883;
+	double v2884;
+	double v2885;
+	double v2886;
+	double v2887;
+	double v2888;
+	double v2889;
+	double v2890;
+	double v2891;
+	double v2892;
+	double v2893;
+	double v2894;
+	double v2895;
+	double v2896;
+	double v2897;
+	double v2898;
+	double v2899;
+	double v2900;
+	double v2901;
+	double v2902;
+	double v2903;
+	double v2904;
+	double v2905;
+	double v2906;
+	double v2907;
+	double v2908;
+	double v2909;
+	double v2910;
+	double v2911;
+	double v2912;
+	double v2913;
+	double v2914;
+	double v2915;
+	double v2916;
+	double v2917;
+	double v2918;
+	double v2919;
+	double v2920;
+	double v2921;
+	double v2922;
+	double v2923;
+	double v2924;
+	double v2925;
+	double v2926;
+	double v2927;
+	double v2928;
+	double v2929;
+	double v2930;
+	double v2931;
+	double v2932;
+	double v2933;
+	double v2934;
+	double v2935;
+	double v2936;
+	double v2937;
+	double v2938;
+	double v2939;
+	double v2940;
+	double v2941;
+	double v2942;
+	double v2943;
+	double v2944;
+	double v2945;
+	double v2946;
+	double v2947;
+	double v2948;
+	double v2949;
+	double v2950;
+	double v2951;
+	double v2952;
+	double v2953;
+	double v2954;
+	double v2955;
+	double v2956;
+	double v2957;
+	double v2958;
+	double v2959;
+	double v2960;
+	double v2961;
+	double v2962;
+	double v2963;
+	double v2964;
+	double v2965;
+	double v2966;
+	double v2967;
+	double v2968;
+	double v2969;
+	double v2970;
+	double v2971;
+	double v2972;
+	double v2973;
+	double v2974;
+	double v2975;
+	double v2976;
+	double v2977;
+	double v2978;
+	double v2979;
+	double v2980;
+	double v2981;
+	double v2982;
+	double v2983;
+	double v2984;
+	double v2985;
+	double v2986;
+	double v2987;
+	double v2988;
+	double v2989;
+	double v2990;
+	double v2991;
+	double v2992;
+	double v2993;
+	double v2994;
+	double v2995;
+	double v2996;
+	double v2997;
+	double v2998;
+	v1999 = ((v1998*0.999)+(b/((v1992+10.5))));
+	v2000 = ((v1999*0.999)+(b/((v1993+11.5))));
+	v2001 = ((v2000*0.999)+(b/((v1994+12.5))));
+	v2002 = ((v2001*0.999)+(b/((v1995+0.5))));
+	v2003 = ((v2002*0.999)+(b/((v1996+1.5))));
+	v2004 = ((v2003*0.999)+(b/((v1997+2.5))));
+	v2005 = ((v2004*0.999)+(b/((v1998+3.5))));
+	v2006 = ((v2005*0.999)+(b/((v1999+4.5))));
+	v2007 = ((v2006*0.999)+(b/((v2000+5.5))));
+	v2008 = ((v2007*0.999)+(b/((v2001+6.5))));
+	v2009 = ((v2008*0.999)+(b/((v2002+7.5))));
+	v2010 = ((v2009*0.999)+(b/((v2003+8.5))));
+	v2011 = ((v2010*0.999)+(b/((v2004+9.5))));
+	v2012 = ((v2011*0.999)+(b/((v2005+10.5))));
+	v2013 = ((v2012*0.999)+(b/((v2006+11.5))));
+	v2014 = ((v2013*0.999)+(b/((v2007+12.5))));
+	v2015 = ((v2014*0.999)+(b/((v2008+0.5))));
+	v2016 = ((v2015*0.999)+(b/((v2009+1.5))));
+	v2017 = ((v2016*0.999)+(b/((v2010+2.5))));
+	v2018 = ((v2017*0.999)+(b/((v2011+3.5))));
+	v2019 = ((v2018*0.999)+(b/((v2012+4.5))));
+	v2020 = ((v2019*0.999)+(b/((v2013+5.5))));
+	v2021 = ((v2020*0.999)+(b/((v2014+6.5))));
+	v2022 = ((v2021*0.999)+(b/((v2015+7.5))));
+	v2023 = ((v2022*0.999)+(b/((v2016+8.5))));
+	v2024 = ((v2023*0.999)+(b/((v2017+9.5))));
+	v2025 = ((v2024*0.999)+(b/((v2018+10.5))));
+	v2026 = ((v2025*0.999)+(b/((v2019+11.5))));
+	v2027 = ((v2026*0.999)+(b/((v2020+12.5))));
+	v2028 = ((v2027*0.999)+(b/((v2021+0.5))));
+	v2029 = ((v2028*0.999)+(b/((v2022+1.5))));
+	v2030 = ((v2029*0.999)+(b/((v2023+2.5))));
+	v2031 = ((v2030*0.999)+(b/((v2024+3.5))));
+	v2032 = ((v2031*0.999)+(b/((v2025+4.5))));
+	v2033 = ((v2032*0.999)+(b/((v2026+5.5))));
+	v2034 = ((v2033*0.999)+(b/((v2027+6.5))));
+	v2035 = ((v2034*0.999)+(b/((v2028+7.5))));
+	v2036 = ((v2035*0.999)+(b/((v2029+8.5))));
+	v2037 = ((v2036*0.999)+(b/((v2030+9.5))));
+	v2038 = ((v2037*0.999)+(b/((v2031+10.5))));
+	v2039 = ((v2038*0.999)+(b/((v2032+11.5))));
+	v2040 = ((v2039*0.999)+(b/((v2033+12.5))));
+	v2041 = ((v2040*0.999)+(b/((v2034+0.5))));
+	v2042 = ((v2041*0.999)+(b/((v2035+1.5))));
+	v2043 = ((v2042*0.999)+(b/((v2036+2.5))));
+	v2044 = ((v2043*0.999)+(b/((v2037+3.5))));
+	v2045 = ((v2044*0.999)+(b/((v2038+4.5))));
+	v2046 = ((v2045*0.999)+(b/((v2039+5.5))));
+	v2047 = ((v2046*0.999)+(b/((v2040+6.5))));
+	v2048 = ((v2047*0.999)+(b/((v2041+7.5))));
+	v2049 = ((v2048*0.999)+(b/((v2042+8.5))));
+	v2050 = ((v2049*0.999)+(b/((v2043+9.5))));
+	v2051 = ((v2050*0.999)+(b/((v2044+10.5))));
+	v2052 = ((v2051*0.999)+(b/((v2045+11.5))));
+	v2053 = ((v2052*0.999)+(b/((v2046+12.5))));
+	v2054 = ((v2053*0.999)+(b/((v2047+0.5))));
+	v2055 = ((v2054*0.999)+(b/((v2048+1.5))));
+	v2056 = ((v2055*0.999)+(b/((v2049+2.5))));
+	v2057 = ((v2056*0.999)+(b/((v2050+3.5))));
+	v2058 = ((v2057*0.999)+(b/((v2051+4.5))));
+	v2059 = ((v2058*0.999)+(b/((v2052+5.5))));
+	v2060 = ((v2059*0.999)+(b/((v2053+6.5))));
+	v2061 = ((v2060*0.999)+(b/((v2054+7.5))));
+	v2062 = ((v2061*0.999)+(b/((v2055+8.5))));
+	v2063 = ((v2062*0.999)+(b/((v2056+9.5))));
+	v2064 = ((v2063*0.999)+(b/((v2057+10.5))));
+	v2065 = ((v2064*0.999)+(b/((v2058+11.5))));
+	v2066 = ((v2065*0.999)+(b/((v2059+12.5))));
+	v2067 = ((v2066*0.999)+(b/((v2060+0.5))));
+	v2068 = ((v2067*0.999)+(b/((v2061+1.5))));
+	v2069 = ((v2068*0.999)+(b/((v2062+2.5))));
+	v2070 = ((v2069*0.999)+(b/((v2063+3.5))));
+	v2071 = ((v2070*0.999)+(b/((v2064+4.5))));
+	v2072 = ((v2071*0.999)+(b/((v2065+5.5))));
+	v2073 = ((v2072*0.999)+(b/((v2066+6.5))));
+	v2074 = ((v2073*0.999)+(b/((v2067+7.5))));
+	v2075 = ((v2074*0.999)+(b/((v2068+8.5))));
+	v2076 = ((v2075*0.999)+(b/((v2069+9.5))));
+	v2077 = ((v2076*0.999)+(b/((v2070+10.5))));
+	v2078 = ((v2077*0.999)+(b/((v2071+11.5))));
+	v2079 = ((v2078*0.999)+(b/((v2072+12.5))));
+	v2080 = ((v2079*0.999)+(b/((v2073+0.5))));
+	v2081 = ((v2080*0.999)+(b/((v2074+1.5))));
+	v2082 = ((v2081*0.999)+(b/((v2075+2.5))));
+	v2083 = ((v2082*0.999)+(b/((v2076+3.5))));
+	v2084 = ((v2083*0.999)+(b/((v2077+4.5))));
+	v2085 = ((v2084*0.999)+(b/((v2078+5.5))));
+	v2086 = ((v2085*0.999)+(b/((v2079+6.5))));
+	v2087 = ((v2086*0.999)+(b/((v2080+7.5))));
+	v2088 = ((v2087*0.999)+(b/((v2081+8.5))));
+	v2089 = ((v2088*0.999)+(b/((v2082+9.5))));
+	v2090 = ((v2089*0.999)+(b/((v2083+10.5))));
+	v2091 = ((v2090*0.999)+(b/((v2084+11.5))));
+	v2092 = ((v2091*0.999)+(b/((v2085+12.5))));
+	v2093 = ((v2092*0.999)+(b/((v2086+0.5))));
+	v2094 = ((v2093*0.999)+(b/((v2087+1.5))));
+	v2095 = ((v2094*0.999)+(b/((v2088+2.5))));
+	v2096 = ((v2095*0.999)+(b/((v2089+3.5))));
+	v2097 = ((v2096*0.999)+(b/((v2090+4.5))));
+	v2098 = ((v2097*0.999)+(b/((v2091+5.5))));
+	v2099 = ((v2098*0.999)+(b/((v2092+6.5))));
+	v2100 = ((v2099*0.999)+(b/((v2093+7.5))));
+	v2101 = ((v2100*0.999)+(b/((v2094+8.5))));
+	v2102 = ((v2101*0.999)+(b/((v2095+9.5))));
+	v2103 = ((v2102*0.999)+(b/((v2096+10.5))));
+	v2104 = ((v2103*0.999)+(b/((v2097+11.5))));
+	v2105 = ((v2104*0.999)+(b/((v2098+12.5))));
+	v2106 = ((v2105*0.999)+(b/((v2099+0.5))));
+	v2107 = ((v2106*0.999)+(b/((v2100+1.5))));
+	v2108 = ((v2107*0.999)+(b/((v2101+2.5))));
+	v2109 = ((v2108*0.999)+(b/((v2102+3.5))));
+	v2110 = ((v2109*0.999)+(b/((v2103+4.5))));
+	v2111 = ((v2110*0.999)+(b/((v2104+5.5))));
+	v2112 = ((v2111*0.999)+(b/((v2105+6.5))));
+	v2113 = ((v2112*0.999)+(b/((v2106+7.5))));
+	v2114 = ((v2113*0.999)+(b/((v2107+8.5))));
+	v2115 = ((v2114*0.999)+(b/((v2108+9.5))));
+	v2116 = ((v2115*0.999)+(b/((v2109+10.5))));
+	v2117 = ((v2116*0.999)+(b/((v2110+11.5))));
+	v2118 = ((v2117*0.999)+(b/((v2111+12.5))));
+	v2119 = ((v2118*0.999)+(b/((v2112+0.5))));
+	v2120 = ((v2119*0.999)+(b/((v2113+1.5))));
+	v2121 = ((v2120*0.999)+(b/((v2114+2.5))));
+	v2122 = ((v2121*0.999)+(b/((v2115+3.5))));
+	v2123 = ((v2122*0.999)+(b/((v2116+4.5))));
+	v2124 = ((v2123*0.999)+(b/((v2117+5.5))));
+	v2125 = ((v2124*0.999)+(b/((v2118+6.5))));
+	v2126 = ((v2125*0.999)+(b/((v2119+7.5))));
+	v2127 = ((v2126*0.999)+(b/((v2120+8.5))));
+	v2128 = ((v2127*0.999)+(b/((v2121+9.5))));
+	v2129 = ((v2128*0.999)+(b/((v2122+10.5))));
+	v2130 = ((v2129*0.999)+(b/((v2123+11.5))));
+	v2131 = ((v2130*0.999)+(b/((v2124+12.5))));
+	v2132 = ((v2131*0.999)+(b/((v2125+0.5))));
+	v2133 = ((v2132*0.999)+(b/((v2126+1.5))));
+	v2134 = ((v2133*0.999)+(b/((v2127+2.5))));
+	v2135 = ((v2134*0.999)+(b/((v2128+3.5))));
+	v2136 = ((v2135*0.999)+(b/((v2129+4.5))));
+	v2137 = ((v2136*0.999)+(b/((v2130+5.5))));
+	v2138 = ((v2137*0.999)+(b/((v2131+6.5))));
+	v2139 = ((v2138*0.999)+(b/((v2132+7.5))));
+	v2140 = ((v2139*0.999)+(b/((v2133+8.5))));
+	v2141 = ((v2140*0.999)+(b/((v2134+9.5))));
+	v2142 = ((v2141*0.999)+(b/((v2135+10.5))));
+	v2143 = ((v2142*0.999)+(b/((v2136+11.5))));
+	v2144 = ((v2143*0.999)+(b/((v2137+12.5))));
+	v2145 = ((v2144*0.999)+(b/((v2138+0.5))));
+	v2146 = ((v2145*0.999)+(b/((v2139+1.5))));
+	v2147 = ((v2146*0.999)+(b/((v2140+2.5))));
+	v2148 = ((v2147*0.999)+(b/((v2141+3.5))));
+	v2149 = ((v2148*0.999)+(b/((v2142+4.5))));
+	v2150 = ((v2149*0.999)+(b/((v2143+5.5))));
+	v2151 = ((v2150*0.999)+(b/((v2144+6.5))));
+	v2152 = ((v2151*0.999)+(b/((v2145+7.5))));
+	v2153 = ((v2152*0.999)+(b/((v2146+8.5))));
+	v2154 = ((v2153*0.999)+(b/((v2147+9.5))));
+	v2155 = ((v2154*0.999)+(b/((v2148+10.5))));
+	v2156 = ((v2155*0.999)+(b/((v2149+11.5))));
+	v2157 = ((v2156*0.999)+(b/((v2150+12.5))));
+	v2158 = ((v2157*0.999)+(b/((v2151+0.5))));
+	v2159 = ((v2158*0.999)+(b/((v2152+1.5))));
+	v2160 = ((v2159*0.999)+(b/((v2153+2.5))));
+	v2161 = ((v2160*0.999)+(b/((v2154+3.5))));
+	v2162 = ((v2161*0.999)+(b/((v2155+4.5))));
+	v2163 = ((v2162*0.999)+(b/((v2156+5.5))));
+	v2164 = ((v2163*0.999)+(b/((v2157+6.5))));
+	v2165 = ((v2164*0.999)+(b/((v2158+7.5))));
+	v2166 = ((v2165*0.999)+(b/((v2159+8.5))));
+	v2167 = ((v2166*0.999)+(b/((v2160+9.5))));
+	v2168 = ((v2167*0.999)+(b/((v2161+10.5))));
+	v2169 = ((v2168*0.999)+(b/((v2162+11.5))));
+	v2170 = ((v2169*0.999)+(b/((v2163+12.5))));
+	v2171 = ((v2170*0.999)+(b/((v2164+0.5))));
+	v2172 = ((v2171*0.999)+(b/((v2165+1.5))));
+	v2173 = ((v2172*0.999)+(b/((v2166+2.5))));
+	v2174 = ((v2173*0.999)+(b/((v2167+3.5))));
+	v2175 = ((v2174*0.999)+(b/((v2168+4.5))));
+	v2176 = ((v2175*0.999)+(b/((v2169+5.5))));
+	v2177 = ((v2176*0.999)+(b/((v2170+6.5))));
+	v2178 = ((v2177*0.999)+(b/((v2171+7.5))));
+	v2179 = ((v2178*0.999)+(b/((v2172+8.5))));
+	v2180 = ((v2179*0.999)+(b/((v2173+9.5))));
+	v2181 = ((v2180*0.999)+(b/((v2174+10.5))));
+	v2182 = ((v2181*0.999)+(b/((v2175+11.5))));
+	v2183 = ((v2182*0.999)+(b/((v2176+12.5))));
+	v2184 = ((v2183*0.999)+(b/((v2177+0.5))));
+	v2185 = ((v2184*0.999)+(b/((v2178+1.5))));
+	v2186 = ((v2185*0.999)+(b/((v2179+2.5))));
+	v2187 = ((v2186*0.999)+(b/((v2180+3.5))));
+	v2188 = ((v2187*0.999)+(b/((v2181+4.5))));
+	v2189 = ((v2188*0.999)+(b/((v2182+5.5))));
+	v2190 = ((v2189*0.999)+(b/((v2183+6.5))));
+	v2191 = ((v2190*0.999)+(b/((v2184+7.5))));
+	v2192 = ((v2191*0.999)+(b/((v2185+8.5))));
+	v2193 = ((v2192*0.999)+(b/((v2186+9.5))));
+	v2194 = ((v2193*0.999)+(b/((v2187+10.5))));
+	v2195 = ((v2194*0.999)+(b/((v2188+11.5))));
+	v2196 = ((v2195*0.999)+(b/((v2189+12.5))));
+	v2197 = ((v2196*0.999)+(b/((v2190+0.5))));
+	v2198 = ((v2197*0.999)+(b/((v2191+1.5))));
+	v2199 = ((v2198*0.999)+(b/((v2192+2.5))));
+	v2200 = ((v2199*0.999)+(b/((v2193+3.5))));
+	v2201 = ((v2200*0.999)+(b/((v2194+4.5))));
+	v2202 = ((v2201*0.999)+(b/((v2195+5.5))));
+	v2203 = ((v2202*0.999)+(b/((v2196+6.5))));
+	v2204 = ((v2203*0.999)+(b/((v2197+7.5))));
+	v2205 = ((v2204*0.999)+(b/((v2198+8.5))));
+	v2206 = ((v2205*0.999)+(b/((v2199+9.5))));
+	v2207 = ((v2206*0.999)+(b/((v2200+10.5))));
+	v2208 = ((v2207*0.999)+(b/((v2201+11.5))));
+	v2209 = ((v2208*0.999)+(b/((v2202+12.5))));
+	v2210 = ((v2209*0.999)+(b/((v2203+0.5))));
+	v2211 = ((v2210*0.999)+(b/((v2204+1.5))));
+	v2212 = ((v2211*0.999)+(b/((v2205+2.5))));
+	v2213 = ((v2212*0.999)+(b/((v2206+3.5))));
+	v2214 = ((v2213*0.999)+(b/((v2207+4.5))));
+	v2215 = ((v2214*0.999)+(b/((v2208+5.5))));
+	v2216 = ((v2215*0.999)+(b/((v2209+6.5))));
+	v2217 = ((v2216*0.999)+(b/((v2210+7.5))));
+	v2218 = ((v2217*0.999)+(b/((v2211+8.5))));
+	v2219 = ((v2218*0.999)+(b/((v2212+9.5))));
+	v2220 = ((v2219*0.999)+(b/((v2213+10.5))));
+	v2221 = ((v2220*0.999)+(b/((v2214+11.5))));
+	v2222 = ((v2221*0.999)+(b/((v2215+12.5))));
+	v2223 = ((v2222*0.999)+(b/((v2216+0.5))));
+	v2224 = ((v2223*0.999)+(b/((v2217+1.5))));
+	v2225 = ((v2224*0.999)+(b/((v2218+2.5))));
+	v2226 = ((v2225*0.999)+(b/((v2219+3.5))));
+	v2227 = ((v2226*0.999)+(b/((v2220+4.5))));
+	v2228 = ((v2227*0.999)+(b/((v2221+5.5))));
+	v2229 = ((v2228*0.999)+(b/((v2222+6.5))));
+	v2230 = ((v2229*0.999)+(b/((v2223+7.5))));
+	v2231 = ((v2230*0.999)+(b/((v2224+8.5))));
+	v2232 = ((v2231*0.999)+(b/((v2225+9.5))));
+	v2233 = ((v2232*0.999)+(b/((v2226+10.5))));
+	v2234 = ((v2233*0.999)+(b/((v2227+11.5))));
+	v2235 = ((v2234*0.999)+(b/((v2228+12.5))));
+	v2236 = ((v2235*0.999)+(b/((v2229+0.5))));
+	v2237 = ((v2236*0.999)+(b/((v2230+1.5))));
+	v2238 = ((v2237*0.999)+(b/((v2231+2.5))));
+	v2239 = ((v2238*0.999)+(b/((v2232+3.5))));
+	v2240 = ((v2239*0.999)+(b/((v2233+4.5))));
+	v2241 = ((v2240*0.999)+(b/((v2234+5.5))));
+	v2242 = ((v2241*0.999)+(b/((v2235+6.5))));
+	v2243 = ((v2242*0.999)+(b/((v2236+7.5))));
+	v2244 = ((v2243*0.999)+(b/((v2237+8.5))));
+	v2245 = ((v2244*0.999)+(b/((v2238+9.5))));
+	v2246 = ((v2245*0.999)+(b/((v2239+10.5))));
+	v2247 = ((v2246*0.999)+(b/((v2240+11.5))));
+	v2248 = ((v2247*0.999)+(b/((v2241+12.5))));
+	v2249 = ((v2248*0.999)+(b/((v2242+0.5))));
+	v2250 = ((v2249*0.999)+(b/((v2243+1.5))));
+	v2251 = ((v2250*0.999)+(b/((v2244+2.5))));
+	v2252 = ((v2251*0.999)+(b/((v2245+3.5))));
+	v2253 = ((v2252*0.999)+(b/((v2246+4.5))));
+	v2254 = ((v2253*0.999)+(b/((v2247+5.5))));
+	v2255 = ((v2254*0.999)+(b/((v2248+6.5))));
+	v2256 = ((v2255*0.999)+(b/((v2249+7.5))));
+	v2257 = ((v2256*0.999)+(b/((v2250+8.5))));
+	v2258 = ((v2257*0.999)+(b/((v2251+9.5))));
+	v2259 = ((v2258*0.999)+(b/((v2252+10.5))));
+	v2260 = ((v2259*0.999)+(b/((v2253+11.5))));
+	v2261 = ((v2260*0.999)+(b/((v2254+12.5))));
+	v2262 = ((v2261*0.999)+(b/((v2255+0.5))));
+	v2263 = ((v2262*0.999)+(b/((v2256+1.5))));
+	v2264 = ((v2263*0.999)+(b/((v2257+2.5))));
+	v2265 = ((v2264*0.999)+(b/((v2258+3.5))));
+	v2266 = ((v2265*0.999)+(b/((v2259+4.5))));
+	v2267 = ((v2266*0.999)+(b/((v2260+5.5))));
+	v2268 = ((v2267*0.999)+(b/((v2261+6.5))));
+	v2269 = ((v2268*0.999)+(b/((v2262+7.5))));
+	v2270 = ((v2269*0.999)+(b/((v2263+8.5))));
+	v2271 = ((v2270*0.999)+(b/((v2264+9.5))));
+	v2272 = ((v2271*0.999)+(b/((v2265+10.5))));
+	v2273 = ((v2272*0.999)+(b/((v2266+11.5))));
+	v2274 = ((v2273*0.999)+(b/((v2267+12.5))));
+	v2275 = ((v2274*0.999)+(b/((v2268+0.5))));
+	v2276 = ((v2275*0.999)+(b/((v2269+1.5))));
+	v2277 = ((v2276*0.999)+(b/((v2270+2.5))));
+	v2278 = ((v2277*0.999)+(b/((v2271+3.5))));
+	v2279 = ((v2278*0.999)+(b/((v2272+4.5))));
+	v2280 = ((v2279*0.999)+(b/((v2273+5.5))));
+	v2281 = ((v2280*0.999)+(b/((v2274+6.5))));
+	v2282 = ((v2281*0.999)+(b/((v2275+7.5))));
+	v2283 = ((v2282*0.999)+(b/((v2276+8.5))));
+	v2284 = ((v2283*0.999)+(b/((v2277+9.5))));
+	v2285 = ((v2284*0.999)+(b/((v2278+10.5))));
+	v2286 = ((v2285*0.999)+(b/((v2279+11.5))));
+	v2287 = ((v2286*0.999)+(b/((v2280+12.5))));
+	v2288 = ((v2287*0.999)+(b/((v2281+0.5))));
+	v2289 = ((v2288*0.999)+(b/((v2282+1.5))));
+	v2290 = ((v2289*0.999)+(b/((v2283+2.5))));
+	v2291 = ((v2290*0.999)+(b/((v2284+3.5))));
+	v2292 = ((v2291*0.999)+(b/((v2285+4.5))));
+	v2293 = ((v2292*0.999)+(b/((v2286+5.5))));
+	v2294 = ((v2293*0.999)+(b/((v2287+6.5))));
+	v2295 = ((v2294*0.999)+(b/((v2288+7.5))));
+	v2296 = ((v2295*0.999)+(b/((v2289+8.5))));
+	v2297 = ((v2296*0.999)+(b/((v2290+9.5))));
+	v2298 = ((v2297*0.999)+(b/((v2291+10.5))));
+	v2299 = ((v2298*0.999)+(b/((v2292+11.5))));
+	v2300 = ((v2299*0.999)+(b/((v2293+12.5))));
+	v2301 = ((v2300*0.999)+(b/((v2294+0.5))));
+	v2302 = ((v2301*0.999)+(b/((v2295+1.5))));
+	v2303 = ((v2302*0.999)+(b/((v2296+2.5))));
+	v2304 = ((v2303*0.999)+(b/((v2297+3.5))));
+	v2305 = ((v2304*0.999)+(b/((v2298+4.5))));
+	v2306 = ((v2305*0.999)+(b/((v2299+5.5))));
+	v2307 = ((v2306*0.999)+(b/((v2300+6.5))));
+	v2308 = ((v2307*0.999)+(b/((v2301+7.5))));
+	v2309 = ((v2308*0.999)+(b/((v2302+8.5))));
+	v2310 = ((v2309*0.999)+(b/((v2303+9.5))));
+	v2311 = ((v2310*0.999)+(b/((v2304+10.5))));
+	v2312 = ((v2311*0.999)+(b/((v2305+11.5))));
+	v2313 = ((v2312*0.999)+(b/((v2306+12.5))));
+	v2314 = ((v2313*0.999)+(b/((v2307+0.5))));
+	v2315 = ((v2314*0.999)+(b/((v2308+1.5))));
+	v2316 = ((v2315*0.999)+(b/((v2309+2.5))));
+	v2317 = ((v2316*0.999)+(b/((v2310+3.5))));
+	v2318 = ((v2317*0.999)+(b/((v2311+4.5))));
+	v2319 = ((v2318*0.999)+(b/((v2312+5.5))));
+	v2320 = ((v2319*0.999)+(b/((v2313+6.5))));
+	v2321 = ((v2320*0.999)+(b/((v2314+7.5))));
+	v2322 = ((v2321*0.999)+(b/((v2315+8.5))));
+	v2323 = ((v2322*0.999)+(b/((v2316+9.5))));
+	v2324 = ((v2323*0.999)+(b/((v2317+10.5))));
+	v2325 = ((v2324*0.999)+(b/((v2318+11.5))));
+	v2326 = ((v2325*0.999)+(b/((v2319+12.5))));
+	v2327 = ((v2326*0.999)+(b/((v2320+0.5))));
+	v2328 = ((v2327*0.999)+(b/((v2321+1.5))));
+	v2329 = ((v2328*0.999)+(b/((v2322+2.5))));
+	v2330 = ((v2329*0.999)+(b/((v2323+3.5))));
+	v2331 = ((v2330*0.999)+(b/((v2324+4.5))));
+	v2332 = ((v2331*0.999)+(b/((v2325+5.5))));
+	v2333 = ((v2332*0.999)+(b/((v2326+6.5))));
+	v2334 = ((v2333*0.999)+(b/((v2327+7.5))));
+	v2335 = ((v2334*0.999)+(b/((v2328+8.5))));
+	v2336 = ((v2335*0.999)+(b/((v2329+9.5))));
+	v2337 = ((v2336*0.999)+(b/((v2330+10.5))));
+	v2338 = ((v2337*0.999)+(b/((v2331+11.5))));
+	v2339 = ((v2338*0.999)+(b/((v2332+12.5))));
+	v2340 = ((v2339*0.999)+(b/((v2333+0.5))));
+	v2341 = ((v2340*0.999)+(b/((v2334+1.5))));
+	v2342 = ((v2341*0.999)+(b/((v2335+2.5))));
+	v2343 = ((v2342*0.999)+(b/((v2336+3.5))));
+	v2344 = ((v2343*0.999)+(b/((v2337+4.5))));
+	v2345 = ((v2344*0.999)+(b/((v2338+5.5))));
+	v2346 = ((v2345*0.999)+(b/((v2339+6.5))));
+	v2347 = ((v2346*0.999)+(b/((v2340+7.5))));
+	v2348 = ((v2347*0.999)+(b/((v2341+8.5))));
+	v2349 = ((v2348*0.999)+(b/((v2342+9.5))));
+	v2350 = ((v2349*0.999)+(b/((v2343+10.5))));
+	v2351 = ((v2350*0.999)+(b/((v2344+11.5))));
+	v2352 = ((v2351*0.999)+(b/((v2345+12.5))));
+	v2353 = ((v2352*0.999)+(b/((v2346+0.5))));
+	v2354 = ((v2353*0.999)+(b/((v2347+1.5))));
+	v2355 = ((v2354*0.999)+(b/((v2348+2.5))));
+	v2356 = ((v2355*0.999)+(b/((v2349+3.5))));
+	v2357 = ((v2356*0.999)+(b/((v2350+4.5))));
+	v2358 = ((v2357*0.999)+(b/((v2351+5.5))));
+	v2359 = ((v2358*0.999)+(b/((v2352+6.5))));
+	v2360 = ((v2359*0.999)+(b/((v2353+7.5))));
+	v2361 = ((v2360*0.999)+(b/((v2354+8.5))));
+	v2362 = ((v2361*0.999)+(b/((v2355+9.5))));
+	v2363 = ((v2362*0.999)+(b/((v2356+10.5))));
+	v2364 = ((v2363*0.999)+(b/((v2357+11.5))));
+	v2365 = ((v2364*0.999)+(b/((v2358+12.5))));
+	v2366 = ((v2365*0.999)+(b/((v2359+0.5))));
+	v2367 = ((v2366*0.999)+(b/((v2360+1.5))));
+	v2368 = ((v2367*0.999)+(b/((v2361+2.5))));
+	v2369 = ((v2368*0.999)+(b/((v2362+3.5))));
+	v2370 = ((v2369*0.999)+(b/((v2363+4.5))));
+	v2371 = ((v2370*0.999)+(b/((v2364+5.5))));
+	v2372 = ((v2371*0.999)+(b/((v2365+6.5))));
+	v2373 = ((v2372*0.999)+(b/((v2366+7.5))));
+	v2374 = ((v2373*0.999)+(b/((v2367+8.5))));
+	v2375 = ((v2374*0.999)+(b/((v2368+9.5))));
+	v2376 = ((v2375*0.999)+(b/((v2369+10.5))));
+	v2377 = ((v2376*0.999)+(b/((v2370+11.5))));
+	v2378 = ((v2377*0.999)+(b/((v2371+12.5))));
+	v2379 = ((v2378*0.999)+(b/((v2372+0.5))));
+	v2380 = ((v2379*0.999)+(b/((v2373+1.5))));
+	v2381 = ((v2380*0.999)+(b/((v2374+2.5))));
+	v2382 = ((v2381*0.999)+(b/((v2375+3.5))));
+	v2383 = ((v2382*0.999)+(b/((v2376+4.5))));
+	v2384 = ((v2383*0.999)+(b/((v2377+5.5))));
+	v2385 = ((v2384*0.999)+(b/((v2378+6.5))));
+	v2386 = ((v2385*0.999)+(b/((v2379+7.5))));
+	v2387 = ((v2386*0.999)+(b/((v2380+8.5))));
+	v2388 = ((v2387*0.999)+(b/((v2381+9.5))));
+	v2389 = ((v2388*0.999)+(b/((v2382+10.5))));
+	v2390 = ((v2389*0.999)+(b/((v2383+11.5))));
+	v2391 = ((v2390*0.999)+(b/((v2384+12.5))));
+	v2392 = ((v2391*0.999)+(b/((v2385+0.5))));
+	v2393 = ((v2392*0.999)+(b/((v2386+1.5))));
+	v2394 = ((v2393*0.999)+(b/((v2387+2.5))));
+	v2395 = ((v2394*0.999)+(b/((v2388+3.5))));
+	v2396 = ((v2395*0.999)+(b/((v2389+4.5))));
+	v2397 = ((v2396*0.999)+(b/((v2390+5.5))));
+	v2398 = ((v2397*0.999)+(b/((v2391+6.5))));
+	v2399 = ((v2398*0.999)+(b/((v2392+7.5))));
+	v2400 = ((v2399*0.999)+(b/((v2393+8.5))));
+	v2401 = ((v2400*0.999)+(b/((v2394+9.5))));
+	v2402 = ((v2401*0.999)+(b/((v2395+10.5))));
+	v2403 = ((v2402*0.999)+(b/((v2396+11.5))));
+	v2404 = ((v2403*0.999)+(b/((v2397+12.5))));
+	v2405 = ((v2404*0.999)+(b/((v2398+0.5))));
+	v2406 = ((v2405*0.999)+(b/((v2399+1.5))));
+	v2407 = ((v2406*0.999)+(b/((v2400+2.5))));
+	v2408 = ((v2407*0.999)+(b/((v2401+3.5))));
+	v2409 = ((v2408*0.999)+(b/((v2402+4.5))));
+	v2410 = ((v2409*0.999)+(b/((v2403+5.5))));
+	v2411 = ((v2410*0.999)+(b/((v2404+6.5))));
+	v2412 = ((v2411*0.999)+(b/((v2405+7.5))));
+	v2413 = ((v2412*0.999)+(b/((v2406+8.5))));
+	v2414 = ((v2413*0.999)+(b/((v2407+9.5))));
+	v2415 = ((v2414*0.999)+(b/((v2408+10.5))));
+	v2416 = ((v2415*0.999)+(b/((v2409+11.5))));
+	v2417 = ((v2416*0.999)+(b/((v2410+12.5))));
+	v2418 = ((v2417*0.999)+(b/((v2411+0.5))));
+	v2419 = ((v2418*0.999)+(b/((v2412+1.5))));
+	v2420 = ((v2419*0.999)+(b/((v2413+2.5))));
+	v2421 = ((v2420*0.999)+(b/((v2414+3.5))));
+	v2422 = ((v2421*0.999)+(b/((v2415+4.5))));
+	v2423 = ((v2422*0.999)+(b/((v2416+5.5))));
+	v2424 = ((v2423*0.999)+(b/((v2417+6.5))));
+	v2425 = ((v2424*0.999)+(b/((v2418+7.5))));
+	v2426 = ((v2425*0.999)+(b/((v2419+8.5))));
+	v2427 = ((v2426*0.999)+(b/((v2420+9.5))));
+	v2428 = ((v2427*0.999)+(b/((v2421+10.5))));
+	v2429 = ((v2428*0.999)+(b/((v2422+11.5))));
+	v2430 = ((v2429*0.999)+(b/((v2423+12.5))));
+	v2431 = ((v2430*0.999)+(b/((v2424+0.5))));
+	v2432 = ((v2431*0.999)+(b/((v2425+1.5))));
+	v2433 = ((v2432*0.999)+(b/((v2426+2.5))));
+	v2434 = ((v2433*0.999)+(b/((v2427+3.5))));
+	v2435 = ((v2434*0.999)+(b/((v2428+4.5))));
+	v2436 = ((v2435*0.999)+(b/((v2429+5.5))));
+	v2437 = ((v2436*0.999)+(b/((v2430+6.5))));
+	v2438 = ((v2437*0.999)+(b/((v2431+7.5))));
+	v2439 = ((v2438*0.999)+(b/((v2432+8.5))));
+	v2440 = ((v2439*0.999)+(b/((v2433+9.5))));
+	v2441 = ((v2440*0.999)+(b/((v2434+10.5))));
+	v2442 = ((v2441*0.999)+(b/((v2435+11.5))));
+	v2443 = ((v2442*0.999)+(b/((v2436+12.5))));
+	v2444 = ((v2443*0.999)+(b/((v2437+0.5))));
+	v2445 = ((v2444*0.999)+(b/((v2438+1.5))));
+	v2446 = ((v2445*0.999)+(b/((v2439+2.5))));
+	v2447 = ((v2446*0.999)+(b/((v2440+3.5))));
+	v2448 = ((v2447*0.999)+(b/((v2441+4.5))));
+	v2449 = ((v2448*0.999)+(b/((v2442+5.5))));
+	v2450 = ((v2449*0.999)+(b/((v2443+6.5))));
+	v2451 = ((v2450*0.999)+(b/((v2444+7.5))));
+	v2452 = ((v2451*0.999)+(b/((v2445+8.5))));
+	v2453 = ((v2452*0.999)+(b/((v2446+9.5))));
+	v2454 = ((v2453*0.999)+(b/((v2447+10.5))));
+	v2455 = ((v2454*0.999)+(b/((v2448+11.5))));
+	v2456 = ((v2455*0.999)+(b/((v2449+12.5))));
+	v2457 = ((v2456*0.999)+(b/((v2450+0.5))));
+	v2458 = ((v2457*0.999)+(b/((v2451+1.5))));
+	v2459 = ((v2458*0.999)+(b/((v2452+2.5))));
+	v2460 = ((v2459*0.999)+(b/((v2453+3.5))));
+	v2461 = ((v2460*0.999)+(b/((v2454+4.5))));
+	v2462 = ((v2461*0.999)+(b/((v2455+5.5))));
+	v2463 = ((v2462*0.999)+(b/((v2456+6.5))));
+	v2464 = ((v2463*0.999)+(b/((v2457+7.5))));
+	v2465 = ((v2464*0.999)+(b/((v2458+8.5))));
+	v2466 = ((v2465*0.999)+(b/((v2459+9.5))));
+	v2467 = ((v2466*0.999)+(b/((v2460+10.5))));
+	v2468 = ((v2467*0.999)+(b/((v2461+11.5))));
+	v2469 = ((v2468*0.999)+(b/((v2462+12.5))));
+	v2470 = ((v2469*0.999)+(b/((v2463+0.5))));
+	v2471 = ((v2470*0.999)+(b/((v2464+1.5))));
+	v2472 = ((v2471*0.999)+(b/((v2465+2.5))));
+	v2473 = ((v2472*0.999)+(b/((v2466+3.5))));
+	v2474 = ((v2473*0.999)+(b/((v2467+4.5))));
+	v2475 = ((v2474*0.999)+(b/((v2468+5.5))));
+	v2476 = ((v2475*0.999)+(b/((v2469+6.5))));
+	v2477 = ((v2476*0.999)+(b/((v2470+7.5))));
+	v2478 = ((v2477*0.999)+(b/((v2471+8.5))));
+	v2479 = ((v2478*0.999)+(b/((v2472+9.5))));
+	v2480 = ((v2479*0.999)+(b/((v2473+10.5))));
+	v2481 = ((v2480*0.999)+(b/((v2474+11.5))));
+	v2482 = ((v2481*0.999)+(b/((v2475+12.5))));
+	v2483 = ((v2482*0.999)+(b/((v2476+0.5))));
+	v2484 = ((v2483*0.999)+(b/((v2477+1.5))));
+	v2485 = ((v2484*0.999)+(b/((v2478+2.5))));
+	v2486 = ((v2485*0.999)+(b/((v2479+3.5))));
+	v2487 = ((v2486*0.999)+(b/((v2480+4.5))));
+	v2488 = ((v2487*0.999)+(b/((v2481+5.5))));
+	v2489 = ((v2488*0.999)+(b/((v2482+6.5))));
+	v2490 = ((v2489*0.999)+(b/((v2483+7.5))));
+	v2491 = ((v2490*0.999)+(b/((v2484+8.5))));
+	v2492 = ((v2491*0.999)+(b/((v2485+9.5))));
+	v2493 = ((v2492*0.999)+(b/((v2486+10.5))));
+	v2494 = ((v2493*0.999)+(b/((v2487+11.5))));
+	v2495 = ((v2494*0.999)+(b/((v2488+12.5))));
+	v2496 = ((v2495*0.999)+(b/((v2489+0.5))));
+	v2497 = ((v2496*0.999)+(b/((v2490+1.5))));
+	v2498 = ((v2497*0.999)+(b/((v2491+2.5))));
+	v2499 = ((v2498*0.999)+(b/((v2492+3.5))));
+	v2500 = ((v2499*0.999)+(b/((v2493+4.5))));
+	v2501 = ((v2500*0.999)+(b/((v2494+5.5))));
+	v2502 = ((v2501*0.999)+(b/((v2495+6.5))));
+	v2503 = ((v2502*0.999)+(b/((v2496+7.5))));
+	v2504 = ((v2503*0.999)+(b/((v2497+8.5))));
+	v2505 = ((v2504*0.999)+(b/((v2498+9.5))));
+	v2506 = ((v2505*0.999)+(b/((v2499+10.5))));
+	v2507 = ((v2506*0.999)+(b/((v2500+11.5))));
+	v2508 = ((v2507*0.999)+(b/((v2501+12.5))));
+	v2509 = ((v2508*0.999)+(b/((v2502+0.5))));
+	v2510 = ((v2509*0.999)+(b/((v2503+1.5))));
+	v2511 = ((v2510*0.999)+(b/((v2504+2.5))));
+	v2512 = ((v2511*0.999)+(b/((v2505+3.5))));
+	v2513 = ((v2512*0.999)+(b/((v2506+4.5))));
+	v2514 = ((v2513*0.999)+(b/((v2507+5.5))));
+	v2515 = ((v2514*0.999)+(b/((v2508+6.5))));
+	v2516 = ((v2515*0.999)+(b/((v2509+7.5))));
+	v2517 = ((v2516*0.999)+(b/((v2510+8.5))));
+	v2518 = ((v2517*0.999)+(b/((v2511+9.5))));
+	v2519 = ((v2518*0.999)+(b/((v2512+10.5))));
+	v2520 = ((v2519*0.999)+(b/((v2513+11.5))));
+	v2521 = ((v2520*0.999)+(b/((v2514+12.5))));
+	v2522 = ((v2521*0.999)+(b/((v2515+0.5))));
+	v2523 = ((v2522*0.999)+(b/((v2516+1.5))));
+	v2524 = ((v2523*0.999)+(b/((v2517+2.5))));
+	v2525 = ((v2524*0.999)+(b/((v2518+3.5))));
+	v2526 = ((v2525*0.999)+(b/((v2519+4.5))));
+	v2527 = ((v2526*0.999)+(b/((v2520+5.5))));
+	v2528 = ((v2527*0.999)+(b/((v2521+6.5))));
+	v2529 = ((v2528*0.999)+(b/((v2522+7.5))));
+	v2530 = ((v2529*0.999)+(b/((v2523+8.5))));
+	v2531 = ((v2530*0.999)+(b/((v2524+9.5))));
+	v2532 = ((v2531*0.999)+(b/((v2525+10.5))));
+	v2533 = ((v2532*0.999)+(b/((v2526+11.5))));
+	v2534 = ((v2533*0.999)+(b/((v2527+12.5))));
+	v2535 = ((v2534*0.999)+(b/((v2528+0.5))));
+	v2536 = ((v2535*0.999)+(b/((v2529+1.5))));
+	v2537 = ((v2536*0.999)+(b/((v2530+2.5))));
+	v2538 = ((v2537*0.999)+(b/((v2531+3.5))));
+	v2539 = ((v2538*0.999)+(b/((v2532+4.5))));
+	v2540 = ((v2539*0.999)+(b/((v2533+5.5))));
+	v2541 = ((v2540*0.999)+(b/((v2534+6.5))));
+	v2542 = ((v2541*0.999)+(b/((v2535+7.5))));
+	v2543 = ((v2542*0.999)+(b/((v2536+8.5))));
+	v2544 = ((v2543*0.999)+(b/((v2537+9.5))));
+	v2545 = ((v2544*0.999)+(b/((v2538+10.5))));
+	v2546 = ((v2545*0.999)+(b/((v2539+11.5))));
+	v2547 = ((v2546*0.999)+(b/((v2540+12.5))));
+	v2548 = ((v2547*0.999)+(b/((v2541+0.5))));
+	v2549 = ((v2548*0.999)+(b/((v2542+1.5))));
+	v2550 = ((v2549*0.999)+(b/((v2543+2.5))));
+	v2551 = ((v2550*0.999)+(b/((v2544+3.5))));
+	v2552 = ((v2551*0.999)+(b/((v2545+4.5))));
+	v2553 = ((v2552*0.999)+(b/((v2546+5.5))));
+	v2554 = ((v2553*0.999)+(b/((v2547+6.5))));
+	v2555 = ((v2554*0.999)+(b/((v2548+7.5))));
+	v2556 = ((v2555*0.999)+(b/((v2549+8.5))));
+	v2557 = ((v2556*0.999)+(b/((v2550+9.5))));
+	v2558 = ((v2557*0.999)+(b/((v2551+10.5))));
+	v2559 = ((v2558*0.999)+(b/((v2552+11.5))));
+	v2560 = ((v2559*0.999)+(b/((v2553+12.5))));
+	v2561 = ((v2560*0.999)+(b/((v2554+0.5))));
+	v2562 = ((v2561*0.999)+(b/((v2555+1.5))));
+	v2563 = ((v2562*0.999)+(b/((v2556+2.5))));
+	v2564 = ((v2563*0.999)+(b/((v2557+3.5))));
+	v2565 = ((v2564*0.999)+(b/((v2558+4.5))));
+	v2566 = ((v2565*0.999)+(b/((v2559+5.5))));
+	v2567 = ((v2566*0.999)+(b/((v2560+6.5))));
+	v2568 = ((v2567*0.999)+(b/((v2561+7.5))));
+	v2569 = ((v2568*0.999)+(b/((v2562+8.5))));
+	v2570 = ((v2569*0.999)+(b/((v2563+9.5))));
+	v2571 = ((v2570*0.999)+(b/((v2564+10.5))));
+	v2572 = ((v2571*0.999)+(b/((v2565+11.5))));
+	v2573 = ((v2572*0.999)+(b/((v2566+12.5))));
+	v2574 = ((v2573*0.999)+(b/((v2567+0.5))));
+	v2575 = ((v2574*0.999)+(b/((v2568+1.5))));
+	v2576 = ((v2575*0.999)+(b/((v2569+2.5))));
+	v2577 = ((v2576*0.999)+(b/((v2570+3.5))));
+	v2578 = ((v2577*0.999)+(b/((v2571+4.5))));
+	v2579 = ((v2578*0.999)+(b/((v2572+5.5))));
+	v2580 = ((v2579*0.999)+(b/((v2573+6.5))));
+	v2581 = ((v2580*0.999)+(b/((v2574+7.5))));
+	v2582 = ((v2581*0.999)+(b/((v2575+8.5))));
+	v2583 = ((v2582*0.999)+(b/((v2576+9.5))));
+	v2584 = ((v2583*0.999)+(b/((v2577+10.5))));
+	v2585 = ((v2584*0.999)+(b/((v2578+11.5))));
+	v2586 = ((v2585*0.999)+(b/((v2579+12.5))));
+	v2587 = ((v2586*0.999)+(b/((v2580+0.5))));
+	v2588 = ((v2587*0.999)+(b/((v2581+1.5))));
+	v2589 = ((v2588*0.999)+(b/((v2582+2.5))));
+	v2590 = ((v2589*0.999)+(b/((v2583+3.5))));
+	v2591 = ((v2590*0.999)+(b/((v2584+4.5))));
+	v2592 = ((v2591*0.999)+(b/((v2585+5.5))));
+	v2593 = ((v2592*0.999)+(b/((v2586+6.5))));
+	v2594 = ((v2593*0.999)+(b/((v2587+7.5))));
+	v2595 = ((v2594*0.999)+(b/((v2588+8.5))));
+	v2596 = ((v2595*0.999)+(b/((v2589+9.5))));
+	v2597 = ((v2596*0.999)+(b/((v2590+10.5))));
+	v2598 = ((v2597*0.999)+(b/((v2591+11.5))));
+	v2599 = ((v2598*0.999)+(b/((v2592+12.5))));
+	v2600 = ((v2599*0.999)+(b/((v2593+0.5))));
+	v2601 = ((v2600*0.999)+(b/((v2594+1.5))));
+	v2602 = ((v2601*0.999)+(b/((v2595+2.5))));
+	v2603 = ((v2602*0.999)+(b/((v2596+3.5))));
+	v2604 = ((v2603*0.999)+(b/((v2597+4.5))));
+	v2605 = ((v2604*0.999)+(b/((v2598+5.5))));
+	v2606 = ((v2605*0.999)+(b/((v2599+6.5))));
+	v2607 = ((v2606*0.999)+(b/((v2600+7.5))));
+	v2608 = ((v2607*0.999)+(b/((v2601+8.5))));
+	v2609 = ((v2608*0.999)+(b/((v2602+9.5))));
+	v2610 = ((v2609*0.999)+(b/((v2603+10.5))));
+	v2611 = ((v2610*0.999)+(b/((v2604+11.5))));
+	v2612 = ((v2611*0.999)+(b/((v2605+12.5))));
+	v2613 = ((v2612*0.999)+(b/((v2606+0.5))));
+	v2614 = ((v2613*0.999)+(b/((v2607+1.5))));
+	v2615 = ((v2614*0.999)+(b/((v2608+2.5))));
+	v2616 = ((v2615*0.999)+(b/((v2609+3.5))));
+	v2617 = ((v2616*0.999)+(b/((v2610+4.5))));
+	v2618 = ((v2617*0.999)+(b/((v2611+5.5))));
+	v2619 = ((v2618*0.999)+(b/((v2612+6.5))));
+	v2620 = ((v2619*0.999)+(b/((v2613+7.5))));
+	v2621 = ((v2620*0.999)+(b/((v2614+8.5))));
+	v2622 = ((v2621*0.999)+(b/((v2615+9.5))));
+	v2623 = ((v2622*0.999)+(b/((v2616+10.5))));
+	v2624 = ((v2623*0.999)+(b/((v2617+11.5))));
+	v2625 = ((v2624*0.999)+(b/((v2618+12.5))));
+	v2626 = ((v2625*0.999)+(b/((v2619+0.5))));
+	v2627 = ((v2626*0.999)+(b/((v2620+1.5))));
+	v2628 = ((v2627*0.999)+(b/((v2621+2.5))));
+	v2629 = ((v2628*0.999)+(b/((v2622+3.5))));
+	v2630 = ((v2629*0.999)+(b/((v2623+4.5))));
+	v2631 = ((v2630*0.999)+(b/((v2624+5.5))));
+	v2632 = ((v2631*0.999)+(b/((v2625+6.5))));
+	v2633 = ((v2632*0.999)+(b/((v2626+7.5))));
+	v2634 = ((v2633*0.999)+(b/((v2627+8.5))));
+	v2635 = ((v2634*0.999)+(b/((v2628+9.5))));
+	v2636 = ((v2635*0.999)+(b/((v2629+10.5))));
+	v2637 = ((v2636*0.999)+(b/((v2630+11.5))));
+	v2638 = ((v2637*0.999)+(b/((v2631+12.5))));
+	v2639 = ((v2638*0.999)+(b/((v2632+0.5))));
+	v2640 = ((v2639*0.999)+(b/((v2633+1.5))));
+	v2641 = ((v2640*0.999)+(b/((v2634+2.5))));
+	v2642 = ((v2641*0.999)+(b/((v2635+3.5))));
+	v2643 = ((v2642*0.999)+(b/((v2636+4.5))));
+	v2644 = ((v2643*0.999)+(b/((v2637+5.5))));
+	v2645 = ((v2644*0.999)+(b/((v2638+6.5))));
+	v2646 = ((v2645*0.999)+(b/((v2639+7.5))));
+	v2647 = ((v2646*0.999)+(b/((v2640+8.5))));
+	v2648 = ((v2647*0.999)+(b/((v2641+9.5))));
+	v2649 = ((v2648*0.999)+(b/((v2642+10.5))));
+	v2650 = ((v2649*0.999)+(b/((v2643+11.5))));
+	v2651 = ((v2650*0.999)+(b/((v2644+12.5))));
+	v2652 = ((v2651*0.999)+(b/((v2645+0.5))));
+	v2653 = ((v2652*0.999)+(b/((v2646+1.5))));
+	v2654 = ((v2653*0.999)+(b/((v2647+2.5))));
+	v2655 = ((v2654*0.999)+(b/((v2648+3.5))));
+	v2656 = ((v2655*0.999)+(b/((v2649+4.5))));
+	v2657 = ((v2656*0.999)+(b/((v2650+5.5))));
+	v2658 = ((v2657*0.999)+(b/((v2651+6.5))));
+	v2659 = ((v2658*0.999)+(b/((v2652+7.5))));
+	v2660 = ((v2659*0.999)+(b/((v2653+8.5))));
+	v2661 = ((v2660*0.999)+(b/((v2654+9.5))));
+	v2662 = ((v2661*0.999)+(b/((v2655+10.5))));
+	v2663 = ((v2662*0.999)+(b/((v2656+11.5))));
+	v2664 = ((v2663*0.999)+(b/((v2657+12.5))));
+	v2665 = ((v2664*0.999)+(b/((v2658+0.5))));
+	v2666 = ((v2665*0.999)+(b/((v2659+1.5))));
+	v2667 = ((v2666*0.999)+(b/((v2660+2.5))));
+	v2668 = ((v2667*0.999)+(b/((v2661+3.5))));
+	v2669 = ((v2668*0.999)+(b/((v2662+4.5))));
+	v2670 = ((v2669*0.999)+(b/((v2663+5.5))));
+	v2671 = ((v2670*0.999)+(b/((v2664+6.5))));
+	v2672 = ((v2671*0.999)+(b/((v2665+7.5))));
+	v2673 = ((v2672*0.999)+(b/((v2666+8.5))));
+	v2674 = ((v2673*0.999)+(b/((v2667+9.5))));
+	v2675 = ((v2674*0.999)+(b/((v2668+10.5))));
+	v2676 = ((v2675*0.999)+(b/((v2669+11.5))));
+	v2677 = ((v2676*0.999)+(b/((v2670+12.5))));
+	v2678 = ((v2677*0.999)+(b/((v2671+0.5))));
+	v2679 = ((v2678*0.999)+(b/((v2672+1.5))));
+	v2680 = ((v2679*0.999)+(b/((v2673+2.5))));
+	v2681 = ((v2680*0.999)+(b/((v2674+3.5))));
+	v2682 = ((v2681*0.999)+(b/((v2675+4.5))));
+	v2683 = ((v2682*0.999)+(b/((v2676+5.5))));
+	v2684 = ((v2683*0.999)+(b/((v2677+6.5))));
+	v2685 = ((v2684*0.999)+(b/((v2678+7.5))));
+	v2686 = ((v2685*0.999)+(b/((v2679+8.5))));
+	v2687 = ((v2686*0.999)+(b/((v2680+9.5))));
+	v2688 = ((v2687*0.999)+(b/((v2681+10.5))));
+	v2689 = ((v2688*0.999)+(b/((v2682+11.5))));
+	v2690 = ((v2689*0.999)+(b/((v2683+12.5))));
+	v2691 = ((v2690*0.999)+(b/((v2684+0.5))));
+	v2692 = ((v2691*0.999)+(b/((v2685+1.5))));
+	v2693 = ((v2692*0.999)+(b/((v2686+2.5))));
+	v2694 = ((v2693*0.999)+(b/((v2687+3.5))));
+	v2695 = ((v2694*0.999)+(b/((v2688+4.5))));
+	v2696 = ((v2695*0.999)+(b/((v2689+5.5))));
+	v2697 = ((v2696*0.999)+(b/((v2690+6.5))));
+	v2698 = ((v2697*0.999)+(b/((v2691+7.5))));
+	v2699 = ((v2698*0.999)+(b/((v2692+8.5))));
+	v2700 = ((v2699*0.999)+(b/((v2693+9.5))));
+	v2701 = ((v2700*0.999)+(b/((v2694+10.5))));
+	v2702 = ((v2701*0.999)+(b/((v2695+11.5))));
+	v2703 = ((v2702*0.999)+(b/((v2696+12.5))));
+	v2704 = ((v2703*0.999)+(b/((v2697+0.5))));
+	v2705 = ((v2704*0.999)+(b/((v2698+1.5))));
+	v2706 = ((v2705*0.999)+(b/((v2699+2.5))));
+	v2707 = ((v2706*0.999)+(b/((v2700+3.5))));
+	v2708 = ((v2707*0.999)+(b/((v2701+4.5))));
+	v2709 = ((v2708*0.999)+(b/((v2702+5.5))));
+	v2710 = ((v2709*0.999)+(b/((v2703+6.5))));
+	v2711 = ((v2710*0.999)+(b/((v2704+7.5))));
+	v2712 = ((v2711*0.999)+(b/((v2705+8.5))));
+	v2713 = ((v2712*0.999)+(b/((v2706+9.5))));
+	v2714 = ((v2713*0.999)+(b/((v2707+10.5))));
+	v2715 = ((v2714*0.999)+(b/((v2708+11.5))));
+	v2716 = ((v2715*0.999)+(b/((v2709+12.5))));
+	v2717 = ((v2716*0.999)+(b/((v2710+0.5))));
+	v2718 = ((v2717*0.999)+(b/((v2711+1.5))));
+	v2719 = ((v2718*0.999)+(b/((v2712+2.5))));
+	v2720 = ((v2719*0.999)+(b/((v2713+3.5))));
+	v2721 = ((v2720*0.999)+(b/((v2714+4.5))));
+	v2722 = ((v2721*0.999)+(b/((v2715+5.5))));
+	v2723 = ((v2722*0.999)+(b/((v2716+6.5))));
+	v2724 = ((v2723*0.999)+(b/((v2717+7.5))));
+	v2725 = ((v2724*0.999)+(b/((v2718+8.5))));
+	v2726 = ((v2725*0.999)+(b/((v2719+9.5))));
+	v2727 = ((v2726*0.999)+(b/((v2720+10.5))));
+	v2728 = ((v2727*0.999)+(b/((v2721+11.5))));
+	v2729 = ((v2728*0.999)+(b/((v2722+12.5))));
+	v2730 = ((v2729*0.999)+(b/((v2723+0.5))));
+	v2731 = ((v2730*0.999)+(b/((v2724+1.5))));
+	v2732 = ((v2731*0.999)+(b/((v2725+2.5))));
+	v2733 = ((v2732*0.999)+(b/((v2726+3.5))));
+	v2734 = ((v2733*0.999)+(b/((v2727+4.5))));
+	v2735 = ((v2734*0.999)+(b/((v2728+5.5))));
+	v2736 = ((v2735*0.999)+(b/((v2729+6.5))));
+	v2737 = ((v2736*0.999)+(b/((v2730+7.5))));
+	v2738 = ((v2737*0.999)+(b/((v2731+8.5))));
+	v2739 = ((v2738*0.999)+(b/((v2732+9.5))));
+	v2740 = ((v2739*0.999)+(b/((v2733+10.5))));
+	v2741 = ((v2740*0.999)+(b/((v2734+11.5))));
+	v2742 = ((v2741*0.999)+(b/((v2735+12.5))));
+	v2743 = ((v2742*0.999)+(b/((v2736+0.5))));
+	v2744 = ((v2743*0.999)+(b/((v2737+1.5))));
+	v2745 = ((v2744*0.999)+(b/((v2738+2.5))));
+	v2746 = ((v2745*0.999)+(b/((v2739+3.5))));
+	v2747 = ((v2746*0.999)+(b/((v2740+4.5))));
+	v2748 = ((v2747*0.999)+(b/((v2741+5.5))));
+	v2749 = ((v2748*0.999)+(b/((v2742+6.5))));
+	v2750 = ((v2749*0.999)+(b/((v2743+7.5))));
+	v2751 = ((v2750*0.999)+(b/((v2744+8.5))));
+	v2752 = ((v2751*0.999)+(b/((v2745+9.5))));
+	v2753 = ((v2752*0.999)+(b/((v2746+10.5))));
+	v2754 = ((v2753*0.999)+(b/((v2747+11.5))));
+	v2755 = ((v2754*0.999)+(b/((v2748+12.5))));
+	v2756 = ((v2755*0.999)+(b/((v2749+0.5))));
+	v2757 = ((v2756*0.999)+(b/((v2750+1.5))));
+	v2758 = ((v2757*0.999)+(b/((v2751+2.5))));
+	v2759 = ((v2758*0.999)+(b/((v2752+3.5))));
+	v2760 = ((v2759*0.999)+(b/((v2753+4.5))));
+	v2761 = ((v2760*0.999)+(b/((v2754+5.5))));
+	v2762 = ((v2761*0.999)+(b/((v2755+6.5))));
+	v2763 = ((v2762*0.999)+(b/((v2756+7.5))));
+	v2764 = ((v2763*0.999)+(b/((v2757+8.5))));
+	v2765 = ((v2764*0.999)+(b/((v2758+9.5))));
+	v2766 = ((v2765*0.999)+(b/((v2759+10.5))));
+	v2767 = ((v2766*0.999)+(b/((v2760+11.5))));
+	v2768 = ((v2767*0.999)+(b/((v2761+12.5))));
+	v2769 = ((v2768*0.999)+(b/((v2762+0.5))));
+	v2770 = ((v2769*0.999)+(b/((v2763+1.5))));
+	v2771 = ((v2770*0.999)+(b/((v2764+2.5))));
+	v2772 = ((v2771*0.999)+(b/((v2765+3.5))));
+	v2773 = ((v2772*0.999)+(b/((v2766+4.5))));
+	v2774 = ((v2773*0.999)+(b/((v2767+5.5))));
+	v2775 = ((v2774*0.999)+(b/((v2768+6.5))));
+	v2776 = ((v2775*0.999)+(b/((v2769+7.5))));
+	v2777 = ((v2776*0.999)+(b/((v2770+8.5))));
+	v2778 = ((v2777*0.999)+(b/((v2771+9.5))));
+	v2779 = ((v2778*0.999)+(b/((v2772+10.5))));
+	v2780 = ((v2779*0.999)+(b/((v2773+11.5))));
+	v2781 = ((v2780*0.999)+(b/((v2774+12.5))));
+	v2782 = ((v2781*0.999)+(b/((v2775+0.5))));
+	v2783 = ((v2782*0.999)+(b/((v2776+1.5))));
+	v2784 = ((v2783*0.999)+(b/((v2777+2.5))));
+	v2785 = ((v2784*0.999)+(b/((v2778+3.5))));
+	v2786 = ((v2785*0.999)+(b/((v2779+4.5))));
+	v2787 = ((v2786*0.999)+(b/((v2780+5.5))));
+	v2788 = ((v2787*0.999)+(b/((v2781+6.5))));
+	v2789 = ((v2788*0.999)+(b/((v2782+7.5))));
+	v2790 = ((v2789*0.999)+(b/((v2783+8.5))));
+	v2791 = ((v2790*0.999)+(b/((v2784+9.5))));
+	v2792 = ((v2791*0.999)+(b/((v2785+10.5))));
+	v2793 = ((v2792*0.999)+(b/((v2786+11.5))));
+	v2794 = ((v2793*0.999)+(b/((v2787+12.5))));
+	v2795 = ((v2794*0.999)+(b/((v2788+0.5))));
+	v2796 = ((v2795*0.999)+(b/((v2789+1.5))));
+	v2797 = ((v2796*0.999)+(b/((v2790+2.5))));
+	v2798 = ((v2797*0.999)+(b/((v2791+3.5))));
+	v2799 = ((v2798*0.999)+(b/((v2792+4.5))));
+	v2800 = ((v2799*0.999)+(b/((v2793+5.5))));
+	v2801 = ((v2800*0.999)+(b/((v2794+6.5))));
+	v2802 = ((v2801*0.999)+(b/((v2795+7.5))));
+	v2803 = ((v2802*0.999)+(b/((v2796+8.5))));
+	v2804 = ((v2803*0.999)+(b/((v2797+9.5))));
+	v2805 = ((v2804*0.999)+(b/((v2798+10.5))));
+	v2806 = ((v2805*0.999)+(b/((v2799+11.5))));
+	v2807 = ((v2806*0.999)+(b/((v2800+12.5))));
+	v2808 = ((v2807*0.999)+(b/((v2801+0.5))));
+	v2809 = ((v2808*0.999)+(b/((v2802+1.5))));
+	v2810 = ((v2809*0.999)+(b/((v2803+2.5))));
+	v2811 = ((v2810*0.999)+(b/((v2804+3.5))));
+	v2812 = ((v2811*0.999)+(b/((v2805+4.5))));
+	v2813 = ((v2812*0.999)+(b/((v2806+5.5))));
+	v2814 = ((v2813*0.999)+(b/((v2807+6.5))));
+	v2815 = ((v2814*0.999)+(b/((v2808+7.5))));
+	v2816 = ((v2815*0.999)+(b/((v2809+8.5))));
+	v2817 = ((v2816*0.999)+(b/((v2810+9.5))));
+	v2818 = ((v2817*0.999)+(b/((v2811+10.5))));
+	v2819 = ((v2818*0.999)+(b/((v2812+11.5))));
+	v2820 = ((v2819*0.999)+(b/((v2813+12.5))));
+	v2821 = ((v2820*0.999)+(b/((v2814+0.5))));
+	v2822 = ((v2821*0.999)+(b/((v2815+1.5))));
+	v2823 = ((v2822*0.999)+(b/((v2816+2.5))));
+	v2824 = ((v2823*0.999)+(b/((v2817+3.5))));
+	v2825 = ((v2824*0.999)+(b/((v2818+4.5))));
+	v2826 = ((v2825*0.999)+(b/((v2819+5.5))));
+	v2827 = ((v2826*0.999)+(b/((v2820+6.5))));
+	v2828 = ((v2827*0.999)+(b/((v2821+7.5))));
+	v2829 = ((v2828*0.999)+(b/((v2822+8.5))));
+	v2830 = ((v2829*0.999)+(b/((v2823+9.5))));
+	v2831 = ((v2830*0.999)+(b/((v2824+10.5))));
+	v2832 = ((v2831*0.999)+(b/((v2825+11.5))));
+	v2833 = ((v2832*0.999)+(b/((v2826+12.5))));
+	v2834 = ((v2833*0.999)+(b/((v2827+0.5))));
+	v2835 = ((v2834*0.999)+(b/((v2828+1.5))));
+	v2836 = ((v2835*0.999)+(b/((v2829+2.5))));
+	v2837 = ((v2836*0.999)+(b/((v2830+3.5))));
+	v2838 = ((v2837*0.999)+(b/((v2831+4.5))));
+	v2839 = ((v2838*0.999)+(b/((v2832+5.5))));
+	v2840 = ((v2839*0.999)+(b/((v2833+6.5))));
+	v2841 = ((v2840*0.999)+(b/((v2834+7.5))));
+	v2842 = ((v2841*0.999)+(b/((v2835+8.5))));
+	v2843 = ((v2842*0.999)+(b/((v2836+9.5))));
+	v2844 = ((v2843*0.999)+(b/((v2837+10.5))));
+	v2845 = ((v2844*0.999)+(b/((v2838+11.5))));
+	v2846 = ((v2845*0.999)+(b/((v2839+12.5))));
+	v2847 = ((v2846*0.999)+(b/((v2840+0.5))));
+	v2848 = ((v2847*0.999)+(b/((v2841+1.5))));
+	v2849 = ((v2848*0.999)+(b/((v2842+2.5))));
+	v2850 = ((v2849*0.999)+(b/((v2843+3.5))));
+	v2851 = ((v2850*0.999)+(b/((v2844+4.5))));
+	v2852 = ((v2851*0.999)+(b/((v2845+5.5))));
+	v2853 = ((v2852*0.999)+(b/((v2846+6.5))));
+	v2854 = ((v2853*0.999)+(b/((v2847+7.5))));
+	v2855 = ((v2854*0.999)+(b/((v2848+8.5))));
+	v2856 = ((v2855*0.999)+(b/((v2849+9.5))));
+	v2857 = ((v2856*0.999)+(b/((v2850+10.5))));
+	v2858 = ((v2857*0.999)+(b/((v2851+11.5))));
+	v2859 = ((v2858*0.999)+(b/((v2852+12.5))));
+	v2860 = ((v2859*0.999)+(b/((v2853+0.5))));
+	v2861 = ((v2860*0.999)+(b/((v2854+1.5))));
+	v2862 = ((v2861*0.999)+(b/((v2855+2.5))));
+	v2863 = ((v2862*0.999)+(b/((v2856+3.5))));
+	v2864 = ((v2863*0.999)+(b/((v2857+4.5))));
+	v2865 = ((v2864*0.999)+(b/((v2858+5.5))));
+	v2866 = ((v2865*0.999)+(b/((v2859+6.5))));
+	v2867 = ((v2866*0.999)+(b/((v2860+7.5))));
+	v2868 = ((v2867*0.999)+(b/((v2861+8.5))));
+	v2869 = ((v2868*0.999)+(b/((v2862+9.5))));
+	v2870 = ((v2869*0.999)+(b/((v2863+10.5))));
+	v2871 = ((v2870*0.999)+(b/((v2864+11.5))));
+	v2872 = ((v2871*0.999)+(b/((v2865+12.5))));
+	v2873 = ((v2872*0.999)+(b/((v2866+0.5))));
+	v2874 = ((v2873*0.999)+(b/((v2867+1.5))));
+	v2875 = ((v2874*0.999)+(b/((v2868+2.5))));
+	v2876 = ((v2875*0.999)+(b/((v2869+3.5))));
+	v2877 = ((v2876*0.999)+(b/((v2870+4.5))));
+	v2878 = ((v2877*0.999)+(b/((v2871+5.5))));
+	v2879 = ((v2878*0.999)+(b/((v2872+6.5))));
+	v2880 = ((v2879*0.999)+(b/((v2873+7.5))));
+	v2881 = ((v2880*0.999)+(b/((v2874+8.5))));
+	v2882 = ((v2881*0.999)+(b/((v2875+9.5))));
+	v2883 = ((v2882*0.999)+(b/((v2876+10.5))));
+	v2884 = ((v2883*0.999)+(b/((v2877+11.5))));
+	v2885 = ((v2884*0.999)+(b/((v2878+12.5))));
+	v2886 = ((v2885*0.999)+(b/((v2879+0.5))));
+	v2887 = ((v2886*0.999)+(b/((v2880+1.5))));
+	v2888 = ((v2887*0.999)+(b/((v2881+2.5))));
+	v2889 = ((v2888*0.999)+(b/((v2882+3.5))));
+	v2890 = ((v2889*0.999)+(b/((v2883+4.5))));
+	v2891 = ((v2890*0.999)+(b/((v2884+5.5))));
+	v2892 = ((v2891*0.999)+(b/((v2885+6.5))));
+	v2893 = ((v2892*0.999)+(b/((v2886+7.5))));
+	v2894 = ((v2893*0.999)+(b/((v2887+8.5))));
+	v2895 = ((v2894*0.999)+(b/((v2888+9.5))));
+	v2896 = ((v2895*0.999)+(b/((v2889+10.5))));
+	v2897 = ((v2896*0.999)+(b/((v2890+11.5))));
+	v2898 = ((v2897*0.999)+(b/((v2891+12.5))));
+	v2899 = ((v2898*0.999)+(b/((v2892+0.5))));
+	v2900 = ((v2899*0.999)+(b/((v2893+1.5))));
+	v2901 = ((v2900*0.999)+(b/((v2894+2.5))));
+	v2902 = ((v2901*0.999)+(b/((v2895+3.5))));
+	v2903 = ((v2902*0.999)+(b/((v2896+4.5))));
+	v2904 = ((v2903*0.999)+(b/((v2897+5.5))));
+	v2905 = ((v2904*0.999)+(b/((v2898+6.5))));
+	v2906 = ((v2905*0.999)+(b/((v2899+7.5))));
+	v2907 = ((v2906*0.999)+(b/((v2900+8.5))));
+	v2908 = ((v2907*0.999)+(b/((v2901+9.5))));
+	v2909 = ((v2908*0.999)+(b/((v2902+10.5))));
+	v2910 = ((v2909*0.999)+(b/((v2903+11.5))));
+	v2911 = ((v2910*0.999)+(b/((v2904+12.5))));
+	v2912 = ((v2911*0.999)+(b/((v2905+0.5))));
+	v2913 = ((v2912*0.999)+(b/((v2906+1.5))));
+	v2914 = ((v2913*0.999)+(b/((v2907+2.5))));
+	v2915 = ((v2914*0.999)+(b/((v2908+3.5))));
+	v2916 = ((v2915*0.999)+(b/((v2909+4.5))));
+	v2917 = ((v2916*0.999)+(b/((v2910+5.5))));
+	v2918 = ((v2917*0.999)+(b/((v2911+6.5))));
+	v2919 = ((v2918*0.999)+(b/((v2912+7.5))));
+	v2920 = ((v2919*0.999)+(b/((v2913+8.5))));
+	v2921 = ((v2920*0.999)+(b/((v2914+9.5))));
+	v2922 = ((v2921*0.999)+(b/((v2915+10.5))));
+	v2923 = ((v2922*0.999)+(b/((v2916+11.5))));
+	v2924 = ((v2923*0.999)+(b/((v2917+12.5))));
+	v2925 = ((v2924*0.999)+(b/((v2918+0.5))));
+	v2926 = ((v2925*0.999)+(b/((v2919+1.5))));
+	v2927 = ((v2926*0.999)+(b/((v2920+2.5))));
+	v2928 = ((v2927*0.999)+(b/((v2921+3.5))));
+	v2929 = ((v2928*0.999)+(b/((v2922+4.5))));
+	v2930 = ((v2929*0.999)+(b/((v2923+5.5))));
+	v2931 = ((v2930*0.999)+(b/((v2924+6.5))));
+	v2932 = ((v2931*0.999)+(b/((v2925+7.5))));
+	v2933 = ((v2932*0.999)+(b/((v2926+8.5))));
+	v2934 = ((v2933*0.999)+(b/((v2927+9.5))));
+	v2935 = ((v2934*0.999)+(b/((v2928+10.5))));
+	v2936 = ((v2935*0.999)+(b/((v2929+11.5))));
+	v2937 = ((v2936*0.999)+(b/((v2930+12.5))));
+	v2938 = ((v2937*0.999)+(b/((v2931+0.5))));
+	v2939 = ((v2938*0.999)+(b/((v2932+1.5))));
+	v2940 = ((v2939*0.999)+(b/((v2933+2.5))));
+	v2941 = ((v2940*0.999)+(b/((v2934+3.5))));
+	v2942 = ((v2941*0.999)+(b/((v2935+4.5))));
+	v2943 = ((v2942*0.999)+(b/((v2936+5.5))));
+	v2944 = ((v2943*0.999)+(b/((v2937+6.5))));
+	v2945 = ((v2944*0.999)+(b/((v2938+7.5))));
+	v2946 = ((v2945*0.999)+(b/((v2939+8.5))));
+	v2947 = ((v2946*0.999)+(b/((v2940+9.5))));
+	v2948 = ((v2947*0.999)+(b/((v2941+10.5))));
+	v2949 = ((v2948*0.999)+(b/((v2942+11.5))));
+	v2950 = ((v2949*0.999)+(b/((v2943+12.5))));
+	v2951 = ((v2950*0.999)+(b/((v2944+0.5))));
+	v2952 = ((v2951*0.999)+(b/((v2945+1.5))));
+	v2953 = ((v2952*0.999)+(b/((v2946+2.5))));
+	v2954 = ((v2953*0.999)+(b/((v2947+3.5))));
+	v2955 = ((v2954*0.999)+(b/((v2948+4.5))));
+	v2956 = ((v2955*0.999)+(b/((v2949+5.5))));
+	v2957 = ((v2956*0.999)+(b/((v2950+6.5))));
+	v2958 = ((v2957*0.999)+(b/((v2951+7.5))));
+	v2959 = ((v2958*0.999)+(b/((v2952+8.5))));
+	v2960 = ((v2959*0.999)+(b/((v2953+9.5))));
+	v2961 = ((v2960*0.999)+(b/((v2954+10.5))));
+	v2962 = ((v2961*0.999)+(b/((v2955+11.5))));
+	v2963 = ((v2962*0.999)+(b/((v2956+12.5))));
+	v2964 = ((v2963*0.999)+(b/((v2957+0.5))));
+	v2965 = ((v2964*0.999)+(b/((v2958+1.5))));
+	v2966 = ((v2965*0.999)+(b/((v2959+2.5))));
+	v2967 = ((v2966*0.999)+(b/((v2960+3.5))));
+	v2968 = ((v2967*0.999)+(b/((v2961+4.5))));
+	v2969 = ((v2968*0.999)+(b/((v2962+5.5))));
+	v2970 = ((v2969*0.999)+(b/((v2963+6.5))));
+	v2971 = ((v2970*0.999)+(b/((v2964+7.5))));
+	v2972 = ((v2971*0.999)+(b/((v2965+8.5))));
+	v2973 = ((v2972*0.999)+(b/((v2966+9.5))));
+	v2974 = ((v2973*0.999)+(b/((v2967+10.5))));
+	v2975 = ((v2974*0.999)+(b/((v2968+11.5))));
+	v2976 = ((v2975*0.999)+(b/((v2969+12.5))));
+	v2977 = ((v2976*0.999)+(b/((v2970+0.5))));
+	v2978 = ((v2977*0.999)+(b/((v2971+1.5))));
+	v2979 = ((v2978*0.999)+(b/((v2972+2.5))));
+	v2980 = ((v2979*0.999)+(b/((v2973+3.5))));
+	v2981 = ((v2980*0.999)+(b/((v2974+4.5))));
+	v2982 = ((v2981*0.999)+(b/((v2975+5.5))));
+	v2983 = ((v2982*0.999)+(b/((v2976+6.5))));
+	v2984 = ((v2983*0.999)+(b/((v2977+7.5))));
+	v2985 = ((v2984*0.999)+(b/((v2978+8.5))));
+	v2986 = ((v2985*0.999)+(b/((v2979+9.5))));
+	v2987 = ((v2986*0.999)+(b/((v2980+10.5))));
+	v2988 = ((v2987*0.999)+(b/((v2981+11.5))));
+	v2989 = ((v2988*0.999)+(b/((v2982+12.5))));
+	v2990 = ((v2989*0.999)+(b/((v2983+0.5))));
+	v2991 = ((v2990*0.999)+(b/((v2984+1.5))));
+	v2992 = ((v2991*0.999)+(b/((v2985+2.5))));
+	v2993 = ((v2992*0.999)+(b/((v2986+3.5))));
+	v2994 = ((v2993*0.999)+(b/((v2987+4.5))));
+	v2995 = ((v2994*0.999)+(b/((v2988+5.5))));
+	v2996 = ((v2995*0.999)+(b/((v2989+6.5))));
+	v2997 = ((v2996*0.999)+(b/((v2990+7.5))));
+	v2998 = ((v2997*0.999)+(b/((v2991+8.5))));
+	this->v2992 = v2992;
+	this->v2998 = v2998;
+}
+
@@ -0,0 +1,13 @@
+#include "chunk_state.h"
+
+void el_state::el_chunk3 ()
+{
+	double b = this->b;
+	double v2992 = this->v2992;
+	double v2998 = this->v2998;
+	double v2999;
+	v2999 = ((v2998*0.999)+(b/((v2992+9.5))));
+	cout << v2999;
+	cout << "\n";
+}
+
@@ -0,0 +1,30 @@
+#pragma once
+#include <iostream>
+#include <cmath>
+
+using namespace std;
+
+struct el_state {
+	double b;
+	double v992;
+	double v993;
+	double v994;
+	double v995;
+	double v996;
+	double v997;
+	double v998;
+	double v1992;
+	double v1993;
+	double v1994;
+	double v1995;
+	double v1996;
+	double v1997;
+	double v1998;
+	double v2992;
+	double v2998;
+	void el_chunk0 ();
+	void el_chunk1 ();
+	void el_chunk2 ();
+	void el_chunk3 ();
+};
+
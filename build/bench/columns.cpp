@@ -0,0 +1,22 @@
+#include <iostream>
+#include <cmath>
+#include "el_columns.h"
+
+using namespace std;
+
+int main()
+{
+	static const char * el_reads [] = { "a", "b" };
+	el_open(el_reads, 2);
+	static const char * el_prints [] = { "c" };
+	el_create(el_prints, 1);
+	for ( long el_record = 0; el_record < el_rows(); el_record++ ) {
+		double a;
+		a = el_column(0, el_record);
+		double b;
+		b = el_column(1, el_record);
+		double c;
+		c = ((a*b)+1);
+		el_store(0, c);
+	}
+}
@@ -0,0 +1,3 @@
+>> a >> b;
+c = a*b+1;
+<< c << "\n";
@@ -0,0 +1,291 @@
+
+/**
+ * Asynchronous I/O runtime for the Expression Language Compiler - This header file is written next
+ * to the generated C++ file when a program is compiled with '--async-io'.  A helper thread reads
+ * the next block of standard input while the program parses the current one, and another helper
+ * thread writes out the last block of output while the program fills the next one, so that I/O
+ * overlaps with computation.  The program only waits when a block is not read or written yet,
+ * and that time is measured: with the EL_IO_STATS environment variable set the program prints
+ * how long it ran, how long it waited for input and output, and the rest as computation, to
+ * standard error when it exits.  The helpers use plain pthreads, whose statically initialized
+ * locks are never destroyed, so they can still be running while the program exits.
+ * @version 1.0
+ * @package Runtime
+ * @category Input/Output
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive and include libraries
+#pragma  once
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+
+/**
+ * The size of a block of input or output.
+ */
+#define EL_BLOCK ( 1 << 16 )
+
+/**
+ * The lock that guards both helpers, and the condition that is signalled whenever a block
+ * changes hands.
+ */
+static pthread_mutex_t el_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t el_changed = PTHREAD_COND_INITIALIZER;
+
+/**
+ * This function returns the time in seconds from an arbitrary start.
+ * @return  double                  Seconds
+ */
+static inline double el_now () {
+	struct timespec now;
+	clock_gettime ( CLOCK_MONOTONIC, &now );
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/**
+ * The two blocks of input, one that the program parses and one that the helper reads into.  It
+ * starts out zeroed as every static does, with both blocks free and the helper not started.
+ */
+struct el_prefetch {
+
+	/**
+	 * The blocks and the number of bytes that were read into each, zero or less at the end.
+	 * @var     char        Blocks
+	 * @var     ssize_t     Sizes
+	 */
+	char Blocks [ 2 ] [ EL_BLOCK ];
+	ssize_t Sizes [ 2 ];
+
+	/**
+	 * Whether a block was read and not given back yet.
+	 * @var     bool        Ready
+	 */
+	bool Ready [ 2 ];
+
+	/**
+	 * The block that the program takes next, and whether it holds the other one.
+	 * @var     int         Next
+	 * @var     bool        Holding
+	 */
+	int Next;
+	bool Holding;
+
+	/**
+	 * Whether the helper was started, and the seconds that the program waited for it.
+	 * @var     bool        Started
+	 * @var     double      Stalled
+	 */
+	bool Started;
+	double Stalled;
+
+};
+
+/**
+ * The block of output that the helper writes out.  It starts out zeroed as every static does,
+ * with nothing to write and the helper not started.
+ */
+struct el_writeback {
+
+	/**
+	 * The bytes to write and where to.
+	 * @var     char        Block
+	 * @var     size_t      Size
+	 * @var     FILE        Stream
+	 */
+	const char * Block;
+	size_t Size;
+	FILE * Stream;
+
+	/**
+	 * Whether the helper is writing a block.
+	 * @var     bool        Busy
+	 */
+	bool Busy;
+
+	/**
+	 * Whether the helper was started, and the seconds that the program waited for it.
+	 * @var     bool        Started
+	 * @var     double      Stalled
+	 */
+	bool Started;
+	double Stalled;
+
+};
+
+static el_prefetch el_reader;
+static el_writeback el_writer;
+
+/**
+ * The helper that reads standard input into whichever block is free, until the input ends.
+ * @param   void        unused      Argument of every pthread
+ * @return  void*                   Nothing
+ */
+static void * el_read_ahead ( void * ) {
+	for ( int block = 0; ; block ^= 1 ) {
+		pthread_mutex_lock ( &el_lock );
+		while ( el_reader.Ready [ block ] ) {
+			pthread_cond_wait ( &el_changed, &el_lock );
+		}
+		pthread_mutex_unlock ( &el_lock );
+		ssize_t count = read ( 0, el_reader.Blocks [ block ], EL_BLOCK );
+		pthread_mutex_lock ( &el_lock );
+		el_reader.Sizes [ block ] = count;
+		el_reader.Ready [ block ] = true;
+		pthread_cond_broadcast ( &el_changed );
+		pthread_mutex_unlock ( &el_lock );
+		if ( count <= 0 ) {
+			return NULL;
+		}
+	}
+}
+
+/**
+ * The helper that writes out every block that it is handed.
+ * @param   void        unused      Argument of every pthread
+ * @return  void*                   Nothing
+ */
+static void * el_write_behind ( void * ) {
+	pthread_mutex_lock ( &el_lock );
+	while ( true ) {
+		while ( !el_writer.Busy ) {
+			pthread_cond_wait ( &el_changed, &el_lock );
+		}
+		pthread_mutex_unlock ( &el_lock );
+		fwrite ( el_writer.Block, 1, el_writer.Size, el_writer.Stream );
+		fflush ( el_writer.Stream );
+		pthread_mutex_lock ( &el_lock );
+		el_writer.Busy = false;
+		pthread_cond_broadcast ( &el_changed );
+	}
+	return NULL;
+}
+
+/**
+ * This function starts a helper that runs until the program exits.
+ * @param   function    helper      The helper to start
+ * @return  void
+ */
+static void el_start ( void * ( *helper ) ( void * ) ) {
+	pthread_t thread;
+	if ( pthread_create ( &thread, NULL, helper, NULL ) != 0 ) {
+		fprintf ( stderr, "async-io: could not start a thread\n" );
+		exit ( 1 );
+	}
+	pthread_detach ( thread );
+}
+
+/**
+ * This function gives back the block of input that the program parsed and takes the next one,
+ * waiting for the helper if it did not read it yet.
+ * @param   char        block       Receives the bytes of the block
+ * @return  ssize_t                 Number of bytes, zero or less at the end of input
+ */
+static ssize_t el_fetch ( char ** block ) {
+	pthread_mutex_lock ( &el_lock );
+	if ( !el_reader.Started ) {
+		el_reader.Started = true;
+		el_start ( el_read_ahead );
+	}
+	if ( el_reader.Holding ) {
+		el_reader.Ready [ el_reader.Next ^ 1 ] = false;
+		pthread_cond_broadcast ( &el_changed );
+	}
+	double start = el_now ();
+	while ( !el_reader.Ready [ el_reader.Next ] ) {
+		pthread_cond_wait ( &el_changed, &el_lock );
+	}
+	el_reader.Stalled += el_now () - start;
+	*block = el_reader.Blocks [ el_reader.Next ];
+	ssize_t count = el_reader.Sizes [ el_reader.Next ];
+	el_reader.Holding = true;
+	el_reader.Next ^= 1;
+	pthread_mutex_unlock ( &el_lock );
+	return count;
+}
+
+/**
+ * This function waits until the helper wrote out the last block that it was handed.  The lock
+ * must be held.
+ * @return  void
+ */
+static void el_wait_written () {
+	double start = el_now ();
+	while ( el_writer.Busy ) {
+		pthread_cond_wait ( &el_changed, &el_lock );
+	}
+	el_writer.Stalled += el_now () - start;
+}
+
+/**
+ * This function hands a block of output to the helper, once it wrote out the one before.  The
+ * block must not change until the next one is handed over.
+ * @param   char        block       Bytes to write
+ * @param   size_t      size        Number of bytes
+ * @param   FILE        stream      Where to write them
+ * @return  void
+ */
+static void el_write_async ( const char * block, size_t size, FILE * stream ) {
+	pthread_mutex_lock ( &el_lock );
+	if ( !el_writer.Started ) {
+		el_writer.Started = true;
+		el_start ( el_write_behind );
+	}
+	el_wait_written ();
+	el_writer.Block = block;
+	el_writer.Size = size;
+	el_writer.Stream = stream;
+	el_writer.Busy = true;
+	pthread_cond_broadcast ( &el_changed );
+	pthread_mutex_unlock ( &el_lock );
+}
+
+/**
+ * This function waits until all output was written out.
+ * @return  void
+ */
+static void el_drain () {
+	pthread_mutex_lock ( &el_lock );
+	el_wait_written ();
+	pthread_mutex_unlock ( &el_lock );
+}
+
+/**
+ * The clock of the whole run, which prints the statistics when the program exits.  It is defined
+ * before the output buffer, so it is destroyed after the buffer wrote out everything.
+ */
+struct el_timer {
+
+	/**
+	 * The time that the program started at.
+	 * @var     double      Start
+	 */
+	double Start;
+
+	/**
+	 * This constructor starts the clock.
+	 * @return  void
+	 */
+	el_timer ()
+		: Start ( el_now () ) {
+	}
+
+	/**
+	 * This destructor prints where the time went if EL_IO_STATS is set.
+	 * @return  void
+	 */
+	~el_timer () {
+		if ( getenv ( "EL_IO_STATS" ) ) {
+			double total = el_now () - Start;
+			fprintf ( stderr, "async-io: %.3f ms total, %.3f ms waiting for input, %.3f ms waiting for output, %.3f ms computing\n",
+				total * 1e3, el_reader.Stalled * 1e3, el_writer.Stalled * 1e3,
+				( total - el_reader.Stalled - el_writer.Stalled ) * 1e3 );
+		}
+	}
+
+};
+
+static el_timer el_clock;
@@ -0,0 +1,47 @@
+
+/**
+ * Batch runtime for the Expression Language Compiler - This header file is written next to the
+ * generated C++ file when a program is compiled with '--batch=W'.  Every variable holds the
+ * values of W records at once in a GCC vector, which the compiler maps onto SSE, AVX2 or AVX-512
+ * registers where the target has them and onto scalar code otherwise.  Additions, subtractions,
+ * multiplications and divisions are exact in every lane, so a batch computes exactly what W
+ * separate runs would.  The generated file defines EL_LANES before it includes this header.
+ * @version 1.0
+ * @package Runtime
+ * @category Batch
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive, the helpers are macros so that no vector crosses a call and the calling
+// convention of vectors never matters
+#pragma  once
+
+/**
+ * The values of one variable in EL_LANES records.
+ */
+typedef double el_lanes __attribute__ ( ( vector_size ( EL_LANES * sizeof ( double ) ) ) );
+
+/**
+ * This macro copies a value into every lane, for expressions that do not use a variable.  Lanes
+ * are passed through unchanged.  Negative zero is the identity of addition, so the value keeps
+ * its sign.
+ * @param   double      value       Value of every lane, or lanes
+ * @return  el_lanes                The lanes
+ */
+#define el_splat( value ) ( -( el_lanes ) {} + ( value ) )
+
+/**
+ * Powers are computed lane by lane with the scalar pow, so that every lane gets exactly the
+ * result of a separate run.  Vectorized pow implementations are not correctly rounded.
+ * @param   el_lanes    base        Lanes or scalar
+ * @param   el_lanes    exponent    Lanes or scalar
+ * @return  el_lanes                The powers
+ */
+#define el_pow( base, exponent ) ( { \
+	el_lanes el_powers = el_splat ( base ), el_exponents = el_splat ( exponent ); \
+	for ( int el_power = 0; el_power < EL_LANES; el_power++ ) { \
+		el_powers [ el_power ] = __builtin_pow ( el_powers [ el_power ], el_exponents [ el_power ] ); \
+	} \
+	el_powers; \
+} )
@@ -0,0 +1,327 @@
+
+/**
+ * Columnar runtime for the Expression Language Compiler - This header file is written next to the
+ * generated C++ file when a program is compiled with '--columnar-input' or '--columnar-output',
+ * and the elcol tool converts between text and the same format.  A columnar file holds one
+ * contiguous array of doubles per column, every column has a row per record:
+ *
+ *   bytes 0-7      magic "ELCOLS01"
+ *   bytes 8-15     number of columns, a 64 bit integer
+ *   bytes 16-23    number of rows, a 64 bit integer
+ *   bytes 24-31    number of bytes of the names, a multiple of 8
+ *   names          the names of the columns, each ended by a null byte, padded with null bytes
+ *   columns        the rows of the first column, then those of the second and so on
+ *
+ * Integers and doubles are in the byte order of the machine.  Columnar input is read from
+ * standard input, which is mapped into memory when it is a file.  Columns are matched by name
+ * against the reads of the program in order, a variable that is read twice per record takes the
+ * first and second column of its name.  Columnar output collects the printed variables of every
+ * record and writes the file to standard output when the program exits.
+ * @version 1.0
+ * @package Runtime
+ * @category Columns
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive and include libraries
+#pragma  once
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * The fixed part of the header of a columnar file.
+ */
+struct el_header {
+
+	/**
+	 * The magic that every columnar file starts with.
+	 * @var     char        Magic
+	 */
+	char Magic [ 8 ];
+
+	/**
+	 * The number of columns, of rows and of bytes of the names.
+	 * @var     uint64_t    Columns, Rows, Names
+	 */
+	uint64_t Columns, Rows, Names;
+
+};
+
+/**
+ * This function prints an error about a columnar file and ends the program.
+ * @param   char        message     What is wrong
+ * @param   char        name        The column that it is about, if any
+ * @return  void
+ */
+static void el_columnar_error ( const char * message, const char * name = "" ) {
+	fprintf ( stderr, "columnar file: %s%s\n", message, name );
+	exit ( 1 );
+}
+
+/**
+ * This function reads everything from a file descriptor.  Files are mapped into memory, anything
+ * else such as a pipe is read into a buffer.
+ * @param   int         descriptor  File descriptor to read
+ * @param   size_t      size        Receives the number of bytes
+ * @return  char*                   The bytes, aligned for doubles
+ */
+static const char * el_map ( int descriptor, size_t& size ) {
+	struct stat status;
+	if ( fstat ( descriptor, &status ) == 0 && S_ISREG ( status.st_mode ) && status.st_size > 0 ) {
+		void * mapped = mmap ( NULL, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+		if ( mapped != MAP_FAILED ) {
+			size = status.st_size;
+			return ( const char * ) mapped;
+		}
+	}
+	size_t capacity = 1 << 16;
+	char * bytes = ( char * ) malloc ( capacity );
+	size = 0;
+	ssize_t count;
+	while ( ( count = read ( descriptor, bytes + size, capacity - size ) ) > 0 ) {
+		size += count;
+		if ( size == capacity ) {
+			capacity *= 2;
+			bytes = ( char * ) realloc ( bytes, capacity );
+		}
+	}
+	return bytes;
+}
+
+/**
+ * The columns of a columnar file that was read.
+ */
+struct el_source {
+
+	/**
+	 * The number of rows of every column.
+	 * @var     long        Rows
+	 */
+	long Rows;
+
+	/**
+	 * The column of every read of the program.
+	 * @var     double      Columns
+	 */
+	const double ** Columns;
+
+	/**
+	 * This function reads a columnar file and finds the column of every read.
+	 * @param   int         descriptor  File descriptor to read
+	 * @param   char        names       Name of the variable of every read, in order
+	 * @param   int         count       Number of reads
+	 * @return  void
+	 */
+	void open ( int descriptor, const char * const names [], int count ) {
+		size_t size;
+		const char * bytes = el_map ( descriptor, size );
+		el_header header;
+		if ( size < sizeof ( header ) ) {
+			el_columnar_error ( "input is too short" );
+		}
+		memcpy ( &header, bytes, sizeof ( header ) );
+		if ( memcmp ( header.Magic, "ELCOLS01", 8 ) != 0 ) {
+			el_columnar_error ( "input does not start with ELCOLS01" );
+		}
+		uint64_t data = sizeof ( header ) + header.Names;
+		if ( header.Names % 8 || header.Names > size - sizeof ( header ) || ( size - data ) / sizeof ( double ) / ( header.Columns ? header.Columns : 1 ) < header.Rows ) {
+			el_columnar_error ( "input is too short" );
+		}
+		Rows = header.Rows;
+		Columns = ( const double ** ) malloc ( ( count ? count : 1 ) * sizeof ( double * ) );
+		for ( int read = 0; read < count; read++ ) {
+			// A variable that was read before takes the next column with its name
+			int occurrence = 0;
+			for ( int before = 0; before < read; before++ ) {
+				occurrence += strcmp ( names [ before ], names [ read ] ) == 0;
+			}
+			const char * name = bytes + sizeof ( header );
+			uint64_t column = 0;
+			for ( ; column < header.Columns && name < bytes + data; column++, name += strnlen ( name, bytes + data - name ) + 1 ) {
+				if ( strcmp ( name, names [ read ] ) == 0 && occurrence-- == 0 ) {
+					break;
+				}
+			}
+			if ( column >= header.Columns || name >= bytes + data ) {
+				el_columnar_error ( "input has no column for ", names [ read ] );
+			}
+			Columns [ read ] = ( const double * ) ( bytes + data ) + column * header.Rows;
+		}
+	}
+
+};
+
+/**
+ * This function writes bytes to standard output, as many writes as it takes.
+ * @param   void        bytes       Bytes to write
+ * @param   size_t      size        Number of bytes
+ * @return  void
+ */
+static void el_write_all ( const void * bytes, size_t size ) {
+	const char * next = ( const char * ) bytes;
+	while ( size > 0 ) {
+		ssize_t count = write ( 1, next, size );
+		if ( count <= 0 ) {
+			return;
+		}
+		next += count;
+		size -= count;
+	}
+}
+
+/**
+ * The columns that are printed, which are written out as a columnar file when the program exits.
+ */
+struct el_sink {
+
+	/**
+	 * The number of columns and the name of every column.
+	 * @var     int         Count
+	 * @var     char        Names
+	 */
+	int Count;
+	const char * const * Names;
+
+	/**
+	 * The number of rows so far, and the number of rows that the columns have room for.
+	 * @var     size_t      Rows, Capacity
+	 */
+	size_t Rows, Capacity;
+
+	/**
+	 * The values of every column.
+	 * @var     double      Columns
+	 */
+	double ** Columns;
+
+	/**
+	 * This function starts out the columns.
+	 * @param   char        names       Name of every column
+	 * @param   int         count       Number of columns
+	 * @return  void
+	 */
+	void create ( const char * const names [], int count ) {
+		Names = names;
+		Count = count;
+		Rows = 0;
+		Capacity = 1 << 12;
+		Columns = ( double ** ) malloc ( ( count ? count : 1 ) * sizeof ( double * ) );
+		for ( int column = 0; column < count; column++ ) {
+			Columns [ column ] = ( double * ) malloc ( Capacity * sizeof ( double ) );
+		}
+	}
+
+	/**
+	 * This function makes room for another row once every column of the last one was stored.
+	 * @return  void
+	 */
+	void grow () {
+		Capacity *= 2;
+		for ( int column = 0; column < Count; column++ ) {
+			Columns [ column ] = ( double * ) realloc ( Columns [ column ], Capacity * sizeof ( double ) );
+		}
+	}
+
+	/**
+	 * This destructor writes out the columnar file when the program exits.
+	 * @return  void
+	 */
+	~el_sink () {
+		if ( Names == NULL ) {
+			return;
+		}
+		uint64_t names = 0;
+		for ( int column = 0; column < Count; column++ ) {
+			names += strlen ( Names [ column ] ) + 1;
+		}
+		el_header header = { { 'E', 'L', 'C', 'O', 'L', 'S', '0', '1' }, ( uint64_t ) Count, Rows, ( names + 7 ) / 8 * 8 };
+		fflush ( stdout );
+		el_write_all ( &header, sizeof ( header ) );
+		for ( int column = 0; column < Count; column++ ) {
+			el_write_all ( Names [ column ], strlen ( Names [ column ] ) + 1 );
+		}
+		el_write_all ( "\0\0\0\0\0\0\0", header.Names - names );
+		for ( int column = 0; column < Count; column++ ) {
+			el_write_all ( Columns [ column ], Rows * sizeof ( double ) );
+		}
+	}
+
+};
+
+static el_source el_columns_in;
+static el_sink el_columns_out;
+
+/**
+ * This function reads the columnar input from standard input.
+ * @param   char        names       Name of the variable of every read, in order
+ * @param   int         count       Number of reads per record
+ * @return  void
+ */
+static inline void el_open ( const char * const names [], int count ) {
+	el_columns_in.open ( 0, names, count );
+}
+
+/**
+ * This function starts the columnar output, which is written to standard output at exit.
+ * @param   char        names       Name of every printed variable, in order
+ * @param   int         count       Number of printed variables per record
+ * @return  void
+ */
+static inline void el_create ( const char * const names [], int count ) {
+	el_columns_out.create ( names, count );
+}
+
+/**
+ * This function returns the number of records of the columnar input.
+ * @return  long                    Number of rows
+ */
+static inline long el_rows () {
+	return el_columns_in.Rows;
+}
+
+/**
+ * This function returns the value of a read in a record.
+ * @param   int         read        Index of the read within the record
+ * @param   long        record      Index of the record
+ * @return  double                  The value
+ */
+static inline double el_column ( int read, long record ) {
+	return el_columns_in.Columns [ read ] [ record ];
+}
+
+/**
+ * These functions store a printed variable as a column of the current record, the last column
+ * of a record ends the row.
+ * @param   int         column      Index of the column
+ * @param   T           value       Value of the variable
+ * @return  void
+ */
+static inline void el_store ( int column, double value ) {
+	el_columns_out.Columns [ column ] [ el_columns_out.Rows ] = value;
+	if ( column == el_columns_out.Count - 1 && ++el_columns_out.Rows == el_columns_out.Capacity ) {
+		el_columns_out.grow ();
+	}
+}
+
+static inline void el_store ( int column, float value ) {
+	el_store ( column, ( double ) value );
+}
+
+static inline void el_store ( int column, long double value ) {
+	el_store ( column, ( double ) value );
+}
+
+static inline void el_store ( int column, long long value ) {
+	el_store ( column, ( double ) value );
+}
+
+template <class T>
+static inline void el_store ( int column, const T& number ) {
+	el_store ( column, number.value () );
+}
@@ -0,0 +1,307 @@
+
+/**
+ * Fast input runtime for the Expression Language Compiler - This header file is written next to
+ * the generated C++ file when a program is compiled with '--fast-input'.  Standard input is read
+ * in large blocks and numbers are parsed without going through iostreams.  Every read behaves
+ * exactly like 'std::cin >> value' does: leading whitespace is skipped, the longest prefix that
+ * looks like a number is consumed, a malformed number sets the value to zero and an overflow
+ * sets it to the largest finite value.  After a failed read or the end of input every later read
+ * leaves its variable alone, just like a std::cin whose failbit is set.  When the generated file
+ * defines EL_THREADS every thread has a buffer of its own, and when it defines EL_ASYNC the blocks
+ * are read ahead by the helper of el_async.h.
+ * @version 1.0
+ * @package Runtime
+ * @category Input
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive and include libraries
+#pragma  once
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+/**
+ * The input buffer.  The single instance is shared by every read, it starts out zeroed as every
+ * static does, which is an empty buffer.
+ */
+struct el_input {
+
+	/**
+	 * The block that standard input is read into.
+	 * @var     char        Block
+	 */
+	char Block [ 1 << 16 ];
+
+	/**
+	 * The bytes that are being read, either the block or a chunk of records.
+	 * @var     char        Buffer
+	 */
+	char * Buffer;
+
+	/**
+	 * The position of the next byte and the number of bytes in the buffer.
+	 * @var     size_t      Position, Size
+	 */
+	size_t Position, Size;
+
+	/**
+	 * Whether the end of input was reached, and whether a read failed.
+	 * @var     bool        End, Failed
+	 */
+	bool End, Failed;
+
+	/**
+	 * The characters of the number that is being read, which may be arbitrarily long.
+	 * @var     char        Token
+	 */
+	char * Token;
+
+	/**
+	 * The length of the token and the size of its allocation.
+	 * @var     size_t      Length, Capacity
+	 */
+	size_t Length, Capacity;
+
+	/**
+	 * This function makes the buffer read the given bytes and nothing else, for a chunk of
+	 * records that a worker thread computes.
+	 * @param   char        text        Bytes of the chunk
+	 * @param   size_t      size        Number of bytes
+	 * @return  void
+	 */
+	void assign ( char * text, size_t size ) {
+		Buffer = text;
+		Position = 0;
+		Size = size;
+		End = true;
+		Failed = false;
+	}
+
+	/**
+	 * This function returns the next byte without consuming it.  Output is flushed before the
+	 * program waits for more input, just like std::cin flushes std::cout.
+	 * @return  int                     The next byte, or EOF
+	 */
+	int peek () {
+		if ( Position == Size ) {
+			if ( End ) {
+				return EOF;
+			}
+			fflush ( stdout );
+#ifdef EL_ASYNC
+			ssize_t count = el_fetch ( &Buffer );
+#else
+			Buffer = Block;
+			ssize_t count = read ( 0, Block, sizeof ( Block ) );
+#endif
+			if ( count <= 0 ) {
+				End = true;
+				return EOF;
+			}
+			Position = 0;
+			Size = count;
+		}
+		return ( unsigned char ) Buffer [ Position ];
+	}
+
+	/**
+	 * This function consumes the next byte and adds it to the token.
+	 * @return  int                     The byte after it, or EOF
+	 */
+	int take () {
+		if ( Length + 1 >= Capacity ) {
+			Capacity *= 2;
+			Token = ( char * ) realloc ( Token, Capacity );
+		}
+		Token [ Length++ ] = Buffer [ Position++ ];
+		Token [ Length ] = '\0';
+		return peek ();
+	}
+
+	/**
+	 * This function skips whitespace and collects the characters that std::num_get accepts
+	 * for a floating point number: a sign, digits with at most one decimal point, and an
+	 * exponent once there was at least one digit.
+	 * @param   bool        exponent    Receives whether there was an exponent
+	 * @return  bool                    False if the end of input was reached first
+	 */
+	bool token ( bool& exponent ) {
+		int next = peek ();
+		while ( next == ' ' || ( next >= '\t' && next <= '\r' ) ) {
+			Position++;
+			next = peek ();
+		}
+		if ( next == EOF ) {
+			Failed = true;
+			return false;
+		}
+		if ( Token == NULL ) {
+			Capacity = 64;
+			Token = ( char * ) malloc ( Capacity );
+		}
+		Length = 0;
+		Token [ 0 ] = '\0';
+		bool digits = false, point = false;
+		exponent = false;
+		if ( next == '+' || next == '-' ) {
+			next = take ();
+		}
+		while ( next != EOF ) {
+			if ( next >= '0' && next <= '9' ) {
+				digits = true;
+			}
+			else if ( next == '.' && !point && !exponent ) {
+				point = true;
+			}
+			else if ( ( next == 'e' || next == 'E' ) && !exponent && digits ) {
+				exponent = true;
+				next = take ();
+				if ( next == '+' || next == '-' ) {
+					next = take ();
+				}
+				continue;
+			}
+			else {
+				break;
+			}
+			next = take ();
+		}
+		return true;
+	}
+
+};
+
+#ifdef EL_THREADS
+static thread_local el_input el_in;
+#else
+static el_input el_in;
+#endif
+
+/**
+ * This function skips whitespace and checks whether there is anything left to read, it decides
+ * whether another record follows when the program runs once per record.
+ * @return  bool                    Whether a read could still succeed
+ */
+static inline bool el_more () {
+	int next = el_in.peek ();
+	while ( next == ' ' || ( next >= '\t' && next <= '\r' ) ) {
+		el_in.Position++;
+		next = el_in.peek ();
+	}
+	return !el_in.Failed && next != EOF;
+}
+
+/**
+ * These functions return the largest finite value of every floating point type.
+ * @return  T                       The largest finite value
+ */
+static inline float el_largest ( float ) {
+	return __FLT_MAX__;
+}
+
+static inline double el_largest ( double ) {
+	return __DBL_MAX__;
+}
+
+static inline long double el_largest ( long double ) {
+	return __LDBL_MAX__;
+}
+
+/**
+ * This function converts the token with the given function, the same way that std::num_get
+ * does: a token that is not a number entirely gives zero and an overflow gives the largest
+ * finite value, both fail.
+ * @param   T           value       Receives the number
+ * @param   function    convert     strtof, strtod or strtold
+ * @return  void
+ */
+template <class T>
+static inline void el_convert ( T& value, T ( *convert ) ( const char *, char ** ) ) {
+	const char * start = el_in.Token;
+	char * end;
+	value = convert ( start, &end );
+	if ( end == start || *end != '\0' ) {
+		value = 0;
+		el_in.Failed = true;
+	}
+	else if ( value > el_largest ( value ) || value < -el_largest ( value ) ) {
+		value = value > 0 ? el_largest ( value ) : -el_largest ( value );
+		el_in.Failed = true;
+	}
+}
+
+/**
+ * This function reads a double.  Plain decimals with at most 15 digits are exact in a double, as
+ * is every power of ten up to 10^22, so a single division of the two is correctly rounded.
+ * Everything else is converted with strtod.
+ * @param   double      value       Variable to read into
+ * @return  void
+ */
+static inline void el_read ( double& value ) {
+	bool exponent;
+	if ( el_in.Failed || !el_in.token ( exponent ) ) {
+		return;
+	}
+	static const double POWERS [] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	const char * text = el_in.Token;
+	bool negative = *text == '-';
+	text += *text == '-' || *text == '+';
+	long long mantissa = 0;
+	int digits = 0, fraction = -1;
+	for ( ; *text; text++ ) {
+		if ( *text == '.' ) {
+			fraction = 0;
+			continue;
+		}
+		mantissa = mantissa * 10 + ( *text - '0' );
+		digits++;
+		fraction += fraction >= 0;
+	}
+	if ( !exponent && digits > 0 && digits <= 15 && fraction <= 22 ) {
+		value = ( double ) mantissa / POWERS [ fraction < 0 ? 0 : fraction ];
+		value = negative ? -value : value;
+		return;
+	}
+	el_convert ( value, strtod );
+}
+
+/**
+ * This function reads a float.
+ * @param   float       value       Variable to read into
+ * @return  void
+ */
+static inline void el_read ( float& value ) {
+	bool exponent;
+	if ( !el_in.Failed && el_in.token ( exponent ) ) {
+		el_convert ( value, strtof );
+	}
+}
+
+/**
+ * This function reads a long double.
+ * @param   long double     value       Variable to read into
+ * @return  void
+ */
+static inline void el_read ( long double& value ) {
+	bool exponent;
+	if ( !el_in.Failed && el_in.token ( exponent ) ) {
+		el_convert ( value, strtold );
+	}
+}
+
+/**
+ * Any other number, e.g. el_fixed, is read as a double that starts out with its current value.
+ * @param   T           number      Variable to read into
+ * @return  void
+ */
+template <class T>
+static inline void el_read ( T& number ) {
+	double value = number.value ();
+	el_read ( value );
+	number = T ( value );
+}
@@ -0,0 +1,428 @@
+
+/**
+ * Math runtime for the Expression Language Compiler - This header file is written next to the
+ * generated C++ file when a program is compiled with '--batch=W' and '--math=ulp' or
+ * '--math=fast', after el_batch.h.  It computes powers for all lanes of a batch at once, as
+ * exp2 ( y * log2 ( x ) ), with the same GCC vectors as the rest of the batch, which the compiler
+ * maps onto SSE2, AVX2 or AVX-512 registers where the target has them and onto scalar code
+ * otherwise.  There are three tiers of accuracy:
+ *
+ *   exact  el_pow of el_batch.h, el_exp2 and el_log2 call libm lane by lane, so every lane is
+ *          what a separate run computes, which is within a hair of correctly rounded
+ *   ulp    el_pow_ulp, el_exp2_ulp and el_log2_ulp carry the logarithm and the argument of the
+ *          exponential as the unevaluated sum of two doubles, and are within 1 ULP
+ *   fast   el_pow_fast, el_exp2_fast and el_log2_fast use plain doubles, exp2 and log2 are within
+ *          a few ULP and pow loses about |y * log2 ( x )| ULP more on top of that
+ *
+ * 'make bench' measures the error of every function against long double libm and its throughput
+ * against libm, which the kernels only beat with AVX2 or AVX-512, i.e. with '-march=native' on a
+ * recent CPU.  Every function follows C99 for zeros, infinities and NaN.  The products that the
+ * exact parts depend on are of numbers that were cut to 26 bits, which are exact whether or not
+ * the compiler contracts them into fused multiply-adds.  The functions are always inlined, so that
+ * no vector crosses a call and the calling convention of vectors never matters.
+ * @version 1.0
+ * @package Runtime
+ * @category Math
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive, the vectors never cross a call so their ABI is not a concern
+#pragma  once
+#pragma  GCC diagnostic ignored "-Wpsabi"
+
+#define EL_MATH static inline __attribute__ ( ( always_inline ) )
+
+/**
+ * The bits of the values of EL_LANES records, signed and unsigned, and a double that is the sum
+ * of two.  Only unsigned bits are shifted right, which needs no AVX-512.
+ */
+typedef long el_words __attribute__ ( ( vector_size ( EL_LANES * sizeof ( double ) ) ) );
+typedef unsigned long el_unsigned __attribute__ ( ( vector_size ( EL_LANES * sizeof ( double ) ) ) );
+struct el_double2 {
+	el_lanes hi, lo;
+};
+
+/**
+ * Where the target has fused multiply-adds, the compiler may fuse a product that is rounded on
+ * purpose into the sums that use it, which would no longer match the rounding error that was
+ * computed for it.  Such products go through an empty statement that the compiler can not see
+ * into, in a register if the lanes fit into one.
+ */
+#if defined ( __FMA__ ) || defined ( __FMA4__ ) || defined ( __AVX512F__ )
+#if EL_LANES <= 4 || EL_LANES <= 8 && defined ( __AVX512F__ )
+#define el_rounded( value ) __asm__ ( "" : "+x" ( value ) )
+#else
+#define el_rounded( value ) __asm__ ( "" : "+m" ( value ) )
+#endif
+#else
+#define el_rounded( value )
+#endif
+
+/**
+ * Adding and subtracting this number rounds a value below 2^51 to an integer, which then lies in
+ * the low bits of the sum.
+ */
+#define EL_MATH_ROUND 6755399441055744.0
+
+/**
+ * This function returns the bits of every lane.
+ * @param   el_lanes    value       The lanes
+ * @return  el_words                The bits
+ */
+EL_MATH el_words el_bits ( const el_lanes& value ) {
+	return ( el_words ) value;
+}
+
+/**
+ * This function returns the lanes with the given bits.
+ * @param   el_words    bits        The bits
+ * @return  el_lanes                The lanes
+ */
+EL_MATH el_lanes el_float ( const el_words& bits ) {
+	return ( el_lanes ) bits;
+}
+
+/**
+ * This function returns the absolute value of every lane.
+ * @param   el_lanes    value       The lanes
+ * @return  el_lanes                The absolute values
+ */
+EL_MATH el_lanes el_abs ( const el_lanes& value ) {
+	return el_float ( el_bits ( value ) & 0x7FFFFFFFFFFFFFFFL );
+}
+
+/**
+ * This function rounds every lane to the nearest integer, ties to even.  Values of 2^51 and
+ * above are integers already.
+ * @param   el_lanes    value       The lanes
+ * @return  el_lanes                The rounded lanes
+ */
+EL_MATH el_lanes el_round ( const el_lanes& value ) {
+	el_lanes rounded = ( value + EL_MATH_ROUND ) - EL_MATH_ROUND;
+	return el_abs ( value ) < 2251799813685248.0 ? rounded : value;
+}
+
+/**
+ * This function converts lanes below 2^51 to the nearest integers.
+ * @param   el_lanes    value       The doubles
+ * @return  el_words                The integers
+ */
+EL_MATH el_words el_integer ( const el_lanes& value ) {
+	return el_bits ( value + EL_MATH_ROUND ) - el_bits ( el_splat ( EL_MATH_ROUND ) );
+}
+
+/**
+ * This function converts integer lanes below 2^51 to doubles.
+ * @param   el_words    value       The integers
+ * @return  el_lanes                The doubles
+ */
+EL_MATH el_lanes el_convert ( const el_words& value ) {
+	return el_float ( value + el_bits ( el_splat ( EL_MATH_ROUND ) ) ) - EL_MATH_ROUND;
+}
+
+/**
+ * This function multiplies every lane by two to an integer power between -2000 and 2000, in
+ * two steps so that both factors are normal numbers.  Only the second step rounds.
+ * @param   el_lanes    value       The lanes
+ * @param   el_lanes    power       The powers, integers
+ * @return  el_lanes                The scaled lanes
+ */
+EL_MATH el_lanes el_scale ( const el_lanes& value, const el_lanes& power ) {
+	el_words half = el_integer ( power * 0.5 ), rest = el_integer ( power ) - half;
+	return value * el_float ( ( half + 1023 ) << 52 ) * el_float ( ( rest + 1023 ) << 52 );
+}
+
+/**
+ * This function cuts every lane to its upper 26 bits, the rest is the value minus the cut.
+ * @param   el_lanes    value       The lanes
+ * @return  el_lanes                The upper bits
+ */
+EL_MATH el_lanes el_upper ( const el_lanes& value ) {
+	return el_float ( el_bits ( value ) & ( long ) 0xFFFFFFFFF8000000UL );
+}
+
+/**
+ * These functions compute with sums of two doubles.  The sums of el_add assume that the first
+ * operand is the larger, those of el_add2 do not.
+ */
+EL_MATH el_double2 el_double ( const el_lanes& hi, const el_lanes& lo ) {
+	el_double2 result = { hi, lo };
+	return result;
+}
+EL_MATH el_double2 el_normalize ( const el_double2& x ) {
+	el_lanes sum = x.hi + x.lo;
+	return el_double ( sum, x.hi - sum + x.lo );
+}
+EL_MATH el_double2 el_add ( const el_lanes& x, const el_double2& y ) {
+	el_lanes sum = x + y.hi;
+	return el_double ( sum, x - sum + y.hi + y.lo );
+}
+EL_MATH el_double2 el_add ( const el_double2& x, const el_double2& y ) {
+	el_lanes sum = x.hi + y.hi;
+	return el_double ( sum, x.hi - sum + y.hi + x.lo + y.lo );
+}
+EL_MATH el_double2 el_add2 ( const el_lanes& x, const el_lanes& y ) {
+	el_lanes sum = x + y, part = sum - x;
+	return el_double ( sum, ( x - ( sum - part ) ) + ( y - part ) );
+}
+EL_MATH el_double2 el_add2 ( const el_double2& x, const el_double2& y ) {
+	el_lanes sum = x.hi + y.hi, part = sum - x.hi;
+	return el_double ( sum, ( x.hi - ( sum - part ) ) + ( y.hi - part ) + x.lo + y.lo );
+}
+EL_MATH el_double2 el_multiply ( const el_double2& x, const el_lanes& y ) {
+	el_lanes xh = el_upper ( x.hi ), xl = x.hi - xh, yh = el_upper ( y ), yl = y - yh;
+	el_lanes product = x.hi * y;
+	el_rounded ( product );
+	return el_double ( product, xh * yh - product + xl * yh + xh * yl + xl * yl + x.lo * y );
+}
+EL_MATH el_double2 el_multiply ( const el_double2& x, const el_double2& y ) {
+	el_lanes xh = el_upper ( x.hi ), xl = x.hi - xh, yh = el_upper ( y.hi ), yl = y.hi - yh;
+	el_lanes product = x.hi * y.hi;
+	el_rounded ( product );
+	return el_double ( product, xh * yh - product + xl * yh + xh * yl + xl * yl + x.hi * y.lo + x.lo * y.hi );
+}
+EL_MATH el_double2 el_square ( const el_double2& x ) {
+	el_lanes xh = el_upper ( x.hi ), xl = x.hi - xh;
+	el_lanes product = x.hi * x.hi;
+	el_rounded ( product );
+	return el_double ( product, xh * xh - product + ( xh + xh ) * xl + xl * xl + x.hi * ( x.lo + x.lo ) );
+}
+EL_MATH el_double2 el_divide ( const el_double2& n, const el_double2& d ) {
+	el_lanes t = 1.0 / d.hi;
+	el_lanes dh = el_upper ( d.hi ), dl = d.hi - dh, th = el_upper ( t ), tl = t - th;
+	el_lanes nh = el_upper ( n.hi ), nl = n.hi - nh;
+	el_lanes quotient = n.hi * t;
+	el_rounded ( quotient );
+	el_lanes error = nh * th - quotient + nh * tl + nl * th + nl * tl + quotient * ( 1 - dh * th - dh * tl - dl * th - dl * tl );
+	return el_double ( quotient, t * ( n.lo - quotient * d.lo ) + error );
+}
+
+/**
+ * This function splits every lane into m * 2^e with m between 0.75 and 1.5, and returns the
+ * logarithm of m as x = ( m - 1 ) / ( m + 1 ) with ln ( m ) = 2 * atanh ( x ).
+ * @param   el_lanes    value       Positive finite lanes
+ * @param   el_lanes    exponent    Receives e
+ * @return  el_double2              x as a sum of two doubles
+ */
+EL_MATH el_double2 el_reduce ( const el_lanes& input, el_lanes& exponent ) {
+	el_words tiny = input < 2.2250738585072014e-308;
+	el_lanes value = tiny ? input * 1.8446744073709552e+19 : input;
+	el_words power = ( el_words ) ( ( el_unsigned ) el_bits ( value * ( 1.0 / 0.75 ) ) >> 52 ) - 1023;
+	el_lanes m = el_float ( el_bits ( value ) - ( power << 52 ) );
+	exponent = el_convert ( power - ( tiny & 64 ) );
+	return el_divide ( el_double ( m - 1, el_splat ( 0.0 ) ), el_add2 ( el_splat ( 1.0 ), m ) );
+}
+
+/**
+ * This function returns the binary logarithm of positive finite lanes as a sum of two doubles,
+ * within about 2^-100 of the logarithm plus the error of the series.
+ * @param   el_lanes    value       The lanes
+ * @return  el_double2              The logarithms
+ */
+EL_MATH el_double2 el_log2_double2 ( const el_lanes& value ) {
+	el_lanes exponent;
+	el_double2 x = el_reduce ( value, exponent ), x2 = el_square ( x );
+	el_lanes t = 0.116255524079935043668677 * x2.hi + 0.103239680901072952701192;
+	t = t * x2.hi + 0.117754809412463995466069;
+	t = t * x2.hi + 0.13332981086846273921509;
+	t = t * x2.hi + 0.153846227114512262845736;
+	t = t * x2.hi + 0.181818180850050775676507;
+	t = t * x2.hi + 0.222222222230083560345903;
+	t = t * x2.hi + 0.285714285714249172087875;
+	t = t * x2.hi + 0.400000000000000077715612;
+	// ln ( m ) = 2 x + 2/3 x^3 + x^5 t
+	el_double2 x3 = el_multiply ( x2, x );
+	el_double2 log = el_double ( x.hi * 2, x.lo * 2 );
+	log = el_add ( log, el_multiply ( x3, el_double ( el_splat ( 0.666666666666666629659233 ), el_splat ( 3.80554962542412056336616e-17 ) ) ) );
+	log = el_add ( log, el_multiply ( el_multiply ( x2, x3 ), t ) );
+	// log2 ( e ) as a sum of two doubles
+	log = el_multiply ( log, el_double ( el_splat ( 1.4426950408889634 ), el_splat ( 2.0355273740931033e-17 ) ) );
+	return el_add2 ( el_double ( exponent, el_splat ( 0.0 ) ), log );
+}
+
+/**
+ * This function returns 2 to the power of a sum of two doubles between -2000 and 2000.
+ * @param   el_double2  value       The exponents
+ * @return  el_lanes                The powers
+ */
+EL_MATH el_lanes el_exp2_double2 ( const el_double2& value ) {
+	el_lanes hi = value.hi > 2000 ? el_splat ( 2000.0 ) : value.hi < -2000 ? el_splat ( -2000.0 ) : value.hi;
+	el_lanes q = el_round ( hi );
+	// s = ( value - q ) * ln ( 2 ), with ln ( 2 ) as a sum of two doubles
+	el_double2 s = el_multiply ( el_normalize ( el_double ( hi - q, value.lo ) ), el_double ( el_splat ( 0.6931471805599453 ), el_splat ( 2.3190468138462996e-17 ) ) );
+	// e^s = 1 + s + s^2 u
+	el_lanes u = 2.51069683420950419527139e-08 * s.hi + 2.76286166770270649116855e-07;
+	u = u * s.hi + 2.75572496725023574143864e-06;
+	u = u * s.hi + 2.48014973989819794114153e-05;
+	u = u * s.hi + 0.000198412698809069797676111;
+	u = u * s.hi + 0.0013888888939977128960529;
+	u = u * s.hi + 0.00833333333332371417601081;
+	u = u * s.hi + 0.0416666666665409524128449;
+	u = u * s.hi + 0.166666666666666740681535;
+	u = u * s.hi + 0.500000000000000999200722;
+	el_double2 t = el_add ( el_add ( el_splat ( 1.0 ), s ), el_multiply ( el_square ( s ), u ) );
+	return el_scale ( t.hi + t.lo, q );
+}
+
+/**
+ * This function returns the binary logarithm of every lane with plain doubles.
+ * @param   el_lanes    value       Positive finite lanes
+ * @return  el_lanes                The logarithms
+ */
+EL_MATH el_lanes el_log2_plain ( const el_lanes& input ) {
+	el_words tiny = input < 2.2250738585072014e-308;
+	el_lanes value = tiny ? input * 1.8446744073709552e+19 : input;
+	el_words power = ( el_words ) ( ( el_unsigned ) el_bits ( value * ( 1.0 / 0.75 ) ) >> 52 ) - 1023;
+	el_lanes m = el_float ( el_bits ( value ) - ( power << 52 ) );
+	el_lanes exponent = el_convert ( power - ( tiny & 64 ) );
+	el_lanes x = ( m - 1 ) / ( m + 1 ), x2 = x * x;
+	el_lanes t = 0.116255524079935043668677 * x2 + 0.103239680901072952701192;
+	t = t * x2 + 0.117754809412463995466069;
+	t = t * x2 + 0.13332981086846273921509;
+	t = t * x2 + 0.153846227114512262845736;
+	t = t * x2 + 0.181818180850050775676507;
+	t = t * x2 + 0.222222222230083560345903;
+	t = t * x2 + 0.285714285714249172087875;
+	t = t * x2 + 0.400000000000000077715612;
+	t = t * x2 + 0.666666666666666629659233;
+	return exponent + ( x * 2 + x * x2 * t ) * 1.4426950408889634;
+}
+
+/**
+ * This function returns 2 to the power of every lane with plain doubles, for lanes between
+ * -2000 and 2000.
+ * @param   el_lanes    value       The exponents
+ * @return  el_lanes                The powers
+ */
+EL_MATH el_lanes el_exp2_plain ( const el_lanes& value ) {
+	el_lanes hi = value > 2000 ? el_splat ( 2000.0 ) : value < -2000 ? el_splat ( -2000.0 ) : value;
+	el_lanes q = el_round ( hi ), s = ( hi - q ) * 0.6931471805599453;
+	el_lanes u = 2.51069683420950419527139e-08 * s + 2.76286166770270649116855e-07;
+	u = u * s + 2.75572496725023574143864e-06;
+	u = u * s + 2.48014973989819794114153e-05;
+	u = u * s + 0.000198412698809069797676111;
+	u = u * s + 0.0013888888939977128960529;
+	u = u * s + 0.00833333333332371417601081;
+	u = u * s + 0.0416666666665409524128449;
+	u = u * s + 0.166666666666666740681535;
+	u = u * s + 0.500000000000000999200722;
+	return el_scale ( 1 + ( s + s * s * u ), q );
+}
+
+/**
+ * This function finishes a power: it overflows and underflows by the exponent y * log2 ( |x| ),
+ * takes the sign of x to odd integer powers, and gives the results of C99 for the special
+ * cases.  Negative numbers to powers that are not integers are NaN.
+ * @param   el_lanes    power       2 to the power of the exponent
+ * @param   el_lanes    exponent    y * log2 ( |x| ), which is infinite if x is zero or infinite
+ * @param   el_lanes    x           The bases
+ * @param   el_lanes    y           The exponents
+ * @return  el_lanes                The powers
+ */
+EL_MATH el_lanes el_power ( const el_lanes& power, const el_lanes& exponent, const el_lanes& x, const el_lanes& y ) {
+	el_lanes infinity = el_splat ( __builtin_inf () ), nan = el_splat ( __builtin_nan ( "" ) );
+	el_lanes result = exponent >= 1024 ? infinity : exponent <= -1076 ? el_splat ( 0.0 ) : power;
+	el_words integer = el_round ( y ) == y, odd = integer & ( el_round ( y * 0.5 ) != y * 0.5 );
+	el_lanes sign = el_float ( ( el_bits ( x ) & ( long ) 0x8000000000000000UL ) | el_bits ( el_splat ( 1.0 ) ) );
+	result = ( sign < 0 ) & odd ? -result : result;
+	result = ( x < 0 ) & ( x != -infinity ) & ~integer ? nan : result;
+	result = ( el_abs ( x ) == 1 ) & ( el_abs ( y ) == infinity ) ? el_splat ( 1.0 ) : result;
+	return ( x == 1 ) | ( y == 0 ) ? el_splat ( 1.0 ) : result;
+}
+
+/**
+ * This function returns the binary logarithm of the lanes that the logarithm of a power starts
+ * from, which is infinite for zeros and infinities and NaN for NaN.
+ * @param   el_lanes    value       The absolute values of the bases
+ * @param   el_lanes    finite      The logarithms of the values that are positive and finite
+ * @return  el_lanes                The logarithms
+ */
+EL_MATH el_lanes el_special ( const el_lanes& value, const el_lanes& finite ) {
+	el_lanes infinity = el_splat ( __builtin_inf () );
+	return value == 0 ? -infinity : value == infinity ? infinity : value != value ? value : finite;
+}
+
+/**
+ * These functions return the lanes that a logarithm is computed from, which are positive and
+ * finite, 1 in the lanes where they are not.
+ */
+EL_MATH el_lanes el_positive ( const el_lanes& value ) {
+	return ( value > 0 ) & ( value < __builtin_inf () ) ? value : el_splat ( 1.0 );
+}
+
+/**
+ * The ulp tier, within 1 ULP.
+ * @param   el_lanes    x, y        The bases and exponents, or the arguments
+ * @return  el_lanes                The results
+ */
+EL_MATH el_lanes el_math_pow_ulp ( const el_lanes& x, const el_lanes& y ) {
+	el_lanes base = el_abs ( x );
+	el_double2 log = el_log2_double2 ( el_positive ( base ) );
+	el_lanes exponent = el_special ( base, log.hi ) * y;
+	el_rounded ( exponent );
+	el_double2 product = el_multiply ( log, y );
+	return el_power ( el_exp2_double2 ( el_double ( exponent, product.lo ) ), exponent, x, y );
+}
+EL_MATH el_lanes el_math_exp2_ulp ( const el_lanes& x ) {
+	el_lanes result = el_exp2_double2 ( el_double ( x, el_splat ( 0.0 ) ) );
+	return x >= 1024 ? el_splat ( __builtin_inf () ) : x <= -1076 ? el_splat ( 0.0 ) : result;
+}
+EL_MATH el_lanes el_math_log2_ulp ( const el_lanes& x ) {
+	el_double2 log = el_log2_double2 ( el_positive ( x ) );
+	el_lanes result = el_special ( x, log.hi + log.lo );
+	return x < 0 ? el_splat ( __builtin_nan ( "" ) ) : result;
+}
+
+/**
+ * The fast tier, with plain doubles.
+ * @param   el_lanes    x, y        The bases and exponents, or the arguments
+ * @return  el_lanes                The results
+ */
+EL_MATH el_lanes el_math_pow_fast ( const el_lanes& x, const el_lanes& y ) {
+	el_lanes base = el_abs ( x );
+	el_lanes exponent = el_special ( base, el_log2_plain ( el_positive ( base ) ) ) * y;
+	return el_power ( el_exp2_plain ( exponent ), exponent, x, y );
+}
+EL_MATH el_lanes el_math_exp2_fast ( const el_lanes& x ) {
+	el_lanes result = el_exp2_plain ( x );
+	return x >= 1024 ? el_splat ( __builtin_inf () ) : x <= -1076 ? el_splat ( 0.0 ) : result;
+}
+EL_MATH el_lanes el_math_log2_fast ( const el_lanes& x ) {
+	el_lanes result = el_special ( x, el_log2_plain ( el_positive ( x ) ) );
+	return x < 0 ? el_splat ( __builtin_nan ( "" ) ) : result;
+}
+
+/**
+ * The exact tier of exp2 and log2, lane by lane with libm like el_pow.
+ * @param   el_lanes    input       The arguments
+ * @return  el_lanes                The results
+ */
+EL_MATH el_lanes el_math_exp2 ( const el_lanes& input ) {
+	el_lanes x = input;
+	for ( int lane = 0; lane < EL_LANES; lane++ ) {
+		x [ lane ] = __builtin_exp2 ( x [ lane ] );
+	}
+	return x;
+}
+EL_MATH el_lanes el_math_log2 ( const el_lanes& input ) {
+	el_lanes x = input;
+	for ( int lane = 0; lane < EL_LANES; lane++ ) {
+		x [ lane ] = __builtin_log2 ( x [ lane ] );
+	}
+	return x;
+}
+
+/**
+ * The functions that the generated code calls, which take lanes or scalars like el_pow.
+ * @param   el_lanes    base, exponent, value       Lanes or scalars
+ * @return  el_lanes                                The results
+ */
+#define el_pow_ulp( base, exponent ) el_math_pow_ulp ( el_splat ( base ), el_splat ( exponent ) )
+#define el_pow_fast( base, exponent ) el_math_pow_fast ( el_splat ( base ), el_splat ( exponent ) )
+#define el_exp2( value ) el_math_exp2 ( el_splat ( value ) )
+#define el_exp2_ulp( value ) el_math_exp2_ulp ( el_splat ( value ) )
+#define el_exp2_fast( value ) el_math_exp2_fast ( el_splat ( value ) )
+#define el_log2( value ) el_math_log2 ( el_splat ( value ) )
+#define el_log2_ulp( value ) el_math_log2_ulp ( el_splat ( value ) )
+#define el_log2_fast( value ) el_math_log2_fast ( el_splat ( value ) )
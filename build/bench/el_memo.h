@@ -0,0 +1,162 @@
+
+/**
+ * Memoization runtime for the Expression Language Compiler - This header file is written next to
+ * the generated C++ file when a program is compiled with '--memoize'.  Every record's inputs are
+ * looked up in a table of the records that were computed before, and the values that a known
+ * record printed are printed again instead of computing them.  The table is an array of buckets
+ * of eight slots, a record can only be stored in the bucket that its hash picks.  The tags of the
+ * slots of a bucket lie next to each other, so a lookup reads one cache line of tags and then
+ * the one slot that matches.  Inputs are compared bit for bit, so that e.g. -0 and 0 are different
+ * records, just like they print differently.  When a bucket is full the least recently used slot
+ * is evicted, unless eviction is turned off, in which case new records are not stored.  The hit
+ * rate is printed to standard error when the program exits.
+ * @version 1.0
+ * @package Runtime
+ * @category Memoization
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive and include libraries
+#pragma  once
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+/**
+ * The table of records that were computed before.
+ */
+struct el_memo {
+
+	/**
+	 * The number of inputs and of printed values per record.
+	 * @var     int         Keys, Values
+	 */
+	int Keys, Values;
+
+	/**
+	 * The number of slots, a power of two of at least eight, and whether a full bucket evicts.
+	 * @var     size_t      Slots
+	 * @var     bool        Evict
+	 */
+	size_t Slots;
+	bool Evict;
+
+	/**
+	 * The tag of every slot, the upper half of the hash of its inputs with the lowest bit set,
+	 * or zero if the slot is empty.
+	 * @var     uint32_t    Tags
+	 */
+	uint32_t * Tags;
+
+	/**
+	 * The lookup that every slot was last used by.
+	 * @var     uint64_t    Stamps
+	 */
+	uint64_t * Stamps;
+
+	/**
+	 * The inputs of every slot followed by the values that its record printed.
+	 * @var     double      Entries
+	 */
+	double * Entries;
+
+	/**
+	 * Where the values of a record go that is not stored.
+	 * @var     double      Scratch
+	 */
+	double * Scratch;
+
+	/**
+	 * Whether the last lookup found its record.
+	 * @var     bool        Hit
+	 */
+	bool Hit;
+
+	/**
+	 * The number of lookups, of hits and of records that were evicted.
+	 * @var     uint64_t    Lookups, Hits, Evictions
+	 */
+	uint64_t Lookups, Hits, Evictions;
+
+	/**
+	 * This constructor creates an empty table.
+	 * @param   int         keys        Number of inputs per record
+	 * @param   int         values      Number of printed values per record
+	 * @param   size_t      slots       Number of slots, a power of two of at least eight
+	 * @param   bool        evict       Whether a full bucket evicts its least recently used slot
+	 * @return  void
+	 */
+	el_memo ( int keys, int values, size_t slots, bool evict )
+		: Keys ( keys ), Values ( values ), Slots ( slots ), Evict ( evict ), Hit ( false ), Lookups ( 0 ), Hits ( 0 ), Evictions ( 0 ) {
+		Tags = ( uint32_t * ) calloc ( slots, sizeof ( uint32_t ) );
+		Stamps = ( uint64_t * ) calloc ( slots, sizeof ( uint64_t ) );
+		Entries = ( double * ) malloc ( slots * ( keys + values ) * sizeof ( double ) );
+		Scratch = ( double * ) malloc ( ( values + 1 ) * sizeof ( double ) );
+	}
+
+	/**
+	 * This destructor prints the hit rate when the program exits.
+	 * @return  void
+	 */
+	~el_memo () {
+		fprintf ( stderr, "memoize: %llu records, %.1f%% hits, %llu evictions, %llu slots\n",
+			( unsigned long long ) Lookups, Lookups ? 100.0 * Hits / Lookups : 0.0,
+			( unsigned long long ) Evictions, ( unsigned long long ) Slots );
+	}
+
+	/**
+	 * This function hashes the bits of the inputs of a record.
+	 * @param   double      keys        The inputs
+	 * @return  uint64_t                The hash
+	 */
+	uint64_t hash ( const double * keys ) const {
+		uint64_t hash = 0x9E3779B97F4A7C15ULL, bits;
+		for ( int key = 0; key < Keys; key++ ) {
+			memcpy ( &bits, keys + key, sizeof ( bits ) );
+			hash = ( hash ^ bits ) * 0xBF58476D1CE4E5B9ULL;
+			hash ^= hash >> 31;
+		}
+		hash = ( hash ^ ( hash >> 30 ) ) * 0x94D049BB133111EBULL;
+		return hash ^ ( hash >> 31 );
+	}
+
+	/**
+	 * This function looks up the inputs of a record.  If they are found the values that the
+	 * record printed are returned.  Otherwise the inputs are stored in a slot of their own if
+	 * the record may be stored, and where its values go is returned.
+	 * @param   double      keys        The inputs of the record
+	 * @param   bool        store       Whether the record may be stored, false after a failed read
+	 * @return  double*                 The values of the record
+	 */
+	double * find ( const double * keys, bool store ) {
+		uint64_t hash = this->hash ( keys );
+		uint32_t tag = ( uint32_t ) ( hash >> 32 ) | 1;
+		size_t bucket = ( hash & ( Slots / 8 - 1 ) ) * 8, victim = bucket;
+		size_t stride = Keys + Values;
+		Lookups++;
+		for ( size_t slot = bucket; slot < bucket + 8; slot++ ) {
+			if ( Tags [ slot ] == tag && memcmp ( Entries + slot * stride, keys, Keys * sizeof ( double ) ) == 0 ) {
+				Hit = true;
+				Hits++;
+				Stamps [ slot ] = Lookups;
+				return Entries + slot * stride + Keys;
+			}
+			// Prefer an empty slot, otherwise the least recently used one
+			if ( Tags [ victim ] && ( !Tags [ slot ] || Stamps [ slot ] < Stamps [ victim ] ) ) {
+				victim = slot;
+			}
+		}
+		Hit = false;
+		if ( !store || ( Tags [ victim ] && !Evict ) ) {
+			return Scratch;
+		}
+		Evictions += Tags [ victim ] != 0;
+		Tags [ victim ] = tag;
+		Stamps [ victim ] = Lookups;
+		memcpy ( Entries + victim * stride, keys, Keys * sizeof ( double ) );
+		return Entries + victim * stride + Keys;
+	}
+
+};
@@ -0,0 +1,201 @@
+
+/**
+ * Buffered output runtime for the Expression Language Compiler - This header file is written next
+ * to the generated C++ file when a program is compiled with '--buffered-output'.  Everything that
+ * is printed is collected in one large buffer, which is written out when it fills up, before
+ * input is read and when the program exits.  Numbers are formatted exactly like the default
+ * formatting of std::cout, which is printf's '%g'.  When the generated file defines EL_THREADS every
+ * thread has a buffer of its own, which a worker thread points at the output of its chunk.  When it
+ * defines EL_ASYNC the buffer is two blocks, one is written out by the helper of el_async.h while
+ * the other one fills up.
+ * @version 1.0
+ * @package Runtime
+ * @category Output
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive and include libraries
+#pragma  once
+#include <cstdio>
+#include <cstring>
+
+/**
+ * The output buffer.  The single instance is flushed by its destructor when the program exits, it
+ * starts out zeroed as every static does, which is an empty buffer that writes to stdout.
+ */
+struct el_output {
+
+	/**
+	 * The blocks that bytes are printed into, only the current one holds bytes that were not
+	 * handed on to be written out yet.
+	 * @var     char        Blocks
+	 * @var     int         Current
+	 */
+	char Blocks [ 2 ] [ 1 << 16 ];
+	int Current;
+
+	/**
+	 * The number of bytes in the buffer.
+	 * @var     size_t      Size
+	 */
+	size_t Size;
+
+	/**
+	 * The stream that the buffer is written to, stdout if it is null.
+	 * @var     FILE        Stream
+	 */
+	FILE * Stream;
+
+	/**
+	 * This destructor writes out whatever is left when the program exits.
+	 * @return  void
+	 */
+	~el_output () {
+		flush ();
+#ifdef EL_ASYNC
+		el_drain ();
+#endif
+	}
+
+	/**
+	 * This function writes out the buffer.
+	 * @return  void
+	 */
+	void flush () {
+		FILE * stream = Stream ? Stream : stdout;
+#ifdef EL_ASYNC
+		el_write_async ( Blocks [ Current ], Size, stream );
+		Current ^= 1;
+#else
+		fwrite ( Blocks [ Current ], 1, Size, stream );
+		fflush ( stream );
+#endif
+		Size = 0;
+	}
+
+	/**
+	 * This function makes room for the given number of bytes, which must fit in the buffer.
+	 * @param   size_t      length      Number of bytes that are about to be printed
+	 * @return  char*                   Where to print them
+	 */
+	char * reserve ( size_t length ) {
+		if ( Size + length > sizeof ( Blocks [ 0 ] ) ) {
+			flush ();
+		}
+		return Blocks [ Current ] + Size;
+	}
+
+};
+
+#ifdef EL_THREADS
+static thread_local el_output el_out;
+#else
+static el_output el_out;
+#endif
+
+/**
+ * This function writes out everything that was printed so far, it is called before input is
+ * read so that prompts show up.
+ * @return  void
+ */
+static inline void el_flush () {
+	el_out.flush ();
+}
+
+/**
+ * This function prints a string, string literals that were printed next to each other were
+ * already joined into one by the compiler.
+ * @param   char        text        Bytes to print
+ * @param   size_t      length      Number of bytes
+ * @return  void
+ */
+static inline void el_write ( const char * text, size_t length ) {
+	// Strings that do not fit are written out directly
+	if ( length > sizeof ( el_out.Blocks [ 0 ] ) ) {
+		el_out.flush ();
+#ifdef EL_ASYNC
+		el_drain ();
+#endif
+		fwrite ( text, 1, length, el_out.Stream ? el_out.Stream : stdout );
+		return;
+	}
+	memcpy ( el_out.reserve ( length ), text, length );
+	el_out.Size += length;
+}
+
+/**
+ * This function prints a string literal.
+ * @param   char        text        String literal to print
+ * @return  void
+ */
+template <size_t LENGTH>
+static inline void el_write ( const char ( &text ) [ LENGTH ] ) {
+	el_write ( text, LENGTH - 1 );
+}
+
+/**
+ * This function prints a double like std::cout does.  Integers with up to six digits are
+ * printed digit by digit, everything else goes through '%g'.
+ * @param   double      value       Number to print
+ * @return  void
+ */
+static inline void el_print ( double value ) {
+	char * output = el_out.reserve ( 32 );
+	if ( value > -1e6 && value < 1e6 && value == ( int ) value && ( value != 0 || !__builtin_signbit ( value ) ) ) {
+		char digits [ 8 ];
+		int number = ( int ) value, count = 0;
+		unsigned magnitude = number < 0 ? -number : number;
+		if ( number < 0 ) {
+			*output++ = '-';
+			el_out.Size++;
+		}
+		do {
+			digits [ count++ ] = '0' + magnitude % 10;
+			magnitude /= 10;
+		} while ( magnitude );
+		while ( count ) {
+			*output++ = digits [ --count ];
+			el_out.Size++;
+		}
+		return;
+	}
+	el_out.Size += snprintf ( output, 32, "%g", value );
+}
+
+/**
+ * Floats are printed through double, just like std::cout does.
+ * @param   float       value       Number to print
+ * @return  void
+ */
+static inline void el_print ( float value ) {
+	el_print ( ( double ) value );
+}
+
+/**
+ * This function prints a long double like std::cout does.
+ * @param   long double     value       Number to print
+ * @return  void
+ */
+static inline void el_print ( long double value ) {
+	el_out.Size += snprintf ( el_out.reserve ( 64 ), 64, "%Lg", value );
+}
+
+/**
+ * This function prints an integer literal like std::cout does.
+ * @param   long long       value       Number to print
+ * @return  void
+ */
+static inline void el_print ( long long value ) {
+	el_out.Size += snprintf ( el_out.reserve ( 32 ), 32, "%lld", value );
+}
+
+/**
+ * Any other number, e.g. el_fixed, is printed through its value.
+ * @param   T           number      Number to print
+ * @return  void
+ */
+template <class T>
+static inline void el_print ( const T& number ) {
+	el_print ( number.value () );
+}
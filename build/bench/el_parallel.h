@@ -0,0 +1,309 @@
+
+/**
+ * Parallel runtime for the Expression Language Compiler - This header file is written next to the
+ * generated C++ file when a program is compiled with '--threads'.  The main thread splits standard
+ * input into chunks of whole records, worker threads compute the chunks with the fast input and
+ * the buffered output pointed at the chunk, and whichever worker finds the oldest chunk done
+ * writes the outputs out in input order.  Records are split with exactly the tokens that el_read
+ * takes, so every record sees the same input as it would in a single thread.  A read that fails
+ * ends the program after its record, just like it does in a single thread.  The number of
+ * threads is the one that was compiled in, or the EL_THREADS environment variable if it is set,
+ * and one per core if either is zero.
+ * @version 1.0
+ * @package Runtime
+ * @category Parallel
+ * @author Rafael Grigorian
+ * @license MIT License <LICENSE.md>
+ */
+
+// Set directive and include libraries
+#pragma  once
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+/**
+ * The number of bytes of input after which a chunk ends with the next record.
+ */
+#define EL_CHUNK ( 1 << 16 )
+
+/**
+ * A chunk of records, together with the output of its records once it was computed.
+ */
+struct el_chunk {
+
+	/**
+	 * The input of the records and its number of bytes.
+	 * @var     char        Input
+	 * @var     size_t      Size
+	 */
+	char * Input;
+	size_t Size;
+
+	/**
+	 * The index of the first record of the chunk.
+	 * @var     long        First
+	 */
+	long First;
+
+	/**
+	 * The output of the records and its number of bytes.
+	 * @var     char        Output
+	 * @var     size_t      Length
+	 */
+	char * Output;
+	size_t Length;
+
+	/**
+	 * Whether the records were computed, and whether a read failed in them.
+	 * @var     bool        Done, Failed
+	 */
+	bool Done, Failed;
+
+};
+
+/**
+ * The chunks that were read but not written yet, and the threads that work on them.  Chunks are
+ * numbered in input order and stored in a ring, the reader waits when it is full.
+ */
+struct el_pool {
+
+	/**
+	 * The lock that guards everything below, and the condition that is signalled whenever
+	 * anything changes.
+	 * @var     mutex                   Lock
+	 * @var     condition_variable      Changed
+	 */
+	std::mutex Lock;
+	std::condition_variable Changed;
+
+	/**
+	 * The ring of chunks.
+	 * @var     vector <el_chunk>       Chunks
+	 */
+	std::vector <el_chunk> Chunks;
+
+	/**
+	 * The number of chunks that were read, taken by a worker and written out.
+	 * @var     long        Read, Taken, Written
+	 */
+	long Read, Taken, Written;
+
+	/**
+	 * Whether the input was read entirely, whether a chunk is being written out, and whether
+	 * the program ends because a read failed.
+	 * @var     bool        End, Writing, Stop
+	 */
+	bool End, Writing, Stop;
+
+	/**
+	 * The generated function that computes the records of the current chunk.
+	 * @var     function    Records
+	 */
+	void ( *Records ) ( long );
+
+};
+
+/**
+ * This function finds the next token that el_read would take: whitespace is skipped and then the
+ * characters that el_input::token collects are.  A token that runs into the end of the bytes can
+ * only be ended by more input.
+ * @param   char        text        Bytes that were read so far
+ * @param   size_t      size        Number of bytes
+ * @param   bool        end         Whether there is no more input after them
+ * @param   size_t      position    Where to start, receives the end of the token
+ * @return  int                     1 for a token, 0 if more input is needed, -1 if no record can
+ *                                  follow, which is the end of input or a byte no number starts with
+ */
+static inline int el_token ( const char * text, size_t size, bool end, size_t& position ) {
+	while ( position < size && ( text [ position ] == ' ' || ( text [ position ] >= '\t' && text [ position ] <= '\r' ) ) ) {
+		position++;
+	}
+	if ( position == size ) {
+		return end ? -1 : 0;
+	}
+	size_t start = position;
+	bool digits = false, point = false, exponent = false;
+	if ( text [ position ] == '+' || text [ position ] == '-' ) {
+		position++;
+	}
+	for ( ; position < size; position++ ) {
+		char next = text [ position ];
+		if ( next >= '0' && next <= '9' ) {
+			digits = true;
+		}
+		else if ( next == '.' && !point && !exponent ) {
+			point = true;
+		}
+		else if ( ( next == 'e' || next == 'E' ) && !exponent && digits ) {
+			exponent = true;
+			if ( position + 1 < size && ( text [ position + 1 ] == '+' || text [ position + 1 ] == '-' ) ) {
+				position++;
+			}
+		}
+		else {
+			break;
+		}
+	}
+	// The read fails on a byte that is not part of a number, so it ends the input
+	if ( position == start ) {
+		position++;
+		return -1;
+	}
+	return position < size || end ? 1 : 0;
+}
+
+/**
+ * This function is run by every worker thread.  It takes the oldest chunk that nobody took yet,
+ * computes its records into a buffer of their own and then writes out every chunk that is done
+ * and next in order, unless another worker is already doing so.
+ * @param   el_pool     pool        The chunks to work on
+ * @return  void
+ */
+static void el_work ( el_pool * pool ) {
+	std::unique_lock <std::mutex> lock ( pool->Lock );
+	while ( true ) {
+		pool->Changed.wait ( lock, [ pool ] () {
+			return pool->Stop || pool->Taken < pool->Read || pool->End;
+		} );
+		if ( pool->Stop || pool->Taken == pool->Read ) {
+			return;
+		}
+		el_chunk& chunk = pool->Chunks [ pool->Taken++ % pool->Chunks.size () ];
+		lock.unlock ();
+		// Compute the records with the input and output of this thread pointed at the chunk
+		el_in.assign ( chunk.Input, chunk.Size );
+		el_out.Stream = open_memstream ( &chunk.Output, &chunk.Length );
+		pool->Records ( chunk.First );
+		el_out.flush ();
+		fclose ( el_out.Stream );
+		el_out.Stream = NULL;
+		chunk.Failed = el_in.Failed;
+		lock.lock ();
+		chunk.Done = true;
+		// Write out the chunks that are next in order
+		while ( !pool->Stop && !pool->Writing && pool->Written < pool->Read ) {
+			el_chunk& next = pool->Chunks [ pool->Written % pool->Chunks.size () ];
+			if ( !next.Done ) {
+				break;
+			}
+			pool->Writing = true;
+			lock.unlock ();
+			fwrite ( next.Output, 1, next.Length, stdout );
+			free ( next.Input );
+			free ( next.Output );
+			lock.lock ();
+			pool->Writing = false;
+			pool->Written++;
+			pool->Stop = next.Failed;
+		}
+		pool->Changed.notify_all ();
+	}
+}
+
+/**
+ * This function runs a program on all of its input records in parallel and writes out their
+ * outputs in order.  The calling thread reads the input and splits it into chunks.
+ * @param   function    records     Computes the records of a chunk, given the index of its first
+ * @param   int         reads       Number of reads per record
+ * @param   int         threads     Number of worker threads, zero for one per core
+ * @return  void
+ */
+static void el_parallel ( void ( *records ) ( long ), int reads, int threads ) {
+	if ( getenv ( "EL_THREADS" ) ) {
+		threads = atoi ( getenv ( "EL_THREADS" ) );
+	}
+	if ( threads <= 0 ) {
+		threads = std::thread::hardware_concurrency ();
+		threads = threads > 0 ? threads : 1;
+	}
+	el_pool pool;
+	pool.Chunks.resize ( 4 * threads );
+	pool.Read = pool.Taken = pool.Written = 0;
+	pool.End = pool.Writing = pool.Stop = false;
+	pool.Records = records;
+	std::vector <std::thread> workers;
+	for ( int i = 0; i < threads; i++ ) {
+		workers.push_back ( std::thread ( el_work, &pool ) );
+	}
+	// Read the input and cut it into chunks of whole records, the start of the chunk is kept in front
+	size_t capacity = 2 * EL_CHUNK, size = 0, position = 0;
+	char * text = ( char * ) malloc ( capacity );
+	bool end = false;
+	long count = 0, first = 0;
+	int found, tokens = 0;
+	while ( true ) {
+		size_t next = position;
+		found = el_token ( text, size, end, next );
+		if ( found == 0 ) {
+			if ( size + EL_CHUNK > capacity ) {
+				capacity *= 2;
+				text = ( char * ) realloc ( text, capacity );
+			}
+			ssize_t length = read ( 0, text + size, capacity - size );
+			end = length <= 0;
+			size += end ? 0 : length;
+			continue;
+		}
+		position = next;
+		if ( found < 0 || ++tokens < reads ) {
+			if ( found < 0 ) {
+				break;
+			}
+			continue;
+		}
+		tokens = 0;
+		count++;
+		if ( position < EL_CHUNK ) {
+			continue;
+		}
+		// Hand the chunk to the workers once there is room for it
+		std::unique_lock <std::mutex> lock ( pool.Lock );
+		pool.Changed.wait ( lock, [ & ] () {
+			return pool.Stop || pool.Read - pool.Written < ( long ) pool.Chunks.size ();
+		} );
+		if ( pool.Stop ) {
+			break;
+		}
+		el_chunk chunk = { ( char * ) malloc ( position ), position, first, NULL, 0, false, false };
+		memcpy ( chunk.Input, text, position );
+		pool.Chunks [ pool.Read++ % pool.Chunks.size () ] = chunk;
+		pool.Changed.notify_all ();
+		lock.unlock ();
+		memmove ( text, text + position, size - position );
+		size -= position;
+		position = 0;
+		first += count;
+		count = 0;
+	}
+	// The last chunk holds whatever is left, up to where the input ends for the program
+	std::unique_lock <std::mutex> lock ( pool.Lock );
+	pool.Changed.wait ( lock, [ & ] () {
+		return pool.Stop || pool.Read - pool.Written < ( long ) pool.Chunks.size ();
+	} );
+	if ( !pool.Stop ) {
+		el_chunk chunk = { text, position, first, NULL, 0, false, false };
+		pool.Chunks [ pool.Read++ % pool.Chunks.size () ] = chunk;
+	}
+	else {
+		free ( text );
+	}
+	pool.End = true;
+	pool.Changed.notify_all ();
+	lock.unlock ();
+	for ( std::thread& worker : workers ) {
+		worker.join ();
+	}
+	// Chunks after a failed read are never written out
+	for ( ; pool.Written < pool.Read; pool.Written++ ) {
+		el_chunk& chunk = pool.Chunks [ pool.Written % pool.Chunks.size () ];
+		free ( chunk.Input );
+		free ( chunk.Output );
+	}
+	fflush ( stdout );
+}
@@ -0,0 +1,27 @@
+#include <cmath>
+#include "embed.h"
+
+extern "C" const size_t priced_inputs = 2;
+extern "C" const char * const priced_fields [] = { "total", NULL };
+
+extern "C" void priced ( const double * el_inputs, priced_outputs * el_outputs )
+{
+	double price;
+	price = el_inputs[0];
+	double quantity;
+	quantity = el_inputs[1];
+	double rate;
+	rate = 0.2;
+	double discount;
+	discount = (1-(pow(rate,2)/2));
+	double total;
+	total = ((price*quantity)*discount);
+	el_outputs->total = total;
+}
+
+extern "C" void priced_batch ( const double * el_inputs, priced_outputs * el_outputs, size_t el_count )
+{
+	for ( size_t el_record = 0; el_record < el_count; el_record++ ) {
+		priced ( el_inputs + el_record * 2, el_outputs + el_record );
+	}
+}
@@ -0,0 +1,5 @@
+>> price >> quantity;
+rate = 0.2;
+discount = 1 - rate^2 / 2;
+total = price * quantity * discount;
+<< total;
@@ -0,0 +1,23 @@
+#pragma once
+#include <stddef.h>
+
+#define priced_INPUTS 2
+#define priced_OUTPUTS 1
+
+typedef struct priced_outputs {
+	double total;
+} priced_outputs;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const size_t priced_inputs;
+extern const char * const priced_fields [];
+
+void priced ( const double * inputs, priced_outputs * outputs );
+void priced_batch ( const double * inputs, priced_outputs * outputs, size_t count );
+
+#ifdef __cplusplus
+}
+#endif
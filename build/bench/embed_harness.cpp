@@ -0,0 +1,34 @@
+#include <cstdio>
+#include <chrono>
+#include "../../include/embed.h"
+#include "embed.cpp"
+EL_PROGRAM ( pricing, R"EL(>> price >> quantity;
+rate = 0.2;
+discount = 1 - rate^2 / 2;
+total = price * quantity * discount;
+<< total;
+)EL" );
+void ( * volatile loaded ) ( const double *, priced_outputs * ) = priced;
+int main()
+{
+	const long N = 10000000;
+	double inputs [ 2 ], output, called = 0, embedded = 0;
+	priced_outputs outputs;
+	auto start = std::chrono::steady_clock::now();
+	for ( long i = 0; i < N; i++ ) {
+		inputs [ 0 ] = i % 100;
+		inputs [ 1 ] = i % 7;
+		loaded ( inputs, &outputs );
+		called += outputs.total;
+	}
+	double pointer = std::chrono::duration<double, std::nano> ( std::chrono::steady_clock::now() - start ).count() / N;
+	start = std::chrono::steady_clock::now();
+	for ( long i = 0; i < N; i++ ) {
+		inputs [ 0 ] = i % 100;
+		inputs [ 1 ] = i % 7;
+		pricing::run ( inputs, &output );
+		embedded += output;
+	}
+	double inlined = std::chrono::duration<double, std::nano> ( std::chrono::steady_clock::now() - start ).count() / N;
+	printf ( "%.2f ns/record called, %.2f ns/record embedded (%s)", pointer, inlined, called == embedded ? "same totals" : "totals differ" );
+}
@@ -0,0 +1,2003 @@
+>> a >> b;
+t0 = a;
+t1 = (t0 * b + 1) / (b^2 + 1);
+t2 = (t1 * b + 2) / (b^2 + 1);
+t3 = (t2 * b + 3) / (b^2 + 1);
+t4 = (t3 * b + 4) / (b^2 + 1);
+t5 = (t4 * b + 5) / (b^2 + 1);
+t6 = (t5 * b + 6) / (b^2 + 1);
+t7 = (t6 * b + 7) / (b^2 + 1);
+t8 = (t7 * b + 8) / (b^2 + 1);
+t9 = (t8 * b + 9) / (b^2 + 1);
+t10 = (t9 * b + 0) / (b^2 + 1);
+t11 = (t10 * b + 1) / (b^2 + 1);
+t12 = (t11 * b + 2) / (b^2 + 1);
+t13 = (t12 * b + 3) / (b^2 + 1);
+t14 = (t13 * b + 4) / (b^2 + 1);
+t15 = (t14 * b + 5) / (b^2 + 1);
+t16 = (t15 * b + 6) / (b^2 + 1);
+t17 = (t16 * b + 7) / (b^2 + 1);
+t18 = (t17 * b + 8) / (b^2 + 1);
+t19 = (t18 * b + 9) / (b^2 + 1);
+t20 = (t19 * b + 0) / (b^2 + 1);
+t21 = (t20 * b + 1) / (b^2 + 1);
+t22 = (t21 * b + 2) / (b^2 + 1);
+t23 = (t22 * b + 3) / (b^2 + 1);
+t24 = (t23 * b + 4) / (b^2 + 1);
+t25 = (t24 * b + 5) / (b^2 + 1);
+t26 = (t25 * b + 6) / (b^2 + 1);
+t27 = (t26 * b + 7) / (b^2 + 1);
+t28 = (t27 * b + 8) / (b^2 + 1);
+t29 = (t28 * b + 9) / (b^2 + 1);
+t30 = (t29 * b + 0) / (b^2 + 1);
+t31 = (t30 * b + 1) / (b^2 + 1);
+t32 = (t31 * b + 2) / (b^2 + 1);
+t33 = (t32 * b + 3) / (b^2 + 1);
+t34 = (t33 * b + 4) / (b^2 + 1);
+t35 = (t34 * b + 5) / (b^2 + 1);
+t36 = (t35 * b + 6) / (b^2 + 1);
+t37 = (t36 * b + 7) / (b^2 + 1);
+t38 = (t37 * b + 8) / (b^2 + 1);
+t39 = (t38 * b + 9) / (b^2 + 1);
+t40 = (t39 * b + 0) / (b^2 + 1);
+t41 = (t40 * b + 1) / (b^2 + 1);
+t42 = (t41 * b + 2) / (b^2 + 1);
+t43 = (t42 * b + 3) / (b^2 + 1);
+t44 = (t43 * b + 4) / (b^2 + 1);
+t45 = (t44 * b + 5) / (b^2 + 1);
+t46 = (t45 * b + 6) / (b^2 + 1);
+t47 = (t46 * b + 7) / (b^2 + 1);
+t48 = (t47 * b + 8) / (b^2 + 1);
+t49 = (t48 * b + 9) / (b^2 + 1);
+t50 = (t49 * b + 0) / (b^2 + 1);
+t51 = (t50 * b + 1) / (b^2 + 1);
+t52 = (t51 * b + 2) / (b^2 + 1);
+t53 = (t52 * b + 3) / (b^2 + 1);
+t54 = (t53 * b + 4) / (b^2 + 1);
+t55 = (t54 * b + 5) / (b^2 + 1);
+t56 = (t55 * b + 6) / (b^2 + 1);
+t57 = (t56 * b + 7) / (b^2 + 1);
+t58 = (t57 * b + 8) / (b^2 + 1);
+t59 = (t58 * b + 9) / (b^2 + 1);
+t60 = (t59 * b + 0) / (b^2 + 1);
+t61 = (t60 * b + 1) / (b^2 + 1);
+t62 = (t61 * b + 2) / (b^2 + 1);
+t63 = (t62 * b + 3) / (b^2 + 1);
+t64 = (t63 * b + 4) / (b^2 + 1);
+t65 = (t64 * b + 5) / (b^2 + 1);
+t66 = (t65 * b + 6) / (b^2 + 1);
+t67 = (t66 * b + 7) / (b^2 + 1);
+t68 = (t67 * b + 8) / (b^2 + 1);
+t69 = (t68 * b + 9) / (b^2 + 1);
+t70 = (t69 * b + 0) / (b^2 + 1);
+t71 = (t70 * b + 1) / (b^2 + 1);
+t72 = (t71 * b + 2) / (b^2 + 1);
+t73 = (t72 * b + 3) / (b^2 + 1);
+t74 = (t73 * b + 4) / (b^2 + 1);
+t75 = (t74 * b + 5) / (b^2 + 1);
+t76 = (t75 * b + 6) / (b^2 + 1);
+t77 = (t76 * b + 7) / (b^2 + 1);
+t78 = (t77 * b + 8) / (b^2 + 1);
+t79 = (t78 * b + 9) / (b^2 + 1);
+t80 = (t79 * b + 0) / (b^2 + 1);
+t81 = (t80 * b + 1) / (b^2 + 1);
+t82 = (t81 * b + 2) / (b^2 + 1);
+t83 = (t82 * b + 3) / (b^2 + 1);
+t84 = (t83 * b + 4) / (b^2 + 1);
+t85 = (t84 * b + 5) / (b^2 + 1);
+t86 = (t85 * b + 6) / (b^2 + 1);
+t87 = (t86 * b + 7) / (b^2 + 1);
+t88 = (t87 * b + 8) / (b^2 + 1);
+t89 = (t88 * b + 9) / (b^2 + 1);
+t90 = (t89 * b + 0) / (b^2 + 1);
+t91 = (t90 * b + 1) / (b^2 + 1);
+t92 = (t91 * b + 2) / (b^2 + 1);
+t93 = (t92 * b + 3) / (b^2 + 1);
+t94 = (t93 * b + 4) / (b^2 + 1);
+t95 = (t94 * b + 5) / (b^2 + 1);
+t96 = (t95 * b + 6) / (b^2 + 1);
+t97 = (t96 * b + 7) / (b^2 + 1);
+t98 = (t97 * b + 8) / (b^2 + 1);
+t99 = (t98 * b + 9) / (b^2 + 1);
+t100 = (t99 * b + 0) / (b^2 + 1);
+t101 = (t100 * b + 1) / (b^2 + 1);
+t102 = (t101 * b + 2) / (b^2 + 1);
+t103 = (t102 * b + 3) / (b^2 + 1);
+t104 = (t103 * b + 4) / (b^2 + 1);
+t105 = (t104 * b + 5) / (b^2 + 1);
+t106 = (t105 * b + 6) / (b^2 + 1);
+t107 = (t106 * b + 7) / (b^2 + 1);
+t108 = (t107 * b + 8) / (b^2 + 1);
+t109 = (t108 * b + 9) / (b^2 + 1);
+t110 = (t109 * b + 0) / (b^2 + 1);
+t111 = (t110 * b + 1) / (b^2 + 1);
+t112 = (t111 * b + 2) / (b^2 + 1);
+t113 = (t112 * b + 3) / (b^2 + 1);
+t114 = (t113 * b + 4) / (b^2 + 1);
+t115 = (t114 * b + 5) / (b^2 + 1);
+t116 = (t115 * b + 6) / (b^2 + 1);
+t117 = (t116 * b + 7) / (b^2 + 1);
+t118 = (t117 * b + 8) / (b^2 + 1);
+t119 = (t118 * b + 9) / (b^2 + 1);
+t120 = (t119 * b + 0) / (b^2 + 1);
+t121 = (t120 * b + 1) / (b^2 + 1);
+t122 = (t121 * b + 2) / (b^2 + 1);
+t123 = (t122 * b + 3) / (b^2 + 1);
+t124 = (t123 * b + 4) / (b^2 + 1);
+t125 = (t124 * b + 5) / (b^2 + 1);
+t126 = (t125 * b + 6) / (b^2 + 1);
+t127 = (t126 * b + 7) / (b^2 + 1);
+t128 = (t127 * b + 8) / (b^2 + 1);
+t129 = (t128 * b + 9) / (b^2 + 1);
+t130 = (t129 * b + 0) / (b^2 + 1);
+t131 = (t130 * b + 1) / (b^2 + 1);
+t132 = (t131 * b + 2) / (b^2 + 1);
+t133 = (t132 * b + 3) / (b^2 + 1);
+t134 = (t133 * b + 4) / (b^2 + 1);
+t135 = (t134 * b + 5) / (b^2 + 1);
+t136 = (t135 * b + 6) / (b^2 + 1);
+t137 = (t136 * b + 7) / (b^2 + 1);
+t138 = (t137 * b + 8) / (b^2 + 1);
+t139 = (t138 * b + 9) / (b^2 + 1);
+t140 = (t139 * b + 0) / (b^2 + 1);
+t141 = (t140 * b + 1) / (b^2 + 1);
+t142 = (t141 * b + 2) / (b^2 + 1);
+t143 = (t142 * b + 3) / (b^2 + 1);
+t144 = (t143 * b + 4) / (b^2 + 1);
+t145 = (t144 * b + 5) / (b^2 + 1);
+t146 = (t145 * b + 6) / (b^2 + 1);
+t147 = (t146 * b + 7) / (b^2 + 1);
+t148 = (t147 * b + 8) / (b^2 + 1);
+t149 = (t148 * b + 9) / (b^2 + 1);
+t150 = (t149 * b + 0) / (b^2 + 1);
+t151 = (t150 * b + 1) / (b^2 + 1);
+t152 = (t151 * b + 2) / (b^2 + 1);
+t153 = (t152 * b + 3) / (b^2 + 1);
+t154 = (t153 * b + 4) / (b^2 + 1);
+t155 = (t154 * b + 5) / (b^2 + 1);
+t156 = (t155 * b + 6) / (b^2 + 1);
+t157 = (t156 * b + 7) / (b^2 + 1);
+t158 = (t157 * b + 8) / (b^2 + 1);
+t159 = (t158 * b + 9) / (b^2 + 1);
+t160 = (t159 * b + 0) / (b^2 + 1);
+t161 = (t160 * b + 1) / (b^2 + 1);
+t162 = (t161 * b + 2) / (b^2 + 1);
+t163 = (t162 * b + 3) / (b^2 + 1);
+t164 = (t163 * b + 4) / (b^2 + 1);
+t165 = (t164 * b + 5) / (b^2 + 1);
+t166 = (t165 * b + 6) / (b^2 + 1);
+t167 = (t166 * b + 7) / (b^2 + 1);
+t168 = (t167 * b + 8) / (b^2 + 1);
+t169 = (t168 * b + 9) / (b^2 + 1);
+t170 = (t169 * b + 0) / (b^2 + 1);
+t171 = (t170 * b + 1) / (b^2 + 1);
+t172 = (t171 * b + 2) / (b^2 + 1);
+t173 = (t172 * b + 3) / (b^2 + 1);
+t174 = (t173 * b + 4) / (b^2 + 1);
+t175 = (t174 * b + 5) / (b^2 + 1);
+t176 = (t175 * b + 6) / (b^2 + 1);
+t177 = (t176 * b + 7) / (b^2 + 1);
+t178 = (t177 * b + 8) / (b^2 + 1);
+t179 = (t178 * b + 9) / (b^2 + 1);
+t180 = (t179 * b + 0) / (b^2 + 1);
+t181 = (t180 * b + 1) / (b^2 + 1);
+t182 = (t181 * b + 2) / (b^2 + 1);
+t183 = (t182 * b + 3) / (b^2 + 1);
+t184 = (t183 * b + 4) / (b^2 + 1);
+t185 = (t184 * b + 5) / (b^2 + 1);
+t186 = (t185 * b + 6) / (b^2 + 1);
+t187 = (t186 * b + 7) / (b^2 + 1);
+t188 = (t187 * b + 8) / (b^2 + 1);
+t189 = (t188 * b + 9) / (b^2 + 1);
+t190 = (t189 * b + 0) / (b^2 + 1);
+t191 = (t190 * b + 1) / (b^2 + 1);
+t192 = (t191 * b + 2) / (b^2 + 1);
+t193 = (t192 * b + 3) / (b^2 + 1);
+t194 = (t193 * b + 4) / (b^2 + 1);
+t195 = (t194 * b + 5) / (b^2 + 1);
+t196 = (t195 * b + 6) / (b^2 + 1);
+t197 = (t196 * b + 7) / (b^2 + 1);
+t198 = (t197 * b + 8) / (b^2 + 1);
+t199 = (t198 * b + 9) / (b^2 + 1);
+t200 = (t199 * b + 0) / (b^2 + 1);
+t201 = (t200 * b + 1) / (b^2 + 1);
+t202 = (t201 * b + 2) / (b^2 + 1);
+t203 = (t202 * b + 3) / (b^2 + 1);
+t204 = (t203 * b + 4) / (b^2 + 1);
+t205 = (t204 * b + 5) / (b^2 + 1);
+t206 = (t205 * b + 6) / (b^2 + 1);
+t207 = (t206 * b + 7) / (b^2 + 1);
+t208 = (t207 * b + 8) / (b^2 + 1);
+t209 = (t208 * b + 9) / (b^2 + 1);
+t210 = (t209 * b + 0) / (b^2 + 1);
+t211 = (t210 * b + 1) / (b^2 + 1);
+t212 = (t211 * b + 2) / (b^2 + 1);
+t213 = (t212 * b + 3) / (b^2 + 1);
+t214 = (t213 * b + 4) / (b^2 + 1);
+t215 = (t214 * b + 5) / (b^2 + 1);
+t216 = (t215 * b + 6) / (b^2 + 1);
+t217 = (t216 * b + 7) / (b^2 + 1);
+t218 = (t217 * b + 8) / (b^2 + 1);
+t219 = (t218 * b + 9) / (b^2 + 1);
+t220 = (t219 * b + 0) / (b^2 + 1);
+t221 = (t220 * b + 1) / (b^2 + 1);
+t222 = (t221 * b + 2) / (b^2 + 1);
+t223 = (t222 * b + 3) / (b^2 + 1);
+t224 = (t223 * b + 4) / (b^2 + 1);
+t225 = (t224 * b + 5) / (b^2 + 1);
+t226 = (t225 * b + 6) / (b^2 + 1);
+t227 = (t226 * b + 7) / (b^2 + 1);
+t228 = (t227 * b + 8) / (b^2 + 1);
+t229 = (t228 * b + 9) / (b^2 + 1);
+t230 = (t229 * b + 0) / (b^2 + 1);
+t231 = (t230 * b + 1) / (b^2 + 1);
+t232 = (t231 * b + 2) / (b^2 + 1);
+t233 = (t232 * b + 3) / (b^2 + 1);
+t234 = (t233 * b + 4) / (b^2 + 1);
+t235 = (t234 * b + 5) / (b^2 + 1);
+t236 = (t235 * b + 6) / (b^2 + 1);
+t237 = (t236 * b + 7) / (b^2 + 1);
+t238 = (t237 * b + 8) / (b^2 + 1);
+t239 = (t238 * b + 9) / (b^2 + 1);
+t240 = (t239 * b + 0) / (b^2 + 1);
+t241 = (t240 * b + 1) / (b^2 + 1);
+t242 = (t241 * b + 2) / (b^2 + 1);
+t243 = (t242 * b + 3) / (b^2 + 1);
+t244 = (t243 * b + 4) / (b^2 + 1);
+t245 = (t244 * b + 5) / (b^2 + 1);
+t246 = (t245 * b + 6) / (b^2 + 1);
+t247 = (t246 * b + 7) / (b^2 + 1);
+t248 = (t247 * b + 8) / (b^2 + 1);
+t249 = (t248 * b + 9) / (b^2 + 1);
+t250 = (t249 * b + 0) / (b^2 + 1);
+t251 = (t250 * b + 1) / (b^2 + 1);
+t252 = (t251 * b + 2) / (b^2 + 1);
+t253 = (t252 * b + 3) / (b^2 + 1);
+t254 = (t253 * b + 4) / (b^2 + 1);
+t255 = (t254 * b + 5) / (b^2 + 1);
+t256 = (t255 * b + 6) / (b^2 + 1);
+t257 = (t256 * b + 7) / (b^2 + 1);
+t258 = (t257 * b + 8) / (b^2 + 1);
+t259 = (t258 * b + 9) / (b^2 + 1);
+t260 = (t259 * b + 0) / (b^2 + 1);
+t261 = (t260 * b + 1) / (b^2 + 1);
+t262 = (t261 * b + 2) / (b^2 + 1);
+t263 = (t262 * b + 3) / (b^2 + 1);
+t264 = (t263 * b + 4) / (b^2 + 1);
+t265 = (t264 * b + 5) / (b^2 + 1);
+t266 = (t265 * b + 6) / (b^2 + 1);
+t267 = (t266 * b + 7) / (b^2 + 1);
+t268 = (t267 * b + 8) / (b^2 + 1);
+t269 = (t268 * b + 9) / (b^2 + 1);
+t270 = (t269 * b + 0) / (b^2 + 1);
+t271 = (t270 * b + 1) / (b^2 + 1);
+t272 = (t271 * b + 2) / (b^2 + 1);
+t273 = (t272 * b + 3) / (b^2 + 1);
+t274 = (t273 * b + 4) / (b^2 + 1);
+t275 = (t274 * b + 5) / (b^2 + 1);
+t276 = (t275 * b + 6) / (b^2 + 1);
+t277 = (t276 * b + 7) / (b^2 + 1);
+t278 = (t277 * b + 8) / (b^2 + 1);
+t279 = (t278 * b + 9) / (b^2 + 1);
+t280 = (t279 * b + 0) / (b^2 + 1);
+t281 = (t280 * b + 1) / (b^2 + 1);
+t282 = (t281 * b + 2) / (b^2 + 1);
+t283 = (t282 * b + 3) / (b^2 + 1);
+t284 = (t283 * b + 4) / (b^2 + 1);
+t285 = (t284 * b + 5) / (b^2 + 1);
+t286 = (t285 * b + 6) / (b^2 + 1);
+t287 = (t286 * b + 7) / (b^2 + 1);
+t288 = (t287 * b + 8) / (b^2 + 1);
+t289 = (t288 * b + 9) / (b^2 + 1);
+t290 = (t289 * b + 0) / (b^2 + 1);
+t291 = (t290 * b + 1) / (b^2 + 1);
+t292 = (t291 * b + 2) / (b^2 + 1);
+t293 = (t292 * b + 3) / (b^2 + 1);
+t294 = (t293 * b + 4) / (b^2 + 1);
+t295 = (t294 * b + 5) / (b^2 + 1);
+t296 = (t295 * b + 6) / (b^2 + 1);
+t297 = (t296 * b + 7) / (b^2 + 1);
+t298 = (t297 * b + 8) / (b^2 + 1);
+t299 = (t298 * b + 9) / (b^2 + 1);
+t300 = (t299 * b + 0) / (b^2 + 1);
+t301 = (t300 * b + 1) / (b^2 + 1);
+t302 = (t301 * b + 2) / (b^2 + 1);
+t303 = (t302 * b + 3) / (b^2 + 1);
+t304 = (t303 * b + 4) / (b^2 + 1);
+t305 = (t304 * b + 5) / (b^2 + 1);
+t306 = (t305 * b + 6) / (b^2 + 1);
+t307 = (t306 * b + 7) / (b^2 + 1);
+t308 = (t307 * b + 8) / (b^2 + 1);
+t309 = (t308 * b + 9) / (b^2 + 1);
+t310 = (t309 * b + 0) / (b^2 + 1);
+t311 = (t310 * b + 1) / (b^2 + 1);
+t312 = (t311 * b + 2) / (b^2 + 1);
+t313 = (t312 * b + 3) / (b^2 + 1);
+t314 = (t313 * b + 4) / (b^2 + 1);
+t315 = (t314 * b + 5) / (b^2 + 1);
+t316 = (t315 * b + 6) / (b^2 + 1);
+t317 = (t316 * b + 7) / (b^2 + 1);
+t318 = (t317 * b + 8) / (b^2 + 1);
+t319 = (t318 * b + 9) / (b^2 + 1);
+t320 = (t319 * b + 0) / (b^2 + 1);
+t321 = (t320 * b + 1) / (b^2 + 1);
+t322 = (t321 * b + 2) / (b^2 + 1);
+t323 = (t322 * b + 3) / (b^2 + 1);
+t324 = (t323 * b + 4) / (b^2 + 1);
+t325 = (t324 * b + 5) / (b^2 + 1);
+t326 = (t325 * b + 6) / (b^2 + 1);
+t327 = (t326 * b + 7) / (b^2 + 1);
+t328 = (t327 * b + 8) / (b^2 + 1);
+t329 = (t328 * b + 9) / (b^2 + 1);
+t330 = (t329 * b + 0) / (b^2 + 1);
+t331 = (t330 * b + 1) / (b^2 + 1);
+t332 = (t331 * b + 2) / (b^2 + 1);
+t333 = (t332 * b + 3) / (b^2 + 1);
+t334 = (t333 * b + 4) / (b^2 + 1);
+t335 = (t334 * b + 5) / (b^2 + 1);
+t336 = (t335 * b + 6) / (b^2 + 1);
+t337 = (t336 * b + 7) / (b^2 + 1);
+t338 = (t337 * b + 8) / (b^2 + 1);
+t339 = (t338 * b + 9) / (b^2 + 1);
+t340 = (t339 * b + 0) / (b^2 + 1);
+t341 = (t340 * b + 1) / (b^2 + 1);
+t342 = (t341 * b + 2) / (b^2 + 1);
+t343 = (t342 * b + 3) / (b^2 + 1);
+t344 = (t343 * b + 4) / (b^2 + 1);
+t345 = (t344 * b + 5) / (b^2 + 1);
+t346 = (t345 * b + 6) / (b^2 + 1);
+t347 = (t346 * b + 7) / (b^2 + 1);
+t348 = (t347 * b + 8) / (b^2 + 1);
+t349 = (t348 * b + 9) / (b^2 + 1);
+t350 = (t349 * b + 0) / (b^2 + 1);
+t351 = (t350 * b + 1) / (b^2 + 1);
+t352 = (t351 * b + 2) / (b^2 + 1);
+t353 = (t352 * b + 3) / (b^2 + 1);
+t354 = (t353 * b + 4) / (b^2 + 1);
+t355 = (t354 * b + 5) / (b^2 + 1);
+t356 = (t355 * b + 6) / (b^2 + 1);
+t357 = (t356 * b + 7) / (b^2 + 1);
+t358 = (t357 * b + 8) / (b^2 + 1);
+t359 = (t358 * b + 9) / (b^2 + 1);
+t360 = (t359 * b + 0) / (b^2 + 1);
+t361 = (t360 * b + 1) / (b^2 + 1);
+t362 = (t361 * b + 2) / (b^2 + 1);
+t363 = (t362 * b + 3) / (b^2 + 1);
+t364 = (t363 * b + 4) / (b^2 + 1);
+t365 = (t364 * b + 5) / (b^2 + 1);
+t366 = (t365 * b + 6) / (b^2 + 1);
+t367 = (t366 * b + 7) / (b^2 + 1);
+t368 = (t367 * b + 8) / (b^2 + 1);
+t369 = (t368 * b + 9) / (b^2 + 1);
+t370 = (t369 * b + 0) / (b^2 + 1);
+t371 = (t370 * b + 1) / (b^2 + 1);
+t372 = (t371 * b + 2) / (b^2 + 1);
+t373 = (t372 * b + 3) / (b^2 + 1);
+t374 = (t373 * b + 4) / (b^2 + 1);
+t375 = (t374 * b + 5) / (b^2 + 1);
+t376 = (t375 * b + 6) / (b^2 + 1);
+t377 = (t376 * b + 7) / (b^2 + 1);
+t378 = (t377 * b + 8) / (b^2 + 1);
+t379 = (t378 * b + 9) / (b^2 + 1);
+t380 = (t379 * b + 0) / (b^2 + 1);
+t381 = (t380 * b + 1) / (b^2 + 1);
+t382 = (t381 * b + 2) / (b^2 + 1);
+t383 = (t382 * b + 3) / (b^2 + 1);
+t384 = (t383 * b + 4) / (b^2 + 1);
+t385 = (t384 * b + 5) / (b^2 + 1);
+t386 = (t385 * b + 6) / (b^2 + 1);
+t387 = (t386 * b + 7) / (b^2 + 1);
+t388 = (t387 * b + 8) / (b^2 + 1);
+t389 = (t388 * b + 9) / (b^2 + 1);
+t390 = (t389 * b + 0) / (b^2 + 1);
+t391 = (t390 * b + 1) / (b^2 + 1);
+t392 = (t391 * b + 2) / (b^2 + 1);
+t393 = (t392 * b + 3) / (b^2 + 1);
+t394 = (t393 * b + 4) / (b^2 + 1);
+t395 = (t394 * b + 5) / (b^2 + 1);
+t396 = (t395 * b + 6) / (b^2 + 1);
+t397 = (t396 * b + 7) / (b^2 + 1);
+t398 = (t397 * b + 8) / (b^2 + 1);
+t399 = (t398 * b + 9) / (b^2 + 1);
+t400 = (t399 * b + 0) / (b^2 + 1);
+t401 = (t400 * b + 1) / (b^2 + 1);
+t402 = (t401 * b + 2) / (b^2 + 1);
+t403 = (t402 * b + 3) / (b^2 + 1);
+t404 = (t403 * b + 4) / (b^2 + 1);
+t405 = (t404 * b + 5) / (b^2 + 1);
+t406 = (t405 * b + 6) / (b^2 + 1);
+t407 = (t406 * b + 7) / (b^2 + 1);
+t408 = (t407 * b + 8) / (b^2 + 1);
+t409 = (t408 * b + 9) / (b^2 + 1);
+t410 = (t409 * b + 0) / (b^2 + 1);
+t411 = (t410 * b + 1) / (b^2 + 1);
+t412 = (t411 * b + 2) / (b^2 + 1);
+t413 = (t412 * b + 3) / (b^2 + 1);
+t414 = (t413 * b + 4) / (b^2 + 1);
+t415 = (t414 * b + 5) / (b^2 + 1);
+t416 = (t415 * b + 6) / (b^2 + 1);
+t417 = (t416 * b + 7) / (b^2 + 1);
+t418 = (t417 * b + 8) / (b^2 + 1);
+t419 = (t418 * b + 9) / (b^2 + 1);
+t420 = (t419 * b + 0) / (b^2 + 1);
+t421 = (t420 * b + 1) / (b^2 + 1);
+t422 = (t421 * b + 2) / (b^2 + 1);
+t423 = (t422 * b + 3) / (b^2 + 1);
+t424 = (t423 * b + 4) / (b^2 + 1);
+t425 = (t424 * b + 5) / (b^2 + 1);
+t426 = (t425 * b + 6) / (b^2 + 1);
+t427 = (t426 * b + 7) / (b^2 + 1);
+t428 = (t427 * b + 8) / (b^2 + 1);
+t429 = (t428 * b + 9) / (b^2 + 1);
+t430 = (t429 * b + 0) / (b^2 + 1);
+t431 = (t430 * b + 1) / (b^2 + 1);
+t432 = (t431 * b + 2) / (b^2 + 1);
+t433 = (t432 * b + 3) / (b^2 + 1);
+t434 = (t433 * b + 4) / (b^2 + 1);
+t435 = (t434 * b + 5) / (b^2 + 1);
+t436 = (t435 * b + 6) / (b^2 + 1);
+t437 = (t436 * b + 7) / (b^2 + 1);
+t438 = (t437 * b + 8) / (b^2 + 1);
+t439 = (t438 * b + 9) / (b^2 + 1);
+t440 = (t439 * b + 0) / (b^2 + 1);
+t441 = (t440 * b + 1) / (b^2 + 1);
+t442 = (t441 * b + 2) / (b^2 + 1);
+t443 = (t442 * b + 3) / (b^2 + 1);
+t444 = (t443 * b + 4) / (b^2 + 1);
+t445 = (t444 * b + 5) / (b^2 + 1);
+t446 = (t445 * b + 6) / (b^2 + 1);
+t447 = (t446 * b + 7) / (b^2 + 1);
+t448 = (t447 * b + 8) / (b^2 + 1);
+t449 = (t448 * b + 9) / (b^2 + 1);
+t450 = (t449 * b + 0) / (b^2 + 1);
+t451 = (t450 * b + 1) / (b^2 + 1);
+t452 = (t451 * b + 2) / (b^2 + 1);
+t453 = (t452 * b + 3) / (b^2 + 1);
+t454 = (t453 * b + 4) / (b^2 + 1);
+t455 = (t454 * b + 5) / (b^2 + 1);
+t456 = (t455 * b + 6) / (b^2 + 1);
+t457 = (t456 * b + 7) / (b^2 + 1);
+t458 = (t457 * b + 8) / (b^2 + 1);
+t459 = (t458 * b + 9) / (b^2 + 1);
+t460 = (t459 * b + 0) / (b^2 + 1);
+t461 = (t460 * b + 1) / (b^2 + 1);
+t462 = (t461 * b + 2) / (b^2 + 1);
+t463 = (t462 * b + 3) / (b^2 + 1);
+t464 = (t463 * b + 4) / (b^2 + 1);
+t465 = (t464 * b + 5) / (b^2 + 1);
+t466 = (t465 * b + 6) / (b^2 + 1);
+t467 = (t466 * b + 7) / (b^2 + 1);
+t468 = (t467 * b + 8) / (b^2 + 1);
+t469 = (t468 * b + 9) / (b^2 + 1);
+t470 = (t469 * b + 0) / (b^2 + 1);
+t471 = (t470 * b + 1) / (b^2 + 1);
+t472 = (t471 * b + 2) / (b^2 + 1);
+t473 = (t472 * b + 3) / (b^2 + 1);
+t474 = (t473 * b + 4) / (b^2 + 1);
+t475 = (t474 * b + 5) / (b^2 + 1);
+t476 = (t475 * b + 6) / (b^2 + 1);
+t477 = (t476 * b + 7) / (b^2 + 1);
+t478 = (t477 * b + 8) / (b^2 + 1);
+t479 = (t478 * b + 9) / (b^2 + 1);
+t480 = (t479 * b + 0) / (b^2 + 1);
+t481 = (t480 * b + 1) / (b^2 + 1);
+t482 = (t481 * b + 2) / (b^2 + 1);
+t483 = (t482 * b + 3) / (b^2 + 1);
+t484 = (t483 * b + 4) / (b^2 + 1);
+t485 = (t484 * b + 5) / (b^2 + 1);
+t486 = (t485 * b + 6) / (b^2 + 1);
+t487 = (t486 * b + 7) / (b^2 + 1);
+t488 = (t487 * b + 8) / (b^2 + 1);
+t489 = (t488 * b + 9) / (b^2 + 1);
+t490 = (t489 * b + 0) / (b^2 + 1);
+t491 = (t490 * b + 1) / (b^2 + 1);
+t492 = (t491 * b + 2) / (b^2 + 1);
+t493 = (t492 * b + 3) / (b^2 + 1);
+t494 = (t493 * b + 4) / (b^2 + 1);
+t495 = (t494 * b + 5) / (b^2 + 1);
+t496 = (t495 * b + 6) / (b^2 + 1);
+t497 = (t496 * b + 7) / (b^2 + 1);
+t498 = (t497 * b + 8) / (b^2 + 1);
+t499 = (t498 * b + 9) / (b^2 + 1);
+t500 = (t499 * b + 0) / (b^2 + 1);
+t501 = (t500 * b + 1) / (b^2 + 1);
+t502 = (t501 * b + 2) / (b^2 + 1);
+t503 = (t502 * b + 3) / (b^2 + 1);
+t504 = (t503 * b + 4) / (b^2 + 1);
+t505 = (t504 * b + 5) / (b^2 + 1);
+t506 = (t505 * b + 6) / (b^2 + 1);
+t507 = (t506 * b + 7) / (b^2 + 1);
+t508 = (t507 * b + 8) / (b^2 + 1);
+t509 = (t508 * b + 9) / (b^2 + 1);
+t510 = (t509 * b + 0) / (b^2 + 1);
+t511 = (t510 * b + 1) / (b^2 + 1);
+t512 = (t511 * b + 2) / (b^2 + 1);
+t513 = (t512 * b + 3) / (b^2 + 1);
+t514 = (t513 * b + 4) / (b^2 + 1);
+t515 = (t514 * b + 5) / (b^2 + 1);
+t516 = (t515 * b + 6) / (b^2 + 1);
+t517 = (t516 * b + 7) / (b^2 + 1);
+t518 = (t517 * b + 8) / (b^2 + 1);
+t519 = (t518 * b + 9) / (b^2 + 1);
+t520 = (t519 * b + 0) / (b^2 + 1);
+t521 = (t520 * b + 1) / (b^2 + 1);
+t522 = (t521 * b + 2) / (b^2 + 1);
+t523 = (t522 * b + 3) / (b^2 + 1);
+t524 = (t523 * b + 4) / (b^2 + 1);
+t525 = (t524 * b + 5) / (b^2 + 1);
+t526 = (t525 * b + 6) / (b^2 + 1);
+t527 = (t526 * b + 7) / (b^2 + 1);
+t528 = (t527 * b + 8) / (b^2 + 1);
+t529 = (t528 * b + 9) / (b^2 + 1);
+t530 = (t529 * b + 0) / (b^2 + 1);
+t531 = (t530 * b + 1) / (b^2 + 1);
+t532 = (t531 * b + 2) / (b^2 + 1);
+t533 = (t532 * b + 3) / (b^2 + 1);
+t534 = (t533 * b + 4) / (b^2 + 1);
+t535 = (t534 * b + 5) / (b^2 + 1);
+t536 = (t535 * b + 6) / (b^2 + 1);
+t537 = (t536 * b + 7) / (b^2 + 1);
+t538 = (t537 * b + 8) / (b^2 + 1);
+t539 = (t538 * b + 9) / (b^2 + 1);
+t540 = (t539 * b + 0) / (b^2 + 1);
+t541 = (t540 * b + 1) / (b^2 + 1);
+t542 = (t541 * b + 2) / (b^2 + 1);
+t543 = (t542 * b + 3) / (b^2 + 1);
+t544 = (t543 * b + 4) / (b^2 + 1);
+t545 = (t544 * b + 5) / (b^2 + 1);
+t546 = (t545 * b + 6) / (b^2 + 1);
+t547 = (t546 * b + 7) / (b^2 + 1);
+t548 = (t547 * b + 8) / (b^2 + 1);
+t549 = (t548 * b + 9) / (b^2 + 1);
+t550 = (t549 * b + 0) / (b^2 + 1);
+t551 = (t550 * b + 1) / (b^2 + 1);
+t552 = (t551 * b + 2) / (b^2 + 1);
+t553 = (t552 * b + 3) / (b^2 + 1);
+t554 = (t553 * b + 4) / (b^2 + 1);
+t555 = (t554 * b + 5) / (b^2 + 1);
+t556 = (t555 * b + 6) / (b^2 + 1);
+t557 = (t556 * b + 7) / (b^2 + 1);
+t558 = (t557 * b + 8) / (b^2 + 1);
+t559 = (t558 * b + 9) / (b^2 + 1);
+t560 = (t559 * b + 0) / (b^2 + 1);
+t561 = (t560 * b + 1) / (b^2 + 1);
+t562 = (t561 * b + 2) / (b^2 + 1);
+t563 = (t562 * b + 3) / (b^2 + 1);
+t564 = (t563 * b + 4) / (b^2 + 1);
+t565 = (t564 * b + 5) / (b^2 + 1);
+t566 = (t565 * b + 6) / (b^2 + 1);
+t567 = (t566 * b + 7) / (b^2 + 1);
+t568 = (t567 * b + 8) / (b^2 + 1);
+t569 = (t568 * b + 9) / (b^2 + 1);
+t570 = (t569 * b + 0) / (b^2 + 1);
+t571 = (t570 * b + 1) / (b^2 + 1);
+t572 = (t571 * b + 2) / (b^2 + 1);
+t573 = (t572 * b + 3) / (b^2 + 1);
+t574 = (t573 * b + 4) / (b^2 + 1);
+t575 = (t574 * b + 5) / (b^2 + 1);
+t576 = (t575 * b + 6) / (b^2 + 1);
+t577 = (t576 * b + 7) / (b^2 + 1);
+t578 = (t577 * b + 8) / (b^2 + 1);
+t579 = (t578 * b + 9) / (b^2 + 1);
+t580 = (t579 * b + 0) / (b^2 + 1);
+t581 = (t580 * b + 1) / (b^2 + 1);
+t582 = (t581 * b + 2) / (b^2 + 1);
+t583 = (t582 * b + 3) / (b^2 + 1);
+t584 = (t583 * b + 4) / (b^2 + 1);
+t585 = (t584 * b + 5) / (b^2 + 1);
+t586 = (t585 * b + 6) / (b^2 + 1);
+t587 = (t586 * b + 7) / (b^2 + 1);
+t588 = (t587 * b + 8) / (b^2 + 1);
+t589 = (t588 * b + 9) / (b^2 + 1);
+t590 = (t589 * b + 0) / (b^2 + 1);
+t591 = (t590 * b + 1) / (b^2 + 1);
+t592 = (t591 * b + 2) / (b^2 + 1);
+t593 = (t592 * b + 3) / (b^2 + 1);
+t594 = (t593 * b + 4) / (b^2 + 1);
+t595 = (t594 * b + 5) / (b^2 + 1);
+t596 = (t595 * b + 6) / (b^2 + 1);
+t597 = (t596 * b + 7) / (b^2 + 1);
+t598 = (t597 * b + 8) / (b^2 + 1);
+t599 = (t598 * b + 9) / (b^2 + 1);
+t600 = (t599 * b + 0) / (b^2 + 1);
+t601 = (t600 * b + 1) / (b^2 + 1);
+t602 = (t601 * b + 2) / (b^2 + 1);
+t603 = (t602 * b + 3) / (b^2 + 1);
+t604 = (t603 * b + 4) / (b^2 + 1);
+t605 = (t604 * b + 5) / (b^2 + 1);
+t606 = (t605 * b + 6) / (b^2 + 1);
+t607 = (t606 * b + 7) / (b^2 + 1);
+t608 = (t607 * b + 8) / (b^2 + 1);
+t609 = (t608 * b + 9) / (b^2 + 1);
+t610 = (t609 * b + 0) / (b^2 + 1);
+t611 = (t610 * b + 1) / (b^2 + 1);
+t612 = (t611 * b + 2) / (b^2 + 1);
+t613 = (t612 * b + 3) / (b^2 + 1);
+t614 = (t613 * b + 4) / (b^2 + 1);
+t615 = (t614 * b + 5) / (b^2 + 1);
+t616 = (t615 * b + 6) / (b^2 + 1);
+t617 = (t616 * b + 7) / (b^2 + 1);
+t618 = (t617 * b + 8) / (b^2 + 1);
+t619 = (t618 * b + 9) / (b^2 + 1);
+t620 = (t619 * b + 0) / (b^2 + 1);
+t621 = (t620 * b + 1) / (b^2 + 1);
+t622 = (t621 * b + 2) / (b^2 + 1);
+t623 = (t622 * b + 3) / (b^2 + 1);
+t624 = (t623 * b + 4) / (b^2 + 1);
+t625 = (t624 * b + 5) / (b^2 + 1);
+t626 = (t625 * b + 6) / (b^2 + 1);
+t627 = (t626 * b + 7) / (b^2 + 1);
+t628 = (t627 * b + 8) / (b^2 + 1);
+t629 = (t628 * b + 9) / (b^2 + 1);
+t630 = (t629 * b + 0) / (b^2 + 1);
+t631 = (t630 * b + 1) / (b^2 + 1);
+t632 = (t631 * b + 2) / (b^2 + 1);
+t633 = (t632 * b + 3) / (b^2 + 1);
+t634 = (t633 * b + 4) / (b^2 + 1);
+t635 = (t634 * b + 5) / (b^2 + 1);
+t636 = (t635 * b + 6) / (b^2 + 1);
+t637 = (t636 * b + 7) / (b^2 + 1);
+t638 = (t637 * b + 8) / (b^2 + 1);
+t639 = (t638 * b + 9) / (b^2 + 1);
+t640 = (t639 * b + 0) / (b^2 + 1);
+t641 = (t640 * b + 1) / (b^2 + 1);
+t642 = (t641 * b + 2) / (b^2 + 1);
+t643 = (t642 * b + 3) / (b^2 + 1);
+t644 = (t643 * b + 4) / (b^2 + 1);
+t645 = (t644 * b + 5) / (b^2 + 1);
+t646 = (t645 * b + 6) / (b^2 + 1);
+t647 = (t646 * b + 7) / (b^2 + 1);
+t648 = (t647 * b + 8) / (b^2 + 1);
+t649 = (t648 * b + 9) / (b^2 + 1);
+t650 = (t649 * b + 0) / (b^2 + 1);
+t651 = (t650 * b + 1) / (b^2 + 1);
+t652 = (t651 * b + 2) / (b^2 + 1);
+t653 = (t652 * b + 3) / (b^2 + 1);
+t654 = (t653 * b + 4) / (b^2 + 1);
+t655 = (t654 * b + 5) / (b^2 + 1);
+t656 = (t655 * b + 6) / (b^2 + 1);
+t657 = (t656 * b + 7) / (b^2 + 1);
+t658 = (t657 * b + 8) / (b^2 + 1);
+t659 = (t658 * b + 9) / (b^2 + 1);
+t660 = (t659 * b + 0) / (b^2 + 1);
+t661 = (t660 * b + 1) / (b^2 + 1);
+t662 = (t661 * b + 2) / (b^2 + 1);
+t663 = (t662 * b + 3) / (b^2 + 1);
+t664 = (t663 * b + 4) / (b^2 + 1);
+t665 = (t664 * b + 5) / (b^2 + 1);
+t666 = (t665 * b + 6) / (b^2 + 1);
+t667 = (t666 * b + 7) / (b^2 + 1);
+t668 = (t667 * b + 8) / (b^2 + 1);
+t669 = (t668 * b + 9) / (b^2 + 1);
+t670 = (t669 * b + 0) / (b^2 + 1);
+t671 = (t670 * b + 1) / (b^2 + 1);
+t672 = (t671 * b + 2) / (b^2 + 1);
+t673 = (t672 * b + 3) / (b^2 + 1);
+t674 = (t673 * b + 4) / (b^2 + 1);
+t675 = (t674 * b + 5) / (b^2 + 1);
+t676 = (t675 * b + 6) / (b^2 + 1);
+t677 = (t676 * b + 7) / (b^2 + 1);
+t678 = (t677 * b + 8) / (b^2 + 1);
+t679 = (t678 * b + 9) / (b^2 + 1);
+t680 = (t679 * b + 0) / (b^2 + 1);
+t681 = (t680 * b + 1) / (b^2 + 1);
+t682 = (t681 * b + 2) / (b^2 + 1);
+t683 = (t682 * b + 3) / (b^2 + 1);
+t684 = (t683 * b + 4) / (b^2 + 1);
+t685 = (t684 * b + 5) / (b^2 + 1);
+t686 = (t685 * b + 6) / (b^2 + 1);
+t687 = (t686 * b + 7) / (b^2 + 1);
+t688 = (t687 * b + 8) / (b^2 + 1);
+t689 = (t688 * b + 9) / (b^2 + 1);
+t690 = (t689 * b + 0) / (b^2 + 1);
+t691 = (t690 * b + 1) / (b^2 + 1);
+t692 = (t691 * b + 2) / (b^2 + 1);
+t693 = (t692 * b + 3) / (b^2 + 1);
+t694 = (t693 * b + 4) / (b^2 + 1);
+t695 = (t694 * b + 5) / (b^2 + 1);
+t696 = (t695 * b + 6) / (b^2 + 1);
+t697 = (t696 * b + 7) / (b^2 + 1);
+t698 = (t697 * b + 8) / (b^2 + 1);
+t699 = (t698 * b + 9) / (b^2 + 1);
+t700 = (t699 * b + 0) / (b^2 + 1);
+t701 = (t700 * b + 1) / (b^2 + 1);
+t702 = (t701 * b + 2) / (b^2 + 1);
+t703 = (t702 * b + 3) / (b^2 + 1);
+t704 = (t703 * b + 4) / (b^2 + 1);
+t705 = (t704 * b + 5) / (b^2 + 1);
+t706 = (t705 * b + 6) / (b^2 + 1);
+t707 = (t706 * b + 7) / (b^2 + 1);
+t708 = (t707 * b + 8) / (b^2 + 1);
+t709 = (t708 * b + 9) / (b^2 + 1);
+t710 = (t709 * b + 0) / (b^2 + 1);
+t711 = (t710 * b + 1) / (b^2 + 1);
+t712 = (t711 * b + 2) / (b^2 + 1);
+t713 = (t712 * b + 3) / (b^2 + 1);
+t714 = (t713 * b + 4) / (b^2 + 1);
+t715 = (t714 * b + 5) / (b^2 + 1);
+t716 = (t715 * b + 6) / (b^2 + 1);
+t717 = (t716 * b + 7) / (b^2 + 1);
+t718 = (t717 * b + 8) / (b^2 + 1);
+t719 = (t718 * b + 9) / (b^2 + 1);
+t720 = (t719 * b + 0) / (b^2 + 1);
+t721 = (t720 * b + 1) / (b^2 + 1);
+t722 = (t721 * b + 2) / (b^2 + 1);
+t723 = (t722 * b + 3) / (b^2 + 1);
+t724 = (t723 * b + 4) / (b^2 + 1);
+t725 = (t724 * b + 5) / (b^2 + 1);
+t726 = (t725 * b + 6) / (b^2 + 1);
+t727 = (t726 * b + 7) / (b^2 + 1);
+t728 = (t727 * b + 8) / (b^2 + 1);
+t729 = (t728 * b + 9) / (b^2 + 1);
+t730 = (t729 * b + 0) / (b^2 + 1);
+t731 = (t730 * b + 1) / (b^2 + 1);
+t732 = (t731 * b + 2) / (b^2 + 1);
+t733 = (t732 * b + 3) / (b^2 + 1);
+t734 = (t733 * b + 4) / (b^2 + 1);
+t735 = (t734 * b + 5) / (b^2 + 1);
+t736 = (t735 * b + 6) / (b^2 + 1);
+t737 = (t736 * b + 7) / (b^2 + 1);
+t738 = (t737 * b + 8) / (b^2 + 1);
+t739 = (t738 * b + 9) / (b^2 + 1);
+t740 = (t739 * b + 0) / (b^2 + 1);
+t741 = (t740 * b + 1) / (b^2 + 1);
+t742 = (t741 * b + 2) / (b^2 + 1);
+t743 = (t742 * b + 3) / (b^2 + 1);
+t744 = (t743 * b + 4) / (b^2 + 1);
+t745 = (t744 * b + 5) / (b^2 + 1);
+t746 = (t745 * b + 6) / (b^2 + 1);
+t747 = (t746 * b + 7) / (b^2 + 1);
+t748 = (t747 * b + 8) / (b^2 + 1);
+t749 = (t748 * b + 9) / (b^2 + 1);
+t750 = (t749 * b + 0) / (b^2 + 1);
+t751 = (t750 * b + 1) / (b^2 + 1);
+t752 = (t751 * b + 2) / (b^2 + 1);
+t753 = (t752 * b + 3) / (b^2 + 1);
+t754 = (t753 * b + 4) / (b^2 + 1);
+t755 = (t754 * b + 5) / (b^2 + 1);
+t756 = (t755 * b + 6) / (b^2 + 1);
+t757 = (t756 * b + 7) / (b^2 + 1);
+t758 = (t757 * b + 8) / (b^2 + 1);
+t759 = (t758 * b + 9) / (b^2 + 1);
+t760 = (t759 * b + 0) / (b^2 + 1);
+t761 = (t760 * b + 1) / (b^2 + 1);
+t762 = (t761 * b + 2) / (b^2 + 1);
+t763 = (t762 * b + 3) / (b^2 + 1);
+t764 = (t763 * b + 4) / (b^2 + 1);
+t765 = (t764 * b + 5) / (b^2 + 1);
+t766 = (t765 * b + 6) / (b^2 + 1);
+t767 = (t766 * b + 7) / (b^2 + 1);
+t768 = (t767 * b + 8) / (b^2 + 1);
+t769 = (t768 * b + 9) / (b^2 + 1);
+t770 = (t769 * b + 0) / (b^2 + 1);
+t771 = (t770 * b + 1) / (b^2 + 1);
+t772 = (t771 * b + 2) / (b^2 + 1);
+t773 = (t772 * b + 3) / (b^2 + 1);
+t774 = (t773 * b + 4) / (b^2 + 1);
+t775 = (t774 * b + 5) / (b^2 + 1);
+t776 = (t775 * b + 6) / (b^2 + 1);
+t777 = (t776 * b + 7) / (b^2 + 1);
+t778 = (t777 * b + 8) / (b^2 + 1);
+t779 = (t778 * b + 9) / (b^2 + 1);
+t780 = (t779 * b + 0) / (b^2 + 1);
+t781 = (t780 * b + 1) / (b^2 + 1);
+t782 = (t781 * b + 2) / (b^2 + 1);
+t783 = (t782 * b + 3) / (b^2 + 1);
+t784 = (t783 * b + 4) / (b^2 + 1);
+t785 = (t784 * b + 5) / (b^2 + 1);
+t786 = (t785 * b + 6) / (b^2 + 1);
+t787 = (t786 * b + 7) / (b^2 + 1);
+t788 = (t787 * b + 8) / (b^2 + 1);
+t789 = (t788 * b + 9) / (b^2 + 1);
+t790 = (t789 * b + 0) / (b^2 + 1);
+t791 = (t790 * b + 1) / (b^2 + 1);
+t792 = (t791 * b + 2) / (b^2 + 1);
+t793 = (t792 * b + 3) / (b^2 + 1);
+t794 = (t793 * b + 4) / (b^2 + 1);
+t795 = (t794 * b + 5) / (b^2 + 1);
+t796 = (t795 * b + 6) / (b^2 + 1);
+t797 = (t796 * b + 7) / (b^2 + 1);
+t798 = (t797 * b + 8) / (b^2 + 1);
+t799 = (t798 * b + 9) / (b^2 + 1);
+t800 = (t799 * b + 0) / (b^2 + 1);
+t801 = (t800 * b + 1) / (b^2 + 1);
+t802 = (t801 * b + 2) / (b^2 + 1);
+t803 = (t802 * b + 3) / (b^2 + 1);
+t804 = (t803 * b + 4) / (b^2 + 1);
+t805 = (t804 * b + 5) / (b^2 + 1);
+t806 = (t805 * b + 6) / (b^2 + 1);
+t807 = (t806 * b + 7) / (b^2 + 1);
+t808 = (t807 * b + 8) / (b^2 + 1);
+t809 = (t808 * b + 9) / (b^2 + 1);
+t810 = (t809 * b + 0) / (b^2 + 1);
+t811 = (t810 * b + 1) / (b^2 + 1);
+t812 = (t811 * b + 2) / (b^2 + 1);
+t813 = (t812 * b + 3) / (b^2 + 1);
+t814 = (t813 * b + 4) / (b^2 + 1);
+t815 = (t814 * b + 5) / (b^2 + 1);
+t816 = (t815 * b + 6) / (b^2 + 1);
+t817 = (t816 * b + 7) / (b^2 + 1);
+t818 = (t817 * b + 8) / (b^2 + 1);
+t819 = (t818 * b + 9) / (b^2 + 1);
+t820 = (t819 * b + 0) / (b^2 + 1);
+t821 = (t820 * b + 1) / (b^2 + 1);
+t822 = (t821 * b + 2) / (b^2 + 1);
+t823 = (t822 * b + 3) / (b^2 + 1);
+t824 = (t823 * b + 4) / (b^2 + 1);
+t825 = (t824 * b + 5) / (b^2 + 1);
+t826 = (t825 * b + 6) / (b^2 + 1);
+t827 = (t826 * b + 7) / (b^2 + 1);
+t828 = (t827 * b + 8) / (b^2 + 1);
+t829 = (t828 * b + 9) / (b^2 + 1);
+t830 = (t829 * b + 0) / (b^2 + 1);
+t831 = (t830 * b + 1) / (b^2 + 1);
+t832 = (t831 * b + 2) / (b^2 + 1);
+t833 = (t832 * b + 3) / (b^2 + 1);
+t834 = (t833 * b + 4) / (b^2 + 1);
+t835 = (t834 * b + 5) / (b^2 + 1);
+t836 = (t835 * b + 6) / (b^2 + 1);
+t837 = (t836 * b + 7) / (b^2 + 1);
+t838 = (t837 * b + 8) / (b^2 + 1);
+t839 = (t838 * b + 9) / (b^2 + 1);
+t840 = (t839 * b + 0) / (b^2 + 1);
+t841 = (t840 * b + 1) / (b^2 + 1);
+t842 = (t841 * b + 2) / (b^2 + 1);
+t843 = (t842 * b + 3) / (b^2 + 1);
+t844 = (t843 * b + 4) / (b^2 + 1);
+t845 = (t844 * b + 5) / (b^2 + 1);
+t846 = (t845 * b + 6) / (b^2 + 1);
+t847 = (t846 * b + 7) / (b^2 + 1);
+t848 = (t847 * b + 8) / (b^2 + 1);
+t849 = (t848 * b + 9) / (b^2 + 1);
+t850 = (t849 * b + 0) / (b^2 + 1);
+t851 = (t850 * b + 1) / (b^2 + 1);
+t852 = (t851 * b + 2) / (b^2 + 1);
+t853 = (t852 * b + 3) / (b^2 + 1);
+t854 = (t853 * b + 4) / (b^2 + 1);
+t855 = (t854 * b + 5) / (b^2 + 1);
+t856 = (t855 * b + 6) / (b^2 + 1);
+t857 = (t856 * b + 7) / (b^2 + 1);
+t858 = (t857 * b + 8) / (b^2 + 1);
+t859 = (t858 * b + 9) / (b^2 + 1);
+t860 = (t859 * b + 0) / (b^2 + 1);
+t861 = (t860 * b + 1) / (b^2 + 1);
+t862 = (t861 * b + 2) / (b^2 + 1);
+t863 = (t862 * b + 3) / (b^2 + 1);
+t864 = (t863 * b + 4) / (b^2 + 1);
+t865 = (t864 * b + 5) / (b^2 + 1);
+t866 = (t865 * b + 6) / (b^2 + 1);
+t867 = (t866 * b + 7) / (b^2 + 1);
+t868 = (t867 * b + 8) / (b^2 + 1);
+t869 = (t868 * b + 9) / (b^2 + 1);
+t870 = (t869 * b + 0) / (b^2 + 1);
+t871 = (t870 * b + 1) / (b^2 + 1);
+t872 = (t871 * b + 2) / (b^2 + 1);
+t873 = (t872 * b + 3) / (b^2 + 1);
+t874 = (t873 * b + 4) / (b^2 + 1);
+t875 = (t874 * b + 5) / (b^2 + 1);
+t876 = (t875 * b + 6) / (b^2 + 1);
+t877 = (t876 * b + 7) / (b^2 + 1);
+t878 = (t877 * b + 8) / (b^2 + 1);
+t879 = (t878 * b + 9) / (b^2 + 1);
+t880 = (t879 * b + 0) / (b^2 + 1);
+t881 = (t880 * b + 1) / (b^2 + 1);
+t882 = (t881 * b + 2) / (b^2 + 1);
+t883 = (t882 * b + 3) / (b^2 + 1);
+t884 = (t883 * b + 4) / (b^2 + 1);
+t885 = (t884 * b + 5) / (b^2 + 1);
+t886 = (t885 * b + 6) / (b^2 + 1);
+t887 = (t886 * b + 7) / (b^2 + 1);
+t888 = (t887 * b + 8) / (b^2 + 1);
+t889 = (t888 * b + 9) / (b^2 + 1);
+t890 = (t889 * b + 0) / (b^2 + 1);
+t891 = (t890 * b + 1) / (b^2 + 1);
+t892 = (t891 * b + 2) / (b^2 + 1);
+t893 = (t892 * b + 3) / (b^2 + 1);
+t894 = (t893 * b + 4) / (b^2 + 1);
+t895 = (t894 * b + 5) / (b^2 + 1);
+t896 = (t895 * b + 6) / (b^2 + 1);
+t897 = (t896 * b + 7) / (b^2 + 1);
+t898 = (t897 * b + 8) / (b^2 + 1);
+t899 = (t898 * b + 9) / (b^2 + 1);
+t900 = (t899 * b + 0) / (b^2 + 1);
+t901 = (t900 * b + 1) / (b^2 + 1);
+t902 = (t901 * b + 2) / (b^2 + 1);
+t903 = (t902 * b + 3) / (b^2 + 1);
+t904 = (t903 * b + 4) / (b^2 + 1);
+t905 = (t904 * b + 5) / (b^2 + 1);
+t906 = (t905 * b + 6) / (b^2 + 1);
+t907 = (t906 * b + 7) / (b^2 + 1);
+t908 = (t907 * b + 8) / (b^2 + 1);
+t909 = (t908 * b + 9) / (b^2 + 1);
+t910 = (t909 * b + 0) / (b^2 + 1);
+t911 = (t910 * b + 1) / (b^2 + 1);
+t912 = (t911 * b + 2) / (b^2 + 1);
+t913 = (t912 * b + 3) / (b^2 + 1);
+t914 = (t913 * b + 4) / (b^2 + 1);
+t915 = (t914 * b + 5) / (b^2 + 1);
+t916 = (t915 * b + 6) / (b^2 + 1);
+t917 = (t916 * b + 7) / (b^2 + 1);
+t918 = (t917 * b + 8) / (b^2 + 1);
+t919 = (t918 * b + 9) / (b^2 + 1);
+t920 = (t919 * b + 0) / (b^2 + 1);
+t921 = (t920 * b + 1) / (b^2 + 1);
+t922 = (t921 * b + 2) / (b^2 + 1);
+t923 = (t922 * b + 3) / (b^2 + 1);
+t924 = (t923 * b + 4) / (b^2 + 1);
+t925 = (t924 * b + 5) / (b^2 + 1);
+t926 = (t925 * b + 6) / (b^2 + 1);
+t927 = (t926 * b + 7) / (b^2 + 1);
+t928 = (t927 * b + 8) / (b^2 + 1);
+t929 = (t928 * b + 9) / (b^2 + 1);
+t930 = (t929 * b + 0) / (b^2 + 1);
+t931 = (t930 * b + 1) / (b^2 + 1);
+t932 = (t931 * b + 2) / (b^2 + 1);
+t933 = (t932 * b + 3) / (b^2 + 1);
+t934 = (t933 * b + 4) / (b^2 + 1);
+t935 = (t934 * b + 5) / (b^2 + 1);
+t936 = (t935 * b + 6) / (b^2 + 1);
+t937 = (t936 * b + 7) / (b^2 + 1);
+t938 = (t937 * b + 8) / (b^2 + 1);
+t939 = (t938 * b + 9) / (b^2 + 1);
+t940 = (t939 * b + 0) / (b^2 + 1);
+t941 = (t940 * b + 1) / (b^2 + 1);
+t942 = (t941 * b + 2) / (b^2 + 1);
+t943 = (t942 * b + 3) / (b^2 + 1);
+t944 = (t943 * b + 4) / (b^2 + 1);
+t945 = (t944 * b + 5) / (b^2 + 1);
+t946 = (t945 * b + 6) / (b^2 + 1);
+t947 = (t946 * b + 7) / (b^2 + 1);
+t948 = (t947 * b + 8) / (b^2 + 1);
+t949 = (t948 * b + 9) / (b^2 + 1);
+t950 = (t949 * b + 0) / (b^2 + 1);
+t951 = (t950 * b + 1) / (b^2 + 1);
+t952 = (t951 * b + 2) / (b^2 + 1);
+t953 = (t952 * b + 3) / (b^2 + 1);
+t954 = (t953 * b + 4) / (b^2 + 1);
+t955 = (t954 * b + 5) / (b^2 + 1);
+t956 = (t955 * b + 6) / (b^2 + 1);
+t957 = (t956 * b + 7) / (b^2 + 1);
+t958 = (t957 * b + 8) / (b^2 + 1);
+t959 = (t958 * b + 9) / (b^2 + 1);
+t960 = (t959 * b + 0) / (b^2 + 1);
+t961 = (t960 * b + 1) / (b^2 + 1);
+t962 = (t961 * b + 2) / (b^2 + 1);
+t963 = (t962 * b + 3) / (b^2 + 1);
+t964 = (t963 * b + 4) / (b^2 + 1);
+t965 = (t964 * b + 5) / (b^2 + 1);
+t966 = (t965 * b + 6) / (b^2 + 1);
+t967 = (t966 * b + 7) / (b^2 + 1);
+t968 = (t967 * b + 8) / (b^2 + 1);
+t969 = (t968 * b + 9) / (b^2 + 1);
+t970 = (t969 * b + 0) / (b^2 + 1);
+t971 = (t970 * b + 1) / (b^2 + 1);
+t972 = (t971 * b + 2) / (b^2 + 1);
+t973 = (t972 * b + 3) / (b^2 + 1);
+t974 = (t973 * b + 4) / (b^2 + 1);
+t975 = (t974 * b + 5) / (b^2 + 1);
+t976 = (t975 * b + 6) / (b^2 + 1);
+t977 = (t976 * b + 7) / (b^2 + 1);
+t978 = (t977 * b + 8) / (b^2 + 1);
+t979 = (t978 * b + 9) / (b^2 + 1);
+t980 = (t979 * b + 0) / (b^2 + 1);
+t981 = (t980 * b + 1) / (b^2 + 1);
+t982 = (t981 * b + 2) / (b^2 + 1);
+t983 = (t982 * b + 3) / (b^2 + 1);
+t984 = (t983 * b + 4) / (b^2 + 1);
+t985 = (t984 * b + 5) / (b^2 + 1);
+t986 = (t985 * b + 6) / (b^2 + 1);
+t987 = (t986 * b + 7) / (b^2 + 1);
+t988 = (t987 * b + 8) / (b^2 + 1);
+t989 = (t988 * b + 9) / (b^2 + 1);
+t990 = (t989 * b + 0) / (b^2 + 1);
+t991 = (t990 * b + 1) / (b^2 + 1);
+t992 = (t991 * b + 2) / (b^2 + 1);
+t993 = (t992 * b + 3) / (b^2 + 1);
+t994 = (t993 * b + 4) / (b^2 + 1);
+t995 = (t994 * b + 5) / (b^2 + 1);
+t996 = (t995 * b + 6) / (b^2 + 1);
+t997 = (t996 * b + 7) / (b^2 + 1);
+t998 = (t997 * b + 8) / (b^2 + 1);
+t999 = (t998 * b + 9) / (b^2 + 1);
+t1000 = (t999 * b + 0) / (b^2 + 1);
+t1001 = (t1000 * b + 1) / (b^2 + 1);
+t1002 = (t1001 * b + 2) / (b^2 + 1);
+t1003 = (t1002 * b + 3) / (b^2 + 1);
+t1004 = (t1003 * b + 4) / (b^2 + 1);
+t1005 = (t1004 * b + 5) / (b^2 + 1);
+t1006 = (t1005 * b + 6) / (b^2 + 1);
+t1007 = (t1006 * b + 7) / (b^2 + 1);
+t1008 = (t1007 * b + 8) / (b^2 + 1);
+t1009 = (t1008 * b + 9) / (b^2 + 1);
+t1010 = (t1009 * b + 0) / (b^2 + 1);
+t1011 = (t1010 * b + 1) / (b^2 + 1);
+t1012 = (t1011 * b + 2) / (b^2 + 1);
+t1013 = (t1012 * b + 3) / (b^2 + 1);
+t1014 = (t1013 * b + 4) / (b^2 + 1);
+t1015 = (t1014 * b + 5) / (b^2 + 1);
+t1016 = (t1015 * b + 6) / (b^2 + 1);
+t1017 = (t1016 * b + 7) / (b^2 + 1);
+t1018 = (t1017 * b + 8) / (b^2 + 1);
+t1019 = (t1018 * b + 9) / (b^2 + 1);
+t1020 = (t1019 * b + 0) / (b^2 + 1);
+t1021 = (t1020 * b + 1) / (b^2 + 1);
+t1022 = (t1021 * b + 2) / (b^2 + 1);
+t1023 = (t1022 * b + 3) / (b^2 + 1);
+t1024 = (t1023 * b + 4) / (b^2 + 1);
+t1025 = (t1024 * b + 5) / (b^2 + 1);
+t1026 = (t1025 * b + 6) / (b^2 + 1);
+t1027 = (t1026 * b + 7) / (b^2 + 1);
+t1028 = (t1027 * b + 8) / (b^2 + 1);
+t1029 = (t1028 * b + 9) / (b^2 + 1);
+t1030 = (t1029 * b + 0) / (b^2 + 1);
+t1031 = (t1030 * b + 1) / (b^2 + 1);
+t1032 = (t1031 * b + 2) / (b^2 + 1);
+t1033 = (t1032 * b + 3) / (b^2 + 1);
+t1034 = (t1033 * b + 4) / (b^2 + 1);
+t1035 = (t1034 * b + 5) / (b^2 + 1);
+t1036 = (t1035 * b + 6) / (b^2 + 1);
+t1037 = (t1036 * b + 7) / (b^2 + 1);
+t1038 = (t1037 * b + 8) / (b^2 + 1);
+t1039 = (t1038 * b + 9) / (b^2 + 1);
+t1040 = (t1039 * b + 0) / (b^2 + 1);
+t1041 = (t1040 * b + 1) / (b^2 + 1);
+t1042 = (t1041 * b + 2) / (b^2 + 1);
+t1043 = (t1042 * b + 3) / (b^2 + 1);
+t1044 = (t1043 * b + 4) / (b^2 + 1);
+t1045 = (t1044 * b + 5) / (b^2 + 1);
+t1046 = (t1045 * b + 6) / (b^2 + 1);
+t1047 = (t1046 * b + 7) / (b^2 + 1);
+t1048 = (t1047 * b + 8) / (b^2 + 1);
+t1049 = (t1048 * b + 9) / (b^2 + 1);
+t1050 = (t1049 * b + 0) / (b^2 + 1);
+t1051 = (t1050 * b + 1) / (b^2 + 1);
+t1052 = (t1051 * b + 2) / (b^2 + 1);
+t1053 = (t1052 * b + 3) / (b^2 + 1);
+t1054 = (t1053 * b + 4) / (b^2 + 1);
+t1055 = (t1054 * b + 5) / (b^2 + 1);
+t1056 = (t1055 * b + 6) / (b^2 + 1);
+t1057 = (t1056 * b + 7) / (b^2 + 1);
+t1058 = (t1057 * b + 8) / (b^2 + 1);
+t1059 = (t1058 * b + 9) / (b^2 + 1);
+t1060 = (t1059 * b + 0) / (b^2 + 1);
+t1061 = (t1060 * b + 1) / (b^2 + 1);
+t1062 = (t1061 * b + 2) / (b^2 + 1);
+t1063 = (t1062 * b + 3) / (b^2 + 1);
+t1064 = (t1063 * b + 4) / (b^2 + 1);
+t1065 = (t1064 * b + 5) / (b^2 + 1);
+t1066 = (t1065 * b + 6) / (b^2 + 1);
+t1067 = (t1066 * b + 7) / (b^2 + 1);
+t1068 = (t1067 * b + 8) / (b^2 + 1);
+t1069 = (t1068 * b + 9) / (b^2 + 1);
+t1070 = (t1069 * b + 0) / (b^2 + 1);
+t1071 = (t1070 * b + 1) / (b^2 + 1);
+t1072 = (t1071 * b + 2) / (b^2 + 1);
+t1073 = (t1072 * b + 3) / (b^2 + 1);
+t1074 = (t1073 * b + 4) / (b^2 + 1);
+t1075 = (t1074 * b + 5) / (b^2 + 1);
+t1076 = (t1075 * b + 6) / (b^2 + 1);
+t1077 = (t1076 * b + 7) / (b^2 + 1);
+t1078 = (t1077 * b + 8) / (b^2 + 1);
+t1079 = (t1078 * b + 9) / (b^2 + 1);
+t1080 = (t1079 * b + 0) / (b^2 + 1);
+t1081 = (t1080 * b + 1) / (b^2 + 1);
+t1082 = (t1081 * b + 2) / (b^2 + 1);
+t1083 = (t1082 * b + 3) / (b^2 + 1);
+t1084 = (t1083 * b + 4) / (b^2 + 1);
+t1085 = (t1084 * b + 5) / (b^2 + 1);
+t1086 = (t1085 * b + 6) / (b^2 + 1);
+t1087 = (t1086 * b + 7) / (b^2 + 1);
+t1088 = (t1087 * b + 8) / (b^2 + 1);
+t1089 = (t1088 * b + 9) / (b^2 + 1);
+t1090 = (t1089 * b + 0) / (b^2 + 1);
+t1091 = (t1090 * b + 1) / (b^2 + 1);
+t1092 = (t1091 * b + 2) / (b^2 + 1);
+t1093 = (t1092 * b + 3) / (b^2 + 1);
+t1094 = (t1093 * b + 4) / (b^2 + 1);
+t1095 = (t1094 * b + 5) / (b^2 + 1);
+t1096 = (t1095 * b + 6) / (b^2 + 1);
+t1097 = (t1096 * b + 7) / (b^2 + 1);
+t1098 = (t1097 * b + 8) / (b^2 + 1);
+t1099 = (t1098 * b + 9) / (b^2 + 1);
+t1100 = (t1099 * b + 0) / (b^2 + 1);
+t1101 = (t1100 * b + 1) / (b^2 + 1);
+t1102 = (t1101 * b + 2) / (b^2 + 1);
+t1103 = (t1102 * b + 3) / (b^2 + 1);
+t1104 = (t1103 * b + 4) / (b^2 + 1);
+t1105 = (t1104 * b + 5) / (b^2 + 1);
+t1106 = (t1105 * b + 6) / (b^2 + 1);
+t1107 = (t1106 * b + 7) / (b^2 + 1);
+t1108 = (t1107 * b + 8) / (b^2 + 1);
+t1109 = (t1108 * b + 9) / (b^2 + 1);
+t1110 = (t1109 * b + 0) / (b^2 + 1);
+t1111 = (t1110 * b + 1) / (b^2 + 1);
+t1112 = (t1111 * b + 2) / (b^2 + 1);
+t1113 = (t1112 * b + 3) / (b^2 + 1);
+t1114 = (t1113 * b + 4) / (b^2 + 1);
+t1115 = (t1114 * b + 5) / (b^2 + 1);
+t1116 = (t1115 * b + 6) / (b^2 + 1);
+t1117 = (t1116 * b + 7) / (b^2 + 1);
+t1118 = (t1117 * b + 8) / (b^2 + 1);
+t1119 = (t1118 * b + 9) / (b^2 + 1);
+t1120 = (t1119 * b + 0) / (b^2 + 1);
+t1121 = (t1120 * b + 1) / (b^2 + 1);
+t1122 = (t1121 * b + 2) / (b^2 + 1);
+t1123 = (t1122 * b + 3) / (b^2 + 1);
+t1124 = (t1123 * b + 4) / (b^2 + 1);
+t1125 = (t1124 * b + 5) / (b^2 + 1);
+t1126 = (t1125 * b + 6) / (b^2 + 1);
+t1127 = (t1126 * b + 7) / (b^2 + 1);
+t1128 = (t1127 * b + 8) / (b^2 + 1);
+t1129 = (t1128 * b + 9) / (b^2 + 1);
+t1130 = (t1129 * b + 0) / (b^2 + 1);
+t1131 = (t1130 * b + 1) / (b^2 + 1);
+t1132 = (t1131 * b + 2) / (b^2 + 1);
+t1133 = (t1132 * b + 3) / (b^2 + 1);
+t1134 = (t1133 * b + 4) / (b^2 + 1);
+t1135 = (t1134 * b + 5) / (b^2 + 1);
+t1136 = (t1135 * b + 6) / (b^2 + 1);
+t1137 = (t1136 * b + 7) / (b^2 + 1);
+t1138 = (t1137 * b + 8) / (b^2 + 1);
+t1139 = (t1138 * b + 9) / (b^2 + 1);
+t1140 = (t1139 * b + 0) / (b^2 + 1);
+t1141 = (t1140 * b + 1) / (b^2 + 1);
+t1142 = (t1141 * b + 2) / (b^2 + 1);
+t1143 = (t1142 * b + 3) / (b^2 + 1);
+t1144 = (t1143 * b + 4) / (b^2 + 1);
+t1145 = (t1144 * b + 5) / (b^2 + 1);
+t1146 = (t1145 * b + 6) / (b^2 + 1);
+t1147 = (t1146 * b + 7) / (b^2 + 1);
+t1148 = (t1147 * b + 8) / (b^2 + 1);
+t1149 = (t1148 * b + 9) / (b^2 + 1);
+t1150 = (t1149 * b + 0) / (b^2 + 1);
+t1151 = (t1150 * b + 1) / (b^2 + 1);
+t1152 = (t1151 * b + 2) / (b^2 + 1);
+t1153 = (t1152 * b + 3) / (b^2 + 1);
+t1154 = (t1153 * b + 4) / (b^2 + 1);
+t1155 = (t1154 * b + 5) / (b^2 + 1);
+t1156 = (t1155 * b + 6) / (b^2 + 1);
+t1157 = (t1156 * b + 7) / (b^2 + 1);
+t1158 = (t1157 * b + 8) / (b^2 + 1);
+t1159 = (t1158 * b + 9) / (b^2 + 1);
+t1160 = (t1159 * b + 0) / (b^2 + 1);
+t1161 = (t1160 * b + 1) / (b^2 + 1);
+t1162 = (t1161 * b + 2) / (b^2 + 1);
+t1163 = (t1162 * b + 3) / (b^2 + 1);
+t1164 = (t1163 * b + 4) / (b^2 + 1);
+t1165 = (t1164 * b + 5) / (b^2 + 1);
+t1166 = (t1165 * b + 6) / (b^2 + 1);
+t1167 = (t1166 * b + 7) / (b^2 + 1);
+t1168 = (t1167 * b + 8) / (b^2 + 1);
+t1169 = (t1168 * b + 9) / (b^2 + 1);
+t1170 = (t1169 * b + 0) / (b^2 + 1);
+t1171 = (t1170 * b + 1) / (b^2 + 1);
+t1172 = (t1171 * b + 2) / (b^2 + 1);
+t1173 = (t1172 * b + 3) / (b^2 + 1);
+t1174 = (t1173 * b + 4) / (b^2 + 1);
+t1175 = (t1174 * b + 5) / (b^2 + 1);
+t1176 = (t1175 * b + 6) / (b^2 + 1);
+t1177 = (t1176 * b + 7) / (b^2 + 1);
+t1178 = (t1177 * b + 8) / (b^2 + 1);
+t1179 = (t1178 * b + 9) / (b^2 + 1);
+t1180 = (t1179 * b + 0) / (b^2 + 1);
+t1181 = (t1180 * b + 1) / (b^2 + 1);
+t1182 = (t1181 * b + 2) / (b^2 + 1);
+t1183 = (t1182 * b + 3) / (b^2 + 1);
+t1184 = (t1183 * b + 4) / (b^2 + 1);
+t1185 = (t1184 * b + 5) / (b^2 + 1);
+t1186 = (t1185 * b + 6) / (b^2 + 1);
+t1187 = (t1186 * b + 7) / (b^2 + 1);
+t1188 = (t1187 * b + 8) / (b^2 + 1);
+t1189 = (t1188 * b + 9) / (b^2 + 1);
+t1190 = (t1189 * b + 0) / (b^2 + 1);
+t1191 = (t1190 * b + 1) / (b^2 + 1);
+t1192 = (t1191 * b + 2) / (b^2 + 1);
+t1193 = (t1192 * b + 3) / (b^2 + 1);
+t1194 = (t1193 * b + 4) / (b^2 + 1);
+t1195 = (t1194 * b + 5) / (b^2 + 1);
+t1196 = (t1195 * b + 6) / (b^2 + 1);
+t1197 = (t1196 * b + 7) / (b^2 + 1);
+t1198 = (t1197 * b + 8) / (b^2 + 1);
+t1199 = (t1198 * b + 9) / (b^2 + 1);
+t1200 = (t1199 * b + 0) / (b^2 + 1);
+t1201 = (t1200 * b + 1) / (b^2 + 1);
+t1202 = (t1201 * b + 2) / (b^2 + 1);
+t1203 = (t1202 * b + 3) / (b^2 + 1);
+t1204 = (t1203 * b + 4) / (b^2 + 1);
+t1205 = (t1204 * b + 5) / (b^2 + 1);
+t1206 = (t1205 * b + 6) / (b^2 + 1);
+t1207 = (t1206 * b + 7) / (b^2 + 1);
+t1208 = (t1207 * b + 8) / (b^2 + 1);
+t1209 = (t1208 * b + 9) / (b^2 + 1);
+t1210 = (t1209 * b + 0) / (b^2 + 1);
+t1211 = (t1210 * b + 1) / (b^2 + 1);
+t1212 = (t1211 * b + 2) / (b^2 + 1);
+t1213 = (t1212 * b + 3) / (b^2 + 1);
+t1214 = (t1213 * b + 4) / (b^2 + 1);
+t1215 = (t1214 * b + 5) / (b^2 + 1);
+t1216 = (t1215 * b + 6) / (b^2 + 1);
+t1217 = (t1216 * b + 7) / (b^2 + 1);
+t1218 = (t1217 * b + 8) / (b^2 + 1);
+t1219 = (t1218 * b + 9) / (b^2 + 1);
+t1220 = (t1219 * b + 0) / (b^2 + 1);
+t1221 = (t1220 * b + 1) / (b^2 + 1);
+t1222 = (t1221 * b + 2) / (b^2 + 1);
+t1223 = (t1222 * b + 3) / (b^2 + 1);
+t1224 = (t1223 * b + 4) / (b^2 + 1);
+t1225 = (t1224 * b + 5) / (b^2 + 1);
+t1226 = (t1225 * b + 6) / (b^2 + 1);
+t1227 = (t1226 * b + 7) / (b^2 + 1);
+t1228 = (t1227 * b + 8) / (b^2 + 1);
+t1229 = (t1228 * b + 9) / (b^2 + 1);
+t1230 = (t1229 * b + 0) / (b^2 + 1);
+t1231 = (t1230 * b + 1) / (b^2 + 1);
+t1232 = (t1231 * b + 2) / (b^2 + 1);
+t1233 = (t1232 * b + 3) / (b^2 + 1);
+t1234 = (t1233 * b + 4) / (b^2 + 1);
+t1235 = (t1234 * b + 5) / (b^2 + 1);
+t1236 = (t1235 * b + 6) / (b^2 + 1);
+t1237 = (t1236 * b + 7) / (b^2 + 1);
+t1238 = (t1237 * b + 8) / (b^2 + 1);
+t1239 = (t1238 * b + 9) / (b^2 + 1);
+t1240 = (t1239 * b + 0) / (b^2 + 1);
+t1241 = (t1240 * b + 1) / (b^2 + 1);
+t1242 = (t1241 * b + 2) / (b^2 + 1);
+t1243 = (t1242 * b + 3) / (b^2 + 1);
+t1244 = (t1243 * b + 4) / (b^2 + 1);
+t1245 = (t1244 * b + 5) / (b^2 + 1);
+t1246 = (t1245 * b + 6) / (b^2 + 1);
+t1247 = (t1246 * b + 7) / (b^2 + 1);
+t1248 = (t1247 * b + 8) / (b^2 + 1);
+t1249 = (t1248 * b + 9) / (b^2 + 1);
+t1250 = (t1249 * b + 0) / (b^2 + 1);
+t1251 = (t1250 * b + 1) / (b^2 + 1);
+t1252 = (t1251 * b + 2) / (b^2 + 1);
+t1253 = (t1252 * b + 3) / (b^2 + 1);
+t1254 = (t1253 * b + 4) / (b^2 + 1);
+t1255 = (t1254 * b + 5) / (b^2 + 1);
+t1256 = (t1255 * b + 6) / (b^2 + 1);
+t1257 = (t1256 * b + 7) / (b^2 + 1);
+t1258 = (t1257 * b + 8) / (b^2 + 1);
+t1259 = (t1258 * b + 9) / (b^2 + 1);
+t1260 = (t1259 * b + 0) / (b^2 + 1);
+t1261 = (t1260 * b + 1) / (b^2 + 1);
+t1262 = (t1261 * b + 2) / (b^2 + 1);
+t1263 = (t1262 * b + 3) / (b^2 + 1);
+t1264 = (t1263 * b + 4) / (b^2 + 1);
+t1265 = (t1264 * b + 5) / (b^2 + 1);
+t1266 = (t1265 * b + 6) / (b^2 + 1);
+t1267 = (t1266 * b + 7) / (b^2 + 1);
+t1268 = (t1267 * b + 8) / (b^2 + 1);
+t1269 = (t1268 * b + 9) / (b^2 + 1);
+t1270 = (t1269 * b + 0) / (b^2 + 1);
+t1271 = (t1270 * b + 1) / (b^2 + 1);
+t1272 = (t1271 * b + 2) / (b^2 + 1);
+t1273 = (t1272 * b + 3) / (b^2 + 1);
+t1274 = (t1273 * b + 4) / (b^2 + 1);
+t1275 = (t1274 * b + 5) / (b^2 + 1);
+t1276 = (t1275 * b + 6) / (b^2 + 1);
+t1277 = (t1276 * b + 7) / (b^2 + 1);
+t1278 = (t1277 * b + 8) / (b^2 + 1);
+t1279 = (t1278 * b + 9) / (b^2 + 1);
+t1280 = (t1279 * b + 0) / (b^2 + 1);
+t1281 = (t1280 * b + 1) / (b^2 + 1);
+t1282 = (t1281 * b + 2) / (b^2 + 1);
+t1283 = (t1282 * b + 3) / (b^2 + 1);
+t1284 = (t1283 * b + 4) / (b^2 + 1);
+t1285 = (t1284 * b + 5) / (b^2 + 1);
+t1286 = (t1285 * b + 6) / (b^2 + 1);
+t1287 = (t1286 * b + 7) / (b^2 + 1);
+t1288 = (t1287 * b + 8) / (b^2 + 1);
+t1289 = (t1288 * b + 9) / (b^2 + 1);
+t1290 = (t1289 * b + 0) / (b^2 + 1);
+t1291 = (t1290 * b + 1) / (b^2 + 1);
+t1292 = (t1291 * b + 2) / (b^2 + 1);
+t1293 = (t1292 * b + 3) / (b^2 + 1);
+t1294 = (t1293 * b + 4) / (b^2 + 1);
+t1295 = (t1294 * b + 5) / (b^2 + 1);
+t1296 = (t1295 * b + 6) / (b^2 + 1);
+t1297 = (t1296 * b + 7) / (b^2 + 1);
+t1298 = (t1297 * b + 8) / (b^2 + 1);
+t1299 = (t1298 * b + 9) / (b^2 + 1);
+t1300 = (t1299 * b + 0) / (b^2 + 1);
+t1301 = (t1300 * b + 1) / (b^2 + 1);
+t1302 = (t1301 * b + 2) / (b^2 + 1);
+t1303 = (t1302 * b + 3) / (b^2 + 1);
+t1304 = (t1303 * b + 4) / (b^2 + 1);
+t1305 = (t1304 * b + 5) / (b^2 + 1);
+t1306 = (t1305 * b + 6) / (b^2 + 1);
+t1307 = (t1306 * b + 7) / (b^2 + 1);
+t1308 = (t1307 * b + 8) / (b^2 + 1);
+t1309 = (t1308 * b + 9) / (b^2 + 1);
+t1310 = (t1309 * b + 0) / (b^2 + 1);
+t1311 = (t1310 * b + 1) / (b^2 + 1);
+t1312 = (t1311 * b + 2) / (b^2 + 1);
+t1313 = (t1312 * b + 3) / (b^2 + 1);
+t1314 = (t1313 * b + 4) / (b^2 + 1);
+t1315 = (t1314 * b + 5) / (b^2 + 1);
+t1316 = (t1315 * b + 6) / (b^2 + 1);
+t1317 = (t1316 * b + 7) / (b^2 + 1);
+t1318 = (t1317 * b + 8) / (b^2 + 1);
+t1319 = (t1318 * b + 9) / (b^2 + 1);
+t1320 = (t1319 * b + 0) / (b^2 + 1);
+t1321 = (t1320 * b + 1) / (b^2 + 1);
+t1322 = (t1321 * b + 2) / (b^2 + 1);
+t1323 = (t1322 * b + 3) / (b^2 + 1);
+t1324 = (t1323 * b + 4) / (b^2 + 1);
+t1325 = (t1324 * b + 5) / (b^2 + 1);
+t1326 = (t1325 * b + 6) / (b^2 + 1);
+t1327 = (t1326 * b + 7) / (b^2 + 1);
+t1328 = (t1327 * b + 8) / (b^2 + 1);
+t1329 = (t1328 * b + 9) / (b^2 + 1);
+t1330 = (t1329 * b + 0) / (b^2 + 1);
+t1331 = (t1330 * b + 1) / (b^2 + 1);
+t1332 = (t1331 * b + 2) / (b^2 + 1);
+t1333 = (t1332 * b + 3) / (b^2 + 1);
+t1334 = (t1333 * b + 4) / (b^2 + 1);
+t1335 = (t1334 * b + 5) / (b^2 + 1);
+t1336 = (t1335 * b + 6) / (b^2 + 1);
+t1337 = (t1336 * b + 7) / (b^2 + 1);
+t1338 = (t1337 * b + 8) / (b^2 + 1);
+t1339 = (t1338 * b + 9) / (b^2 + 1);
+t1340 = (t1339 * b + 0) / (b^2 + 1);
+t1341 = (t1340 * b + 1) / (b^2 + 1);
+t1342 = (t1341 * b + 2) / (b^2 + 1);
+t1343 = (t1342 * b + 3) / (b^2 + 1);
+t1344 = (t1343 * b + 4) / (b^2 + 1);
+t1345 = (t1344 * b + 5) / (b^2 + 1);
+t1346 = (t1345 * b + 6) / (b^2 + 1);
+t1347 = (t1346 * b + 7) / (b^2 + 1);
+t1348 = (t1347 * b + 8) / (b^2 + 1);
+t1349 = (t1348 * b + 9) / (b^2 + 1);
+t1350 = (t1349 * b + 0) / (b^2 + 1);
+t1351 = (t1350 * b + 1) / (b^2 + 1);
+t1352 = (t1351 * b + 2) / (b^2 + 1);
+t1353 = (t1352 * b + 3) / (b^2 + 1);
+t1354 = (t1353 * b + 4) / (b^2 + 1);
+t1355 = (t1354 * b + 5) / (b^2 + 1);
+t1356 = (t1355 * b + 6) / (b^2 + 1);
+t1357 = (t1356 * b + 7) / (b^2 + 1);
+t1358 = (t1357 * b + 8) / (b^2 + 1);
+t1359 = (t1358 * b + 9) / (b^2 + 1);
+t1360 = (t1359 * b + 0) / (b^2 + 1);
+t1361 = (t1360 * b + 1) / (b^2 + 1);
+t1362 = (t1361 * b + 2) / (b^2 + 1);
+t1363 = (t1362 * b + 3) / (b^2 + 1);
+t1364 = (t1363 * b + 4) / (b^2 + 1);
+t1365 = (t1364 * b + 5) / (b^2 + 1);
+t1366 = (t1365 * b + 6) / (b^2 + 1);
+t1367 = (t1366 * b + 7) / (b^2 + 1);
+t1368 = (t1367 * b + 8) / (b^2 + 1);
+t1369 = (t1368 * b + 9) / (b^2 + 1);
+t1370 = (t1369 * b + 0) / (b^2 + 1);
+t1371 = (t1370 * b + 1) / (b^2 + 1);
+t1372 = (t1371 * b + 2) / (b^2 + 1);
+t1373 = (t1372 * b + 3) / (b^2 + 1);
+t1374 = (t1373 * b + 4) / (b^2 + 1);
+t1375 = (t1374 * b + 5) / (b^2 + 1);
+t1376 = (t1375 * b + 6) / (b^2 + 1);
+t1377 = (t1376 * b + 7) / (b^2 + 1);
+t1378 = (t1377 * b + 8) / (b^2 + 1);
+t1379 = (t1378 * b + 9) / (b^2 + 1);
+t1380 = (t1379 * b + 0) / (b^2 + 1);
+t1381 = (t1380 * b + 1) / (b^2 + 1);
+t1382 = (t1381 * b + 2) / (b^2 + 1);
+t1383 = (t1382 * b + 3) / (b^2 + 1);
+t1384 = (t1383 * b + 4) / (b^2 + 1);
+t1385 = (t1384 * b + 5) / (b^2 + 1);
+t1386 = (t1385 * b + 6) / (b^2 + 1);
+t1387 = (t1386 * b + 7) / (b^2 + 1);
+t1388 = (t1387 * b + 8) / (b^2 + 1);
+t1389 = (t1388 * b + 9) / (b^2 + 1);
+t1390 = (t1389 * b + 0) / (b^2 + 1);
+t1391 = (t1390 * b + 1) / (b^2 + 1);
+t1392 = (t1391 * b + 2) / (b^2 + 1);
+t1393 = (t1392 * b + 3) / (b^2 + 1);
+t1394 = (t1393 * b + 4) / (b^2 + 1);
+t1395 = (t1394 * b + 5) / (b^2 + 1);
+t1396 = (t1395 * b + 6) / (b^2 + 1);
+t1397 = (t1396 * b + 7) / (b^2 + 1);
+t1398 = (t1397 * b + 8) / (b^2 + 1);
+t1399 = (t1398 * b + 9) / (b^2 + 1);
+t1400 = (t1399 * b + 0) / (b^2 + 1);
+t1401 = (t1400 * b + 1) / (b^2 + 1);
+t1402 = (t1401 * b + 2) / (b^2 + 1);
+t1403 = (t1402 * b + 3) / (b^2 + 1);
+t1404 = (t1403 * b + 4) / (b^2 + 1);
+t1405 = (t1404 * b + 5) / (b^2 + 1);
+t1406 = (t1405 * b + 6) / (b^2 + 1);
+t1407 = (t1406 * b + 7) / (b^2 + 1);
+t1408 = (t1407 * b + 8) / (b^2 + 1);
+t1409 = (t1408 * b + 9) / (b^2 + 1);
+t1410 = (t1409 * b + 0) / (b^2 + 1);
+t1411 = (t1410 * b + 1) / (b^2 + 1);
+t1412 = (t1411 * b + 2) / (b^2 + 1);
+t1413 = (t1412 * b + 3) / (b^2 + 1);
+t1414 = (t1413 * b + 4) / (b^2 + 1);
+t1415 = (t1414 * b + 5) / (b^2 + 1);
+t1416 = (t1415 * b + 6) / (b^2 + 1);
+t1417 = (t1416 * b + 7) / (b^2 + 1);
+t1418 = (t1417 * b + 8) / (b^2 + 1);
+t1419 = (t1418 * b + 9) / (b^2 + 1);
+t1420 = (t1419 * b + 0) / (b^2 + 1);
+t1421 = (t1420 * b + 1) / (b^2 + 1);
+t1422 = (t1421 * b + 2) / (b^2 + 1);
+t1423 = (t1422 * b + 3) / (b^2 + 1);
+t1424 = (t1423 * b + 4) / (b^2 + 1);
+t1425 = (t1424 * b + 5) / (b^2 + 1);
+t1426 = (t1425 * b + 6) / (b^2 + 1);
+t1427 = (t1426 * b + 7) / (b^2 + 1);
+t1428 = (t1427 * b + 8) / (b^2 + 1);
+t1429 = (t1428 * b + 9) / (b^2 + 1);
+t1430 = (t1429 * b + 0) / (b^2 + 1);
+t1431 = (t1430 * b + 1) / (b^2 + 1);
+t1432 = (t1431 * b + 2) / (b^2 + 1);
+t1433 = (t1432 * b + 3) / (b^2 + 1);
+t1434 = (t1433 * b + 4) / (b^2 + 1);
+t1435 = (t1434 * b + 5) / (b^2 + 1);
+t1436 = (t1435 * b + 6) / (b^2 + 1);
+t1437 = (t1436 * b + 7) / (b^2 + 1);
+t1438 = (t1437 * b + 8) / (b^2 + 1);
+t1439 = (t1438 * b + 9) / (b^2 + 1);
+t1440 = (t1439 * b + 0) / (b^2 + 1);
+t1441 = (t1440 * b + 1) / (b^2 + 1);
+t1442 = (t1441 * b + 2) / (b^2 + 1);
+t1443 = (t1442 * b + 3) / (b^2 + 1);
+t1444 = (t1443 * b + 4) / (b^2 + 1);
+t1445 = (t1444 * b + 5) / (b^2 + 1);
+t1446 = (t1445 * b + 6) / (b^2 + 1);
+t1447 = (t1446 * b + 7) / (b^2 + 1);
+t1448 = (t1447 * b + 8) / (b^2 + 1);
+t1449 = (t1448 * b + 9) / (b^2 + 1);
+t1450 = (t1449 * b + 0) / (b^2 + 1);
+t1451 = (t1450 * b + 1) / (b^2 + 1);
+t1452 = (t1451 * b + 2) / (b^2 + 1);
+t1453 = (t1452 * b + 3) / (b^2 + 1);
+t1454 = (t1453 * b + 4) / (b^2 + 1);
+t1455 = (t1454 * b + 5) / (b^2 + 1);
+t1456 = (t1455 * b + 6) / (b^2 + 1);
+t1457 = (t1456 * b + 7) / (b^2 + 1);
+t1458 = (t1457 * b + 8) / (b^2 + 1);
+t1459 = (t1458 * b + 9) / (b^2 + 1);
+t1460 = (t1459 * b + 0) / (b^2 + 1);
+t1461 = (t1460 * b + 1) / (b^2 + 1);
+t1462 = (t1461 * b + 2) / (b^2 + 1);
+t1463 = (t1462 * b + 3) / (b^2 + 1);
+t1464 = (t1463 * b + 4) / (b^2 + 1);
+t1465 = (t1464 * b + 5) / (b^2 + 1);
+t1466 = (t1465 * b + 6) / (b^2 + 1);
+t1467 = (t1466 * b + 7) / (b^2 + 1);
+t1468 = (t1467 * b + 8) / (b^2 + 1);
+t1469 = (t1468 * b + 9) / (b^2 + 1);
+t1470 = (t1469 * b + 0) / (b^2 + 1);
+t1471 = (t1470 * b + 1) / (b^2 + 1);
+t1472 = (t1471 * b + 2) / (b^2 + 1);
+t1473 = (t1472 * b + 3) / (b^2 + 1);
+t1474 = (t1473 * b + 4) / (b^2 + 1);
+t1475 = (t1474 * b + 5) / (b^2 + 1);
+t1476 = (t1475 * b + 6) / (b^2 + 1);
+t1477 = (t1476 * b + 7) / (b^2 + 1);
+t1478 = (t1477 * b + 8) / (b^2 + 1);
+t1479 = (t1478 * b + 9) / (b^2 + 1);
+t1480 = (t1479 * b + 0) / (b^2 + 1);
+t1481 = (t1480 * b + 1) / (b^2 + 1);
+t1482 = (t1481 * b + 2) / (b^2 + 1);
+t1483 = (t1482 * b + 3) / (b^2 + 1);
+t1484 = (t1483 * b + 4) / (b^2 + 1);
+t1485 = (t1484 * b + 5) / (b^2 + 1);
+t1486 = (t1485 * b + 6) / (b^2 + 1);
+t1487 = (t1486 * b + 7) / (b^2 + 1);
+t1488 = (t1487 * b + 8) / (b^2 + 1);
+t1489 = (t1488 * b + 9) / (b^2 + 1);
+t1490 = (t1489 * b + 0) / (b^2 + 1);
+t1491 = (t1490 * b + 1) / (b^2 + 1);
+t1492 = (t1491 * b + 2) / (b^2 + 1);
+t1493 = (t1492 * b + 3) / (b^2 + 1);
+t1494 = (t1493 * b + 4) / (b^2 + 1);
+t1495 = (t1494 * b + 5) / (b^2 + 1);
+t1496 = (t1495 * b + 6) / (b^2 + 1);
+t1497 = (t1496 * b + 7) / (b^2 + 1);
+t1498 = (t1497 * b + 8) / (b^2 + 1);
+t1499 = (t1498 * b + 9) / (b^2 + 1);
+t1500 = (t1499 * b + 0) / (b^2 + 1);
+t1501 = (t1500 * b + 1) / (b^2 + 1);
+t1502 = (t1501 * b + 2) / (b^2 + 1);
+t1503 = (t1502 * b + 3) / (b^2 + 1);
+t1504 = (t1503 * b + 4) / (b^2 + 1);
+t1505 = (t1504 * b + 5) / (b^2 + 1);
+t1506 = (t1505 * b + 6) / (b^2 + 1);
+t1507 = (t1506 * b + 7) / (b^2 + 1);
+t1508 = (t1507 * b + 8) / (b^2 + 1);
+t1509 = (t1508 * b + 9) / (b^2 + 1);
+t1510 = (t1509 * b + 0) / (b^2 + 1);
+t1511 = (t1510 * b + 1) / (b^2 + 1);
+t1512 = (t1511 * b + 2) / (b^2 + 1);
+t1513 = (t1512 * b + 3) / (b^2 + 1);
+t1514 = (t1513 * b + 4) / (b^2 + 1);
+t1515 = (t1514 * b + 5) / (b^2 + 1);
+t1516 = (t1515 * b + 6) / (b^2 + 1);
+t1517 = (t1516 * b + 7) / (b^2 + 1);
+t1518 = (t1517 * b + 8) / (b^2 + 1);
+t1519 = (t1518 * b + 9) / (b^2 + 1);
+t1520 = (t1519 * b + 0) / (b^2 + 1);
+t1521 = (t1520 * b + 1) / (b^2 + 1);
+t1522 = (t1521 * b + 2) / (b^2 + 1);
+t1523 = (t1522 * b + 3) / (b^2 + 1);
+t1524 = (t1523 * b + 4) / (b^2 + 1);
+t1525 = (t1524 * b + 5) / (b^2 + 1);
+t1526 = (t1525 * b + 6) / (b^2 + 1);
+t1527 = (t1526 * b + 7) / (b^2 + 1);
+t1528 = (t1527 * b + 8) / (b^2 + 1);
+t1529 = (t1528 * b + 9) / (b^2 + 1);
+t1530 = (t1529 * b + 0) / (b^2 + 1);
+t1531 = (t1530 * b + 1) / (b^2 + 1);
+t1532 = (t1531 * b + 2) / (b^2 + 1);
+t1533 = (t1532 * b + 3) / (b^2 + 1);
+t1534 = (t1533 * b + 4) / (b^2 + 1);
+t1535 = (t1534 * b + 5) / (b^2 + 1);
+t1536 = (t1535 * b + 6) / (b^2 + 1);
+t1537 = (t1536 * b + 7) / (b^2 + 1);
+t1538 = (t1537 * b + 8) / (b^2 + 1);
+t1539 = (t1538 * b + 9) / (b^2 + 1);
+t1540 = (t1539 * b + 0) / (b^2 + 1);
+t1541 = (t1540 * b + 1) / (b^2 + 1);
+t1542 = (t1541 * b + 2) / (b^2 + 1);
+t1543 = (t1542 * b + 3) / (b^2 + 1);
+t1544 = (t1543 * b + 4) / (b^2 + 1);
+t1545 = (t1544 * b + 5) / (b^2 + 1);
+t1546 = (t1545 * b + 6) / (b^2 + 1);
+t1547 = (t1546 * b + 7) / (b^2 + 1);
+t1548 = (t1547 * b + 8) / (b^2 + 1);
+t1549 = (t1548 * b + 9) / (b^2 + 1);
+t1550 = (t1549 * b + 0) / (b^2 + 1);
+t1551 = (t1550 * b + 1) / (b^2 + 1);
+t1552 = (t1551 * b + 2) / (b^2 + 1);
+t1553 = (t1552 * b + 3) / (b^2 + 1);
+t1554 = (t1553 * b + 4) / (b^2 + 1);
+t1555 = (t1554 * b + 5) / (b^2 + 1);
+t1556 = (t1555 * b + 6) / (b^2 + 1);
+t1557 = (t1556 * b + 7) / (b^2 + 1);
+t1558 = (t1557 * b + 8) / (b^2 + 1);
+t1559 = (t1558 * b + 9) / (b^2 + 1);
+t1560 = (t1559 * b + 0) / (b^2 + 1);
+t1561 = (t1560 * b + 1) / (b^2 + 1);
+t1562 = (t1561 * b + 2) / (b^2 + 1);
+t1563 = (t1562 * b + 3) / (b^2 + 1);
+t1564 = (t1563 * b + 4) / (b^2 + 1);
+t1565 = (t1564 * b + 5) / (b^2 + 1);
+t1566 = (t1565 * b + 6) / (b^2 + 1);
+t1567 = (t1566 * b + 7) / (b^2 + 1);
+t1568 = (t1567 * b + 8) / (b^2 + 1);
+t1569 = (t1568 * b + 9) / (b^2 + 1);
+t1570 = (t1569 * b + 0) / (b^2 + 1);
+t1571 = (t1570 * b + 1) / (b^2 + 1);
+t1572 = (t1571 * b + 2) / (b^2 + 1);
+t1573 = (t1572 * b + 3) / (b^2 + 1);
+t1574 = (t1573 * b + 4) / (b^2 + 1);
+t1575 = (t1574 * b + 5) / (b^2 + 1);
+t1576 = (t1575 * b + 6) / (b^2 + 1);
+t1577 = (t1576 * b + 7) / (b^2 + 1);
+t1578 = (t1577 * b + 8) / (b^2 + 1);
+t1579 = (t1578 * b + 9) / (b^2 + 1);
+t1580 = (t1579 * b + 0) / (b^2 + 1);
+t1581 = (t1580 * b + 1) / (b^2 + 1);
+t1582 = (t1581 * b + 2) / (b^2 + 1);
+t1583 = (t1582 * b + 3) / (b^2 + 1);
+t1584 = (t1583 * b + 4) / (b^2 + 1);
+t1585 = (t1584 * b + 5) / (b^2 + 1);
+t1586 = (t1585 * b + 6) / (b^2 + 1);
+t1587 = (t1586 * b + 7) / (b^2 + 1);
+t1588 = (t1587 * b + 8) / (b^2 + 1);
+t1589 = (t1588 * b + 9) / (b^2 + 1);
+t1590 = (t1589 * b + 0) / (b^2 + 1);
+t1591 = (t1590 * b + 1) / (b^2 + 1);
+t1592 = (t1591 * b + 2) / (b^2 + 1);
+t1593 = (t1592 * b + 3) / (b^2 + 1);
+t1594 = (t1593 * b + 4) / (b^2 + 1);
+t1595 = (t1594 * b + 5) / (b^2 + 1);
+t1596 = (t1595 * b + 6) / (b^2 + 1);
+t1597 = (t1596 * b + 7) / (b^2 + 1);
+t1598 = (t1597 * b + 8) / (b^2 + 1);
+t1599 = (t1598 * b + 9) / (b^2 + 1);
+t1600 = (t1599 * b + 0) / (b^2 + 1);
+t1601 = (t1600 * b + 1) / (b^2 + 1);
+t1602 = (t1601 * b + 2) / (b^2 + 1);
+t1603 = (t1602 * b + 3) / (b^2 + 1);
+t1604 = (t1603 * b + 4) / (b^2 + 1);
+t1605 = (t1604 * b + 5) / (b^2 + 1);
+t1606 = (t1605 * b + 6) / (b^2 + 1);
+t1607 = (t1606 * b + 7) / (b^2 + 1);
+t1608 = (t1607 * b + 8) / (b^2 + 1);
+t1609 = (t1608 * b + 9) / (b^2 + 1);
+t1610 = (t1609 * b + 0) / (b^2 + 1);
+t1611 = (t1610 * b + 1) / (b^2 + 1);
+t1612 = (t1611 * b + 2) / (b^2 + 1);
+t1613 = (t1612 * b + 3) / (b^2 + 1);
+t1614 = (t1613 * b + 4) / (b^2 + 1);
+t1615 = (t1614 * b + 5) / (b^2 + 1);
+t1616 = (t1615 * b + 6) / (b^2 + 1);
+t1617 = (t1616 * b + 7) / (b^2 + 1);
+t1618 = (t1617 * b + 8) / (b^2 + 1);
+t1619 = (t1618 * b + 9) / (b^2 + 1);
+t1620 = (t1619 * b + 0) / (b^2 + 1);
+t1621 = (t1620 * b + 1) / (b^2 + 1);
+t1622 = (t1621 * b + 2) / (b^2 + 1);
+t1623 = (t1622 * b + 3) / (b^2 + 1);
+t1624 = (t1623 * b + 4) / (b^2 + 1);
+t1625 = (t1624 * b + 5) / (b^2 + 1);
+t1626 = (t1625 * b + 6) / (b^2 + 1);
+t1627 = (t1626 * b + 7) / (b^2 + 1);
+t1628 = (t1627 * b + 8) / (b^2 + 1);
+t1629 = (t1628 * b + 9) / (b^2 + 1);
+t1630 = (t1629 * b + 0) / (b^2 + 1);
+t1631 = (t1630 * b + 1) / (b^2 + 1);
+t1632 = (t1631 * b + 2) / (b^2 + 1);
+t1633 = (t1632 * b + 3) / (b^2 + 1);
+t1634 = (t1633 * b + 4) / (b^2 + 1);
+t1635 = (t1634 * b + 5) / (b^2 + 1);
+t1636 = (t1635 * b + 6) / (b^2 + 1);
+t1637 = (t1636 * b + 7) / (b^2 + 1);
+t1638 = (t1637 * b + 8) / (b^2 + 1);
+t1639 = (t1638 * b + 9) / (b^2 + 1);
+t1640 = (t1639 * b + 0) / (b^2 + 1);
+t1641 = (t1640 * b + 1) / (b^2 + 1);
+t1642 = (t1641 * b + 2) / (b^2 + 1);
+t1643 = (t1642 * b + 3) / (b^2 + 1);
+t1644 = (t1643 * b + 4) / (b^2 + 1);
+t1645 = (t1644 * b + 5) / (b^2 + 1);
+t1646 = (t1645 * b + 6) / (b^2 + 1);
+t1647 = (t1646 * b + 7) / (b^2 + 1);
+t1648 = (t1647 * b + 8) / (b^2 + 1);
+t1649 = (t1648 * b + 9) / (b^2 + 1);
+t1650 = (t1649 * b + 0) / (b^2 + 1);
+t1651 = (t1650 * b + 1) / (b^2 + 1);
+t1652 = (t1651 * b + 2) / (b^2 + 1);
+t1653 = (t1652 * b + 3) / (b^2 + 1);
+t1654 = (t1653 * b + 4) / (b^2 + 1);
+t1655 = (t1654 * b + 5) / (b^2 + 1);
+t1656 = (t1655 * b + 6) / (b^2 + 1);
+t1657 = (t1656 * b + 7) / (b^2 + 1);
+t1658 = (t1657 * b + 8) / (b^2 + 1);
+t1659 = (t1658 * b + 9) / (b^2 + 1);
+t1660 = (t1659 * b + 0) / (b^2 + 1);
+t1661 = (t1660 * b + 1) / (b^2 + 1);
+t1662 = (t1661 * b + 2) / (b^2 + 1);
+t1663 = (t1662 * b + 3) / (b^2 + 1);
+t1664 = (t1663 * b + 4) / (b^2 + 1);
+t1665 = (t1664 * b + 5) / (b^2 + 1);
+t1666 = (t1665 * b + 6) / (b^2 + 1);
+t1667 = (t1666 * b + 7) / (b^2 + 1);
+t1668 = (t1667 * b + 8) / (b^2 + 1);
+t1669 = (t1668 * b + 9) / (b^2 + 1);
+t1670 = (t1669 * b + 0) / (b^2 + 1);
+t1671 = (t1670 * b + 1) / (b^2 + 1);
+t1672 = (t1671 * b + 2) / (b^2 + 1);
+t1673 = (t1672 * b + 3) / (b^2 + 1);
+t1674 = (t1673 * b + 4) / (b^2 + 1);
+t1675 = (t1674 * b + 5) / (b^2 + 1);
+t1676 = (t1675 * b + 6) / (b^2 + 1);
+t1677 = (t1676 * b + 7) / (b^2 + 1);
+t1678 = (t1677 * b + 8) / (b^2 + 1);
+t1679 = (t1678 * b + 9) / (b^2 + 1);
+t1680 = (t1679 * b + 0) / (b^2 + 1);
+t1681 = (t1680 * b + 1) / (b^2 + 1);
+t1682 = (t1681 * b + 2) / (b^2 + 1);
+t1683 = (t1682 * b + 3) / (b^2 + 1);
+t1684 = (t1683 * b + 4) / (b^2 + 1);
+t1685 = (t1684 * b + 5) / (b^2 + 1);
+t1686 = (t1685 * b + 6) / (b^2 + 1);
+t1687 = (t1686 * b + 7) / (b^2 + 1);
+t1688 = (t1687 * b + 8) / (b^2 + 1);
+t1689 = (t1688 * b + 9) / (b^2 + 1);
+t1690 = (t1689 * b + 0) / (b^2 + 1);
+t1691 = (t1690 * b + 1) / (b^2 + 1);
+t1692 = (t1691 * b + 2) / (b^2 + 1);
+t1693 = (t1692 * b + 3) / (b^2 + 1);
+t1694 = (t1693 * b + 4) / (b^2 + 1);
+t1695 = (t1694 * b + 5) / (b^2 + 1);
+t1696 = (t1695 * b + 6) / (b^2 + 1);
+t1697 = (t1696 * b + 7) / (b^2 + 1);
+t1698 = (t1697 * b + 8) / (b^2 + 1);
+t1699 = (t1698 * b + 9) / (b^2 + 1);
+t1700 = (t1699 * b + 0) / (b^2 + 1);
+t1701 = (t1700 * b + 1) / (b^2 + 1);
+t1702 = (t1701 * b + 2) / (b^2 + 1);
+t1703 = (t1702 * b + 3) / (b^2 + 1);
+t1704 = (t1703 * b + 4) / (b^2 + 1);
+t1705 = (t1704 * b + 5) / (b^2 + 1);
+t1706 = (t1705 * b + 6) / (b^2 + 1);
+t1707 = (t1706 * b + 7) / (b^2 + 1);
+t1708 = (t1707 * b + 8) / (b^2 + 1);
+t1709 = (t1708 * b + 9) / (b^2 + 1);
+t1710 = (t1709 * b + 0) / (b^2 + 1);
+t1711 = (t1710 * b + 1) / (b^2 + 1);
+t1712 = (t1711 * b + 2) / (b^2 + 1);
+t1713 = (t1712 * b + 3) / (b^2 + 1);
+t1714 = (t1713 * b + 4) / (b^2 + 1);
+t1715 = (t1714 * b + 5) / (b^2 + 1);
+t1716 = (t1715 * b + 6) / (b^2 + 1);
+t1717 = (t1716 * b + 7) / (b^2 + 1);
+t1718 = (t1717 * b + 8) / (b^2 + 1);
+t1719 = (t1718 * b + 9) / (b^2 + 1);
+t1720 = (t1719 * b + 0) / (b^2 + 1);
+t1721 = (t1720 * b + 1) / (b^2 + 1);
+t1722 = (t1721 * b + 2) / (b^2 + 1);
+t1723 = (t1722 * b + 3) / (b^2 + 1);
+t1724 = (t1723 * b + 4) / (b^2 + 1);
+t1725 = (t1724 * b + 5) / (b^2 + 1);
+t1726 = (t1725 * b + 6) / (b^2 + 1);
+t1727 = (t1726 * b + 7) / (b^2 + 1);
+t1728 = (t1727 * b + 8) / (b^2 + 1);
+t1729 = (t1728 * b + 9) / (b^2 + 1);
+t1730 = (t1729 * b + 0) / (b^2 + 1);
+t1731 = (t1730 * b + 1) / (b^2 + 1);
+t1732 = (t1731 * b + 2) / (b^2 + 1);
+t1733 = (t1732 * b + 3) / (b^2 + 1);
+t1734 = (t1733 * b + 4) / (b^2 + 1);
+t1735 = (t1734 * b + 5) / (b^2 + 1);
+t1736 = (t1735 * b + 6) / (b^2 + 1);
+t1737 = (t1736 * b + 7) / (b^2 + 1);
+t1738 = (t1737 * b + 8) / (b^2 + 1);
+t1739 = (t1738 * b + 9) / (b^2 + 1);
+t1740 = (t1739 * b + 0) / (b^2 + 1);
+t1741 = (t1740 * b + 1) / (b^2 + 1);
+t1742 = (t1741 * b + 2) / (b^2 + 1);
+t1743 = (t1742 * b + 3) / (b^2 + 1);
+t1744 = (t1743 * b + 4) / (b^2 + 1);
+t1745 = (t1744 * b + 5) / (b^2 + 1);
+t1746 = (t1745 * b + 6) / (b^2 + 1);
+t1747 = (t1746 * b + 7) / (b^2 + 1);
+t1748 = (t1747 * b + 8) / (b^2 + 1);
+t1749 = (t1748 * b + 9) / (b^2 + 1);
+t1750 = (t1749 * b + 0) / (b^2 + 1);
+t1751 = (t1750 * b + 1) / (b^2 + 1);
+t1752 = (t1751 * b + 2) / (b^2 + 1);
+t1753 = (t1752 * b + 3) / (b^2 + 1);
+t1754 = (t1753 * b + 4) / (b^2 + 1);
+t1755 = (t1754 * b + 5) / (b^2 + 1);
+t1756 = (t1755 * b + 6) / (b^2 + 1);
+t1757 = (t1756 * b + 7) / (b^2 + 1);
+t1758 = (t1757 * b + 8) / (b^2 + 1);
+t1759 = (t1758 * b + 9) / (b^2 + 1);
+t1760 = (t1759 * b + 0) / (b^2 + 1);
+t1761 = (t1760 * b + 1) / (b^2 + 1);
+t1762 = (t1761 * b + 2) / (b^2 + 1);
+t1763 = (t1762 * b + 3) / (b^2 + 1);
+t1764 = (t1763 * b + 4) / (b^2 + 1);
+t1765 = (t1764 * b + 5) / (b^2 + 1);
+t1766 = (t1765 * b + 6) / (b^2 + 1);
+t1767 = (t1766 * b + 7) / (b^2 + 1);
+t1768 = (t1767 * b + 8) / (b^2 + 1);
+t1769 = (t1768 * b + 9) / (b^2 + 1);
+t1770 = (t1769 * b + 0) / (b^2 + 1);
+t1771 = (t1770 * b + 1) / (b^2 + 1);
+t1772 = (t1771 * b + 2) / (b^2 + 1);
+t1773 = (t1772 * b + 3) / (b^2 + 1);
+t1774 = (t1773 * b + 4) / (b^2 + 1);
+t1775 = (t1774 * b + 5) / (b^2 + 1);
+t1776 = (t1775 * b + 6) / (b^2 + 1);
+t1777 = (t1776 * b + 7) / (b^2 + 1);
+t1778 = (t1777 * b + 8) / (b^2 + 1);
+t1779 = (t1778 * b + 9) / (b^2 + 1);
+t1780 = (t1779 * b + 0) / (b^2 + 1);
+t1781 = (t1780 * b + 1) / (b^2 + 1);
+t1782 = (t1781 * b + 2) / (b^2 + 1);
+t1783 = (t1782 * b + 3) / (b^2 + 1);
+t1784 = (t1783 * b + 4) / (b^2 + 1);
+t1785 = (t1784 * b + 5) / (b^2 + 1);
+t1786 = (t1785 * b + 6) / (b^2 + 1);
+t1787 = (t1786 * b + 7) / (b^2 + 1);
+t1788 = (t1787 * b + 8) / (b^2 + 1);
+t1789 = (t1788 * b + 9) / (b^2 + 1);
+t1790 = (t1789 * b + 0) / (b^2 + 1);
+t1791 = (t1790 * b + 1) / (b^2 + 1);
+t1792 = (t1791 * b + 2) / (b^2 + 1);
+t1793 = (t1792 * b + 3) / (b^2 + 1);
+t1794 = (t1793 * b + 4) / (b^2 + 1);
+t1795 = (t1794 * b + 5) / (b^2 + 1);
+t1796 = (t1795 * b + 6) / (b^2 + 1);
+t1797 = (t1796 * b + 7) / (b^2 + 1);
+t1798 = (t1797 * b + 8) / (b^2 + 1);
+t1799 = (t1798 * b + 9) / (b^2 + 1);
+t1800 = (t1799 * b + 0) / (b^2 + 1);
+t1801 = (t1800 * b + 1) / (b^2 + 1);
+t1802 = (t1801 * b + 2) / (b^2 + 1);
+t1803 = (t1802 * b + 3) / (b^2 + 1);
+t1804 = (t1803 * b + 4) / (b^2 + 1);
+t1805 = (t1804 * b + 5) / (b^2 + 1);
+t1806 = (t1805 * b + 6) / (b^2 + 1);
+t1807 = (t1806 * b + 7) / (b^2 + 1);
+t1808 = (t1807 * b + 8) / (b^2 + 1);
+t1809 = (t1808 * b + 9) / (b^2 + 1);
+t1810 = (t1809 * b + 0) / (b^2 + 1);
+t1811 = (t1810 * b + 1) / (b^2 + 1);
+t1812 = (t1811 * b + 2) / (b^2 + 1);
+t1813 = (t1812 * b + 3) / (b^2 + 1);
+t1814 = (t1813 * b + 4) / (b^2 + 1);
+t1815 = (t1814 * b + 5) / (b^2 + 1);
+t1816 = (t1815 * b + 6) / (b^2 + 1);
+t1817 = (t1816 * b + 7) / (b^2 + 1);
+t1818 = (t1817 * b + 8) / (b^2 + 1);
+t1819 = (t1818 * b + 9) / (b^2 + 1);
+t1820 = (t1819 * b + 0) / (b^2 + 1);
+t1821 = (t1820 * b + 1) / (b^2 + 1);
+t1822 = (t1821 * b + 2) / (b^2 + 1);
+t1823 = (t1822 * b + 3) / (b^2 + 1);
+t1824 = (t1823 * b + 4) / (b^2 + 1);
+t1825 = (t1824 * b + 5) / (b^2 + 1);
+t1826 = (t1825 * b + 6) / (b^2 + 1);
+t1827 = (t1826 * b + 7) / (b^2 + 1);
+t1828 = (t1827 * b + 8) / (b^2 + 1);
+t1829 = (t1828 * b + 9) / (b^2 + 1);
+t1830 = (t1829 * b + 0) / (b^2 + 1);
+t1831 = (t1830 * b + 1) / (b^2 + 1);
+t1832 = (t1831 * b + 2) / (b^2 + 1);
+t1833 = (t1832 * b + 3) / (b^2 + 1);
+t1834 = (t1833 * b + 4) / (b^2 + 1);
+t1835 = (t1834 * b + 5) / (b^2 + 1);
+t1836 = (t1835 * b + 6) / (b^2 + 1);
+t1837 = (t1836 * b + 7) / (b^2 + 1);
+t1838 = (t1837 * b + 8) / (b^2 + 1);
+t1839 = (t1838 * b + 9) / (b^2 + 1);
+t1840 = (t1839 * b + 0) / (b^2 + 1);
+t1841 = (t1840 * b + 1) / (b^2 + 1);
+t1842 = (t1841 * b + 2) / (b^2 + 1);
+t1843 = (t1842 * b + 3) / (b^2 + 1);
+t1844 = (t1843 * b + 4) / (b^2 + 1);
+t1845 = (t1844 * b + 5) / (b^2 + 1);
+t1846 = (t1845 * b + 6) / (b^2 + 1);
+t1847 = (t1846 * b + 7) / (b^2 + 1);
+t1848 = (t1847 * b + 8) / (b^2 + 1);
+t1849 = (t1848 * b + 9) / (b^2 + 1);
+t1850 = (t1849 * b + 0) / (b^2 + 1);
+t1851 = (t1850 * b + 1) / (b^2 + 1);
+t1852 = (t1851 * b + 2) / (b^2 + 1);
+t1853 = (t1852 * b + 3) / (b^2 + 1);
+t1854 = (t1853 * b + 4) / (b^2 + 1);
+t1855 = (t1854 * b + 5) / (b^2 + 1);
+t1856 = (t1855 * b + 6) / (b^2 + 1);
+t1857 = (t1856 * b + 7) / (b^2 + 1);
+t1858 = (t1857 * b + 8) / (b^2 + 1);
+t1859 = (t1858 * b + 9) / (b^2 + 1);
+t1860 = (t1859 * b + 0) / (b^2 + 1);
+t1861 = (t1860 * b + 1) / (b^2 + 1);
+t1862 = (t1861 * b + 2) / (b^2 + 1);
+t1863 = (t1862 * b + 3) / (b^2 + 1);
+t1864 = (t1863 * b + 4) / (b^2 + 1);
+t1865 = (t1864 * b + 5) / (b^2 + 1);
+t1866 = (t1865 * b + 6) / (b^2 + 1);
+t1867 = (t1866 * b + 7) / (b^2 + 1);
+t1868 = (t1867 * b + 8) / (b^2 + 1);
+t1869 = (t1868 * b + 9) / (b^2 + 1);
+t1870 = (t1869 * b + 0) / (b^2 + 1);
+t1871 = (t1870 * b + 1) / (b^2 + 1);
+t1872 = (t1871 * b + 2) / (b^2 + 1);
+t1873 = (t1872 * b + 3) / (b^2 + 1);
+t1874 = (t1873 * b + 4) / (b^2 + 1);
+t1875 = (t1874 * b + 5) / (b^2 + 1);
+t1876 = (t1875 * b + 6) / (b^2 + 1);
+t1877 = (t1876 * b + 7) / (b^2 + 1);
+t1878 = (t1877 * b + 8) / (b^2 + 1);
+t1879 = (t1878 * b + 9) / (b^2 + 1);
+t1880 = (t1879 * b + 0) / (b^2 + 1);
+t1881 = (t1880 * b + 1) / (b^2 + 1);
+t1882 = (t1881 * b + 2) / (b^2 + 1);
+t1883 = (t1882 * b + 3) / (b^2 + 1);
+t1884 = (t1883 * b + 4) / (b^2 + 1);
+t1885 = (t1884 * b + 5) / (b^2 + 1);
+t1886 = (t1885 * b + 6) / (b^2 + 1);
+t1887 = (t1886 * b + 7) / (b^2 + 1);
+t1888 = (t1887 * b + 8) / (b^2 + 1);
+t1889 = (t1888 * b + 9) / (b^2 + 1);
+t1890 = (t1889 * b + 0) / (b^2 + 1);
+t1891 = (t1890 * b + 1) / (b^2 + 1);
+t1892 = (t1891 * b + 2) / (b^2 + 1);
+t1893 = (t1892 * b + 3) / (b^2 + 1);
+t1894 = (t1893 * b + 4) / (b^2 + 1);
+t1895 = (t1894 * b + 5) / (b^2 + 1);
+t1896 = (t1895 * b + 6) / (b^2 + 1);
+t1897 = (t1896 * b + 7) / (b^2 + 1);
+t1898 = (t1897 * b + 8) / (b^2 + 1);
+t1899 = (t1898 * b + 9) / (b^2 + 1);
+t1900 = (t1899 * b + 0) / (b^2 + 1);
+t1901 = (t1900 * b + 1) / (b^2 + 1);
+t1902 = (t1901 * b + 2) / (b^2 + 1);
+t1903 = (t1902 * b + 3) / (b^2 + 1);
+t1904 = (t1903 * b + 4) / (b^2 + 1);
+t1905 = (t1904 * b + 5) / (b^2 + 1);
+t1906 = (t1905 * b + 6) / (b^2 + 1);
+t1907 = (t1906 * b + 7) / (b^2 + 1);
+t1908 = (t1907 * b + 8) / (b^2 + 1);
+t1909 = (t1908 * b + 9) / (b^2 + 1);
+t1910 = (t1909 * b + 0) / (b^2 + 1);
+t1911 = (t1910 * b + 1) / (b^2 + 1);
+t1912 = (t1911 * b + 2) / (b^2 + 1);
+t1913 = (t1912 * b + 3) / (b^2 + 1);
+t1914 = (t1913 * b + 4) / (b^2 + 1);
+t1915 = (t1914 * b + 5) / (b^2 + 1);
+t1916 = (t1915 * b + 6) / (b^2 + 1);
+t1917 = (t1916 * b + 7) / (b^2 + 1);
+t1918 = (t1917 * b + 8) / (b^2 + 1);
+t1919 = (t1918 * b + 9) / (b^2 + 1);
+t1920 = (t1919 * b + 0) / (b^2 + 1);
+t1921 = (t1920 * b + 1) / (b^2 + 1);
+t1922 = (t1921 * b + 2) / (b^2 + 1);
+t1923 = (t1922 * b + 3) / (b^2 + 1);
+t1924 = (t1923 * b + 4) / (b^2 + 1);
+t1925 = (t1924 * b + 5) / (b^2 + 1);
+t1926 = (t1925 * b + 6) / (b^2 + 1);
+t1927 = (t1926 * b + 7) / (b^2 + 1);
+t1928 = (t1927 * b + 8) / (b^2 + 1);
+t1929 = (t1928 * b + 9) / (b^2 + 1);
+t1930 = (t1929 * b + 0) / (b^2 + 1);
+t1931 = (t1930 * b + 1) / (b^2 + 1);
+t1932 = (t1931 * b + 2) / (b^2 + 1);
+t1933 = (t1932 * b + 3) / (b^2 + 1);
+t1934 = (t1933 * b + 4) / (b^2 + 1);
+t1935 = (t1934 * b + 5) / (b^2 + 1);
+t1936 = (t1935 * b + 6) / (b^2 + 1);
+t1937 = (t1936 * b + 7) / (b^2 + 1);
+t1938 = (t1937 * b + 8) / (b^2 + 1);
+t1939 = (t1938 * b + 9) / (b^2 + 1);
+t1940 = (t1939 * b + 0) / (b^2 + 1);
+t1941 = (t1940 * b + 1) / (b^2 + 1);
+t1942 = (t1941 * b + 2) / (b^2 + 1);
+t1943 = (t1942 * b + 3) / (b^2 + 1);
+t1944 = (t1943 * b + 4) / (b^2 + 1);
+t1945 = (t1944 * b + 5) / (b^2 + 1);
+t1946 = (t1945 * b + 6) / (b^2 + 1);
+t1947 = (t1946 * b + 7) / (b^2 + 1);
+t1948 = (t1947 * b + 8) / (b^2 + 1);
+t1949 = (t1948 * b + 9) / (b^2 + 1);
+t1950 = (t1949 * b + 0) / (b^2 + 1);
+t1951 = (t1950 * b + 1) / (b^2 + 1);
+t1952 = (t1951 * b + 2) / (b^2 + 1);
+t1953 = (t1952 * b + 3) / (b^2 + 1);
+t1954 = (t1953 * b + 4) / (b^2 + 1);
+t1955 = (t1954 * b + 5) / (b^2 + 1);
+t1956 = (t1955 * b + 6) / (b^2 + 1);
+t1957 = (t1956 * b + 7) / (b^2 + 1);
+t1958 = (t1957 * b + 8) / (b^2 + 1);
+t1959 = (t1958 * b + 9) / (b^2 + 1);
+t1960 = (t1959 * b + 0) / (b^2 + 1);
+t1961 = (t1960 * b + 1) / (b^2 + 1);
+t1962 = (t1961 * b + 2) / (b^2 + 1);
+t1963 = (t1962 * b + 3) / (b^2 + 1);
+t1964 = (t1963 * b + 4) / (b^2 + 1);
+t1965 = (t1964 * b + 5) / (b^2 + 1);
+t1966 = (t1965 * b + 6) / (b^2 + 1);
+t1967 = (t1966 * b + 7) / (b^2 + 1);
+t1968 = (t1967 * b + 8) / (b^2 + 1);
+t1969 = (t1968 * b + 9) / (b^2 + 1);
+t1970 = (t1969 * b + 0) / (b^2 + 1);
+t1971 = (t1970 * b + 1) / (b^2 + 1);
+t1972 = (t1971 * b + 2) / (b^2 + 1);
+t1973 = (t1972 * b + 3) / (b^2 + 1);
+t1974 = (t1973 * b + 4) / (b^2 + 1);
+t1975 = (t1974 * b + 5) / (b^2 + 1);
+t1976 = (t1975 * b + 6) / (b^2 + 1);
+t1977 = (t1976 * b + 7) / (b^2 + 1);
+t1978 = (t1977 * b + 8) / (b^2 + 1);
+t1979 = (t1978 * b + 9) / (b^2 + 1);
+t1980 = (t1979 * b + 0) / (b^2 + 1);
+t1981 = (t1980 * b + 1) / (b^2 + 1);
+t1982 = (t1981 * b + 2) / (b^2 + 1);
+t1983 = (t1982 * b + 3) / (b^2 + 1);
+t1984 = (t1983 * b + 4) / (b^2 + 1);
+t1985 = (t1984 * b + 5) / (b^2 + 1);
+t1986 = (t1985 * b + 6) / (b^2 + 1);
+t1987 = (t1986 * b + 7) / (b^2 + 1);
+t1988 = (t1987 * b + 8) / (b^2 + 1);
+t1989 = (t1988 * b + 9) / (b^2 + 1);
+t1990 = (t1989 * b + 0) / (b^2 + 1);
+t1991 = (t1990 * b + 1) / (b^2 + 1);
+t1992 = (t1991 * b + 2) / (b^2 + 1);
+t1993 = (t1992 * b + 3) / (b^2 + 1);
+t1994 = (t1993 * b + 4) / (b^2 + 1);
+t1995 = (t1994 * b + 5) / (b^2 + 1);
+t1996 = (t1995 * b + 6) / (b^2 + 1);
+t1997 = (t1996 * b + 7) / (b^2 + 1);
+t1998 = (t1997 * b + 8) / (b^2 + 1);
+t1999 = (t1998 * b + 9) / (b^2 + 1);
+t2000 = (t1999 * b + 0) / (b^2 + 1);
+<< t2000 << "\n";
@@ -0,0 +1,91 @@
+#include "el_input.h"
+#include "el_output.h"
+
+extern "C" double pow ( double, double );
+
+int main()
+{
+	double a = 0;
+	double b = 0;
+	double c = 0;
+	double d = 0;
+	double e = 0;
+	double f = 0;
+	double g = 0;
+	double h = 0;
+	double ta = 0;
+	double tb = 0;
+	double tc = 0;
+	double td = 0;
+	double te = 0;
+	double tf = 0;
+	double tg = 0;
+	double th = 0;
+	double y = 0;
+	bool el_initial = true;
+	for ( long el_record = 0; el_more(); el_record++ ) {
+		double el_value;
+		el_value = a;
+		el_read(el_value);
+		bool el_changed0 = el_initial || __builtin_memcmp ( &el_value, &a, sizeof ( el_value ) );
+		a = el_value;
+		el_value = b;
+		el_read(el_value);
+		bool el_changed1 = el_initial || __builtin_memcmp ( &el_value, &b, sizeof ( el_value ) );
+		b = el_value;
+		el_value = c;
+		el_read(el_value);
+		bool el_changed2 = el_initial || __builtin_memcmp ( &el_value, &c, sizeof ( el_value ) );
+		c = el_value;
+		el_value = d;
+		el_read(el_value);
+		bool el_changed3 = el_initial || __builtin_memcmp ( &el_value, &d, sizeof ( el_value ) );
+		d = el_value;
+		el_value = e;
+		el_read(el_value);
+		bool el_changed4 = el_initial || __builtin_memcmp ( &el_value, &e, sizeof ( el_value ) );
+		e = el_value;
+		el_value = f;
+		el_read(el_value);
+		bool el_changed5 = el_initial || __builtin_memcmp ( &el_value, &f, sizeof ( el_value ) );
+		f = el_value;
+		el_value = g;
+		el_read(el_value);
+		bool el_changed6 = el_initial || __builtin_memcmp ( &el_value, &g, sizeof ( el_value ) );
+		g = el_value;
+		el_value = h;
+		el_read(el_value);
+		bool el_changed7 = el_initial || __builtin_memcmp ( &el_value, &h, sizeof ( el_value ) );
+		h = el_value;
+		if ( el_changed0 ) {
+			ta = (pow(a,(pow(a,(pow(a,0.5)))))+pow(a,3.7));
+		}
+		if ( el_changed1 ) {
+			tb = (pow(b,(pow(b,(pow(b,0.5)))))+pow(b,3.7));
+		}
+		if ( el_changed2 ) {
+			tc = (pow(c,(pow(c,(pow(c,0.5)))))+pow(c,3.7));
+		}
+		if ( el_changed3 ) {
+			td = (pow(d,(pow(d,(pow(d,0.5)))))+pow(d,3.7));
+		}
+		if ( el_changed4 ) {
+			te = (pow(e,(pow(e,(pow(e,0.5)))))+pow(e,3.7));
+		}
+		if ( el_changed5 ) {
+			tf = (pow(f,(pow(f,(pow(f,0.5)))))+pow(f,3.7));
+		}
+		if ( el_changed6 ) {
+			tg = (pow(g,(pow(g,(pow(g,0.5)))))+pow(g,3.7));
+		}
+		if ( el_changed7 ) {
+			th = (pow(h,(pow(h,(pow(h,0.5)))))+pow(h,3.7));
+		}
+		if ( el_changed0 || el_changed1 || el_changed2 || el_changed3 || el_changed4 || el_changed5 || el_changed6 || el_changed7 ) {
+			y = ((((((((0+ta)+tb)+tc)+td)+te)+tf)+tg)+th);
+		}
+		el_print(y);
+		el_write("\n");
+		el_initial = false;
+	}
+}
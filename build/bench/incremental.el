@@ -0,0 +1,11 @@
+>> a >> b >> c >> d >> e >> f >> g >> h;
+ta = a^(a^(a^0.5)) + a^3.7;
+tb = b^(b^(b^0.5)) + b^3.7;
+tc = c^(c^(c^0.5)) + c^3.7;
+td = d^(d^(d^0.5)) + d^3.7;
+te = e^(e^(e^0.5)) + e^3.7;
+tf = f^(f^(f^0.5)) + f^3.7;
+tg = g^(g^(g^0.5)) + g^3.7;
+th = h^(h^(h^0.5)) + h^3.7;
+y = 0 + ta + tb + tc + td + te + tf + tg + th;
+<< y << "\n";